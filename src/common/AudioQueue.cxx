@@ -74,6 +74,9 @@ uInt32 AudioQueue::fragmentSize() const
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 Int16* AudioQueue::enqueue(Int16* fragment)
 {
+  if (fragment && myCaptureCallback)
+    myCaptureCallback(fragment, myFragmentSize, myIsStereo);
+
   const lock_guard<mutex> guard(myMutex);
 
   Int16* newFragment = nullptr;
@@ -142,3 +145,9 @@ void AudioQueue::ignoreOverflows(bool shouldIgnoreOverflows)
 {
   myIgnoreOverflows = shouldIgnoreOverflows;
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void AudioQueue::setCaptureCallback(const CaptureCallback& callback)
+{
+  myCaptureCallback = callback;
+}
@@ -18,6 +18,7 @@
 #ifndef AUDIO_QUEUE_HXX
 #define AUDIO_QUEUE_HXX
 
+#include <functional>
 #include <mutex>
 
 #include "bspf.hxx"
@@ -36,6 +37,9 @@
 */
 class AudioQueue
 {
+  public:
+    using CaptureCallback = std::function<void(const Int16*, uInt32, bool)>;
+
   public:
 
     /**
@@ -96,6 +100,14 @@ class AudioQueue
      */
     void ignoreOverflows(bool shouldIgnoreOverflows);
 
+    /**
+      Set a callback that receives each filled fragment when it is enqueued
+      (used for recording). This must be set before emulation starts.
+
+      @param callback  The callback, receiving fragment, size and stereo flag
+     */
+    void setCaptureCallback(const CaptureCallback& callback);
+
   private:
 
     // The size of an individual fragment (in stereo / mono samples)
@@ -130,6 +142,9 @@ class AudioQueue
     // Log overflows?
     bool myIgnoreOverflows{true};
 
+    // Called for each enqueued fragment
+    CaptureCallback myCaptureCallback;
+
     StaggeredLogger myOverflowLogger{"audio buffer overflow", Logger::Level::INFO};
 
   private:
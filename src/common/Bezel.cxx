@@ -21,7 +21,7 @@
 #include "Console.hxx"
 #include "EventHandler.hxx"
 #include "FBSurface.hxx"
-#include "PNGLibrary.hxx"
+#include "ImageCache.hxx"
 #include "PropsSet.hxx"
 
 #include "Bezel.hxx"
@@ -133,30 +133,31 @@ bool Bezel::load()
   {
     if(!mySurface)
       mySurface = myFB.allocateSurface(1, 1); // dummy size
-    try
-    {
-      const string& path = myOSystem.bezelDir().getPath();
-      VariantList metaData;
-      int index = 0;
+    const string& path = myOSystem.bezelDir().getPath();
+    int index = 0;
 
-      do
+    do
+    {
+      imageName = getName(index);
+      if(imageName != EmptyString)
       {
-        imageName = getName(index);
-        if(imageName != EmptyString)
+        // Note: JPG does not support transparency
+        const string imagePath = path + imageName + ".png";
+        const FSNode node(imagePath);
+        if(node.exists())
         {
-          // Note: JPG does not support transparency
-          const string imagePath = path + imageName + ".png";
-          const FSNode node(imagePath);
-          if(node.exists())
-          {
-            isValid = true;
-            myOSystem.png().loadImage(imagePath, *mySurface, metaData);
-            break;
-          }
+          // The bezel is reloaded on every video mode change, so the
+          // decoded image is taken from the cache if possible
+          const ImageCache::ImagePtr image = myOSystem.imageCache().load(imagePath);
+          isValid = image->error.empty();
+          if(isValid)
+            ImageCache::loadToSurface(*image, *mySurface);
+          else
+            cerr << "ERROR: Bezel load\n";
+          break;
         }
-      } while(index != -1);
-    }
-    catch(const runtime_error&) { cerr << "ERROR: Bezel load\n"; }
+      }
+    } while(index != -1);
   }
 #else
   const bool show = false;
@@ -48,51 +48,55 @@ FSNodeZIP::FSNodeZIP(string_view p)
 
 // cerr << " => p: " << p << '\n';
 
-  // Open file at least once to initialize the virtual file count
-  try
   {
-    myZipHandler->open(_zipFile);
-  }
-  catch(const runtime_error&)
-  {
-    // TODO: Actually present the error passed in back to the user
-    //       For now, we just indicate that no ROMs were found
-    _error = zip_error::NO_ROMS;
-  }
-  _numFiles = myZipHandler->romFiles();
-  if(_numFiles == 0)
-  {
-    _error = zip_error::NO_ROMS;
-  }
+    const std::lock_guard<std::mutex> lock(myZipMutex);
 
-  // We always need a virtual file/path
-  // Either one is given, or we use the first one
-  if(pos+5 < p.length())  // if something comes after '.zip'
-  {
-    _virtualPath = p.substr(pos+5);
-    _isFile = Bankswitch::isValidRomName(_virtualPath);
-    _isDirectory = !_isFile;
-  }
-  else if(_numFiles == 1)
-  {
-    bool found = false;
-    while(myZipHandler->hasNext() && !found)
+    // Open file at least once to initialize the virtual file count
+    try
     {
-      const auto& [name, size] = myZipHandler->next();
-      if(Bankswitch::isValidRomName(name))
-      {
-        _virtualPath = name;
-        _size = size;
-        _isFile = true;
+      myZipHandler->open(_zipFile);
+    }
+    catch(const runtime_error&)
+    {
+      // TODO: Actually present the error passed in back to the user
+      //       For now, we just indicate that no ROMs were found
+      _error = zip_error::NO_ROMS;
+    }
+    _numFiles = myZipHandler->romFiles();
+    if(_numFiles == 0)
+    {
+      _error = zip_error::NO_ROMS;
+    }
 
-        found = true;
+    // We always need a virtual file/path
+    // Either one is given, or we use the first one
+    if(pos+5 < p.length())  // if something comes after '.zip'
+    {
+      _virtualPath = p.substr(pos+5);
+      _isFile = Bankswitch::isValidRomName(_virtualPath);
+      _isDirectory = !_isFile;
+    }
+    else if(_numFiles == 1)
+    {
+      bool found = false;
+      while(myZipHandler->hasNext() && !found)
+      {
+        const auto& [name, size] = myZipHandler->next();
+        if(Bankswitch::isValidRomName(name))
+        {
+          _virtualPath = name;
+          _size = size;
+          _isFile = true;
+
+          found = true;
+        }
       }
+      if(!found)
+        return;
     }
-    if(!found)
-      return;
+    else if(_numFiles > 1)
+      _isDirectory = true;
   }
-  else if(_numFiles > 1)
-    _isDirectory = true;
 
   // Create a concrete FSNode to use
   // This *must not* be a ZIP file; it must be a real FSNode object that
@@ -151,13 +155,9 @@ bool FSNodeZIP::exists() const
     // We need to inspect the actual path, not just the ZIP file itself
     try
     {
+      const std::lock_guard<std::mutex> lock(myZipMutex);
       myZipHandler->open(_zipFile);
-      while(myZipHandler->hasNext())
-      {
-        const auto& [name, size] = myZipHandler->next();
-        if(BSPF::startsWithIgnoreCase(name, _virtualPath))
-          return true;
-      }
+      return myZipHandler->hasPrefix(_virtualPath);
     }
     catch(const runtime_error&)
     {
@@ -177,6 +177,7 @@ bool FSNodeZIP::getChildren(AbstractFSList& myList, ListMode mode) const
     return false;
 
   std::set<string> dirs;
+  const std::lock_guard<std::mutex> lock(myZipMutex);
   myZipHandler->open(_zipFile);
   while(myZipHandler->hasNext())
   {
@@ -222,16 +223,10 @@ size_t FSNodeZIP::read(ByteBuffer& buffer, size_t) const
     default: throw runtime_error("FSNodeZIP::read default case hit");
   }
 
+  const std::lock_guard<std::mutex> lock(myZipMutex);
   myZipHandler->open(_zipFile);
 
-  bool found = false;
-  while(myZipHandler->hasNext() && !found)
-  {
-    const auto& [name, size] = myZipHandler->next();
-    found = name == _virtualPath;
-  }
-
-  return found ? myZipHandler->decompress(buffer) : 0;
+  return myZipHandler->select(_virtualPath) ? myZipHandler->decompress(buffer) : 0;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -284,5 +279,6 @@ AbstractFSNodePtr FSNodeZIP::getParent() const
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 unique_ptr<ZipHandler> FSNodeZIP::myZipHandler = make_unique<ZipHandler>();
+std::mutex FSNodeZIP::myZipMutex;
 
 #endif  // ZIP_SUPPORT
@@ -20,6 +20,8 @@
 #ifndef FS_NODE_ZIP_HXX
 #define FS_NODE_ZIP_HXX
 
+#include <mutex>
+
 #include "ZipHandler.hxx"
 #include "FSNode.hxx"
 
@@ -60,6 +62,9 @@ class FSNodeZIP : public AbstractFSNode
     //////////////////////////////////////////////////////////
 
     size_t getSize() const override { return _size; }
+    uInt64 getModTime() const override {
+      return _realNode ? _realNode->getModTime() : 0;
+    }
     bool getChildren(AbstractFSList& list, ListMode mode) const override;
     AbstractFSNodePtr getParent() const override;
 
@@ -110,6 +115,10 @@ class FSNodeZIP : public AbstractFSNode
 
     // ZipHandler static reference variable responsible for accessing ZIP files
     static unique_ptr<ZipHandler> myZipHandler;
+
+    // The handler keeps the state of the currently opened archive, so all
+    // accesses to it (from whichever thread) must hold this lock
+    static std::mutex myZipMutex;
 };
 
 #endif
@@ -0,0 +1,385 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2024 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#include <cmath>
+
+#include "Logger.hxx"
+#include "OSystem.hxx"
+#include "Console.hxx"
+#include "EmulationTiming.hxx"
+#include "FrameBuffer.hxx"
+#include "TIASurface.hxx"
+#include "TIA.hxx"
+#ifdef IMAGE_SUPPORT
+  #include "PNGLibrary.hxx"
+#endif
+#include "FrameCapture.hxx"
+
+namespace {
+  // Write little-endian integers, as required by the WAV format
+  void writeLE(std::ofstream& out, uInt32 value, uInt32 bytes)
+  {
+    for(uInt32 i = 0; i < bytes; ++i, value >>= 8)
+      out.put(static_cast<char>(value & 0xff));
+  }
+
+  void writeWavHeader(std::ofstream& out, uInt32 sampleRate, uInt32 dataBytes)
+  {
+    constexpr uInt32 channels = 2, bytesPerSample = 2;
+
+    out.write("RIFF", 4);
+    writeLE(out, 36 + dataBytes, 4);
+    out.write("WAVEfmt ", 8);
+    writeLE(out, 16, 4);                                       // chunk size
+    writeLE(out, 1, 2);                                        // PCM
+    writeLE(out, channels, 2);
+    writeLE(out, sampleRate, 4);
+    writeLE(out, sampleRate * channels * bytesPerSample, 4);   // byte rate
+    writeLE(out, channels * bytesPerSample, 2);                // block align
+    writeLE(out, bytesPerSample * 8, 2);                       // bits per sample
+    out.write("data", 4);
+    writeLE(out, dataBytes, 4);
+  }
+} // namespace
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+FrameCapture::FrameCapture(OSystem& osystem)
+  : myOSystem{osystem}
+{
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+FrameCapture::~FrameCapture()
+{
+  stopRecording();
+
+  {
+    const std::lock_guard<std::mutex> lock(myMutex);
+    myQuit = true;
+  }
+  myCondition.notify_one();
+
+  if(myThread.joinable())
+    myThread.join();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool FrameCapture::startRecording(const string& basename)
+{
+  if(myRecording || !myOSystem.hasConsole())
+    return false;
+
+  // The files are only touched by the writer thread once it processes the
+  // first item; make sure it has finished with any previous recording
+  {
+    std::unique_lock<std::mutex> lock(myMutex);
+    myCondition.wait(lock, [this]{ return myQueue.empty(); });
+
+    myVideo.open(basename + ".y4m", std::ios_base::binary);
+    myAudio.open(basename + ".wav", std::ios_base::binary);
+    if(!myVideo.is_open() || !myAudio.is_open())
+    {
+      myVideo.close();
+      myAudio.close();
+      Logger::error("ERROR: Couldn't create recording files '" + basename + "'");
+      return false;
+    }
+    myVideoWidth = myVideoHeight = 0;
+    myAudioBytes = 0;
+    myAudioHeaderWritten = false;
+    mySampleRate = myOSystem.console().emulationTiming().audioSampleRate();
+    myFrameRate = myOSystem.console().currentFrameRate();
+    myStats = Stats{};
+  }
+
+  myRecording = true;
+  Logger::info("Recording to '" + basename + ".y4m/.wav'");
+
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void FrameCapture::stopRecording()
+{
+  if(!myRecording.exchange(false))
+    return;
+
+  Item item;
+  item.type = Item::Type::Close;
+  enqueue(std::move(item), 0);
+
+  const Stats s = stats();
+  ostringstream buf;
+  buf << "Recording stopped, " << s.frames << " frames ("
+      << s.droppedFrames << " dropped), " << s.fragments
+      << " audio fragments (" << s.droppedFragments << " dropped)";
+  Logger::info(buf.view());
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void FrameCapture::addFrame(TIA& tia, uInt32 frames)
+{
+  if(!myRecording)
+    return;
+
+  Item item;
+  item.type = Item::Type::Frame;
+  item.repeat = std::max(frames, 1U);
+  copyFrame(tia, item);
+
+  enqueue(std::move(item), MAX_FRAMES);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void FrameCapture::addAudio(const Int16* fragment, uInt32 size, bool stereo)
+{
+  if(!myRecording)
+    return;
+
+  Item item;
+  item.type = Item::Type::Audio;
+  item.stereo = stereo;
+  item.samples.assign(fragment, fragment + (stereo ? size * 2 : size));
+
+  enqueue(std::move(item), MAX_FRAGMENTS);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void FrameCapture::addSnapshot(TIA& tia, const string& filename,
+                               const VariantList& metaData)
+{
+  Item item;
+  item.type = Item::Type::Snapshot;
+  item.filename = filename;
+  item.metaData = metaData;
+  copyFrame(tia, item);
+
+  enqueue(std::move(item), MAX_FRAMES);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+FrameCapture::Stats FrameCapture::stats() const
+{
+  const std::lock_guard<std::mutex> lock(myMutex);
+
+  return myStats;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void FrameCapture::copyFrame(TIA& tia, Item& item) const
+{
+  item.width = tia.width();
+  item.height = tia.height();
+  item.pixels.assign(tia.frameBuffer(),
+                     tia.frameBuffer() + static_cast<size_t>(item.width) * item.height);
+  item.palette = myOSystem.frameBuffer().tiaSurface().rgbPalette();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool FrameCapture::enqueue(Item&& item, uInt32 limit)
+{
+  {
+    const std::lock_guard<std::mutex> lock(myMutex);
+
+    const bool isAudio = item.type == Item::Type::Audio;
+    uInt32& queued = isAudio ? myQueuedFragments : myQueuedFrames;
+
+    if(item.type == Item::Type::Close)
+      ;  // never dropped
+    else if(queued >= limit)
+    {
+      ++(isAudio ? myStats.droppedFragments : myStats.droppedFrames);
+      return false;
+    }
+    else
+    {
+      ++queued;
+      if(item.type != Item::Type::Snapshot)
+        ++(isAudio ? myStats.fragments : myStats.frames);
+    }
+
+    myQueue.push_back(std::move(item));
+    myStats.maxQueued = std::max(myStats.maxQueued,
+                                 static_cast<uInt32>(myQueue.size()));
+
+    // Start the writer thread on first use
+    if(!myThread.joinable())
+      myThread = std::thread(&FrameCapture::threadMain, this);
+  }
+  myCondition.notify_all();
+
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void FrameCapture::threadMain()
+{
+  std::unique_lock<std::mutex> lock(myMutex);
+
+  while(true)
+  {
+    myCondition.wait(lock, [this]{ return myQuit || !myQueue.empty(); });
+    if(myQueue.empty())
+      break;  // quit, and nothing left to write
+
+    // Keep the item in the queue while it is processed, so that
+    // 'startRecording' waits for pending writes to finish
+    Item& item = myQueue.front();
+    lock.unlock();
+
+    try
+    {
+      switch(item.type)
+      {
+        using enum Item::Type;
+        case Frame:     writeFrame(item);     break;
+        case Audio:     writeAudio(item);     break;
+        case Snapshot:  writeSnapshot(item);  break;
+        case Close:     closeFiles();         break;
+      }
+    }
+    catch(const std::exception& e)
+    {
+      Logger::error(e.what());
+    }
+
+    lock.lock();
+    if(item.type == Item::Type::Audio)
+      --myQueuedFragments;
+    else if(item.type != Item::Type::Close)
+      --myQueuedFrames;
+    myQueue.pop_front();
+    myCondition.notify_all();
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void FrameCapture::writeFrame(const Item& item)
+{
+  if(!myVideo.is_open())
+    return;
+
+  // The stream header is written for the first frame, and its dimensions
+  // are used for the whole recording
+  if(myVideoWidth == 0)
+  {
+    myVideoWidth = item.width * 2;  // TIA pixels are twice as wide as high
+    myVideoHeight = item.height;
+    myVideo << "YUV4MPEG2 W" << myVideoWidth << " H" << myVideoHeight
+            << " F" << std::lround(myFrameRate * 1000) << ":1000"
+            << " Ip A1:1 C444\n";
+  }
+
+  // Convert to full resolution YCbCr (BT.601) planes
+  const size_t planeSize = static_cast<size_t>(myVideoWidth) * myVideoHeight;
+  vector<uInt8> planes(planeSize * 3, 0);
+  uInt8* y = planes.data();
+  uInt8* u = y + planeSize;
+  uInt8* v = u + planeSize;
+
+  const uInt32 height = std::min(item.height, myVideoHeight);
+  const uInt32 width = std::min(item.width, myVideoWidth / 2);
+  for(uInt32 row = 0; row < height; ++row)
+  {
+    const uInt8* in = item.pixels.data() + static_cast<size_t>(row) * item.width;
+    const size_t out = static_cast<size_t>(row) * myVideoWidth;
+
+    for(uInt32 x = 0; x < width; ++x)
+    {
+      const uInt32 rgb = item.palette[in[x]];
+      const Int32 r = (rgb >> 16) & 0xff, g = (rgb >> 8) & 0xff, b = rgb & 0xff;
+
+      const auto Y = static_cast<uInt8>((( 66 * r + 129 * g +  25 * b + 128) >> 8) + 16);
+      const auto U = static_cast<uInt8>(((-38 * r -  74 * g + 112 * b + 128) >> 8) + 128);
+      const auto V = static_cast<uInt8>(((112 * r -  94 * g -  18 * b + 128) >> 8) + 128);
+
+      y[out + x * 2] = y[out + x * 2 + 1] = Y;
+      u[out + x * 2] = u[out + x * 2 + 1] = U;
+      v[out + x * 2] = v[out + x * 2 + 1] = V;
+    }
+  }
+
+  // Frames which were emulated but not rendered are repeated, so that
+  // video and audio stay in sync
+  for(uInt32 i = 0; i < item.repeat; ++i)
+  {
+    myVideo.write("FRAME\n", 6);
+    myVideo.write(reinterpret_cast<const char*>(planes.data()),
+                  static_cast<std::streamsize>(planes.size()));
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void FrameCapture::writeAudio(const Item& item)
+{
+  if(!myAudio.is_open())
+    return;
+
+  if(!myAudioHeaderWritten)
+  {
+    // The sizes are filled in when the file is closed
+    writeWavHeader(myAudio, mySampleRate, 0);
+    myAudioHeaderWritten = true;
+  }
+
+  // Always write stereo; mono samples are duplicated
+  vector<char> buffer;
+  buffer.reserve(item.stereo ? item.samples.size() * 2 : item.samples.size() * 4);
+  for(const Int16 sample: item.samples)
+  {
+    const auto s = static_cast<uInt16>(sample);
+    for(int i = item.stereo ? 1 : 2; i > 0; --i)
+    {
+      buffer.push_back(static_cast<char>(s & 0xff));
+      buffer.push_back(static_cast<char>(s >> 8));
+    }
+  }
+  myAudio.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  myAudioBytes += static_cast<uInt32>(buffer.size());
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void FrameCapture::writeSnapshot(const Item& item)
+{
+#ifdef IMAGE_SUPPORT
+  // Double the pixels horizontally, for the correct aspect ratio
+  const size_t width = static_cast<size_t>(item.width) * 2;
+  vector<uInt32> pixels(width * item.height);
+
+  for(size_t i = 0; i < item.pixels.size(); ++i)
+    pixels[i * 2] = pixels[i * 2 + 1] = item.palette[item.pixels[i]];
+
+  PNGLibrary::saveImage(item.filename, pixels.data(), width, item.height,
+                        item.metaData);
+#endif
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void FrameCapture::closeFiles()
+{
+  if(myAudio.is_open())
+  {
+    if(myAudioHeaderWritten)
+    {
+      myAudio.seekp(0);
+      writeWavHeader(myAudio, mySampleRate, myAudioBytes);
+    }
+    myAudio.close();
+  }
+  if(myVideo.is_open())
+    myVideo.close();
+}
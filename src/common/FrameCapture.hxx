@@ -0,0 +1,183 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2024 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef FRAME_CAPTURE_HXX
+#define FRAME_CAPTURE_HXX
+
+class OSystem;
+class TIA;
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+#include "bspf.hxx"
+#include "FrameBufferConstants.hxx"
+#include "Variant.hxx"
+
+/**
+  This class implements an asynchronous capture pipeline for TIA frames and
+  audio. Frames (as palette indices) and audio fragments are copied into a
+  bounded queue, and encoded and written on a background thread, so that
+  neither rendering nor emulation wait for compression or disk I/O.
+
+  Two kinds of output are supported:
+    - single PNG images (used by continuous snapshot mode)
+    - a recording of raw Y4M video plus WAV audio
+
+  If the queue is full, frames and audio fragments are dropped; the number
+  of dropped items is tracked in the statistics.
+*/
+class FrameCapture
+{
+  public:
+    struct Stats {
+      uInt32 frames{0};           // frames queued
+      uInt32 droppedFrames{0};    // frames dropped due to a full queue
+      uInt32 fragments{0};        // audio fragments queued
+      uInt32 droppedFragments{0}; // audio fragments dropped due to a full queue
+      uInt32 maxQueued{0};        // maximum number of items in the queue
+    };
+
+  public:
+    explicit FrameCapture(OSystem& osystem);
+    ~FrameCapture();
+
+    /**
+      Start recording video and audio to '<basename>.y4m' and
+      '<basename>.wav'.
+
+      @param basename  The path and filename of the recording, without extension
+
+      @return  True if the output files could be created
+    */
+    bool startRecording(const string& basename);
+
+    /**
+      Stop recording; the files are finished on the background thread.
+    */
+    void stopRecording();
+
+    /**
+      Answer whether a recording is active.
+    */
+    bool isRecording() const { return myRecording; }
+
+    /**
+      Queue the current TIA frame for recording.
+
+      @param tia     The TIA containing the frame to capture
+      @param frames  The number of emulated frames this frame represents
+    */
+    void addFrame(TIA& tia, uInt32 frames = 1);
+
+    /**
+      Queue an audio fragment for recording. This is called from the
+      emulation thread.
+
+      @param fragment  The audio samples
+      @param size      The number of (mono or stereo) samples
+      @param stereo    Whether the samples are stereo
+    */
+    void addAudio(const Int16* fragment, uInt32 size, bool stereo);
+
+    /**
+      Queue the current TIA frame to be saved as a PNG image.
+
+      @param tia       The TIA containing the frame to capture
+      @param filename  The filename of the PNG image
+      @param metaData  The meta data to add to the PNG image
+    */
+    void addSnapshot(TIA& tia, const string& filename,
+                     const VariantList& metaData);
+
+    /**
+      Answer the queue statistics of the current (or last) recording.
+    */
+    Stats stats() const;
+
+  private:
+    struct Item {
+      enum class Type { Frame, Audio, Snapshot, Close };
+
+      Type type{Type::Frame};
+      uInt32 width{0}, height{0}, repeat{1};
+      bool stereo{false};
+      vector<uInt8> pixels;
+      vector<Int16> samples;
+      PaletteArray palette{};
+      string filename;
+      VariantList metaData;
+    };
+
+    // Copy the current TIA frame into the item
+    void copyFrame(TIA& tia, Item& item) const;
+
+    // Add an item to the queue, unless 'limit' items are queued already
+    bool enqueue(Item&& item, uInt32 limit);
+
+    // The background thread entry point
+    void threadMain();
+
+    // Handlers for the queued items, called on the background thread
+    void writeFrame(const Item& item);
+    void writeAudio(const Item& item);
+    void writeSnapshot(const Item& item);
+    void closeFiles();
+
+  private:
+    // Maximum number of queued frames and audio fragments
+    static constexpr uInt32 MAX_FRAMES = 32, MAX_FRAGMENTS = 512;
+
+    // Global OSystem object
+    OSystem& myOSystem;
+
+    // The queue, guarded by myMutex and signalled by myCondition
+    std::deque<Item> myQueue;
+    uInt32 myQueuedFrames{0}, myQueuedFragments{0};
+    mutable std::mutex myMutex;
+    std::condition_variable myCondition;
+    bool myQuit{false};
+
+    // The background thread, started on first use
+    std::thread myThread;
+
+    // Recording state (main thread)
+    std::atomic<bool> myRecording{false};
+    Stats myStats;
+
+    // Output state (background thread)
+    std::ofstream myVideo, myAudio;
+    uInt32 myVideoWidth{0}, myVideoHeight{0};
+    uInt32 myAudioBytes{0};
+    bool myAudioHeaderWritten{false};
+    uInt32 mySampleRate{0};
+    float myFrameRate{0.F};
+
+  private:
+    // Following constructors and assignment operators not supported
+    FrameCapture() = delete;
+    FrameCapture(const FrameCapture&) = delete;
+    FrameCapture(FrameCapture&&) = delete;
+    FrameCapture& operator=(const FrameCapture&) = delete;
+    FrameCapture& operator=(FrameCapture&&) = delete;
+};
+
+#endif
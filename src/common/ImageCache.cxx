@@ -0,0 +1,275 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2024 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifdef IMAGE_SUPPORT
+
+#include "FBSurface.hxx"
+#include "FSNode.hxx"
+#include "JPGLibrary.hxx"
+#include "OSystem.hxx"
+#include "PNGLibrary.hxx"
+
+#include "ImageCache.hxx"
+
+namespace {
+  // Get the modification time and size identifying the file's contents
+  bool fileStamp(const string& filename, uInt64& modTime, size_t& size)
+  {
+    const FSNode node(filename);
+    if(!node.isFile())
+      return false;
+
+    modTime = node.getModTime();
+    size = node.getSize();
+    return true;
+  }
+
+  // The result for images which don't exist
+  ImageCache::ImagePtr noImage()
+  {
+    auto image = make_shared<ImageCache::Image>();
+    image->error = "No image found";
+    return image;
+  }
+} // namespace
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+ImageCache::ImageCache(OSystem& osystem)
+  : myOSystem{osystem}
+{
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+ImageCache::~ImageCache()
+{
+  {
+    const std::lock_guard<std::mutex> lock(myMutex);
+    myStop = true;
+  }
+  myCondition.notify_all();
+
+  if(myWorker.joinable())
+    myWorker.join();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+ImageCache::ImagePtr ImageCache::load(const string& filename)
+{
+  uInt64 modTime{0};
+  size_t size{0};
+  if(!fileStamp(filename, modTime, size))
+    return noImage();
+
+  {
+    const std::lock_guard<std::mutex> lock(myMutex);
+    if(ImagePtr image = find(filename, modTime, size); image)
+      return image;
+  }
+
+  ImagePtr image = decode(filename);
+
+  const std::lock_guard<std::mutex> lock(myMutex);
+  insert(filename, modTime, size, image);
+
+  return image;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+ImageCache::ImagePtr ImageCache::request(const string& filename)
+{
+  uInt64 modTime{0};
+  size_t size{0};
+  if(!fileStamp(filename, modTime, size))
+    return noImage();
+
+  const std::lock_guard<std::mutex> lock(myMutex);
+  if(ImagePtr image = find(filename, modTime, size); image)
+    return image;
+
+  if(filename != myDecoding)
+  {
+    // Move the image to the front of the queue, discarding the oldest
+    // requests if too many are pending
+    std::erase(myRequests, filename);
+    std::erase(myPrefetches, filename);
+    myRequests.push_front(filename);
+    if(myRequests.size() > MAX_QUEUED)
+      myRequests.pop_back();
+
+    startWorker();
+    myCondition.notify_all();
+  }
+  return nullptr;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ImageCache::prefetch(const string& filename)
+{
+  uInt64 modTime{0};
+  size_t size{0};
+  if(!fileStamp(filename, modTime, size))
+    return;
+
+  const std::lock_guard<std::mutex> lock(myMutex);
+  if(filename == myDecoding || find(filename, modTime, size) ||
+     BSPF::contains(myRequests, filename) || BSPF::contains(myPrefetches, filename))
+    return;
+
+  myPrefetches.push_front(filename);
+  if(myPrefetches.size() > MAX_QUEUED)
+    myPrefetches.pop_back();
+
+  startWorker();
+  myCondition.notify_all();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ImageCache::loadToSurface(const Image& image, FBSurface& surface)
+{
+  // First determine if we need to resize the surface
+  const uInt32 iw = image.width, ih = image.height;
+  if(iw > surface.width() || ih > surface.height())
+    surface.resize(iw, ih);
+
+  // The source dimensions are set here; the destination dimensions are
+  // set by whoever owns the surface
+  surface.setSrcPos(0, 0);
+  surface.setSrcSize(iw, ih);
+
+  uInt32 *s_buf{nullptr}, s_pitch{0};
+  surface.basePtr(s_buf, s_pitch);
+  const uInt32* i_buf = image.pixels.data();
+
+  for(uInt32 irow = 0; irow < ih; ++irow, i_buf += iw, s_buf += s_pitch)
+    std::copy_n(i_buf, iw, s_buf);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+ImageCache::ImagePtr ImageCache::find(const string& filename, uInt64 modTime,
+                                      size_t size)
+{
+  const auto it = myCache.find(filename);
+  if(it == myCache.end())
+    return nullptr;
+
+  Entry& entry = it->second;
+  if(entry.modTime != modTime || entry.size != size)
+  {
+    // The file has changed since it was decoded
+    myCacheSize -= entry.image->pixels.size() * sizeof(uInt32);
+    myLRU.erase(entry.lru);
+    myCache.erase(it);
+    return nullptr;
+  }
+
+  // Mark as most recently used
+  myLRU.splice(myLRU.begin(), myLRU, entry.lru);
+  return entry.image;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ImageCache::insert(const string& filename, uInt64 modTime, size_t size,
+                        const ImagePtr& image)
+{
+  if(const auto it = myCache.find(filename); it != myCache.end())
+  {
+    myCacheSize -= it->second.image->pixels.size() * sizeof(uInt32);
+    myLRU.erase(it->second.lru);
+    myCache.erase(it);
+  }
+
+  myLRU.push_front(filename);
+  myCache.emplace(filename, Entry{modTime, size, image, myLRU.begin()});
+  myCacheSize += image->pixels.size() * sizeof(uInt32);
+
+  // Discard the least recently used images (but never the new one)
+  while(myCacheSize > MAX_CACHE_SIZE && myLRU.size() > 1)
+  {
+    const auto it = myCache.find(myLRU.back());
+    myCacheSize -= it->second.image->pixels.size() * sizeof(uInt32);
+    myCache.erase(it);
+    myLRU.pop_back();
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+ImageCache::ImagePtr ImageCache::decode(const string& filename) const
+{
+  auto image = make_shared<Image>();
+
+  try
+  {
+    const string::size_type idx = filename.find_last_of('.');
+
+    if(idx != string::npos && filename.substr(idx + 1) == "png")
+      myOSystem.png().decodeImage(filename, image->pixels, image->width,
+                                  image->height, image->metaData);
+    else
+      myOSystem.jpg().decodeImage(filename, image->pixels, image->width,
+                                  image->height, image->metaData);
+  }
+  catch(const runtime_error& e)
+  {
+    image->pixels.clear();
+    image->width = image->height = 0;
+    image->error = e.what();
+  }
+  return image;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ImageCache::startWorker()
+{
+  if(!myWorker.joinable())
+    myWorker = std::thread(&ImageCache::worker, this);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void ImageCache::worker()
+{
+  std::unique_lock<std::mutex> lock(myMutex);
+
+  while(true)
+  {
+    myCondition.wait(lock, [this] {
+      return myStop || !myRequests.empty() || !myPrefetches.empty();
+    });
+    if(myStop)
+      break;
+
+    // Requested images take precedence over prefetched ones
+    std::deque<string>& queue = !myRequests.empty() ? myRequests : myPrefetches;
+    myDecoding = std::move(queue.front());
+    queue.pop_front();
+
+    lock.unlock();
+
+    uInt64 modTime{0};
+    size_t size{0};
+    ImagePtr image;
+    if(fileStamp(myDecoding, modTime, size))
+      image = decode(myDecoding);
+
+    lock.lock();
+
+    if(image)
+      insert(myDecoding, modTime, size, image);
+    myDecoding.clear();
+  }
+}
+
+#endif  // IMAGE_SUPPORT
@@ -0,0 +1,166 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2024 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifdef IMAGE_SUPPORT
+
+#ifndef IMAGE_CACHE_HXX
+#define IMAGE_CACHE_HXX
+
+class OSystem;
+class FBSurface;
+
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include "bspf.hxx"
+#include "Variant.hxx"
+
+/**
+  This class keeps decoded PNG and JPG images (eg. ROM snapshots and
+  bezels) in a cache of limited size, discarding the least recently used
+  ones first.  Images are keyed by filename, and are decoded again when
+  the file's modification time or size has changed.
+
+  Images can either be decoded immediately, or requested and prefetched,
+  in which case they are decoded by a background thread.  This way the
+  UI doesn't have to wait while images are being decoded.
+
+  The pixels are stored in the format used by the framebuffer, so that
+  they only have to be copied into a surface.
+*/
+class ImageCache
+{
+  public:
+    struct Image {
+      uInt32 width{0}, height{0};
+      vector<uInt32> pixels;
+      VariantList metaData;
+      string error;  // non-empty if the image couldn't be decoded
+    };
+    using ImagePtr = shared_ptr<const Image>;
+
+  public:
+    explicit ImageCache(OSystem& osystem);
+    ~ImageCache();
+
+    /**
+      Get the given image, decoding it now if it isn't cached.
+
+      @param filename  The image file (PNG or JPG)
+
+      @return  The image; check its 'error' for decoding errors
+    */
+    ImagePtr load(const string& filename);
+
+    /**
+      Get the given image if it is cached, otherwise queue it for decoding
+      in the background, ahead of any earlier requests and prefetches.
+      Calling this repeatedly polls for the image.
+
+      @param filename  The image file (PNG or JPG)
+
+      @return  The image, or nullptr if it is still being decoded
+    */
+    ImagePtr request(const string& filename);
+
+    /**
+      Queue the given image for decoding in the background, unless it is
+      already cached.  Prefetches are decoded only when no requested images
+      are pending, and only the most recent ones are kept.
+
+      @param filename  The image file (PNG or JPG)
+    */
+    void prefetch(const string& filename);
+
+    /**
+      Copy the given image into the surface.  The surface is resized as
+      necessary to accommodate the image.
+
+      @param image    The image to copy
+      @param surface  The FBSurface into which to place the image
+    */
+    static void loadToSurface(const Image& image, FBSurface& surface);
+
+  private:
+    struct Entry {
+      uInt64 modTime{0};
+      size_t size{0};
+      ImagePtr image;
+      std::list<string>::iterator lru;
+    };
+
+    // Get the cached image for the file (or nullptr); must be called with
+    // myMutex held
+    ImagePtr find(const string& filename, uInt64 modTime, size_t size);
+
+    // Add an image to the cache, discarding old images as necessary; must
+    // be called with myMutex held
+    void insert(const string& filename, uInt64 modTime, size_t size,
+                const ImagePtr& image);
+
+    // Decode the given file
+    ImagePtr decode(const string& filename) const;
+
+    // Start the background thread, if not yet running; must be called with
+    // myMutex held
+    void startWorker();
+
+    // The background thread entry point
+    void worker();
+
+  private:
+    // The maximum size of the decoded pixels kept in the cache
+    static constexpr size_t MAX_CACHE_SIZE = 64 * 1024 * 1024;
+
+    // The maximum number of pending requests and prefetches
+    static constexpr size_t MAX_QUEUED = 8;
+
+    OSystem& myOSystem;
+
+    // The cached images, and their order of use (most recent first)
+    std::unordered_map<string, Entry> myCache;
+    std::list<string> myLRU;
+    size_t myCacheSize{0};
+
+    // The images waiting to be decoded (most recent first), and the image
+    // currently being decoded
+    std::deque<string> myRequests, myPrefetches;
+    string myDecoding;
+
+    // Guards all of the above
+    std::mutex myMutex;
+    std::condition_variable myCondition;
+
+    std::thread myWorker;
+    bool myStop{false};
+
+  private:
+    // Following constructors and assignment operators not supported
+    ImageCache() = delete;
+    ImageCache(const ImageCache&) = delete;
+    ImageCache(ImageCache&&) = delete;
+    ImageCache& operator=(const ImageCache&) = delete;
+    ImageCache& operator=(ImageCache&&) = delete;
+};
+
+#endif
+
+#endif  // IMAGE_SUPPORT
@@ -35,6 +35,43 @@ JPGLibrary::JPGLibrary(OSystem& osystem)
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void JPGLibrary::loadImage(const string& filename, FBSurface& surface,
                            VariantList& metaData)
+{
+  // nanojpeg decodes into global storage
+  const std::lock_guard<std::mutex> lock(ourMutex);
+
+  readImage(filename);
+
+  // Read the meta data we got
+  readMetaData(filename, metaData);
+
+  // Load image into the surface, setting the correct dimensions
+  loadImagetoSurface(surface);
+
+  // Cleanup
+  njDone();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void JPGLibrary::decodeImage(const string& filename, vector<uInt32>& pixels,
+                             uInt32& width, uInt32& height,
+                             VariantList& metaData)
+{
+  // nanojpeg decodes into global storage
+  const std::lock_guard<std::mutex> lock(ourMutex);
+
+  readImage(filename);
+  readMetaData(filename, metaData);
+
+  width = myReadInfo.width;
+  height = myReadInfo.height;
+  pixels.resize(static_cast<size_t>(width) * height);
+  mapPixels(pixels.data(), width);
+
+  njDone();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void JPGLibrary::readImage(const string& filename)
 {
   std::ifstream in(filename, std::ios_base::binary | std::ios::ate);
   if(!in.is_open())
@@ -57,15 +94,6 @@ void JPGLibrary::loadImage(const string& filename, FBSurface& surface,
   myReadInfo.width = njGetWidth();
   myReadInfo.height = njGetHeight();
   myReadInfo.pitch = myReadInfo.width * 3;
-
-  // Read the meta data we got
-  readMetaData(filename, metaData);
-
-  // Load image into the surface, setting the correct dimensions
-  loadImagetoSurface(surface);
-
-  // Cleanup
-  njDone();
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -84,11 +112,17 @@ void JPGLibrary::loadImagetoSurface(FBSurface& surface)
   // Convert RGB triples into pixels and store in the surface
   uInt32 *s_buf{nullptr}, s_pitch{0};
   surface.basePtr(s_buf, s_pitch);
+  mapPixels(s_buf, s_pitch);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void JPGLibrary::mapPixels(uInt32* s_buf, uInt32 s_pitch) const
+{
   const uInt8* i_buf = myReadInfo.buffer;
   const uInt32 i_pitch = myReadInfo.pitch;
 
   const FrameBuffer& fb = myOSystem.frameBuffer();
-  for(uInt32 irow = 0; irow < ih; ++irow, i_buf += i_pitch, s_buf += s_pitch)
+  for(uInt32 irow = 0; irow < myReadInfo.height; ++irow, i_buf += i_pitch, s_buf += s_pitch)
   {
     const uInt8* i_ptr = i_buf;
     uInt32* s_ptr = s_buf;
@@ -117,5 +151,6 @@ void JPGLibrary::readMetaData(const string& filename, VariantList& metaData)
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 std::vector<char> JPGLibrary::myFileBuffer;
+std::mutex JPGLibrary::ourMutex;
 
 #endif  // IMAGE_SUPPORT
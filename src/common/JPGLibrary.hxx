@@ -23,6 +23,8 @@
 class OSystem;
 class FBSurface;
 
+#include <mutex>
+
 /**
   This class implements a thin wrapper around the nanojpeg library, and
   abstracts all the irrelevant details other loading an actual image.
@@ -49,6 +51,22 @@ class JPGLibrary
     void loadImage(const string& filename, FBSurface& surface,
                    VariantList& metaData);
 
+    /**
+      Read a JPG image from the specified file into a pixel buffer, in the
+      format used by the framebuffer.  This may be called from any thread.
+
+      @param filename  The filename to load the JPG image
+      @param pixels    The buffer receiving the pixels, row by row
+      @param width     The width of the JPG image
+      @param height    The height of the JPG image
+      @param metaData  The meta data of the JPG image
+
+      @post  On failure, a runtime_error is thrown containing a more
+             detailed error message.
+    */
+    void decodeImage(const string& filename, vector<uInt32>& pixels,
+                     uInt32& width, uInt32& height, VariantList& metaData);
+
   private:
     // Global OSystem object
     OSystem& myOSystem;
@@ -62,6 +80,16 @@ class JPGLibrary
     ReadInfoType myReadInfo;
     static std::vector<char> myFileBuffer;
 
+    // Serializes all decoding, since nanojpeg uses global storage
+    static std::mutex ourMutex;
+
+    /**
+      Decode the JPG image from the given file into 'ReadInfo'.
+
+      @param filename  The filename to load the JPG image
+    */
+    void readImage(const string& filename);
+
     /**
       Load the JPG data from 'ReadInfo' into the FBSurface.  The surface
       is resized as necessary to accommodate the data.
@@ -70,6 +98,14 @@ class JPGLibrary
     */
     void loadImagetoSurface(FBSurface& surface);
 
+    /**
+      Convert the RGB data from 'ReadInfo' into framebuffer pixels.
+
+      @param s_buf    The destination buffer
+      @param s_pitch  The pitch (in pixels) of the destination buffer
+    */
+    void mapPixels(uInt32* s_buf, uInt32 s_pitch) const;
+
     /**
       Read EXIF meta data chunks from the image.
 
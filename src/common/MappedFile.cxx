@@ -0,0 +1,134 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2024 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#if defined(BSPF_UNIX) || defined(BSPF_MACOS)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#elif defined(BSPF_WINDOWS)
+  #include "Windows.hxx"
+#endif
+
+#include "MappedFile.hxx"
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+MappedFile::MappedFile(const string& filename, bool mapOnly)
+{
+#if defined(BSPF_UNIX) || defined(BSPF_MACOS)
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if(fd < 0)
+    return;
+
+  struct stat st{};
+  if(::fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0)
+  {
+    void* const ptr = ::mmap(nullptr, static_cast<size_t>(st.st_size),
+                             PROT_READ, MAP_PRIVATE, fd, 0);
+    if(ptr != MAP_FAILED)
+    {
+      myData = static_cast<const uInt8*>(ptr);
+      mySize = static_cast<size_t>(st.st_size);
+      myIsMapped = true;
+    }
+  }
+  // The mapping stays valid after the file is closed
+  ::close(fd);
+
+  if(myIsMapped)
+    return;
+#elif defined(BSPF_WINDOWS)
+  const HANDLE file = ::CreateFileA(filename.c_str(), GENERIC_READ,
+      FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if(file == INVALID_HANDLE_VALUE)
+    return;
+
+  LARGE_INTEGER length{};
+  if(::GetFileSizeEx(file, &length) && length.QuadPart > 0 &&
+     static_cast<uInt64>(length.QuadPart) <= SIZE_MAX)
+  {
+    const HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY,
+                                                0, 0, nullptr);
+    if(mapping != nullptr)
+    {
+      const void* const ptr = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+      if(ptr != nullptr)
+      {
+        myData = static_cast<const uInt8*>(ptr);
+        mySize = static_cast<size_t>(length.QuadPart);
+        myIsMapped = true;
+      }
+      // The view stays valid after the mapping handle is closed
+      ::CloseHandle(mapping);
+    }
+  }
+  ::CloseHandle(file);
+
+  if(myIsMapped)
+    return;
+#endif
+  if(mapOnly)
+    return;
+
+  // Memory-mapping is not available; read the complete file
+  std::ifstream in(filename, std::ios::binary | std::ios::ate);
+  if(!in)
+    return;
+
+  const auto length = static_cast<size_t>(in.tellg());
+  if(length == 0)
+    return;
+
+  myBuffer = make_unique<uInt8[]>(length);
+  in.seekg(0);
+  if(in.read(reinterpret_cast<char*>(myBuffer.get()), length))
+  {
+    myData = myBuffer.get();
+    mySize = length;
+  }
+  else
+    myBuffer.reset();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+MappedFile::~MappedFile()
+{
+#if defined(BSPF_UNIX) || defined(BSPF_MACOS)
+  if(myIsMapped)
+    ::munmap(const_cast<uInt8*>(myData), mySize);
+#elif defined(BSPF_WINDOWS)
+  if(myIsMapped)
+    ::UnmapViewOfFile(myData);
+#endif
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void MappedFile::willNeed(size_t offset, size_t size) const
+{
+#if defined(BSPF_UNIX) || defined(BSPF_MACOS)
+  if(!myIsMapped || offset >= mySize)
+    return;
+
+  // The advised range must start at a page boundary
+  static const auto pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+  const size_t start = offset - offset % pageSize;
+  const size_t end = std::min(offset + size, mySize);
+
+  ::posix_madvise(const_cast<uInt8*>(myData) + start, end - start,
+                  POSIX_MADV_WILLNEED);
+#endif
+}
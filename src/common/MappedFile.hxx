@@ -0,0 +1,81 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2024 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef MAPPED_FILE_HXX
+#define MAPPED_FILE_HXX
+
+#include "bspf.hxx"
+
+/**
+  A read-only view of the complete contents of a file.  Where supported,
+  the file is memory-mapped, so that only the parts actually accessed are
+  read from disk; otherwise the file is read into memory.
+
+  The contents remain valid for the lifetime of the object.
+*/
+class MappedFile
+{
+  public:
+    /**
+      Map the given file.  If this fails, the object is empty (see
+      'isValid()').
+
+      @param filename  The path of the file to map
+      @param mapOnly   Don't read the file into memory if it cannot be
+                       memory-mapped (e.g. for huge files)
+    */
+    explicit MappedFile(const string& filename, bool mapOnly = false);
+    ~MappedFile();
+
+    /**
+      Answer whether the file could be mapped.
+    */
+    bool isValid() const { return myData != nullptr; }
+
+    const uInt8* data() const { return myData; }
+    size_t size() const { return mySize; }
+
+    /**
+      Advise the OS that the given range of the file will be accessed soon,
+      so that it is read from disk in the background.  This has no effect
+      if the file is not memory-mapped.
+
+      @param offset  The start of the range
+      @param size    The size of the range (clipped to the file size)
+    */
+    void willNeed(size_t offset, size_t size) const;
+
+  private:
+    const uInt8* myData{nullptr};
+    size_t mySize{0};
+
+    // Used when the file cannot be memory-mapped
+    ByteBuffer myBuffer;
+
+    // Whether 'myData' points to a memory mapping
+    bool myIsMapped{false};
+
+  private:
+    // Following constructors and assignment operators not supported
+    MappedFile() = delete;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+};
+
+#endif
@@ -23,6 +23,8 @@
 #include "FBSurface.hxx"
 #include "Props.hxx"
 #include "TIASurface.hxx"
+#include "TIA.hxx"
+#include "FrameCapture.hxx"
 #include "Version.hxx"
 #include "PNGLibrary.hxx"
 
@@ -35,6 +37,31 @@ PNGLibrary::PNGLibrary(OSystem& osystem)
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void PNGLibrary::loadImage(const string& filename, FBSurface& surface,
                            VariantList& metaData)
+{
+  const bool hasAlpha = readImage(filename, ReadInfo, metaData);
+
+  // Load image into the surface, setting the correct dimensions
+  loadImagetoSurface(surface, hasAlpha);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void PNGLibrary::decodeImage(const string& filename, vector<uInt32>& pixels,
+                             uInt32& width, uInt32& height,
+                             VariantList& metaData) const
+{
+  // Use separate storage, since 'ReadInfo' is reserved for the main thread
+  ReadInfoType info;
+  const bool hasAlpha = readImage(filename, info, metaData);
+
+  width = info.width;
+  height = info.height;
+  pixels.resize(static_cast<size_t>(width) * height);
+  mapPixels(info, hasAlpha, pixels.data(), width);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool PNGLibrary::readImage(const string& filename, ReadInfoType& info,
+                           VariantList& metaData)
 {
   png_structp png_ptr{nullptr};
   png_infop info_ptr{nullptr};
@@ -104,15 +131,15 @@ void PNGLibrary::loadImage(const string& filename, FBSurface& surface,
   }
 
   // Create/initialize storage area for the current image
-  if(!allocateStorage(iwidth, iheight, hasAlpha))
+  if(!allocateStorage(info, iwidth, iheight, hasAlpha))
     loadImageERROR("Not enough memory to read PNG image");
 
   // The PNG read function expects an array of rows, not a single 1-D array
-  for(uInt32 irow = 0, offset = 0; irow < ReadInfo.height; ++irow, offset += ReadInfo.pitch)
-    ReadInfo.row_pointers[irow] = ReadInfo.buffer.data() + offset;
+  for(uInt32 irow = 0, offset = 0; irow < info.height; ++irow, offset += info.pitch)
+    info.row_pointers[irow] = info.buffer.data() + offset;
 
   // Read the entire image in one go
-  png_read_image(png_ptr, ReadInfo.row_pointers.data());
+  png_read_image(png_ptr, info.row_pointers.data());
 
   // We're finished reading
   png_read_end(png_ptr, info_ptr);
@@ -120,12 +147,11 @@ void PNGLibrary::loadImage(const string& filename, FBSurface& surface,
   // Read the meta data we got
   readMetaData(png_ptr, info_ptr, metaData);
 
-  // Load image into the surface, setting the correct dimensions
-  loadImagetoSurface(surface, hasAlpha);
-
   // Cleanup
   if(png_ptr)
     png_destroy_read_struct(&png_ptr, info_ptr ? &info_ptr : nullptr, nullptr);
+
+  return hasAlpha;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -187,6 +213,23 @@ void PNGLibrary::saveImage(const string& filename, const FBSurface& surface,
   saveImageToDisk(out, rows, width, height, metaData);
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void PNGLibrary::saveImage(const string& filename, const uInt32* pixels,
+                           size_t width, size_t height, const VariantList& metaData)
+{
+  std::ofstream out(filename, std::ios_base::binary);
+  if(!out.is_open())
+    throw runtime_error("ERROR: Couldn't create snapshot file");
+
+  // Set up pointers into the pixel data (the same format as 'readPixels')
+  vector<png_bytep> rows(height);
+  for(size_t k = 0; k < height; ++k)
+    rows[k] = reinterpret_cast<png_bytep>(const_cast<uInt32*>(pixels + k * width));
+
+  // And save the image
+  saveImageToDisk(out, rows, width, height, metaData);
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void PNGLibrary::saveImageToDisk(std::ofstream& out, const vector<png_bytep>& rows,
   size_t width, size_t height, const VariantList& metaData)
@@ -252,8 +295,19 @@ void PNGLibrary::saveImageToDisk(std::ofstream& out, const vector<png_bytep>& ro
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void PNGLibrary::updateTime(uInt64 time)
 {
-  if(++mySnapCounter % mySnapInterval == 0)
-    takeSnapshot(static_cast<uInt32>(time) >> 10);  // not quite milliseconds, but close enough
+  if(++mySnapCounter % mySnapInterval == 0 && myOSystem.hasConsole())
+  {
+    const uInt32 number = static_cast<uInt32>(time) >> 10;  // not quite milliseconds, but close enough
+
+    // 1x snapshots are the plain TIA image, which is encoded and written on
+    // the capture thread, so emulation doesn't stall. Otherwise the image
+    // must be rendered (scaling, TV effects), like for a manual snapshot.
+    if(myOSystem.settings().getBool("ss1x"))
+      myOSystem.capture().addSnapshot(myOSystem.console().tia(),
+          snapshotFilename(number), snapshotMetaData(false));
+    else
+      takeSnapshot(number);
+  }
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -300,6 +354,49 @@ void PNGLibrary::takeSnapshot(uInt32 number)
   if(!myOSystem.hasConsole())
     return;
 
+  const string filename = snapshotFilename(number);
+  const VariantList metaData = snapshotMetaData(true);
+
+  // Now create a PNG snapshot
+  string message = "Snapshot saved";
+  if(myOSystem.settings().getBool("ss1x"))
+  {
+    try
+    {
+      Common::Rect rect;
+      const FBSurface& surface =
+        myOSystem.frameBuffer().tiaSurface().baseSurface(rect);
+      PNGLibrary::saveImage(filename, surface, rect, metaData);
+    }
+    catch(const runtime_error& e)
+    {
+      message = e.what();
+    }
+  }
+  else
+  {
+    // Make sure we have a 'clean' image, with no onscreen messages
+    myOSystem.frameBuffer().enableMessages(false);
+    myOSystem.frameBuffer().tiaSurface().renderForSnapshot();
+
+    try
+    {
+      PNGLibrary::saveImage(filename, metaData);
+    }
+    catch(const runtime_error& e)
+    {
+      message = e.what();
+    }
+
+    // Re-enable old messages
+    myOSystem.frameBuffer().enableMessages(true);
+  }
+  myOSystem.frameBuffer().showTextMessage(message);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+string PNGLibrary::snapshotFilename(uInt32 number) const
+{
   // Figure out the correct snapshot name
   string filename;
   const string sspath = myOSystem.snapshotSaveDir().getPath() +
@@ -338,6 +435,12 @@ void PNGLibrary::takeSnapshot(uInt32 number)
   else
     filename = sspath + ".png";
 
+  return filename;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+VariantList PNGLibrary::snapshotMetaData(bool effects) const
+{
   // Some text fields to add to the PNG snapshot
   VariantList metaData;
   ostringstream version;
@@ -350,60 +453,28 @@ void PNGLibrary::takeSnapshot(uInt32 number)
       : myOSystem.romFile().getName();
   VarList::push_back(metaData, "ROM Name", name);
   VarList::push_back(metaData, "ROM MD5", myOSystem.console().properties().get(PropType::Cart_MD5));
-  VarList::push_back(metaData, "TV Effects", myOSystem.frameBuffer().tiaSurface().effectsInfo());
+  VarList::push_back(metaData, "TV Effects", effects
+      ? myOSystem.frameBuffer().tiaSurface().effectsInfo() : "None");
 
-  // Now create a PNG snapshot
-  string message = "Snapshot saved";
-  if(myOSystem.settings().getBool("ss1x"))
-  {
-    try
-    {
-      Common::Rect rect;
-      const FBSurface& surface =
-        myOSystem.frameBuffer().tiaSurface().baseSurface(rect);
-      PNGLibrary::saveImage(filename, surface, rect, metaData);
-    }
-    catch(const runtime_error& e)
-    {
-      message = e.what();
-    }
-  }
-  else
-  {
-    // Make sure we have a 'clean' image, with no onscreen messages
-    myOSystem.frameBuffer().enableMessages(false);
-    myOSystem.frameBuffer().tiaSurface().renderForSnapshot();
-
-    try
-    {
-      PNGLibrary::saveImage(filename, metaData);
-    }
-    catch(const runtime_error& e)
-    {
-      message = e.what();
-    }
-
-    // Re-enable old messages
-    myOSystem.frameBuffer().enableMessages(true);
-  }
-  myOSystem.frameBuffer().showTextMessage(message);
+  return metaData;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool PNGLibrary::allocateStorage(size_t width, size_t height, bool hasAlpha)
+bool PNGLibrary::allocateStorage(ReadInfoType& info, size_t width,
+                                 size_t height, bool hasAlpha)
 {
   // Create space for the entire image (3(4) bytes per pixel in RGB(A) format)
   const size_t req_buffer_size = width * height * (hasAlpha ? 4 : 3);
-  if(req_buffer_size > ReadInfo.buffer.capacity())
-    ReadInfo.buffer.resize(req_buffer_size * 1.5);
+  if(req_buffer_size > info.buffer.capacity())
+    info.buffer.resize(req_buffer_size * 1.5);
 
   const size_t req_row_size = height;
-  if(req_row_size > ReadInfo.row_pointers.capacity())
-    ReadInfo.row_pointers.resize(req_row_size * 1.5);
+  if(req_row_size > info.row_pointers.capacity())
+    info.row_pointers.resize(req_row_size * 1.5);
 
-  ReadInfo.width  = static_cast<png_uint_32>(width);
-  ReadInfo.height = static_cast<png_uint_32>(height);
-  ReadInfo.pitch  = static_cast<png_uint_32>(width * (hasAlpha ? 4 : 3));
+  info.width  = static_cast<png_uint_32>(width);
+  info.height = static_cast<png_uint_32>(height);
+  info.pitch  = static_cast<png_uint_32>(width * (hasAlpha ? 4 : 3));
 
   return true;
 }
@@ -424,19 +495,26 @@ void PNGLibrary::loadImagetoSurface(FBSurface& surface, bool hasAlpha)
   // Convert RGB triples into pixels and store in the surface
   uInt32 *s_buf{nullptr}, s_pitch{0};
   surface.basePtr(s_buf, s_pitch);
-  const uInt8* i_buf = ReadInfo.buffer.data();
-  const uInt32 i_pitch = ReadInfo.pitch;
+  mapPixels(ReadInfo, hasAlpha, s_buf, s_pitch);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void PNGLibrary::mapPixels(const ReadInfoType& info, bool hasAlpha,
+                           uInt32* s_buf, uInt32 s_pitch) const
+{
+  const uInt8* i_buf = info.buffer.data();
+  const uInt32 i_pitch = info.pitch;
 
   const FrameBuffer& fb = myOSystem.frameBuffer();
-  for(uInt32 irow = 0; irow < ih; ++irow, i_buf += i_pitch, s_buf += s_pitch)
+  for(uInt32 irow = 0; irow < info.height; ++irow, i_buf += i_pitch, s_buf += s_pitch)
   {
     const uInt8* i_ptr = i_buf;
     uInt32* s_ptr = s_buf;
     if(hasAlpha)
-      for(uInt32 icol = 0; icol < ReadInfo.width; ++icol, i_ptr += 4)
+      for(uInt32 icol = 0; icol < info.width; ++icol, i_ptr += 4)
         *s_ptr++ = fb.mapRGBA(*i_ptr, *(i_ptr+1), *(i_ptr+2), *(i_ptr+3));
     else
-      for(uInt32 icol = 0; icol < ReadInfo.width; ++icol, i_ptr += 3)
+      for(uInt32 icol = 0; icol < info.width; ++icol, i_ptr += 3)
         *s_ptr++ = fb.mapRGB(*i_ptr, *(i_ptr+1), *(i_ptr+2));
   }
 }
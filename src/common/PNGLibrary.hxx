@@ -52,6 +52,23 @@ class PNGLibrary
     void loadImage(const string& filename, FBSurface& surface,
                    VariantList& metaData);
 
+    /**
+      Read a PNG image from the specified file into a pixel buffer, in the
+      format used by the framebuffer.  Unlike 'loadImage', this may be
+      called from any thread.
+
+      @param filename  The filename to load the PNG image
+      @param pixels    The buffer receiving the pixels, row by row
+      @param width     The width of the PNG image
+      @param height    The height of the PNG image
+      @param metaData  The meta data of the PNG image
+
+      @post  On failure, a runtime_error is thrown containing a more
+             detailed error message.
+    */
+    void decodeImage(const string& filename, vector<uInt32>& pixels,
+                     uInt32& width, uInt32& height, VariantList& metaData) const;
+
     /**
       Save the current FrameBuffer image to a PNG file.  Note that in most
       cases this will be a TIA image, but it could actually be used for
@@ -83,6 +100,24 @@ class PNGLibrary
                           const Common::Rect& rect = Common::Rect{},
                           const VariantList& metaData = VariantList{});
 
+    /**
+      Save the given pixel data to a PNG file.  This may be called from
+      any thread.
+
+      @param filename  The filename to save the PNG image
+      @param pixels    The pixel data (in 0x00RRGGBB format)
+      @param width     The width of the PNG image
+      @param height    The height of the PNG image
+      @param metaData  The meta data to add to the PNG image
+
+      @post  On success, the PNG file has been saved to 'filename',
+             otherwise a runtime_error is thrown containing a
+             more detailed error message.
+    */
+    static void saveImage(const string& filename, const uInt32* pixels,
+                          size_t width, size_t height,
+                          const VariantList& metaData = VariantList{});
+
     /**
       Called at regular intervals, and used to determine whether a
       continuous snapshot is due to be taken.
@@ -124,6 +159,22 @@ class PNGLibrary
     */
     void takeSnapshot(uInt32 number = 0);
 
+  private:
+    /**
+      Determine the snapshot filename, based on the name of the ROM, and also
+      optionally using the number given as a parameter.
+
+      @param number  Optional number to append to the snapshot name
+    */
+    string snapshotFilename(uInt32 number) const;
+
+    /**
+      Create the meta data added to each snapshot.
+
+      @param effects  Whether the snapshot includes TV effects
+    */
+    VariantList snapshotMetaData(bool effects) const;
+
   private:
     // Global OSystem object
     OSystem& myOSystem;
@@ -150,10 +201,24 @@ class PNGLibrary
       dependent on the given dimensions.  If memory has been previously
       allocated and it can accommodate the given dimensions, it is used directly.
 
+      @param info    The storage to (re)allocate, usually 'ReadInfo'
       @param width   The width of the PNG image
       @param height  The height of the PNG image
     */
-    static bool allocateStorage(size_t width, size_t height, bool hasAlpha);
+    static bool allocateStorage(ReadInfoType& info, size_t width,
+                                size_t height, bool hasAlpha);
+
+    /**
+      Read a PNG image from the specified file into the given storage.
+
+      @param filename  The filename to load the PNG image
+      @param info      The storage to place the RGB(A) data into
+      @param metaData  The meta data of the PNG image
+
+      @return  Whether the image data contains an alpha channel
+    */
+    static bool readImage(const string& filename, ReadInfoType& info,
+                          VariantList& metaData);
 
     /** The actual method which saves a PNG image.
 
@@ -175,6 +240,17 @@ class PNGLibrary
     */
     void loadImagetoSurface(FBSurface& surface, bool hasAlpha);
 
+    /**
+      Convert the RGB(A) data from the given storage into framebuffer pixels.
+
+      @param info      The storage containing the image data
+      @param hasAlpha  Whether the image data contains an alpha channel
+      @param s_buf     The destination buffer
+      @param s_pitch   The pitch (in pixels) of the destination buffer
+    */
+    void mapPixels(const ReadInfoType& info, bool hasAlpha,
+                   uInt32* s_buf, uInt32 s_pitch) const;
+
     /**
       Write PNG tEXt chunks to the image.
     */
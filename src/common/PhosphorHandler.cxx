@@ -15,8 +15,52 @@
 // this file, and for a DISCLAIMER OF ALL WARRANTIES.
 //============================================================================
 
+#include <cmath>
+
+#if defined(__SSE2__)
+  #include <emmintrin.h>
+#endif
+#if defined(__ARM_NEON)
+  #include <arm_neon.h>
+#endif
+
 #include "PhosphorHandler.hxx"
 
+#ifdef AVX2_TARGET
+  #include <immintrin.h>
+
+namespace {
+  // AVX2 version of the SIMD part of PhosphorHandler::getRow()
+  // Returns the number of pixels processed
+  AVX2_TARGET uInt32 getRowAVX2(const uInt32* c, uInt32* p, uInt32* out,
+                                uInt32 n, uInt16 phosphorFactor)
+  {
+    const __m256i factor = _mm256_set1_epi16(static_cast<short>(phosphorFactor));
+    const __m256i mask = _mm256_set1_epi32(0x00ffffff);
+    const __m256i zero = _mm256_setzero_si256();
+    uInt32 i = 0;
+
+    for(; i + 8 <= n; i += 8)
+    {
+      const __m256i cur = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c + i));
+      const __m256i prev = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+
+      // Decay previous values (8.8 fixed-point), then take the maximum
+      const __m256i lo = _mm256_srli_epi16(_mm256_mullo_epi16(
+          _mm256_unpacklo_epi8(prev, zero), factor), 8);
+      const __m256i hi = _mm256_srli_epi16(_mm256_mullo_epi16(
+          _mm256_unpackhi_epi8(prev, zero), factor), 8);
+      const __m256i res = _mm256_and_si256(
+          _mm256_max_epu8(cur, _mm256_packus_epi16(lo, hi)), mask);
+
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(p + i), res);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), res);
+    }
+    return i;
+  }
+} // namespace
+#endif
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool PhosphorHandler::initialize(bool enable, int blend)
 {
@@ -30,11 +74,12 @@ bool PhosphorHandler::initialize(bool enable, int blend)
   {
     if(blend >= 0 && blend <= 100)
       myPhosphorPercent = blend / 100.F;
+    ourPhosphorFactor = static_cast<uInt16>(std::lround(myPhosphorPercent * 256));
 
     // Used to calculate an averaged color for the 'phosphor' effect
     const auto getPhosphor = [&] (const uInt8 c1, uInt8 c2) -> uInt8 {
       // Use maximum of current and decayed previous values
-      c2 = static_cast<uInt8>(c2 * myPhosphorPercent);
+      c2 = static_cast<uInt8>((c2 * ourPhosphorFactor) >> 8);
       if(c1 > c2)  return c1; // raise (assumed immediate)
       else         return c2; // decay
     };
@@ -46,6 +91,66 @@ bool PhosphorHandler::initialize(bool enable, int blend)
   return true;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void PhosphorHandler::getRow(const uInt32* c, uInt32* p, uInt32* out, uInt32 n)
+{
+  uInt32 i = 0;
+
+#ifdef AVX2_TARGET
+  if(BSPF::hasAVX2())
+    i = getRowAVX2(c, p, out, n, ourPhosphorFactor);
+#endif
+
+#if defined(__SSE2__)
+  {
+    const __m128i factor = _mm_set1_epi16(static_cast<short>(ourPhosphorFactor));
+    const __m128i mask = _mm_set1_epi32(0x00ffffff);
+    const __m128i zero = _mm_setzero_si128();
+
+    for(; i + 4 <= n; i += 4)
+    {
+      const __m128i cur = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c + i));
+      const __m128i prev = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+
+      // Decay previous values (8.8 fixed-point), then take the maximum
+      const __m128i lo = _mm_srli_epi16(_mm_mullo_epi16(
+          _mm_unpacklo_epi8(prev, zero), factor), 8);
+      const __m128i hi = _mm_srli_epi16(_mm_mullo_epi16(
+          _mm_unpackhi_epi8(prev, zero), factor), 8);
+      const __m128i res = _mm_and_si128(
+          _mm_max_epu8(cur, _mm_packus_epi16(lo, hi)), mask);
+
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), res);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), res);
+    }
+  }
+#elif defined(__ARM_NEON)
+  {
+    const uint32x4_t mask = vdupq_n_u32(0x00ffffff);
+
+    for(; i + 4 <= n; i += 4)
+    {
+      const uint8x16_t cur = vreinterpretq_u8_u32(vld1q_u32(c + i));
+      const uint8x16_t prev = vreinterpretq_u8_u32(vld1q_u32(p + i));
+
+      // Decay previous values (8.8 fixed-point), then take the maximum
+      const uint8x8_t lo = vshrn_n_u16(
+          vmulq_n_u16(vmovl_u8(vget_low_u8(prev)), ourPhosphorFactor), 8);
+      const uint8x8_t hi = vshrn_n_u16(
+          vmulq_n_u16(vmovl_u8(vget_high_u8(prev)), ourPhosphorFactor), 8);
+      const uint32x4_t res = vandq_u32(vreinterpretq_u32_u8(
+          vmaxq_u8(cur, vcombine_u8(lo, hi))), mask);
+
+      vst1q_u32(p + i, res);
+      vst1q_u32(out + i, res);
+    }
+  }
+#endif
+
+  for(; i < n; ++i)
+    p[i] = out[i] = getPixel(c[i], p[i]);
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 PhosphorHandler::PhosphorMode PhosphorHandler::toPhosphorMode(string_view name)
 {
@@ -73,3 +178,6 @@ string_view PhosphorHandler::toPhosphorName(PhosphorMode type)
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 PhosphorHandler::PhosphorLUT PhosphorHandler::ourPhosphorLUT;
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt16 PhosphorHandler::ourPhosphorFactor = 128;
@@ -74,6 +74,19 @@ class PhosphorHandler
               ourPhosphorLUT[bc][bp];
     }
 
+    /**
+      Used to calculate the 'phosphor' effect for a whole row of pixels.
+      Where available, SIMD instructions are used to blend several pixels
+      at once (using the same fixed-point decay as the lookup table);
+      the remaining pixels are handled by 'getPixel'.
+
+      @param c    RGB colors of the current frame
+      @param p    RGB colors of the previous frame; updated with the result
+      @param out  Destination for the averaged RGB colors
+      @param n    Number of pixels in the row
+    */
+    static void getRow(const uInt32* c, uInt32* p, uInt32* out, uInt32 n);
+
   private:
     // Use phosphor effect
     bool myUsePhosphor{false};
@@ -86,6 +99,10 @@ class PhosphorHandler
     using PhosphorLUT = BSPF::array2D<uInt8, kColor, kColor>;
     static PhosphorLUT ourPhosphorLUT;
 
+    // Decay factor of the previous frame in 8.8 fixed-point format
+    // (256 = no decay), used by both the lookup table and the SIMD code
+    static uInt16 ourPhosphorFactor;
+
   private:
     PhosphorHandler(const PhosphorHandler&) = delete;
     PhosphorHandler(PhosphorHandler&&) = delete;
@@ -20,8 +20,19 @@
 #include <zlib.h>
 
 #include "Bankswitch.hxx"
+#include "FSNodeFactory.hxx"
+#include "MappedFile.hxx"
 #include "ZipHandler.hxx"
 
+namespace {
+  // Answer the size and modification time of the given file on disk
+  std::pair<uInt64, uInt64> fileStatus(const string& filename)
+  {
+    const auto node = FSNodeFactory::create(filename, FSNodeFactory::Type::SYSTEM);
+    return { node->getSize(), node->getModTime() };
+  }
+} // namespace
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void ZipHandler::open(const string& filename)
 {
@@ -31,26 +42,24 @@ void ZipHandler::open(const string& filename)
   // Ensure we start with a nullptr result
   myZip.reset();
 
+  // Only a previously used entry will exist in the cache, so we know its
+  // index is valid, unless the file has been replaced in the meantime
   ZipFilePtr ptr = findCached(filename);
-  if(ptr)
-  {
-    // Only a previously used entry will exist in the cache, so we know it's valid
+  if(ptr && fileStatus(filename) == std::make_pair(ptr->myLength, ptr->myModTime))
     myZip = std::move(ptr);
 
-    // Was already initialized; we just need to re-open it
-    if(!myZip->open())
-      throw runtime_error(errorMessage(ZipError::FILE_ERROR));
-  }
-  else
+  if(!myZip)
   {
     // Allocate memory for the ZipFile structure
     try        { ptr = make_unique<ZipFile>(filename); }
     catch(...) { throw runtime_error(errorMessage(ZipError::OUT_OF_MEMORY)); }
 
-    // Open the file and initialize it
+    // Open the file and index it; the file is only mapped again when
+    // something is decompressed
     if(!ptr->open())
       throw runtime_error(errorMessage(ZipError::FILE_ERROR));
     ptr->initialize();
+    ptr->close();
 
     myZip = std::move(ptr);
 
@@ -78,39 +87,70 @@ void ZipHandler::reset()
 {
   // Reset the position and go from there
   if(myZip)
-    myZip->myCdPos = 0;
+  {
+    myZip->myPos = 0;
+    myZip->myHeader = nullptr;
+  }
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool ZipHandler::hasNext() const
 {
-  return myZip && (myZip->myCdPos < myZip->myEcd.cdSize);
+  return myZip && (myZip->myPos < myZip->myEntries.size());
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 std::tuple<string, size_t> ZipHandler::next()
 {
-  if(hasNext())
+  while(hasNext())
   {
     const ZipHeader* const header = myZip->nextFile();
-    if(!header)
-      throw runtime_error(errorMessage(ZipError::FILE_CORRUPT));
-    else if(header->uncompressedLength == 0)
-      return next();
-    else
+    if(header->uncompressedLength != 0)
       return {header->filename, header->uncompressedLength};
   }
   return {EmptyString, 0};
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool ZipHandler::select(string_view name)
+{
+  if(!myZip)
+    return false;
+
+  // Names differing only in case are adjacent in the sorted index
+  for(auto it = myZip->lowerBound(name); it != myZip->mySorted.end(); ++it)
+  {
+    const ZipHeader& header = myZip->myEntries[*it];
+    if(!BSPF::equalsIgnoreCase(header.filename, name))
+      break;
+    if(header.filename == name)
+    {
+      myZip->myHeader = &header;
+      return true;
+    }
+  }
+  return false;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool ZipHandler::hasPrefix(string_view prefix) const
+{
+  if(!myZip)
+    return false;
+
+  const auto it = myZip->lowerBound(prefix);
+  return it != myZip->mySorted.end() &&
+         BSPF::startsWithIgnoreCase(myZip->myEntries[*it].filename, prefix);
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 uInt64 ZipHandler::decompress(ByteBuffer& image)
 {
-  if(myZip && myZip->myHeader.uncompressedLength > 0)
+  if(myZip && myZip->myHeader && myZip->myHeader->uncompressedLength > 0)
   {
     try
     {
-      const uInt64 length = myZip->myHeader.uncompressedLength;
+      const uInt64 length = myZip->myHeader->uncompressedLength;
       image = make_unique<uInt8[]>(length);
 
       myZip->decompress(image, length);
@@ -201,25 +241,22 @@ void ZipHandler::addToCache()
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 ZipHandler::ZipFile::ZipFile(const string& filename)
-  : myFilename{filename},
-    myBuffer{make_unique<uInt8[]>(DECOMPRESS_BUFSIZE)}
+  : myFilename{filename}
 {
-  std::fill(myBuffer.get(), myBuffer.get() + DECOMPRESS_BUFSIZE, 0);
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+ZipHandler::ZipFile::~ZipFile() = default;
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool ZipHandler::ZipFile::open()
 {
-  myStream.open(myFilename, fstream::in | fstream::binary);
-  if(!myStream.is_open())
+  myFile = make_unique<MappedFile>(myFilename);
+  if(!myFile->isValid())
   {
-    myLength = 0;
+    myFile.reset();
     return false;
   }
-  myStream.exceptions( std::ios_base::failbit | std::ios_base::badbit | std::ios_base::eofbit );
-  myStream.seekg(0, std::ios::end);
-  myLength = myStream.tellg();
-  myStream.seekg(0, std::ios::beg);
 
   return true;
 }
@@ -227,6 +264,9 @@ bool ZipHandler::ZipFile::open()
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void ZipHandler::ZipFile::initialize()
 {
+  myLength = myFile->size();
+  myModTime = fileStatus(myFilename).second;
+
   // Read ecd data
   readEcd();
 
@@ -235,64 +275,37 @@ void ZipHandler::ZipFile::initialize()
      myEcd.cdDiskEntries != myEcd.cdTotalEntries)
     throw runtime_error(errorMessage(ZipError::UNSUPPORTED));
 
-  // Allocate memory for the central directory
-  try        { myCd = make_unique<uInt8[]>(myEcd.cdSize + 1); }
-  catch(...) { throw runtime_error(errorMessage(ZipError::OUT_OF_MEMORY)); }
-
-  // Read the central directory
-  uInt64 read_length = 0;
-  const bool success = readStream(myCd, myEcd.cdStartDiskOffset, myEcd.cdSize, read_length);
-  if(!success)
-    throw runtime_error(errorMessage(ZipError::FILE_ERROR));
-  else if(read_length != myEcd.cdSize)
+  // Make sure the central directory is completely contained in the file
+  if(myEcd.cdStartDiskOffset + myEcd.cdSize > myLength)
     throw runtime_error(errorMessage(ZipError::FILE_TRUNCATED));
+
+  readCentralDirectory();
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void ZipHandler::ZipFile::close()
 {
-  if(myStream.is_open())
-    myStream.close();
+  myFile.reset();
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void ZipHandler::ZipFile::readEcd()
 {
-  uInt64 buflen = 1024;
-
-  // We may need multiple tries
-  while(buflen < 65536)
-  {
-    uInt64 read_length = 0;
-
-    // Max out the buf length at the size of the file
-    if(buflen > myLength)
-      buflen = myLength;
-
-    // Allocate buffer
-    const ByteBuffer buffer = make_unique<uInt8[]>(buflen + 1);
-    if(buffer == nullptr)
-      throw runtime_error(errorMessage(ZipError::OUT_OF_MEMORY));
+  // The ECD is at the end of the file, followed by a comment of at most 64K
+  const uInt64 buflen = std::min<uInt64>(myLength, 65536 + EcdReader::minimumLength());
+  if(buflen < EcdReader::minimumLength())
+    throw runtime_error(errorMessage(ZipError::BAD_SIGNATURE));
 
-    // Read in one buffers' worth of data
-    const bool success = readStream(buffer, myLength - buflen, buflen, read_length);
-    if(!success || read_length != buflen)
-      throw runtime_error(errorMessage(ZipError::FILE_ERROR));
+  const uInt8* const buffer = myFile->data() + myLength - buflen;
 
-    // Find the ECD signature
-    Int32 offset = 0;
-    for(offset = static_cast<Int32>(buflen - EcdReader::minimumLength()); offset >= 0; --offset)
-    {
-      const EcdReader reader(buffer.get() + offset);
-      if(reader.signatureCorrect() && ((reader.totalLength() + offset) <= buflen))
-        break;
-    }
-
-    // If we found it, fill out the data
-    if(offset >= 0)
+  // Find the ECD signature, searching backwards from the end
+  for(auto offset = static_cast<Int64>(buflen - EcdReader::minimumLength());
+      offset >= 0; --offset)
+  {
+    const EcdReader reader(buffer + offset);
+    if(reader.signatureCorrect() && ((reader.totalLength() + offset) <= buflen))
     {
       // Extract ECD info
-      const EcdReader reader(buffer.get() + offset);
       myEcd.diskNumber        = reader.thisDiskNo();
       myEcd.cdStartDiskNumber = reader.dirStartDisk();
       myEcd.cdDiskEntries     = reader.dirDiskEntries();
@@ -301,145 +314,174 @@ void ZipHandler::ZipFile::readEcd()
       myEcd.cdStartDiskOffset = reader.dirOffset();
       return;
     }
-
-    // Didn't find it; expand our search
-    if(buflen < myLength)
-      buflen *= 2;
-    else
-      throw runtime_error(errorMessage(ZipError::BAD_SIGNATURE));
   }
-  throw runtime_error(errorMessage(ZipError::OUT_OF_MEMORY));
+  throw runtime_error(errorMessage(ZipError::BAD_SIGNATURE));
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool ZipHandler::ZipFile::readStream(const ByteBuffer& out, uInt64 offset,
-                                     uInt64 length, uInt64& actual)
+void ZipHandler::ZipFile::readCentralDirectory()
 {
-  try
-  {
-    myStream.seekg(offset);
-    myStream.read(reinterpret_cast<char*>(out.get()), length);
+  const uInt8* const cd = myFile->data() + myEcd.cdStartDiskOffset;
 
-    actual = myStream.gcount();
-    return true;
-  }
-  catch(...)
+  myEntries.clear();
+  myEntries.reserve(myEcd.cdTotalEntries);
+
+  for(uInt64 pos = 0; pos < myEcd.cdSize; )
   {
-    return false;
+    // Make sure we have enough data
+    const CentralDirEntryReader reader(cd + pos);
+    if(pos + CentralDirEntryReader::minimumLength() > myEcd.cdSize ||
+       !reader.signatureCorrect() || ((pos + reader.totalLength()) > myEcd.cdSize))
+      throw runtime_error(errorMessage(ZipError::FILE_CORRUPT));
+
+    // Extract file header info
+    ZipHeader& header = myEntries.emplace_back();
+    header.versionCreated     = reader.versionCreated();
+    header.versionNeeded      = reader.versionNeeded();
+    header.bitFlag            = reader.generalFlag();
+    header.compression        = reader.compressionMethod();
+    header.crc                = reader.crc32();
+    header.compressedLength   = reader.compressedSize();
+    header.uncompressedLength = reader.uncompressedSize();
+    header.startDiskNumber    = reader.startDisk();
+    header.localHeaderOffset  = reader.headerOffset();
+    header.filename           = reader.filename();
+
+    // Advance the position
+    pos += reader.totalLength();
   }
+
+  // Index the entries by name, for quick lookup of single files
+  mySorted.resize(myEntries.size());
+  for(uInt32 i = 0; i < mySorted.size(); ++i)
+    mySorted[i] = i;
+  std::stable_sort(mySorted.begin(), mySorted.end(), [this](uInt32 a, uInt32 b) {
+    return BSPF::compareIgnoreCase(myEntries[a].filename, myEntries[b].filename) < 0;
+  });
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 const ZipHandler::ZipHeader* ZipHandler::ZipFile::nextFile()
 {
-  // Make sure we have enough data
-  // If we're at or past the end, we're done
-  const CentralDirEntryReader reader(myCd.get() + myCdPos);
-  if(!reader.signatureCorrect() || ((myCdPos + reader.totalLength()) > myEcd.cdSize))
+  if(myPos >= myEntries.size())
     return nullptr;
 
-  // Extract file header info
-  myHeader.versionCreated     = reader.versionCreated();
-  myHeader.versionNeeded      = reader.versionNeeded();
-  myHeader.bitFlag            = reader.generalFlag();
-  myHeader.compression        = reader.compressionMethod();
-  myHeader.crc                = reader.crc32();
-  myHeader.compressedLength   = reader.compressedSize();
-  myHeader.uncompressedLength = reader.uncompressedSize();
-  myHeader.startDiskNumber    = reader.startDisk();
-  myHeader.localHeaderOffset  = reader.headerOffset();
-  myHeader.filename           = reader.filename();
-
-  // Advance the position
-  myCdPos += reader.totalLength();
-  return &myHeader;
+  myHeader = &myEntries[myPos++];
+  return myHeader;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+std::vector<uInt32>::const_iterator
+ZipHandler::ZipFile::lowerBound(string_view name) const
+{
+  return std::lower_bound(mySorted.begin(), mySorted.end(), name,
+      [this](uInt32 entry, string_view value) {
+        return BSPF::compareIgnoreCase(myEntries[entry].filename, value) < 0;
+      });
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void ZipHandler::ZipFile::decompress(const ByteBuffer& out, uInt64 length)
 {
   // If we don't have enough buffer, error
-  if(length < myHeader.uncompressedLength)
+  if(length < myHeader->uncompressedLength)
     throw runtime_error(errorMessage(ZipError::BUFFER_TOO_SMALL));
 
   // Make sure the info in the header aligns with what we know
-  if(myHeader.startDiskNumber != myEcd.diskNumber)
+  if(myHeader->startDiskNumber != myEcd.diskNumber)
     throw runtime_error(errorMessage(ZipError::UNSUPPORTED));
 
-  // Get the compressed data offset
-  const uInt64 offset = getCompressedDataOffset();
+  // Map the file only for this call, and make sure it still is the one
+  // that was indexed
+  if(!open())
+    throw runtime_error(errorMessage(ZipError::FILE_ERROR));
+  if(myFile->size() != myLength || fileStatus(myFilename).second != myModTime)
+  {
+    close();
+    throw runtime_error(errorMessage(ZipError::FILE_CORRUPT));
+  }
 
-  // Handle compression types
-  switch(myHeader.compression)
+  try
   {
-    case 0:
-      decompressDataType0(offset, out, length);
-      break;
+    // Get the compressed data offset
+    const uInt64 offset = getCompressedDataOffset();
 
-    case 8:
-      decompressDataType8(offset, out, length);
-      break;
+    // Handle compression types
+    switch(myHeader->compression)
+    {
+      case 0:
+        decompressDataType0(offset, out, length);
+        break;
+
+      case 8:
+        decompressDataType8(offset, out, length);
+        break;
 
-    case 14:
-      // FIXME - LZMA format not yet supported
-      throw runtime_error(errorMessage(ZipError::LZMA_UNSUPPORTED));
+      case 14:
+        // FIXME - LZMA format not yet supported
+        throw runtime_error(errorMessage(ZipError::LZMA_UNSUPPORTED));
 
-    default:
-      throw runtime_error(errorMessage(ZipError::UNSUPPORTED));
+      default:
+        throw runtime_error(errorMessage(ZipError::UNSUPPORTED));
+    }
   }
+  catch(...)
+  {
+    close();
+    throw;
+  }
+  close();
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 uInt64 ZipHandler::ZipFile::getCompressedDataOffset()
 {
   // Don't support a number of features
-  const GeneralFlagReader flags(myHeader.bitFlag);
-  if(myHeader.startDiskNumber != myEcd.diskNumber ||
-     myHeader.versionNeeded > 63 || flags.patchData() ||
+  const GeneralFlagReader flags(myHeader->bitFlag);
+  if(myHeader->startDiskNumber != myEcd.diskNumber ||
+     myHeader->versionNeeded > 63 || flags.patchData() ||
      flags.encrypted() || flags.strongEncryption())
     throw runtime_error(errorMessage(ZipError::UNSUPPORTED));
 
-  // Read the fixed-sized part of the local file header
-  uInt64 read_length = 0;
-  const bool success = readStream(myBuffer, myHeader.localHeaderOffset, 0x1e, read_length);
-  if(!success)
-    throw runtime_error(errorMessage(ZipError::FILE_ERROR));
-  else if(read_length != LocalFileHeaderReader::minimumLength())
+  // Check the fixed-sized part of the local file header
+  if(myHeader->localHeaderOffset + LocalFileHeaderReader::minimumLength() > myLength)
     throw runtime_error(errorMessage(ZipError::FILE_TRUNCATED));
 
   // Compute the final offset
-  const LocalFileHeaderReader reader(&myBuffer[0]);
+  const LocalFileHeaderReader reader(myFile->data() + myHeader->localHeaderOffset);
   if(!reader.signatureCorrect())
     throw runtime_error(errorMessage(ZipError::BAD_SIGNATURE));
 
-  return myHeader.localHeaderOffset + reader.totalLength();
+  const uInt64 offset = myHeader->localHeaderOffset + reader.totalLength();
+  if(offset + myHeader->compressedLength > myLength)
+    throw runtime_error(errorMessage(ZipError::FILE_TRUNCATED));
+
+  return offset;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void ZipHandler::ZipFile::decompressDataType0(
     uInt64 offset, const ByteBuffer& out, uInt64 length)
 {
-  // The data is uncompressed; just read it
-  uInt64 read_length = 0;
-  const bool success = readStream(out, offset, myHeader.compressedLength, read_length);
-  if(!success)
-    throw runtime_error(errorMessage(ZipError::FILE_ERROR));
-  else if(read_length != myHeader.compressedLength)
-    throw runtime_error(errorMessage(ZipError::FILE_TRUNCATED));
+  // The data is uncompressed; just copy it from the mapped file
+  if(myHeader->compressedLength > length)
+    throw runtime_error(errorMessage(ZipError::BUFFER_TOO_SMALL));
+
+  std::copy_n(myFile->data() + offset, myHeader->compressedLength, out.get());
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void ZipHandler::ZipFile::decompressDataType8(
     uInt64 offset, const ByteBuffer& out, uInt64 length)
 {
-  uInt64 input_remaining = myHeader.compressedLength;
-
-  // Reset the stream
+  // Reset the stream; the complete compressed data is available in the
+  // mapped file, so it can be inflated in one go
   z_stream stream{};
   stream.zalloc = Z_NULL;
   stream.zfree = Z_NULL;
   stream.opaque = Z_NULL;
-  stream.avail_in = 0;
+  stream.next_in = const_cast<Bytef *>(myFile->data() + offset);
+  stream.avail_in = static_cast<uInt32>(myHeader->compressedLength);
   stream.next_out = reinterpret_cast<Bytef *>(out.get());
   stream.avail_out = static_cast<uInt32>(length);
 
@@ -448,45 +490,12 @@ void ZipHandler::ZipFile::decompressDataType8(
   if(zerr != Z_OK)
     throw runtime_error(errorMessage(ZipError::DECOMPRESS_ERROR));
 
-  // Loop until we're done
-  for(;;)
+  // Now inflate
+  zerr = inflate(&stream, Z_FINISH);
+  if(zerr != Z_STREAM_END)
   {
-    // Read in the next chunk of data
-    uInt64 read_length = 0;
-    const bool success = readStream(myBuffer, offset,
-          std::min(input_remaining, static_cast<uInt64>(sizeof(myBuffer.get()))), read_length);
-    if(!success)
-    {
-      inflateEnd(&stream);
-      throw runtime_error(errorMessage(ZipError::FILE_ERROR));
-    }
-    offset += read_length;
-
-    // If we read nothing, but still have data left, the file is truncated
-    if(read_length == 0 && input_remaining > 0)
-    {
-      inflateEnd(&stream);
-      throw runtime_error(errorMessage(ZipError::FILE_TRUNCATED));
-    }
-
-    // Fill out the input data
-    stream.next_in = myBuffer.get();
-    stream.avail_in = static_cast<uInt32>(read_length);
-    input_remaining -= read_length;
-
-    // Add a dummy byte at end of compressed data
-    if(input_remaining == 0)
-      stream.avail_in++;
-
-    // Now inflate
-    zerr = inflate(&stream, Z_NO_FLUSH);
-    if(zerr == Z_STREAM_END)
-      break;
-    else if(zerr != Z_OK)
-    {
-      inflateEnd(&stream);
-      throw runtime_error(errorMessage(ZipError::DECOMPRESS_ERROR));
-    }
+    inflateEnd(&stream);
+    throw runtime_error(errorMessage(ZipError::DECOMPRESS_ERROR));
   }
 
   // Finish decompression
@@ -495,7 +504,7 @@ void ZipHandler::ZipFile::decompressDataType8(
     throw runtime_error(errorMessage(ZipError::DECOMPRESS_ERROR));
 
   // If anything looks funny, report an error
-  if(stream.avail_out > 0 || input_remaining > 0)
+  if(stream.avail_out > 0)
     throw runtime_error(errorMessage(ZipError::DECOMPRESS_ERROR));
 }
 
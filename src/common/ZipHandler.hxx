@@ -24,10 +24,19 @@
 
 #include "bspf.hxx"
 
+class MappedFile;
+
 /**
   This class implements a thin wrapper around the zip file management code
   from the MAME project.
 
+  The central directory of an archive is indexed once, and the index is
+  cached.  The archive itself is memory-mapped only while it is indexed
+  and while a file is decompressed, and its size and modification time are
+  checked before each decompression.  If an archive is truncated by another
+  process during one of these short windows, accessing the mapping can
+  still raise SIGBUS (on POSIX systems) or an access violation (Windows).
+
   @author  Original code by Aaron Giles, ZipHandler wrapper class and heavy
            modifications/refactoring by Stephen Anthony.
 */
@@ -45,6 +54,14 @@ class ZipHandler
     bool hasNext() const;  // Answer whether there are more files present
     std::tuple<string, size_t> next();  // Get information on next file
 
+    // Select the file with the given name for decompression, and answer
+    // whether it exists
+    bool select(string_view name);
+
+    // Answer whether the name of any file starts with the given prefix
+    // (ignoring case)
+    bool hasPrefix(string_view prefix) const;
+
     // Decompress the currently selected file and return its length
     // An exception will be thrown on any errors
     uInt64 decompress(ByteBuffer& image);
@@ -100,39 +117,44 @@ class ZipHandler
     struct ZipFile
     {
       string  myFilename;     // copy of ZIP filename (for caching)
-      fstream myStream;       // C++ fstream file handle
+      unique_ptr<MappedFile> myFile;  // contents of the zip file, while mapped
       uInt64  myLength{0};    // length of zip file
+      uInt64  myModTime{0};   // modification time of zip file
       uInt16  myRomfiles{0};  // number of ROM files in central directory
 
       ZipEcd  myEcd;          // end of central directory
 
-      ByteBuffer myCd;        // central directory raw data
-      uInt64    myCdPos{0};   // position in central directory
-      ZipHeader myHeader;     // current file header
-
-      ByteBuffer myBuffer;    // buffer for decompression
+      // The central directory, parsed once when the file is first opened
+      std::vector<ZipHeader> myEntries;
+      std::vector<uInt32> mySorted;    // indices of 'myEntries', sorted by name
+      size_t myPos{0};                 // position in 'myEntries'
+      const ZipHeader* myHeader{nullptr};  // current file header
 
       /** Constructor */
       explicit ZipFile(const string& filename);
+      ~ZipFile();
 
-      /** Open the file and set up the internal stream buffer*/
+      /** Open (map) the file */
       bool open();
 
-      /** Read the ZIP contents from the internal stream buffer */
+      /** Read the ECD data and the central directory */
       void initialize();
 
-      /** Close previously opened internal stream buffer */
+      /** Close (unmap) the file */
       void close();
 
       /** Read the ECD data */
       void readEcd();
 
-      /** Read data from stream */
-      bool readStream(const ByteBuffer& out, uInt64 offset, uInt64 length, uInt64& actual);
+      /** Parse the central directory into 'myEntries' */
+      void readCentralDirectory();
 
       /** Return the next entry in the ZIP file */
       const ZipHeader* nextFile();
 
+      /** Return the first entry whose name is not less than 'name' (ignoring case) */
+      std::vector<uInt32>::const_iterator lowerBound(string_view name) const;
+
       /** Decompress the most recently found file in the ZIP into target buffer */
       void decompress(const ByteBuffer& out, uInt64 length);
 
@@ -299,7 +321,6 @@ class ZipHandler
     void addToCache();
 
   private:
-    static constexpr size_t DECOMPRESS_BUFSIZE = 128_KB;
     static constexpr size_t CACHE_SIZE = 64; // number of open files to cache
 
     ZipFilePtr myZip;
@@ -144,6 +144,22 @@ namespace BSPF
     #define FORCE_INLINE inline __attribute__((always_inline))
   #endif
 
+  // Functions marked with AVX2_TARGET may use AVX2 instructions regardless
+  // of the compiler flags, but must only be called when hasAVX2() is true
+  // (only supported by GCC and Clang on x86)
+  #if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+    #define AVX2_TARGET __attribute__((target("avx2")))
+
+    inline bool hasAVX2()
+    {
+      static const bool avx2 = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+      }();
+      return avx2;
+    }
+  #endif
+
   // Get next power of two greater than or equal to the given value
   inline constexpr size_t nextPowerOfTwo(size_t size) {
     if(size < 2) return 1;
@@ -10,13 +10,16 @@ MODULE_OBJS := \
 	src/common/FBBackendSDL2.o \
 	src/common/FBSurfaceSDL2.o \
 	src/common/FpsMeter.o \
+	src/common/FrameCapture.o \
 	src/common/FSNodeZIP.o \
 	src/common/HighScoresManager.o \
+	src/common/ImageCache.o \
 	src/common/JoyMap.o \
 	src/common/JPGLibrary.o \
 	src/common/KeyMap.o \
 	src/common/Logger.o \
 	src/common/main.o \
+	src/common/MappedFile.o \
 	src/common/MouseControl.o \
 	src/common/PaletteHandler.o \
 	src/common/PhosphorHandler.o \
@@ -63,6 +63,14 @@ void StellaDb::initialize()
     highscoreRepository->initialize();
     myHighscoreRepository = std::move(highscoreRepository);
 
+    auto romCatalogueRepository = make_unique<KeyValueRepositorySqlite>(*myDb, "rom_catalogue", "path", "entry");
+    romCatalogueRepository->initialize();
+    myRomCatalogueRepository = std::move(romCatalogueRepository);
+
+    auto romDetectionRepository = make_unique<KeyValueRepositorySqlite>(*myDb, "rom_detection", "md5", "entry");
+    romDetectionRepository->initialize();
+    myRomDetectionRepository = std::move(romDetectionRepository);
+
     myPropertyRepository = make_unique<CompositeKVRJsonAdapter>(*myPropertyRepositoryHost);
 
     if (myDb->getUserVersion() == 0) {
@@ -77,6 +85,8 @@ void StellaDb::initialize()
     mySettingsRepository = make_unique<KeyValueRepositoryNoop>();
     myPropertyRepository = make_unique<CompositeKeyValueRepositoryNoop>();
     myHighscoreRepository = make_unique<CompositeKeyValueRepositoryNoop>();
+    myRomCatalogueRepository = make_unique<KeyValueRepositoryNoop>();
+    myRomDetectionRepository = make_unique<KeyValueRepositoryNoop>();
 
     myDb.reset();
     myPropertyRepositoryHost.reset();
@@ -40,6 +40,12 @@ class StellaDb
     CompositeKeyValueRepositoryAtomic& highscoreRepository() const {
       return *myHighscoreRepository;
     }
+    KeyValueRepositoryAtomic& romCatalogueRepository() const {
+      return *myRomCatalogueRepository;
+    }
+    KeyValueRepositoryAtomic& romDetectionRepository() const {
+      return *myRomDetectionRepository;
+    }
 
     string databaseFileName() const;
 
@@ -63,6 +69,8 @@ class StellaDb
     unique_ptr<KeyValueRepositoryAtomic> myPropertyRepositoryHost;
     unique_ptr<CompositeKeyValueRepository> myPropertyRepository;
     unique_ptr<CompositeKeyValueRepositoryAtomic> myHighscoreRepository;
+    unique_ptr<KeyValueRepositoryAtomic> myRomCatalogueRepository;
+    unique_ptr<KeyValueRepositoryAtomic> myRomDetectionRepository;
 };
 
 #endif // STELLA_DB_HXX
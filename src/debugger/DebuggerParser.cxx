@@ -988,6 +988,36 @@ void DebuggerParser::executeBreakLabel()
   commandResult << " breakpoint at $" << Base::HEX4 << addr << " (no mirrors)";
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// "busStats"
+void DebuggerParser::executeBusStats()
+{
+  System& system = debugger.mySystem;
+
+  if(argCount == 0)
+  {
+    if(system.busStatisticsEnabled())
+    {
+      ostringstream buf;
+      system.printBusStatistics(buf);
+      string stats = buf.str();
+      stats.pop_back();  // remove the final newline
+      commandResult << stats;
+    }
+    else
+      commandResult << "bus statistics disabled, enable with 'busStats on'";
+  }
+  else if(argStrings[0] == "on" || argStrings[0] == "off")
+  {
+    const bool enable = argStrings[0] == "on";
+
+    system.enableBusStatistics(enable);
+    commandResult << "bus statistics " << (enable ? "enabled" : "disabled");
+  }
+  else
+    commandResult << red("invalid argument (must be 'on' or 'off')");
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 // "c"
 void DebuggerParser::executeC()
@@ -2851,6 +2881,18 @@ DebuggerParser::CommandArray DebuggerParser::commands = { {
     std::mem_fn(&DebuggerParser::executeBreakLabel)
   },
 
+  {
+    "busStats",
+    "Show bus access statistics, or turn them on/off",
+    "Counts accesses per device, page and cart address, plus bank switches\n"
+    "'on' (re)starts counting, 'off' stops it\n"
+    "Example: busStats on, busStats, busStats off",
+    false,
+    false,
+    { Parameters::ARG_LABEL, Parameters::ARG_END_ARGS },
+    std::mem_fn(&DebuggerParser::executeBusStats)
+  },
+
   {
     "c",
     "Carry Flag: set (0 or 1), or toggle (no arg)",
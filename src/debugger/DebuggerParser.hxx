@@ -101,7 +101,7 @@ class DebuggerParser
       std::array<Parameters, 10> parms;
       std::function<void (DebuggerParser*)> executor;
     };
-    using CommandArray = std::array<Command, 111>;
+    using CommandArray = std::array<Command, 112>;
     static CommandArray commands;
 
     struct Trap
@@ -159,6 +159,7 @@ class DebuggerParser
     void executeBreak();
     void executeBreakIf();
     void executeBreakLabel();
+    void executeBusStats();
     void executeC();
     void executeCheat();
     void executeClearBreaks();
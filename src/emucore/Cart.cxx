@@ -15,6 +15,10 @@
 // this file, and for a DISCLAIMER OF ALL WARRANTIES.
 //============================================================================
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
 #include "FSNode.hxx"
 #include "Settings.hxx"
 #include "System.hxx"
@@ -24,6 +28,7 @@
 #endif
 
 #include "Cart.hxx"
+#define MAPNAME "/CartRAM"
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 Cartridge::Cartridge(const Settings& settings, string_view md5)
@@ -227,6 +232,43 @@ void Cartridge::initializeRAM(uInt8* arr, size_t size, uInt8 val) const
     std::fill_n(arr, size, val);
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt8* Cartridge::createSharedRAM(size_t size)
+{
+  mySharedRAM.reset();
+
+  const size_t mapSize = sizeof(SharedRAMHeader) + size;
+  const int fd = shm_open(MAPNAME, O_CREAT | O_RDWR, S_IRUSR | S_IWUSR);
+  if(fd < 0)
+    throw runtime_error("Unable to create shared cartridge RAM");
+
+  void* map = ftruncate(fd, mapSize) == 0
+    ? mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)
+    : MAP_FAILED;
+  close(fd);
+  if(map == MAP_FAILED)
+  {
+    shm_unlink(MAPNAME);
+    throw runtime_error("Unable to map shared cartridge RAM");
+  }
+
+  mySharedRAM.reset(new(map) SharedRAMHeader);
+  mySharedRAM->size = static_cast<uInt32>(size);
+
+  // The segment may be left over from an earlier run
+  uInt8* ram = reinterpret_cast<uInt8*>(mySharedRAM.get() + 1);
+  std::fill_n(ram, size, 0);
+
+  return ram;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Cartridge::SharedRAMDeleter::operator()(SharedRAMHeader* header) const noexcept
+{
+  munmap(header, sizeof(SharedRAMHeader) + header->size);
+  shm_unlink(MAPNAME);
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 uInt16 Cartridge::initializeStartBank(uInt16 defaultBank)
 {
@@ -411,6 +411,32 @@ class Cartridge : public Device
     */
     virtual bool randomStartBank() const;
 
+    /**
+      Allocate the cartridge RAM in the shared memory segment "/CartRAM",
+      where external readers can observe it live, like the RIOT RAM in
+      "/M6532RAM".  The segment starts with a SharedRAMHeader (which also
+      holds the current bank, see updateSharedBank()), followed by the RAM.
+      It is unmapped and unlinked when the cartridge is destroyed.
+
+      @param size  The size of the RAM to allocate
+      @return  Pointer to the zero-filled RAM
+    */
+    uInt8* createSharedRAM(size_t size);
+
+    template<size_t N>
+    std::array<uInt8, N>& createSharedRAM() {
+      return *reinterpret_cast<std::array<uInt8, N>*>(createSharedRAM(N));
+    }
+
+    /**
+      Publish the current bank in the shared RAM segment (if any).
+
+      @param bank  The bank to publish
+    */
+    void updateSharedBank(uInt16 bank) {
+      if(mySharedRAM) mySharedRAM->bank = bank;
+    }
+
   protected:
     // Settings class for the application
     const Settings& mySettings;
@@ -464,6 +490,17 @@ class Cartridge : public Device
     // access.
     ShortArray myRamReadAccesses;
 
+    // Start of the shared RAM segment, the RAM follows directly
+    struct SharedRAMHeader {
+      uInt32 size{0};      // size of the RAM in bytes
+      uInt16 bank{0};      // current bank
+      uInt16 reserved{0};
+    };
+    struct SharedRAMDeleter {
+      void operator()(SharedRAMHeader* header) const noexcept;
+    };
+    std::unique_ptr<SharedRAMHeader, SharedRAMDeleter> mySharedRAM;
+
     // Following constructors and assignment operators not supported
     Cartridge() = delete;
     Cartridge(const Cartridge&) = delete;
@@ -111,6 +111,16 @@ uInt8 CartridgeAR::peek(uInt16 addr)
     return myImage[(addr & 0x07FF) + myImageOffset[1]];
   }
 
+  // Is one of the "dummy" SC BIOS hotspots for an instant load being
+  // accessed? ($FA00 for the initial load, $FA03 for multi-loads)
+  if(((addr & 0x1FFF) == 0x1A00 || (addr & 0x1FFF) == 0x1A03) &&
+     (myImageOffset[1] == RAM_SIZE))
+  {
+    instantLoadIntoRAM(mySystem->peek(0x0080), (addr & 0x1FFF) == 0x1A03);
+
+    return myImage[(addr & 0x07FF) + myImageOffset[1]];
+  }
+
   // Cancel any pending write if more than 5 distinct accesses have occurred
   // TODO: Modify to handle when the distinct counter wraps around...
   if(myWritePending &&
@@ -272,12 +282,30 @@ void CartridgeAR::initializeROM()
   // SC BIOS code - a value placed in offset 281 will be stored in A
   ourDummyROMCode[281] = mySystem->randGenerator().next();
 
+  // For instant loads, the multiload and initial load entry points jump to
+  // $FA03 resp. $FA00 instead of clearing page 7 resp. reading the load
+  // at $F850
+  const bool instantLoad = mySettings.getBool("instantscload");
+  ourDummyROMCode[5]  = instantLoad ? 0x03 : 0x18;
+  ourDummyROMCode[6]  = instantLoad ? 0xFA : 0xF8;
+  ourDummyROMCode[22] = instantLoad ? 0x00 : 0x50;
+  ourDummyROMCode[23] = instantLoad ? 0xFA : 0xF8;
+
   // Initialize ROM with illegal 6502 opcode that causes a real 6502 to jam
   std::fill_n(myImage.begin() + (RAM_SIZE), BANK_SIZE, 0x02);
 
   // Copy the "dummy" Supercharger BIOS code into the ROM area
   std::copy_n(ourDummyROMCode.data(), ourDummyROMCode.size(), myImage.data() + (RAM_SIZE));
 
+  // The instant load hotspots at $FA00 and $FA03 are followed by a jump to
+  // the code at $F913, which starts the load (see instantLoadIntoRAM)
+  for(const uInt16 offset: {0x200, 0x203})
+  {
+    myImage[(RAM_SIZE) + offset + 0] = 0x4C;
+    myImage[(RAM_SIZE) + offset + 1] = 0x13;
+    myImage[(RAM_SIZE) + offset + 2] = 0xF9;
+  }
+
   // Finally set 6502 vectors to point to initial load code at 0xF80A of BIOS
   myImage[(RAM_SIZE) + BANK_SIZE - 4] = 0x0A;
   myImage[(RAM_SIZE) + BANK_SIZE - 3] = 0xF8;
@@ -353,6 +381,44 @@ void CartridgeAR::loadIntoRAM(uInt8 load)
   cerr << "ERROR: Supercharger load is missing from ROM image...\n";
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void CartridgeAR::instantLoadIntoRAM(uInt8 load, bool multiload)
+{
+  // Do everything the "dummy" SC BIOS does around reading a load, except
+  // for its last few instructions at $F913, which switch to the load's
+  // bank configuration and jump to its start address
+
+  // Clear page 7 of RAM bank 0 like the real SC (multi-loads only)
+  if(multiload)
+    std::fill_n(myImage.begin() + 0x0700, 256, 0);
+
+  loadIntoRAM(load);
+
+  // Copy the code for switching banks and starting the load into page zero
+  mySystem->poke(0xfa, 0xcd);  // CMP $fff8
+  mySystem->poke(0xfb, 0xf8);
+  mySystem->poke(0xfc, 0xff);
+  mySystem->poke(0xfd, 0x4c);  // JMP $????
+
+  // Clear some of the 2600's RAM and TIA registers like the real SC BIOS does
+  for(uInt16 addr = 0x04; addr <= 0x2c; ++addr)
+    mySystem->poke(addr, 0);
+  for(uInt16 addr = 0x81; addr <= 0x9d; ++addr)
+    mySystem->poke(addr, 0);
+
+  // Unless they are skipped (see initializeROM), the progress bars leave some
+  // TIA registers set (PF0 - PF2 end up cleared again). Only the player
+  // positions, which the bars reset with RESP0/RESP1, differ from the BIOS.
+  if(myImage[(RAM_SIZE) + 109] != 0xFF)
+  {
+    mySystem->poke(0x01, 0x02);  // VBLANK
+    mySystem->poke(0x0a, 0x05);  // CTRLPF
+    mySystem->poke(0x15, 0x0c);  // AUDC0
+    mySystem->poke(0x17, 0x0a);  // AUDF0
+    mySystem->poke(0x21, 0x10);  // HMP1
+  }
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool CartridgeAR::bank(uInt16 bank, uInt16)
 {
@@ -189,6 +189,10 @@ class CartridgeAR : public Cartridge
     // Load the specified load into SC RAM
     void loadIntoRAM(uInt8 load);
 
+    // Load the specified load into SC RAM and do the setup of the SC BIOS
+    // (for the initial load or a multi-load)
+    void instantLoadIntoRAM(uInt8 load, bool multiload);
+
     // Sets up a "dummy" BIOS ROM in the ROM bank of the cartridge
     void initializeROM();
 
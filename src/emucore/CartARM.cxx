@@ -23,6 +23,7 @@
 CartridgeARM::CartridgeARM(const Settings& settings, string_view md5)
   : Cartridge(settings, md5)
 {
+  setClockRate(NTSC_CLOCK_RATE);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -56,19 +57,25 @@ void CartridgeARM::consoleChanged(ConsoleTiming timing)
 {
   myThumbEmulator->setConsoleTiming(timing);
 
-  constexpr double NTSC  = 1193191.66666667;  // NTSC  6507 clock rate
-  constexpr double PAL   = 1182298;           // PAL   6507 clock rate
-  constexpr double SECAM = 1187500;           // SECAM 6507 clock rate
-
   switch(timing)
   {
-    case ConsoleTiming::ntsc:   myClockRate = NTSC;   break;
-    case ConsoleTiming::pal:    myClockRate = PAL;    break;
-    case ConsoleTiming::secam:  myClockRate = SECAM;  break;
+    case ConsoleTiming::ntsc:   setClockRate(NTSC_CLOCK_RATE);   break;
+    case ConsoleTiming::pal:    setClockRate(PAL_CLOCK_RATE);    break;
+    case ConsoleTiming::secam:  setClockRate(SECAM_CLOCK_RATE);  break;
     default:  break;  // satisfy compiler
   }
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void CartridgeARM::setClockRate(double rate)
+{
+  myClockRate = rate;
+
+  // Must be calculated exactly like in musicClocks()
+  for(uInt32 cycles = 0; cycles < MUSIC_CLOCKS_CACHED; ++cycles)
+    myMusicClocks[cycles] = (20000.0 * cycles) / myClockRate;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void CartridgeARM::updateCycles(int cycles)
 {
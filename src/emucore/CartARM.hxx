@@ -71,6 +71,35 @@ class CartridgeARM : public Cartridge
     */
     virtual void setInitialState();
 
+    /**
+      Get the number of music data fetcher clocks (20 KHz) which have passed
+      in the given number of 6507 cycles.  The fractional part is carried
+      over to the next call.
+
+      @param cycles  The number of 6507 cycles since the last call
+      @return  The number of whole music data fetcher clocks
+    */
+    uInt32 musicClocks(uInt32 cycles)
+    {
+      // Usually only a few cycles pass between two updates (e.g. one
+      // scanline); the clocks for these are looked up instead of divided,
+      // which gives exactly the same value
+      const double clocks = (cycles < MUSIC_CLOCKS_CACHED
+                             ? myMusicClocks[cycles]
+                             : (20000.0 * cycles) / myClockRate)
+                            + myFractionalClocks;
+      const auto wholeClocks = static_cast<uInt32>(clocks);
+      myFractionalClocks = clocks - static_cast<double>(wholeClocks);
+      return wholeClocks;
+    }
+
+    /**
+      Get and set the fractional music data fetcher clocks carried over
+      (e.g. for the state files).
+    */
+    double musicClockFraction() const { return myFractionalClocks; }
+    void setMusicClockFraction(double fraction) { myFractionalClocks = fraction; }
+
     void enableCycleCount(bool enable) const { myThumbEmulator->enableCycleCount(enable); }
     // Get number of memory accesses of last and last but one ARM runs.
     void updateCycles(int cycles);
@@ -112,7 +141,14 @@ class CartridgeARM : public Cartridge
     bool myIncCycles{false};
 
     // Console clock rate
-    double myClockRate{1193191.66666667};
+    double myClockRate{0.0};
+
+    // Music data fetcher clocks for up to MUSIC_CLOCKS_CACHED - 1 cycles
+    static constexpr uInt32 MUSIC_CLOCKS_CACHED = 512;
+    std::array<double, MUSIC_CLOCKS_CACHED> myMusicClocks{};
+
+    // Fractional music data fetcher clocks unused during the last update
+    double myFractionalClocks{0.0};
   #ifdef DEBUGGER_SUPPORT
     Thumbulator::Stats myStats{0};
     Thumbulator::Stats myPrevStats{0};
@@ -121,6 +157,20 @@ class CartridgeARM : public Cartridge
   #endif
 
   private:
+    /**
+      Set the console clock rate, and precalculate the music data fetcher
+      clocks for it.
+
+      @param rate  The 6507 clock rate in Hz
+    */
+    void setClockRate(double rate);
+
+  private:
+    // 6507 clock rates
+    static constexpr double NTSC_CLOCK_RATE  = 1193191.66666667;
+    static constexpr double PAL_CLOCK_RATE   = 1182298;
+    static constexpr double SECAM_CLOCK_RATE = 1187500;
+
     // Following constructors and assignment operators not supported
     CartridgeARM() = delete;
     CartridgeARM(const CartridgeARM&) = delete;
@@ -137,7 +137,7 @@ void CartridgeBUS::reset()
 
   // Update cycles to the current system cycles
   myAudioCycles = myARMCycles = 0;
-  myFractionalClocks = 0.0;
+  setMusicClockFraction(0.0);
 
   setInitialState();
 
@@ -195,9 +195,7 @@ inline void CartridgeBUS::updateMusicModeDataFetchers()
   myAudioCycles = mySystem->cycles();
 
   // Calculate the number of BUS OSC clocks since the last update
-  const double clocks = ((20000.0 * cycles) / myClockRate) + myFractionalClocks;
-  const auto wholeClocks = static_cast<uInt32>(clocks);
-  myFractionalClocks = clocks - static_cast<double>(wholeClocks);
+  const uInt32 wholeClocks = musicClocks(cycles);
 
   // Let's update counters and flags of the music mode data fetchers
   if(wholeClocks > 0)
@@ -567,9 +565,9 @@ bool CartridgeBUS::poke(uInt16 address, uInt8 value)
 
         case 0x1c:  // BUSSTUFF
           if (value==0)
-            myMode = 0;     // lower nybble 0 = STUFFON in BUS3
+            setMode(0);     // lower nybble 0 = STUFFON in BUS3
           else
-            myMode = 0x0f;  // lower nybble f = STUFFOFF in BUS3
+            setMode(0x0f);  // lower nybble f = STUFFOFF in BUS3
           break;
 
         case 0x20: case 0x21: case 0x22: case 0x23:
@@ -709,7 +707,7 @@ bool CartridgeBUS::poke(uInt16 address, uInt8 value)
           break;
 
         case 0xFF2: // SETMODE
-          myMode = value;
+          setMode(value);
           break;
 
         case 0xFF3: // CALLFN
@@ -766,9 +764,9 @@ bool CartridgeBUS::poke(uInt16 address, uInt8 value)
 
           case 0x09:  // 0x19 turn on STY ZP bus stuffing if value is 0
             if (value==0)
-              myMode = 0;     // lower nybble 0 = STUFFON in BUS3
+              setMode(0);     // lower nybble 0 = STUFFON in BUS3
             else
-              myMode = 0x0f;  // lower nybble f = STUFFOFF in BUS3
+              setMode(0x0f);  // lower nybble f = STUFFOFF in BUS3
             break;
 
           case 0x0A:  // 0x1A CALLFUNCTION
@@ -794,17 +792,49 @@ bool CartridgeBUS::bank(uInt16 bank, uInt16)
   myBankOffset = bank << 12;
 
   // Setup the page access methods for the current bank
+  mapProgramPages();
+  updateSharedBank(bank);
+
+  return myBankChanged = true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void CartridgeBUS::mapProgramPages()
+{
   System::PageAccess access(this, System::PageAccessType::READ);
 
+  // Without bus stuffing and fast jump, reading the ROM has no side effects,
+  // except in the last page (bankswitching, BUS3 and PlusROM hotspots)
+  const bool directPeek = !BUS_STUFF_ON(myMode);
+  constexpr uInt16 hotspotPage = 0x1FF0 & ~System::PAGE_MASK;
+
   // Map Program ROM image into the system
   for(uInt16 addr = 0x1040; addr < 0x2000; addr += System::PAGE_SIZE)
   {
-    access.romAccessBase = &myRomAccessBase[myBankOffset + (addr & 0x0FFF)];
-    access.romPeekCounter = &myRomAccessCounter[myBankOffset + (addr & 0x0FFF)];
-    access.romPokeCounter = &myRomAccessCounter[myBankOffset + (addr & 0x0FFF) + 28_KB];
+    const uInt32 offset = myBankOffset + (addr & 0x0FFF);
+
+    access.directPeekBase = directPeek && addr != hotspotPage
+        ? &myProgramImage[offset] : nullptr;
+    access.romAccessBase = &myRomAccessBase[offset];
+    access.romPeekCounter = &myRomAccessCounter[offset];
+    access.romPokeCounter = &myRomAccessCounter[offset + 28_KB];
     mySystem->setPageAccess(addr, access);
   }
-  return myBankChanged = true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void CartridgeBUS::setMode(uInt8 mode)
+{
+  const bool remap = BUS_STUFF_ON(myMode) != BUS_STUFF_ON(mode);
+
+  myMode = mode;
+  if(remap)
+  {
+    // Direct peeks don't reset the STY and fast jump operand detection,
+    // so do it here (the peeks of this poke's operands would do it too)
+    mySTYZeroPageAddress = myJMPoperandAddress = 0;
+    mapProgramPages();
+  }
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -927,7 +957,7 @@ bool CartridgeBUS::save(Serializer& out) const
 
     // Save cycles and clocks
     out.putLong(myAudioCycles);
-    out.putDouble(myFractionalClocks);
+    out.putDouble(musicClockFraction());
     out.putLong(myARMCycles);
 
     // Audio info
@@ -970,7 +1000,7 @@ bool CartridgeBUS::load(Serializer& in)
 
     // Get system cycles and fractional clocks
     myAudioCycles = in.getLong();
-    myFractionalClocks = in.getDouble();
+    setMusicClockFraction(in.getDouble());
     myARMCycles = in.getLong();
 
     // Audio info
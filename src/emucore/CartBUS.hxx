@@ -215,6 +215,18 @@ class CartridgeBUS : public CartridgeARM
     */
     void callFunction(uInt8 value);
 
+    /**
+      Change the mode (SETMODE or STUFFMODE), and remap the program ROM if
+      bus stuffing has been switched on or off.
+    */
+    void setMode(uInt8 mode);
+
+    /**
+      Map the program ROM of the current bank into the system.  Pages are
+      read directly when bus stuffing is off, except for the hotspot page.
+    */
+    void mapProgramPages();
+
     uInt32 getDatastreamPointer(uInt8 index) const;
     void setDatastreamPointer(uInt8 index, uInt32 value);
 
@@ -249,7 +261,7 @@ class CartridgeBUS : public CartridgeARM
     //   $0000 - 2K BUS driver
     //   $0800 - 4K Display Data
     //   $1800 - 2K C Variable & Stack
-    std::array<uInt8, 8_KB> myRAM;
+    std::array<uInt8, 8_KB>& myRAM{createSharedRAM<8_KB>()};
 
     // Indicates the offset into the ROM image (aligns to current bank)
     uInt16 myBankOffset{0};
@@ -291,9 +303,6 @@ class CartridgeBUS : public CartridgeARM
     // The music waveform sizes
     std::array<uInt8, 3> myMusicWaveformSize{0};
 
-    // Fractional DPC music OSC clocks unused during the last update
-    double myFractionalClocks{0.0};
-
     // Controls mode, lower nybble sets Fast Fetch, upper nybble sets audio
     // -0 = Bus Stuffing ON
     // -F = Bus Stuffing OFF
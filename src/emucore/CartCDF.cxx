@@ -120,7 +120,7 @@ void CartridgeCDF::reset()
   initializeStartBank(isCDFJplus() ? 0 : 6);
 
   myAudioCycles = myARMCycles = 0;
-  myFractionalClocks = 0.0;
+  setMusicClockFraction(0.0);
 
   setInitialState();
 
@@ -171,9 +171,7 @@ FORCE_INLINE void CartridgeCDF::updateMusicModeDataFetchers()
   myAudioCycles = mySystem->cycles();
 
   // Calculate the number of CDF OSC clocks since the last update
-  const double clocks = ((20000.0 * cycles) / myClockRate) + myFractionalClocks;
-  const auto wholeClocks = static_cast<uInt32>(clocks);
-  myFractionalClocks = clocks - static_cast<double>(wholeClocks);
+  const uInt32 wholeClocks = musicClocks(cycles);
 
   // Let's update counters and flags of the music mode data fetchers
   if(wholeClocks > 0)
@@ -407,7 +405,7 @@ bool CartridgeCDF::poke(uInt16 address, uInt8 value)
       break;
 
     case 0x0FF2:   // SETMODE
-      myMode = value;
+      setMode(value);
       break;
 
     case 0x0FF3:   // CALLFN
@@ -462,17 +460,50 @@ bool CartridgeCDF::bank(uInt16 bank, uInt16)
   myBankOffset = bank << 12;
 
   // Setup the page access methods for the current bank
+  mapProgramPages();
+  updateSharedBank(bank);
+
+  return myBankChanged = true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void CartridgeCDF::mapProgramPages()
+{
   System::PageAccess access(this, System::PageAccessType::READ);
 
+  // Without fast fetch and fast jump, reading the ROM has no side effects,
+  // except in the last page (bankswitching and PlusROM hotspots)
+  const bool directPeek = !FAST_FETCH_ON(myMode);
+  constexpr uInt16 hotspotPage = 0x1FF0 & ~System::PAGE_MASK;
+
   // Map Program ROM image into the system
   for(uInt16 addr = 0x1040; addr < 0x2000; addr += System::PAGE_SIZE)
   {
-    access.romAccessBase = &myRomAccessBase[myBankOffset + (addr & 0x0FFF)];
-    access.romPeekCounter = &myRomAccessCounter[myBankOffset + (addr & 0x0FFF)];
-    access.romPokeCounter = &myRomAccessCounter[myBankOffset + (addr & 0x0FFF) + 28_KB];  // TODO: Change for CDFJ+???
+    const uInt32 offset = myBankOffset + (addr & 0x0FFF);
+
+    access.directPeekBase = directPeek && addr != hotspotPage
+        ? &myProgramImage[offset] : nullptr;
+    access.romAccessBase = &myRomAccessBase[offset];
+    access.romPeekCounter = &myRomAccessCounter[offset];
+    access.romPokeCounter = &myRomAccessCounter[offset + 28_KB];  // TODO: Change for CDFJ+???
     mySystem->setPageAccess(addr, access);
   }
-  return myBankChanged = true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void CartridgeCDF::setMode(uInt8 mode)
+{
+  const bool remap = FAST_FETCH_ON(myMode) != FAST_FETCH_ON(mode);
+
+  myMode = mode;
+  if(remap)
+  {
+    // Direct peeks don't reset the fast fetch/jump operand detection,
+    // so do it here (the peeks of this poke's operands would do it too)
+    myJMPoperandAddress = 0;
+    myLDAXYimmediateOperandAddress = LDAXY_OVERRIDE_INACTIVE;
+    mapProgramPages();
+  }
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -578,7 +609,7 @@ bool CartridgeCDF::save(Serializer& out) const
 
     // Save cycles and clocks
     out.putLong(myAudioCycles);
-    out.putDouble(myFractionalClocks);
+    out.putDouble(musicClockFraction());
     out.putLong(myARMCycles);
 
     CartridgeARM::save(out);
@@ -620,7 +651,7 @@ bool CartridgeCDF::load(Serializer& in)
 
     // Get cycles and clocks
     myAudioCycles = in.getLong();
-    myFractionalClocks = in.getDouble();
+    setMusicClockFraction(in.getDouble());
     myARMCycles = in.getLong();
 
     CartridgeARM::load(in);
@@ -248,6 +248,18 @@ class CartridgeCDF : public CartridgeARM
     */
     void callFunction(uInt8 value);
 
+    /**
+      Change the mode (SETMODE), and remap the program ROM if fast fetch
+      mode has been switched on or off.
+    */
+    void setMode(uInt8 mode);
+
+    /**
+      Map the program ROM of the current bank into the system.  Pages are
+      read directly when fast fetch mode is off, except for the hotspot page.
+    */
+    void mapProgramPages();
+
     uInt32 getDatastreamPointer(uInt8 index) const;
     void setDatastreamPointer(uInt8 index, uInt32 value);
 
@@ -296,7 +308,7 @@ class CartridgeCDF : public CartridgeARM
     // For CDFJ+, used as:
     //   $0000 - 2K Driver
     //   $0800 - Display Data, C Variables & Stack
-    std::array<uInt8, 32_KB> myRAM;
+    std::array<uInt8, 32_KB>& myRAM{createSharedRAM<32_KB>()};
 
     // Indicates the offset into the ROM image (aligns to current bank)
     uInt16 myBankOffset{0};
@@ -332,9 +344,6 @@ class CartridgeCDF : public CartridgeARM
     // The music waveform sizes
     std::array<uInt8, 3> myMusicWaveformSize{0};
 
-    // Fractional CDF music, OSC clocks unused during the last update
-    double myFractionalClocks{0.0};
-
     // Controls mode, lower nybble sets Fast Fetch, upper nybble sets audio
     // -0 = Fast Fetch ON
     // -F = Fast Fetch OFF
@@ -53,10 +53,10 @@ void CartridgeCV::reset()
   if(myInitialRAM != nullptr)
   {
     // Copy the RAM image into my buffer
-    std::copy_n(myInitialRAM.get(), 1_KB, myRAM.get());
+    std::copy_n(myInitialRAM.get(), 1_KB, myRAM);
   }
   else
-    initializeRAM(myRAM.get(), myRamSize);
+    initializeRAM(myRAM, myRamSize);
 
   myBankChanged = true;
 }
@@ -125,7 +125,7 @@ void CartridgeDPCPlus::setInitialState()
   // Initialize various other parameters
   myFastFetch = myLDAimmediate = false;
   myAudioCycles = myARMCycles = 0;
-  myFractionalClocks = 0.0;
+  setMusicClockFraction(0.0);
 
   CartridgeARM::setInitialState();
 }
@@ -169,9 +169,7 @@ FORCE_INLINE void CartridgeDPCPlus::updateMusicModeDataFetchers()
   myAudioCycles = mySystem->cycles();
 
   // Calculate the number of DPC+ OSC clocks since the last update
-  const double clocks = ((20000.0 * cycles) / myClockRate) + myFractionalClocks;
-  const auto wholeClocks = static_cast<uInt32>(clocks);
-  myFractionalClocks = clocks - static_cast<double>(wholeClocks);
+  const uInt32 wholeClocks = musicClocks(cycles);
 
   // Let's update counters and flags of the music mode data fetchers
   if(wholeClocks > 0)
@@ -472,7 +470,7 @@ bool CartridgeDPCPlus::poke(uInt16 address, uInt8 value)
         switch (index)
         {
           case 0x00:  // FASTFETCH - turns on LDA #<DFxDATA mode of value is 0
-            myFastFetch = (value == 0);
+            setFastFetch(value == 0);
             break;
 
           case 0x01:  // PARAMETER - set parameter used by CALLFUNCTION (not all functions use the parameter)
@@ -621,17 +619,47 @@ bool CartridgeDPCPlus::bank(uInt16 bank, uInt16)
   myBankOffset = bank << 12;
 
   // Setup the page access methods for the current bank
+  mapProgramPages();
+  updateSharedBank(bank);
+
+  return myBankChanged = true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void CartridgeDPCPlus::mapProgramPages()
+{
   System::PageAccess access(this, System::PageAccessType::READ);
 
+  // Without fast fetch, reading the ROM has no side effects, except in the
+  // last page (bankswitching and PlusROM hotspots)
+  const bool directPeek = !myFastFetch;
+  constexpr uInt16 hotspotPage = 0x1FF0 & ~System::PAGE_MASK;
+
   // Map Program ROM image into the system
   for(uInt16 addr = 0x1080; addr < 0x2000; addr += System::PAGE_SIZE)
   {
-    access.romAccessBase = &myRomAccessBase[myBankOffset + (addr & 0x0FFF)];
-    access.romPeekCounter = &myRomAccessCounter[myBankOffset + (addr & 0x0FFF)];
-    access.romPokeCounter = &myRomAccessCounter[myBankOffset + (addr & 0x0FFF) + 24_KB];
+    const uInt32 offset = myBankOffset + (addr & 0x0FFF);
+
+    access.directPeekBase = directPeek && addr != hotspotPage
+        ? &myProgramImage[offset] : nullptr;
+    access.romAccessBase = &myRomAccessBase[offset];
+    access.romPeekCounter = &myRomAccessCounter[offset];
+    access.romPokeCounter = &myRomAccessCounter[offset + 24_KB];
     mySystem->setPageAccess(addr, access);
   }
-  return myBankChanged = true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void CartridgeDPCPlus::setFastFetch(bool enable)
+{
+  if(myFastFetch != enable)
+  {
+    myFastFetch = enable;
+    // Direct peeks don't reset the LDA # detection, so do it here
+    // (the peeks of this poke's operands would do it too)
+    myLDAimmediate = false;
+    mapProgramPages();
+  }
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -724,7 +752,7 @@ bool CartridgeDPCPlus::save(Serializer& out) const
 
     // Get system cycles and fractional clocks
     out.putLong(myAudioCycles);
-    out.putDouble(myFractionalClocks);
+    out.putDouble(musicClockFraction());
 
     // Clock info for Thumbulator
     out.putLong(myARMCycles);
@@ -787,7 +815,7 @@ bool CartridgeDPCPlus::load(Serializer& in)
 
     // Get audio cycles and fractional clocks
     myAudioCycles = in.getLong();
-    myFractionalClocks = in.getDouble();
+    setMusicClockFraction(in.getDouble());
 
     // Clock info for Thumbulator
     myARMCycles = in.getLong();
@@ -220,6 +220,18 @@ class CartridgeDPCPlus : public CartridgeARM
     */
     void callFunction(uInt8 value);
 
+    /**
+      Switch fast fetch mode on or off, and remap the program ROM
+      accordingly.
+    */
+    void setFastFetch(bool enable);
+
+    /**
+      Map the program ROM of the current bank into the system.  Pages are
+      read directly when fast fetch mode is off, except for the hotspot page.
+    */
+    void mapProgramPages();
+
   private:
     // The ROM image and size
     ByteBuffer myImage;
@@ -235,7 +247,7 @@ class CartridgeDPCPlus : public CartridgeARM
     //   3K DPC+ driver
     //   4K Display Data
     //   1K Frequency Data
-    std::array<uInt8, 8_KB> myDPCRAM;
+    std::array<uInt8, 8_KB>& myDPCRAM{createSharedRAM<8_KB>()};
 
     // Pointer to the 1K frequency table
     uInt8* myFrequencyImage{nullptr};
@@ -285,9 +297,6 @@ class CartridgeDPCPlus : public CartridgeARM
     // System cycle count when the last Thumbulator::run() occurred
     uInt64 myARMCycles{0};
 
-    // Fractional DPC music OSC clocks unused during the last update
-    double myFractionalClocks{0.0};
-
     // Indicates the offset into the ROM image (aligns to current bank)
     uInt16 myBankOffset{0};
 
@@ -15,21 +15,214 @@
 // this file, and for a DISCLAIMER OF ALL WARRANTIES.
 //============================================================================
 
+#include <bitset>
+
 #include "bspf.hxx"
 #include "Logger.hxx"
 
 #include "CartDetector.hxx"
 #include "CartMVC.hxx"
 
+namespace {
+  // All signatures which are searched for in the complete ROM image
+  enum Sig: uInt8 {
+    STA_1FF9, STA_FFF9,                                     // F8
+    ORA_3E0_ORA, LDA_3E0_ORA,                               // 03E0
+    LDA_0800, LDA_0840, BIT_0800, NOP_0800_JMP, NOP_0FFF_JMP,  // 0840
+    BIT_FC0, STA_FC0, LDA_FC0, BIT_EFC0,                    // 0FA0
+    STA_3E, STA_3F,                                         // 3E, 3F
+    STR_3EX, STR_TJ3E,                                      // 3EX, 3E+
+    STR_BUS, STR_CDF, STR_PLUSCDFJ, STR_LENIN, STR_DPCPLUS, // ARM, CTY
+    STA_F3FF_X, STA_F400_Y,                                 // CV
+    STA_1FE0, STA_5FE0, STA_FFE9, NOP_1FE0, LDA_1FE0,       // E0
+    LDA_FFE9, LDA_FFED, LDA_BFF3,
+    LDA_FFE2, LDA_FFE5, LDA_1FE5, LDA_1FE7, NOP_1FE7,       // E7
+    STA_FFE7, STA_1FE7,
+    LDA_FFE4, LDA_FFE6,                                     // E78K
+    NOP_FFE0, LDA_FFE0,                                     // EF
+    FC_POWER_PLAY, FC_SURFS_UP, FC_3D_HAVOC,                // FC
+    FE_DECATHLON, FE_ROBOT_TANK, FE_SPACE_SHUTTLE,          // FE
+    FE_SPACE_SHUTTLE_SECAM, FE_THWOCKER,
+    LDA_FFF1_RTS,                                           // JANE
+    LDA_0CB8,                                               // GL
+    LDA_0800_X,                                             // SB
+    TVBOY_STA_JMP,                                          // TV Boy
+    STA_240, LDA_240, LDA_21F_X, BIT_2C0, STA_2C0, LDA_2C0, // UA
+    LDA_39_JMP,                                             // WD
+    LDA_080D, LDA_081D, LDA_082D, NOP_080D, NOP_081D, NOP_082D,  // X07
+    NUM_SIGS
+  };
+
+  struct Signature {
+    uInt8 size{0};
+    std::array<uInt8, 8> bytes{};
+  };
+
+  constexpr std::array<Signature, NUM_SIGS> SIGNATURES = [] {
+    std::array<Signature, NUM_SIGS> s{};
+    const auto add = [&s](Sig id, std::initializer_list<uInt8> bytes) {
+      s[id].size = static_cast<uInt8>(bytes.size());
+      std::copy(bytes.begin(), bytes.end(), s[id].bytes.begin());
+    };
+
+    add(STA_1FF9,      { 0x8D, 0xF9, 0x1F });  // STA $1FF9
+    add(STA_FFF9,      { 0x8D, 0xF9, 0xFF });  // STA $FFF9
+    add(ORA_3E0_ORA,   { 0x0D, 0xE0, 0x03, 0x0D });  // ORA $3E0, ORA (Popeye)
+    add(LDA_3E0_ORA,   { 0xAD, 0xE0, 0x03, 0xAD });  // LDA $3E0, ORA (Montezuma's Revenge)
+    add(LDA_0800,      { 0xAD, 0x00, 0x08 });  // LDA $0800
+    add(LDA_0840,      { 0xAD, 0x40, 0x08 });  // LDA $0840
+    add(BIT_0800,      { 0x2C, 0x00, 0x08 });  // BIT $0800
+    add(NOP_0800_JMP,  { 0x0C, 0x00, 0x08, 0x4C });  // NOP $0800; JMP ...
+    add(NOP_0FFF_JMP,  { 0x0C, 0xFF, 0x0F, 0x4C });  // NOP $0FFF; JMP ...
+    add(BIT_FC0,       { 0x2C, 0xC0, 0x0F });  // BIT $FC0  (H.E.R.O., Kung-Fu Master)
+    add(STA_FC0,       { 0x8D, 0xC0, 0x0F });  // STA $FC0  (Pole Position, Subterranea)
+    add(LDA_FC0,       { 0xAD, 0xC0, 0x0F });  // LDA $FC0  (Front Line, Zaxxon)
+    add(BIT_EFC0,      { 0x2C, 0xC0, 0xEF });  // BIT $EFC0 (Motocross)
+    add(STA_3E,        { 0x85, 0x3E });  // STA $3E
+    add(STA_3F,        { 0x85, 0x3F });  // STA $3F
+    add(STR_3EX,       { '3', 'E', 'X' });
+    add(STR_TJ3E,      { 'T', 'J', '3', 'E' });
+    add(STR_BUS,       { 'B', 'U', 'S' });
+    add(STR_CDF,       { 'C', 'D', 'F' });
+    add(STR_PLUSCDFJ,  { 'P', 'L', 'U', 'S', 'C', 'D', 'F', 'J' });
+    add(STR_LENIN,     { 'L', 'E', 'N', 'I', 'N' });
+    add(STR_DPCPLUS,   { 'D', 'P', 'C', '+' });
+    add(STA_F3FF_X,    { 0x9D, 0xFF, 0xF3 });  // STA $F3FF,X  MagiCard
+    add(STA_F400_Y,    { 0x99, 0x00, 0xF4 });  // STA $F400,Y  Video Life
+    add(STA_1FE0,      { 0x8D, 0xE0, 0x1F });  // STA $1FE0
+    add(STA_5FE0,      { 0x8D, 0xE0, 0x5F });  // STA $5FE0
+    add(STA_FFE9,      { 0x8D, 0xE9, 0xFF });  // STA $FFE9
+    add(NOP_1FE0,      { 0x0C, 0xE0, 0x1F });  // NOP $1FE0
+    add(LDA_1FE0,      { 0xAD, 0xE0, 0x1F });  // LDA $1FE0
+    add(LDA_FFE9,      { 0xAD, 0xE9, 0xFF });  // LDA $FFE9
+    add(LDA_FFED,      { 0xAD, 0xED, 0xFF });  // LDA $FFED
+    add(LDA_BFF3,      { 0xAD, 0xF3, 0xBF });  // LDA $BFF3
+    add(LDA_FFE2,      { 0xAD, 0xE2, 0xFF });  // LDA $FFE2
+    add(LDA_FFE5,      { 0xAD, 0xE5, 0xFF });  // LDA $FFE5
+    add(LDA_1FE5,      { 0xAD, 0xE5, 0x1F });  // LDA $1FE5
+    add(LDA_1FE7,      { 0xAD, 0xE7, 0x1F });  // LDA $1FE7
+    add(NOP_1FE7,      { 0x0C, 0xE7, 0x1F });  // NOP $1FE7
+    add(STA_FFE7,      { 0x8D, 0xE7, 0xFF });  // STA $FFE7
+    add(STA_1FE7,      { 0x8D, 0xE7, 0x1F });  // STA $1FE7
+    add(LDA_FFE4,      { 0xAD, 0xE4, 0xFF });  // LDA $FFE4
+    add(LDA_FFE6,      { 0xAD, 0xE6, 0xFF });  // LDA $FFE6
+    add(NOP_FFE0,      { 0x0C, 0xE0, 0xFF });  // NOP $FFE0
+    add(LDA_FFE0,      { 0xAD, 0xE0, 0xFF });  // LDA $FFE0
+    // STA $1FF8, LSR, LSR, STA... Power Play Arcade Menus, 3-D Ghost Attack
+    add(FC_POWER_PLAY, { 0x8d, 0xf8, 0x1f, 0x4a, 0x4a, 0x8d });
+    // STA $FFF8, STA $FFFC        Surf's Up (4K)
+    add(FC_SURFS_UP,   { 0x8d, 0xf8, 0xff, 0x8d, 0xfc, 0xff });
+    // STY $FFF9, LDA $FFFC        3-D Havoc
+    add(FC_3D_HAVOC,   { 0x8c, 0xf9, 0xff, 0xad, 0xfc, 0xff });
+    add(FE_DECATHLON,  { 0x20, 0x00, 0xD0, 0xC6, 0xC5 });  // JSR $D000; DEC $C5  Decathlon
+    add(FE_ROBOT_TANK, { 0x20, 0xC3, 0xF8, 0xA5, 0x82 });  // JSR $F8C3; LDA $82  Robot Tank
+    add(FE_SPACE_SHUTTLE,
+                       { 0xD0, 0xFB, 0x20, 0x73, 0xFE });  // BNE $FB; JSR $FE73  Space Shuttle (NTSC/PAL)
+    add(FE_SPACE_SHUTTLE_SECAM,
+                       { 0xD0, 0xFB, 0x20, 0x68, 0xFE });  // BNE $FB; JSR $FE73  Space Shuttle (SECAM)
+    add(FE_THWOCKER,   { 0x20, 0x00, 0xF0, 0x84, 0xD6 });  // JSR $F000; $84, $D6 Thwocker
+    add(LDA_FFF1_RTS,  { 0xad, 0xf1, 0xff, 0x60 });  // LDA $FFF1; RTS
+    add(LDA_0CB8,      { 0xad, 0xb8, 0x0c });  // LDA $0CB8
+    add(LDA_0800_X,    { 0xBD, 0x00, 0x08 });  // LDA $0800,x
+    add(TVBOY_STA_JMP, { 0x91, 0x82, 0x6c, 0xfc, 0xff });  // STA ($82),Y; JMP ($FFFC)
+    add(STA_240,       { 0x8D, 0x40, 0x02 });  // STA $240 (Funky Fish, Pleiades)
+    add(LDA_240,       { 0xAD, 0x40, 0x02 });  // LDA $240 (???)
+    add(LDA_21F_X,     { 0xBD, 0x1F, 0x02 });  // LDA $21F,X (Gingerbread Man)
+    add(BIT_2C0,       { 0x2C, 0xC0, 0x02 });  // BIT $2C0 (Time Pilot)
+    add(STA_2C0,       { 0x8D, 0xC0, 0x02 });  // STA $2C0 (Fathom, Vanguard)
+    add(LDA_2C0,       { 0xAD, 0xC0, 0x02 });  // LDA $2C0 (Mickey)
+    add(LDA_39_JMP,    { 0xA5, 0x39, 0x4C });  // LDA $39, JMP
+    add(LDA_080D,      { 0xAD, 0x0D, 0x08 });  // LDA $080D
+    add(LDA_081D,      { 0xAD, 0x1D, 0x08 });  // LDA $081D
+    add(LDA_082D,      { 0xAD, 0x2D, 0x08 });  // LDA $082D
+    add(NOP_080D,      { 0x0C, 0x0D, 0x08 });  // NOP $080D
+    add(NOP_081D,      { 0x0C, 0x1D, 0x08 });  // NOP $081D
+    add(NOP_082D,      { 0x0C, 0x2D, 0x08 });  // NOP $082D
+
+    return s;
+  }();
+
+  // The scan relies on every signature being defined, and at least two
+  // bytes long
+  static_assert(std::all_of(SIGNATURES.begin(), SIGNATURES.end(),
+      [](const Signature& sig) { return sig.size >= 2; }));
+
+  // The signatures indexed by their first byte, plus a filter of all
+  // signature prefixes, which rejects most image positions with one lookup
+  struct SignatureIndex {
+    std::bitset<65536> prefixes;
+    std::array<std::vector<uInt8>, 256> candidates;
+
+    SignatureIndex() {
+      for(uInt8 id = 0; id < NUM_SIGS; ++id)
+      {
+        const auto& bytes = SIGNATURES[id].bytes;
+        prefixes.set(bytes[0] | (bytes[1] << 8));
+        candidates[bytes[0]].push_back(id);
+      }
+    }
+  };
+} // namespace
+
+class CartDetector::SignatureScan
+{
+  public:
+    SignatureScan(const ByteBuffer& image, size_t size);
+
+    /**
+      Answer whether the signature was found at least 'minhits' times,
+      using the same rules as searchForBytes()
+    */
+    bool found(Sig sig, uInt32 minhits = 1) const {
+      return myHits[sig] >= minhits;
+    }
+
+  private:
+    std::array<uInt32, NUM_SIGS> myHits{};
+};
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+CartDetector::SignatureScan::SignatureScan(const ByteBuffer& image, size_t size)
+{
+  static const SignatureIndex index;
+
+  // The first position at which the next hit of each signature may start;
+  // like searchForBytes(), hits must not overlap or touch each other
+  std::array<size_t, NUM_SIGS> next{};
+  const uInt8* data = image.get();
+
+  for(size_t i = 0; i + 1 < size; ++i)
+  {
+    if(!index.prefixes[data[i] | (data[i + 1] << 8)])
+      continue;
+
+    for(const uInt8 id: index.candidates[data[i]])
+    {
+      const Signature& sig = SIGNATURES[id];
+
+      // searchForBytes() never checks the last possible position
+      if(i >= next[id] && i + sig.size < size &&
+         std::memcmp(data + i, sig.bytes.data(), sig.size) == 0)
+      {
+        ++myHits[id];
+        next[id] = i + sig.size + 1;
+      }
+    }
+  }
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 Bankswitch::Type CartDetector::autodetectType(const ByteBuffer& image, size_t size)
 {
+  // Search for all signatures at once
+  const SignatureScan scan(image, size);
+
   // Guess type based on size
   Bankswitch::Type type = Bankswitch::Type::_AUTO;
 
   if((size % 8448) == 0 || size == 6_KB)
   {
-    if(size == 6_KB && isProbablyGL(image, size))
+    if(size == 6_KB && isProbablyGL(scan))
       type = Bankswitch::Type::_GL;
     else
       type = Bankswitch::Type::_AR;
@@ -37,17 +230,17 @@ Bankswitch::Type CartDetector::autodetectType(const ByteBuffer& image, size_t si
   else if((size <= 2_KB) ||
           (size == 4_KB && std::memcmp(image.get(), image.get() + 2_KB, 2_KB) == 0))
   {
-    type = isProbablyCV(image, size) ? Bankswitch::Type::_CV : Bankswitch::Type::_2K;
+    type = isProbablyCV(scan) ? Bankswitch::Type::_CV : Bankswitch::Type::_2K;
   }
   else if(size == 4_KB)
   {
-    if(isProbablyCV(image, size))
+    if(isProbablyCV(scan))
       type = Bankswitch::Type::_CV;
     else if(isProbably4KSC(image, size))
       type = Bankswitch::Type::_4KSC;
-    else if (isProbablyFC(image, size))
+    else if (isProbablyFC(scan))
       type = Bankswitch::Type::_FC;
-    else if (isProbablyGL(image, size))
+    else if (isProbablyGL(scan))
       type = Bankswitch::Type::_GL;
     else
       type = Bankswitch::Type::_4K;
@@ -55,40 +248,35 @@ Bankswitch::Type CartDetector::autodetectType(const ByteBuffer& image, size_t si
   else if(size == 8_KB)
   {
     // First check for *potential* F8
-    static constexpr uInt8 signature[2][3] = {
-      { 0x8D, 0xF9, 0x1F },  // STA $1FF9
-      { 0x8D, 0xF9, 0xFF }   // STA $FFF9
-    };
-    const bool f8 = searchForBytes(image, size, signature[0], 3, 2) ||
-                    searchForBytes(image, size, signature[1], 3, 2);
+    const bool f8 = scan.found(STA_1FF9, 2) || scan.found(STA_FFF9, 2);
 
     if(isProbablySC(image, size))
       type = Bankswitch::Type::_F8SC;
     else if(std::memcmp(image.get(), image.get() + 4_KB, 4_KB) == 0)
       type = Bankswitch::Type::_4K;
-    else if(isProbablyE0(image, size))
+    else if(isProbablyE0(scan))
       type = Bankswitch::Type::_E0;
-    else if(isProbably3EX(image, size))
+    else if(isProbably3EX(scan))
       type = Bankswitch::Type::_3EX;
-    else if(isProbably3E(image, size))
+    else if(isProbably3E(scan))
       type = Bankswitch::Type::_3E;
-    else if(isProbably3F(image, size))
+    else if(isProbably3F(scan))
       type = Bankswitch::Type::_3F;
-    else if(isProbablyUA(image, size))
+    else if(isProbablyUA(scan))
       type = Bankswitch::Type::_UA;
-    else if(isProbably0FA0(image, size))
+    else if(isProbably0FA0(scan))
       type = Bankswitch::Type::_0FA0;
-    else if(isProbablyFE(image, size) && !f8)
+    else if(isProbablyFE(scan) && !f8)
       type = Bankswitch::Type::_FE;
-    else if(isProbably0840(image, size))
+    else if(isProbably0840(scan))
       type = Bankswitch::Type::_0840;
-    else if(isProbablyE78K(image, size))
+    else if(isProbablyE78K(scan))
       type = Bankswitch::Type::_E7;
-    else if (isProbablyWD(image,size))
+    else if (isProbablyWD(scan))
       type = Bankswitch::Type::_WD;
-    else if (isProbablyFC(image, size))
+    else if (isProbablyFC(scan))
       type = Bankswitch::Type::_FC;
-    else if(isProbably03E0(image, size))
+    else if(isProbably03E0(scan))
       type = Bankswitch::Type::_03E0;
     else
       type = Bankswitch::Type::_F8;
@@ -103,7 +291,7 @@ Bankswitch::Type CartDetector::autodetectType(const ByteBuffer& image, size_t si
   }
   else if(size == 12_KB)
   {
-    if(isProbablyE7(image, size))
+    if(isProbablyE7(scan))
       type = Bankswitch::Type::_E7;
     else
       type = Bankswitch::Type::_FA;
@@ -112,19 +300,19 @@ Bankswitch::Type CartDetector::autodetectType(const ByteBuffer& image, size_t si
   {
     if (isProbablySC(image, size))
       type = Bankswitch::Type::_F6SC;
-    else if (isProbablyE7(image, size))
+    else if (isProbablyE7(scan))
       type = Bankswitch::Type::_E7;
-    else if (isProbablyFC(image, size))
+    else if (isProbablyFC(scan))
       type = Bankswitch::Type::_FC;
-    else if (isProbably3EX(image, size))
+    else if (isProbably3EX(scan))
       type = Bankswitch::Type::_3EX;
-    else if (isProbably3E(image, size))
+    else if (isProbably3E(scan))
       type = Bankswitch::Type::_3E;
   /* no known 16K 3F ROMS
-    else if(isProbably3F(image, size))
+    else if(isProbably3F(scan))
       type = Bankswitch::Type::_3F;
   */
-    else if (isProbablyJANE(image, size))
+    else if (isProbablyJANE(scan))
       type = Bankswitch::Type::_JANE;
     else
       type = Bankswitch::Type::_F6;
@@ -137,117 +325,117 @@ Bankswitch::Type CartDetector::autodetectType(const ByteBuffer& image, size_t si
   {
     if(isProbablyARM(image, size))
       type = Bankswitch::Type::_FA2;
-    else /*if(isProbablyDPCplus(image, size))*/
+    else /*if(isProbablyDPCplus(scan))*/
       type = Bankswitch::Type::_DPCP;
   }
   else if(size == 32_KB)
   {
-    if (isProbablyCTY(image, size))
+    if (isProbablyCTY(scan))
       type = Bankswitch::Type::_CTY;
-    else if(isProbablyCDF(image, size))
+    else if(isProbablyCDF(scan))
       type = Bankswitch::Type::_CDF;
-    else if(isProbablyDPCplus(image, size))
+    else if(isProbablyDPCplus(scan))
       type = Bankswitch::Type::_DPCP;
     else if(isProbablySC(image, size))
       type = Bankswitch::Type::_F4SC;
-    else if(isProbably3EX(image, size))
+    else if(isProbably3EX(scan))
       type = Bankswitch::Type::_3EX;
-    else if(isProbably3E(image, size))
+    else if(isProbably3E(scan))
       type = Bankswitch::Type::_3E;
-    else if(isProbably3F(image, size))
+    else if(isProbably3F(scan))
       type = Bankswitch::Type::_3F;
-    else if (isProbablyBUS(image, size))
+    else if (isProbablyBUS(scan))
       type = Bankswitch::Type::_BUS;
     else if(isProbablyFA2(image, size))
       type = Bankswitch::Type::_FA2;
-    else if (isProbablyFC(image, size))
+    else if (isProbablyFC(scan))
       type = Bankswitch::Type::_FC;
     else
       type = Bankswitch::Type::_F4;
   }
   else if(size == 60_KB)
   {
-    if(isProbablyCTY(image, size))
+    if(isProbablyCTY(scan))
       type = Bankswitch::Type::_CTY;
     else
       type = Bankswitch::Type::_F4;
   }
   else if(size == 64_KB)
   {
-    if (isProbablyCDF(image, size))
+    if (isProbablyCDF(scan))
       type = Bankswitch::Type::_CDF;
-    else if(isProbably3EX(image, size))
+    else if(isProbably3EX(scan))
       type = Bankswitch::Type::_3EX;
-    else if(isProbably3E(image, size))
+    else if(isProbably3E(scan))
       type = Bankswitch::Type::_3E;
-    else if(isProbably3F(image, size))
+    else if(isProbably3F(scan))
       type = Bankswitch::Type::_3F;
     else if(isProbably4A50(image, size))
       type = Bankswitch::Type::_4A50;
-    else if(isProbablyEF(image, size, type))
+    else if(isProbablyEF(image, size, scan, type))
       ; // type has been set directly in the function
-    else if(isProbablyX07(image, size))
+    else if(isProbablyX07(scan))
       type = Bankswitch::Type::_X07;
     else
       type = Bankswitch::Type::_F0;
   }
   else if(size == 128_KB)
   {
-    if (isProbablyCDF(image, size))
+    if (isProbablyCDF(scan))
       type = Bankswitch::Type::_CDF;
-    else if(isProbably3EX(image, size))
+    else if(isProbably3EX(scan))
       type = Bankswitch::Type::_3EX;
-    else if(isProbably3E(image, size))
+    else if(isProbably3E(scan))
       type = Bankswitch::Type::_3E;
     else if(isProbablyDF(image, size, type))
       ; // type has been set directly in the function
-    else if(isProbably3F(image, size))
+    else if(isProbably3F(scan))
       type = Bankswitch::Type::_3F;
     else if(isProbably4A50(image, size))
       type = Bankswitch::Type::_4A50;
-    else /*if(isProbablySB(image, size))*/
+    else /*if(isProbablySB(scan))*/
       type = Bankswitch::Type::_SB;
   }
   else if(size == 256_KB)
   {
-    if (isProbablyCDF(image, size))
+    if (isProbablyCDF(scan))
       type = Bankswitch::Type::_CDF;
-    else if(isProbably3EX(image, size))
+    else if(isProbably3EX(scan))
       type = Bankswitch::Type::_3EX;
-    else if(isProbably3E(image, size))
+    else if(isProbably3E(scan))
       type = Bankswitch::Type::_3E;
     else if(isProbablyBF(image, size, type))
       ; // type has been set directly in the function
-    else if(isProbably3F(image, size))
+    else if(isProbably3F(scan))
       type = Bankswitch::Type::_3F;
-    else /*if(isProbablySB(image, size))*/
+    else /*if(isProbablySB(scan))*/
       type = Bankswitch::Type::_SB;
   }
   else if(size == 512_KB)
   {
-    if(isProbablyTVBoy(image, size))
+    if(isProbablyTVBoy(scan))
       type = Bankswitch::Type::_TVBOY;
-    else if (isProbablyCDF(image, size))
+    else if (isProbablyCDF(scan))
       type = Bankswitch::Type::_CDF;
-    else if(isProbably3EX(image, size))
+    else if(isProbably3EX(scan))
       type = Bankswitch::Type::_3EX;
-    else if(isProbably3E(image, size))
+    else if(isProbably3E(scan))
       type = Bankswitch::Type::_3E;
-    else if(isProbably3F(image, size))
+    else if(isProbably3F(scan))
       type = Bankswitch::Type::_3F;
   }
   else  // what else can we do?
   {
-    if(isProbably3EX(image, size))
+    if(isProbably3EX(scan))
       type = Bankswitch::Type::_3EX;
-    else if(isProbably3E(image, size))
+    else if(isProbably3E(scan))
       type = Bankswitch::Type::_3E;
-    else if(isProbably3F(image, size))
+    else if(isProbably3F(scan))
       type = Bankswitch::Type::_3F;
   }
 
   // Variable sized ROM formats are independent of image size and come last
-  if(isProbably3EPlus(image, size))
+  if(isProbably3EPlus(scan))
     type = Bankswitch::Type::_3EP;
   else if(isProbablyMDM(image, size))
     type = Bankswitch::Type::_MDM;
@@ -325,105 +513,66 @@ bool CartDetector::isProbablyARM(const ByteBuffer& image, size_t size)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbably03E0(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbably03E0(const SignatureScan& scan)
 {
   // 03E0 cart bankswitching for Brazilian Parker Bros ROMs, switches segment
   // 0 into bank 0 by accessing address 0x3E0 using 'LDA $3E0' or 'ORA $3E0'.
-  static constexpr uInt8 signature[2][4] = {
-    { 0x0D, 0xE0, 0x03, 0x0D },  // ORA $3E0, ORA (Popeye)
-    { 0xAD, 0xE0, 0x03, 0xAD }   // LDA $3E0, ORA (Montezuma's Revenge)
-  };
-  for(const auto* const sig: signature)
-    if(searchForBytes(image, size, sig, 4))
-      return true;
-
-  return false;
+  return scan.found(ORA_3E0_ORA) || scan.found(LDA_3E0_ORA);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbably0840(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbably0840(const SignatureScan& scan)
 {
   // 0840 cart bankswitching is triggered by accessing addresses 0x0800
   // or 0x0840 at least twice
-  static constexpr uInt8 signature1[3][3] = {
-    { 0xAD, 0x00, 0x08 },  // LDA $0800
-    { 0xAD, 0x40, 0x08 },  // LDA $0840
-    { 0x2C, 0x00, 0x08 }   // BIT $0800
-  };
-  for(const auto* const sig: signature1)
-    if(searchForBytes(image, size, sig, 3, 2))
-      return true;
-
-  static constexpr uInt8 signature2[2][4] = {
-    { 0x0C, 0x00, 0x08, 0x4C },  // NOP $0800; JMP ...
-    { 0x0C, 0xFF, 0x0F, 0x4C }   // NOP $0FFF; JMP ...
-  };
-  for(const auto* const sig: signature2)
-    if(searchForBytes(image, size, sig, 4, 2))
-      return true;
-
-  return false;
+  return scan.found(LDA_0800, 2) || scan.found(LDA_0840, 2) ||
+         scan.found(BIT_0800, 2) ||
+         scan.found(NOP_0800_JMP, 2) || scan.found(NOP_0FFF_JMP, 2);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbably0FA0(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbably0FA0(const SignatureScan& scan)
 {
   // Other Brazilian (Fotomania) ROM's bankswitching switches to bank 1 by
   // accessing address 0xFC0 using 'BIT $FC0', 'BIT $FC0' or 'STA $FC0'
   // Also a game (Motocross) using 'BIT $EFC0' has been found
-  static constexpr uInt8 signature[4][3] = {
-    { 0x2C, 0xC0, 0x0F },  // BIT $FC0  (H.E.R.O., Kung-Fu Master)
-    { 0x8D, 0xC0, 0x0F },  // STA $FC0  (Pole Position, Subterranea)
-    { 0xAD, 0xC0, 0x0F },  // LDA $FC0  (Front Line, Zaxxon)
-    { 0x2C, 0xC0, 0xEF }   // BIT $EFC0 (Motocross)
-  };
-  for(const auto* const sig: signature)
-    if(searchForBytes(image, size, sig, 3))
-      return true;
-
-  return false;
+  return scan.found(BIT_FC0) || scan.found(STA_FC0) ||
+         scan.found(LDA_FC0) || scan.found(BIT_EFC0);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbably3E(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbably3E(const SignatureScan& scan)
 {
   // 3E cart RAM bankswitching is triggered by storing the bank number
   // in address 3E using 'STA $3E', ROM bankswitching is triggered by
   // storing the bank number in address 3F using 'STA $3F'.
   // We expect the latter will be present at least 2 times, since there
   // are at least two banks
-
-  static constexpr uInt8 signature1[] = { 0x85, 0x3E };  // STA $3E
-  static constexpr uInt8 signature2[] = { 0x85, 0x3F };  // STA $3F
-  return searchForBytes(image, size, signature1, 2)
-    && searchForBytes(image, size, signature2, 2, 2);
+  return scan.found(STA_3E) && scan.found(STA_3F, 2);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbably3EX(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbably3EX(const SignatureScan& scan)
 {
   // 3EX cart have at least 2 occurrences of the string "3EX"
-  static constexpr uInt8 _3EX[] = { '3', 'E', 'X' };
-  return searchForBytes(image, size, _3EX, 3, 2);
+  return scan.found(STR_3EX, 2);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbably3EPlus(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbably3EPlus(const SignatureScan& scan)
 {
   // 3E+ cart is identified key 'TJ3E' in the ROM
-  static constexpr uInt8 tj3e[] = { 'T', 'J', '3', 'E' };
-  return searchForBytes(image, size, tj3e, 4);
+  return scan.found(STR_TJ3E);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbably3F(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbably3F(const SignatureScan& scan)
 {
   // 3F cart bankswitching is triggered by storing the bank number
   // in address 3F using 'STA $3F'
   // We expect it will be present at least 2 times, since there are
   // at least two banks
-  static constexpr uInt8 signature[] = { 0x85, 0x3F };  // STA $3F
-  return searchForBytes(image, size, signature, 2, 2);
+  return scan.found(STA_3F, 2);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -480,47 +629,35 @@ bool CartDetector::isProbablyBF(const ByteBuffer& image, size_t size,
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyBUS(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyBUS(const SignatureScan& scan)
 {
   // BUS ARM code has 2 occurrences of the string BUS
   // Note: all Harmony/Melody custom drivers also contain the value
   // 0x10adab1e (LOADABLE) if needed for future improvement
-  static constexpr uInt8 bus[] = { 'B', 'U', 'S' };
-  return searchForBytes(image, size, bus, 3, 2);
+  return scan.found(STR_BUS, 2);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyCDF(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyCDF(const SignatureScan& scan)
 {
   // CDF ARM code has 3 occurrences of the string CDF
   // Note: all Harmony/Melody custom drivers also contain the value
   // 0x10adab1e (LOADABLE) if needed for future improvement
-  static constexpr uInt8 cdf[] = { 'C', 'D', 'F' };
-  static constexpr uInt8 cdfjplus[] = { 'P', 'L', 'U', 'S', 'C', 'D', 'F', 'J' };
-  return (searchForBytes(image, size, cdf, 3, 3) ||
-          searchForBytes(image, size, cdfjplus, 8, 1));
+  return scan.found(STR_CDF, 3) || scan.found(STR_PLUSCDFJ);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyCTY(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyCTY(const SignatureScan& scan)
 {
-  static constexpr uInt8 lenin[] = { 'L', 'E', 'N', 'I', 'N' };
-  return searchForBytes(image, size, lenin, 5);
+  return scan.found(STR_LENIN);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyCV(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyCV(const SignatureScan& scan)
 {
   // CV RAM access occurs at addresses $f3ff and $f400
   // These signatures are attributed to the MESS project
-  static constexpr uInt8 signature[2][3] = {
-    { 0x9D, 0xFF, 0xF3 },  // STA $F3FF,X  MagiCard
-    { 0x99, 0x00, 0xF4 }   // STA $F400,Y  Video Life
-  };
-  if(searchForBytes(image, size, signature[0], 3))
-    return true;
-  else
-    return searchForBytes(image, size, signature[1], 3);
+  return scan.found(STA_F3FF_X) || scan.found(STA_F400_Y);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -547,17 +684,16 @@ bool CartDetector::isProbablyDF(const ByteBuffer& image, size_t size,
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyDPCplus(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyDPCplus(const SignatureScan& scan)
 {
   // DPC+ ARM code has 2 occurrences of the string DPC+
   // Note: all Harmony/Melody custom drivers also contain the value
   // 0x10adab1e (LOADABLE) if needed for future improvement
-  static constexpr uInt8 dpcp[] = { 'D', 'P', 'C', '+' };
-  return searchForBytes(image, size, dpcp, 4, 2);
+  return scan.found(STR_DPCPLUS, 2);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyE0(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyE0(const SignatureScan& scan)
 {
   // E0 cart bankswitching is triggered by accessing addresses
   // $FE0 to $FF9 using absolute non-indexed addressing
@@ -565,25 +701,14 @@ bool CartDetector::isProbablyE0(const ByteBuffer& image, size_t size)
   // search for only certain known signatures
   // Thanks to "stella@casperkitty.com" for this advice
   // These signatures are attributed to the MESS project
-  static constexpr uInt8 signature[8][3] = {
-    { 0x8D, 0xE0, 0x1F },  // STA $1FE0
-    { 0x8D, 0xE0, 0x5F },  // STA $5FE0
-    { 0x8D, 0xE9, 0xFF },  // STA $FFE9
-    { 0x0C, 0xE0, 0x1F },  // NOP $1FE0
-    { 0xAD, 0xE0, 0x1F },  // LDA $1FE0
-    { 0xAD, 0xE9, 0xFF },  // LDA $FFE9
-    { 0xAD, 0xED, 0xFF },  // LDA $FFED
-    { 0xAD, 0xF3, 0xBF }   // LDA $BFF3
-  };
-  for(const auto* const sig: signature)
-    if(searchForBytes(image, size, sig, 3))
-      return true;
-
-  return false;
+  return scan.found(STA_1FE0) || scan.found(STA_5FE0) ||
+         scan.found(STA_FFE9) || scan.found(NOP_1FE0) ||
+         scan.found(LDA_1FE0) || scan.found(LDA_FFE9) ||
+         scan.found(LDA_FFED) || scan.found(LDA_BFF3);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyE7(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyE7(const SignatureScan& scan)
 {
   // E7 cart bankswitching is triggered by accessing addresses
   // $FE0 to $FE6 using absolute non-indexed addressing
@@ -591,44 +716,25 @@ bool CartDetector::isProbablyE7(const ByteBuffer& image, size_t size)
   // search for only certain known signatures
   // Thanks to "stella@casperkitty.com" for this advice
   // These signatures are attributed to the MESS project
-  static constexpr uInt8 signature[7][3] = {
-    { 0xAD, 0xE2, 0xFF },  // LDA $FFE2
-    { 0xAD, 0xE5, 0xFF },  // LDA $FFE5
-    { 0xAD, 0xE5, 0x1F },  // LDA $1FE5
-    { 0xAD, 0xE7, 0x1F },  // LDA $1FE7
-    { 0x0C, 0xE7, 0x1F },  // NOP $1FE7
-    { 0x8D, 0xE7, 0xFF },  // STA $FFE7
-    { 0x8D, 0xE7, 0x1F }   // STA $1FE7
-  };
-  for(const auto* const sig: signature)
-    if(searchForBytes(image, size, sig, 3))
-      return true;
-
-  return false;
+  return scan.found(LDA_FFE2) || scan.found(LDA_FFE5) ||
+         scan.found(LDA_1FE5) || scan.found(LDA_1FE7) ||
+         scan.found(NOP_1FE7) || scan.found(STA_FFE7) ||
+         scan.found(STA_1FE7);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyE78K(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyE78K(const SignatureScan& scan)
 {
   // E78K cart bankswitching is triggered by accessing addresses
   // $FE4 to $FE6 using absolute non-indexed addressing
   // To eliminate false positives (and speed up processing), we
   // search for only certain known signatures
-  static constexpr uInt8 signature[3][3] = {
-    { 0xAD, 0xE4, 0xFF },  // LDA $FFE4
-    { 0xAD, 0xE5, 0xFF },  // LDA $FFE5
-    { 0xAD, 0xE6, 0xFF },  // LDA $FFE6
-  };
-  for(const auto* const sig: signature)
-    if(searchForBytes(image, size, sig, 3))
-      return true;
-
-  return false;
+  return scan.found(LDA_FFE4) || scan.found(LDA_FFE5) || scan.found(LDA_FFE6);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool CartDetector::isProbablyEF(const ByteBuffer& image, size_t size,
-                                Bankswitch::Type& type)
+                                const SignatureScan& scan, Bankswitch::Type& type)
 {
   // Newer EF carts store strings 'EFEF' and 'EFSC' starting at address $FFF8
   // This signature is attributed to "RevEng" of AtariAge
@@ -648,21 +754,8 @@ bool CartDetector::isProbablyEF(const ByteBuffer& image, size_t size,
   // Otherwise, EF cart bankswitching switches banks by accessing addresses
   // 0xFE0 to 0xFEF, usually with either a NOP or LDA
   // It's likely that the code will switch to bank 0, so that's what is tested
-  bool isEF = false;
-  static constexpr uInt8 signature[4][3] = {
-    { 0x0C, 0xE0, 0xFF },  // NOP $FFE0
-    { 0xAD, 0xE0, 0xFF },  // LDA $FFE0
-    { 0x0C, 0xE0, 0x1F },  // NOP $1FE0
-    { 0xAD, 0xE0, 0x1F }   // LDA $1FE0
-  };
-  for(const auto* const sig: signature)
-  {
-    if(searchForBytes(image, size, sig, 3))
-    {
-      isEF = true;
-      break;
-    }
-  }
+  const bool isEF = scan.found(NOP_FFE0) || scan.found(LDA_FFE0) ||
+                    scan.found(NOP_1FE0) || scan.found(LDA_1FE0);
 
   // Now that we know that the ROM is EF, we need to check if it's
   // the SC variant
@@ -691,55 +784,34 @@ bool CartDetector::isProbablyFA2(const ByteBuffer& image, size_t)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyFC(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyFC(const SignatureScan& scan)
 {
   // FC bankswitching uses consecutive writes to 3 hotspots
-  static constexpr uInt8 signature[3][6] = {
-    { 0x8d, 0xf8, 0x1f, 0x4a, 0x4a, 0x8d }, // STA $1FF8, LSR, LSR, STA... Power Play Arcade Menus, 3-D Ghost Attack
-    { 0x8d, 0xf8, 0xff, 0x8d, 0xfc, 0xff }, // STA $FFF8, STA $FFFC        Surf's Up (4K)
-    { 0x8c, 0xf9, 0xff, 0xad, 0xfc, 0xff }  // STY $FFF9, LDA $FFFC        3-D Havoc
-  };
-  for(const auto* const sig: signature)
-    if(searchForBytes(image, size, sig, 6))
-      return true;
-
-  return false;
+  return scan.found(FC_POWER_PLAY) || scan.found(FC_SURFS_UP) ||
+         scan.found(FC_3D_HAVOC);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyFE(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyFE(const SignatureScan& scan)
 {
   // FE bankswitching is very weird, but always seems to include a
   // 'JSR $xxxx'
   // These signatures are (mostly) attributed to the MESS project
-  static constexpr uInt8 signature[5][5] = {
-    { 0x20, 0x00, 0xD0, 0xC6, 0xC5 },  // JSR $D000; DEC $C5  Decathlon
-    { 0x20, 0xC3, 0xF8, 0xA5, 0x82 },  // JSR $F8C3; LDA $82  Robot Tank
-    { 0xD0, 0xFB, 0x20, 0x73, 0xFE },  // BNE $FB; JSR $FE73  Space Shuttle (NTSC/PAL)
-    { 0xD0, 0xFB, 0x20, 0x68, 0xFE },  // BNE $FB; JSR $FE73  Space Shuttle (SECAM)
-    { 0x20, 0x00, 0xF0, 0x84, 0xD6 }   // JSR $F000; $84, $D6 Thwocker
-  };
-  for(const auto* const sig: signature)
-    if(searchForBytes(image, size, sig, 5))
-      return true;
-
-  return false;
+  return scan.found(FE_DECATHLON) || scan.found(FE_ROBOT_TANK) ||
+         scan.found(FE_SPACE_SHUTTLE) || scan.found(FE_SPACE_SHUTTLE_SECAM) ||
+         scan.found(FE_THWOCKER);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyJANE(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyJANE(const SignatureScan& scan)
 {
-  static constexpr uInt8 signature[] = { 0xad, 0xf1, 0xff, 0x60 };  // LDA $0CB8
-
-  return searchForBytes(image, size, signature, sizeof(signature));
+  return scan.found(LDA_FFF1_RTS);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyGL(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyGL(const SignatureScan& scan)
 {
-  static constexpr uInt8 signature[] = { 0xad, 0xb8, 0x0c };  // LDA $0CB8
-
-  return searchForBytes(image, size, signature, 3);
+  return scan.found(LDA_0CB8);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -783,76 +855,45 @@ size_t CartDetector::isProbablyMVC(const FSNode& rom)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablySB(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablySB(const SignatureScan& scan)
 {
   // SB cart bankswitching switches banks by accessing address 0x0800
-  static constexpr uInt8 signature[2][3] = {
-    { 0xBD, 0x00, 0x08 },  // LDA $0800,x
-    { 0xAD, 0x00, 0x08 }   // LDA $0800
-  };
-  if(searchForBytes(image, size, signature[0], 3))
-    return true;
-  else
-    return searchForBytes(image, size, signature[1], 3);
+  return scan.found(LDA_0800_X) || scan.found(LDA_0800);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyTVBoy(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyTVBoy(const SignatureScan& scan)
 {
   // TV Boy cart bankswitching switches banks by accessing addresses 0x1800..$187F
-  static constexpr uInt8 signature[5] = { 0x91, 0x82, 0x6c, 0xfc, 0xff };  // STA ($82),Y; JMP ($FFFC)
-  return searchForBytes(image, size, signature, 5);
+  return scan.found(TVBOY_STA_JMP);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyUA(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyUA(const SignatureScan& scan)
 {
   // UA cart bankswitching switches to bank 1 by accessing address 0x240
   // using 'STA $240' or 'LDA $240'.
   // Brazilian (Digivison) cart bankswitching switches to bank 1 by accessing address 0x2C0
   // using 'BIT $2C0', 'STA $2C0' or 'LDA $2C0'
-  static constexpr uInt8 signature[6][3] = {
-    { 0x8D, 0x40, 0x02 },  // STA $240 (Funky Fish, Pleiades)
-    { 0xAD, 0x40, 0x02 },  // LDA $240 (???)
-    { 0xBD, 0x1F, 0x02 },  // LDA $21F,X (Gingerbread Man)
-    { 0x2C, 0xC0, 0x02 },  // BIT $2C0 (Time Pilot)
-    { 0x8D, 0xC0, 0x02 },  // STA $2C0 (Fathom, Vanguard)
-    { 0xAD, 0xC0, 0x02 },  // LDA $2C0 (Mickey)
-  };
-  for(const auto* const sig: signature)
-    if(searchForBytes(image, size, sig, 3))
-      return true;
-
-  return false;
+  return scan.found(STA_240) || scan.found(LDA_240) ||
+         scan.found(LDA_21F_X) || scan.found(BIT_2C0) ||
+         scan.found(STA_2C0) || scan.found(LDA_2C0);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyWD(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyWD(const SignatureScan& scan)
 {
   // WD cart bankswitching switches banks by accessing address 0x30..0x3f
-  static constexpr uInt8 signature[1][3] = {
-    { 0xA5, 0x39, 0x4C }  // LDA $39, JMP
-  };
-  return searchForBytes(image, size, signature[0], 3);
+  return scan.found(LDA_39_JMP);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool CartDetector::isProbablyX07(const ByteBuffer& image, size_t size)
+bool CartDetector::isProbablyX07(const SignatureScan& scan)
 {
   // X07 bankswitching switches to bank 0, 1, 2, etc by accessing address 0x08xd
-  static constexpr uInt8 signature[6][3] = {
-    { 0xAD, 0x0D, 0x08 },  // LDA $080D
-    { 0xAD, 0x1D, 0x08 },  // LDA $081D
-    { 0xAD, 0x2D, 0x08 },  // LDA $082D
-    { 0x0C, 0x0D, 0x08 },  // NOP $080D
-    { 0x0C, 0x1D, 0x08 },  // NOP $081D
-    { 0x0C, 0x2D, 0x08 }   // NOP $082D
-  };
-  for(const auto* const sig: signature)
-    if(searchForBytes(image, size, sig, 3))
-      return true;
-
-  return false;
+  return scan.found(LDA_080D) || scan.found(LDA_081D) ||
+         scan.found(LDA_082D) || scan.found(NOP_080D) ||
+         scan.found(NOP_081D) || scan.found(NOP_082D);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
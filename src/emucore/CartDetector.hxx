@@ -53,6 +53,12 @@ class CartDetector
     static bool isProbablyPlusROM(const ByteBuffer& image, size_t size);
 
   private:
+    /**
+      The hit counts of all signatures searched for in the complete ROM
+      image, which are determined in a single pass over the image
+    */
+    class SignatureScan;
+
     /**
       Search the image for the specified byte signature
 
@@ -89,37 +95,37 @@ class CartDetector
     /**
       Returns true if the image is probably a 03E0 bankswitching cartridge
     */
-    static bool isProbably03E0(const ByteBuffer& image, size_t size);
+    static bool isProbably03E0(const SignatureScan& scan);
 
     /**
       Returns true if the image is probably a 0840 bankswitching cartridge
     */
-    static bool isProbably0840(const ByteBuffer& image, size_t size);
+    static bool isProbably0840(const SignatureScan& scan);
 
     /**
       Returns true if the image is probably a Brazilian 0FA0 bankswitching cartridge
     */
-    static bool isProbably0FA0(const ByteBuffer& image, size_t size);
+    static bool isProbably0FA0(const SignatureScan& scan);
 
     /**
       Returns true if the image is probably a 3E bankswitching cartridge
     */
-    static bool isProbably3E(const ByteBuffer& image, size_t size);
+    static bool isProbably3E(const SignatureScan& scan);
 
     /**
     Returns true if the image is probably a 3EX bankswitching cartridge
     */
-    static bool isProbably3EX(const ByteBuffer& image, size_t size);
+    static bool isProbably3EX(const SignatureScan& scan);
 
     /**
       Returns true if the image is probably a 3E+ bankswitching cartridge
     */
-    static bool isProbably3EPlus(const ByteBuffer& image, size_t size);
+    static bool isProbably3EPlus(const SignatureScan& scan);
 
     /**
       Returns true if the image is probably a 3F bankswitching cartridge
     */
-    static bool isProbably3F(const ByteBuffer& image, size_t size);
+    static bool isProbably3F(const SignatureScan& scan);
 
     /**
       Returns true if the image is probably a 4A50 bankswitching cartridge
@@ -139,22 +145,22 @@ class CartDetector
     /**
       Returns true if the image is probably a BUS bankswitching cartridge
     */
-    static bool isProbablyBUS(const ByteBuffer& image, size_t size);
+    static bool isProbablyBUS(const SignatureScan& scan);
 
     /**
       Returns true if the image is probably a CDF bankswitching cartridge
     */
-    static bool isProbablyCDF(const ByteBuffer& image, size_t size);
+    static bool isProbablyCDF(const SignatureScan& scan);
 
     /**
       Returns true if the image is probably a CTY bankswitching cartridge
     */
-    static bool isProbablyCTY(const ByteBuffer& image, size_t size);
+    static bool isProbablyCTY(const SignatureScan& scan);
 
     /**
       Returns true if the image is probably a CV bankswitching cartridge
     */
-    static bool isProbablyCV(const ByteBuffer& image, size_t size);
+    static bool isProbablyCV(const SignatureScan& scan);
 
     /**
       Returns true if the image is probably a DF/DFSC bankswitching cartridge
@@ -164,27 +170,28 @@ class CartDetector
     /**
       Returns true if the image is probably a DPC+ bankswitching cartridge
     */
-    static bool isProbablyDPCplus(const ByteBuffer& image, size_t size);
+    static bool isProbablyDPCplus(const SignatureScan& scan);
 
     /**
       Returns true if the image is probably a E0 bankswitching cartridge
     */
-    static bool isProbablyE0(const ByteBuffer& image, size_t size);
+    static bool isProbablyE0(const SignatureScan& scan);
 
     /**
       Returns true if the image is probably a E7 bankswitching cartridge
     */
-    static bool isProbablyE7(const ByteBuffer& image, size_t size);
+    static bool isProbablyE7(const SignatureScan& scan);
 
     /**
     Returns true if the image is probably a E78K bankswitching cartridge
     */
-    static bool isProbablyE78K(const ByteBuffer& image, size_t size);
+    static bool isProbablyE78K(const SignatureScan& scan);
 
     /**
       Returns true if the image is probably an EF/EFSC bankswitching cartridge
     */
-    static bool isProbablyEF(const ByteBuffer& image, size_t size, Bankswitch::Type& type);
+    static bool isProbablyEF(const ByteBuffer& image, size_t size,
+                             const SignatureScan& scan, Bankswitch::Type& type);
 
     /**
       Returns true if the image is probably an F6 bankswitching cartridge
@@ -199,22 +206,22 @@ class CartDetector
     /**
       Returns true if the image is probably an FC bankswitching cartridge
     */
-    static bool isProbablyFC(const ByteBuffer& image, size_t size);
+    static bool isProbablyFC(const SignatureScan& scan);
 
     /**
       Returns true if the image is probably an FE bankswitching cartridge
     */
-    static bool isProbablyFE(const ByteBuffer& image, size_t size);
+    static bool isProbablyFE(const SignatureScan& scan);
 
     /**
       Returns true if the image is probably a JANE cartridge (Tarzan)
     */
-    static bool isProbablyJANE(const ByteBuffer& image, size_t size);
+    static bool isProbablyJANE(const SignatureScan& scan);
 
     /**
       Returns true if the image is probably a GameLine cartridge
     */
-    static bool isProbablyGL(const ByteBuffer& image, size_t size);
+    static bool isProbablyGL(const SignatureScan& scan);
 
     /**
       Returns true if the image is probably a MDM bankswitching cartridge
@@ -229,27 +236,27 @@ class CartDetector
     /**
       Returns true if the image is probably a SB bankswitching cartridge
     */
-    static bool isProbablySB(const ByteBuffer& image, size_t size);
+    static bool isProbablySB(const SignatureScan& scan);
 
     /**
       Returns true if the image is probably a TV Boy bankswitching cartridge
     */
-    static bool isProbablyTVBoy(const ByteBuffer& image, size_t size);
+    static bool isProbablyTVBoy(const SignatureScan& scan);
 
     /**
       Returns true if the image is probably a UA bankswitching cartridge
     */
-    static bool isProbablyUA(const ByteBuffer& image, size_t size);
+    static bool isProbablyUA(const SignatureScan& scan);
 
     /**
       Returns true if the image is probably a Wickstead Design bankswitching cartridge
     */
-    static bool isProbablyWD(const ByteBuffer& image, size_t size);
+    static bool isProbablyWD(const SignatureScan& scan);
 
     /**
       Returns true if the image is probably an X07 bankswitching cartridge
     */
-    static bool isProbablyX07(const ByteBuffer& image, size_t size);
+    static bool isProbablyX07(const SignatureScan& scan);
 
   private:
     // Following constructors and assignment operators not supported
@@ -276,6 +276,8 @@ bool CartridgeE7::bank(uInt16 bank, uInt16)
     // Set the page accessing method for the 1K bank of RAM reading pages
     setAccess(0x1000 + BANK_SIZE / 2, BANK_SIZE / 2, 0, myRAM.data(), romSize(), System::PageAccessType::READ);
   }
+  updateSharedBank(bank);
+
   return myBankChanged = true;
 }
 
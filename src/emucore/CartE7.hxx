@@ -258,8 +258,8 @@ class CartridgeE7 : public Cartridge
     // Size of the ROM image
     size_t mySize{0};
 
-    // The 2K of RAM
-    std::array<uInt8, RAM_SIZE> myRAM;
+    // The 2K of RAM (see createSharedRAM())
+    std::array<uInt8, RAM_SIZE>& myRAM{createSharedRAM<RAM_SIZE>()};
 
     // Indicates which bank is in the segment
     std::array<uInt16, NUM_SEGMENTS> myCurrentBank;
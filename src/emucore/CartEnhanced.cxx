@@ -89,10 +89,12 @@ void CartridgeEnhanced::install(System& system)
 
   // Allocate array for the RAM area
   if(myRamSize > 0)
-    myRAM = make_unique<uInt8[]>(myRamSize);
+    myRAM = createSharedRAM(myRamSize);
 
   mySystem = &system;
 
+  buildPageAccess();
+
   if(myRomOffset > 0)
   {
     // Setup page access for extended RAM; banked RAM will be setup in bank()
@@ -136,7 +138,7 @@ void CartridgeEnhanced::install(System& system)
 void CartridgeEnhanced::reset()
 {
   if(myRamSize > 0)
-    initializeRAM(myRAM.get(), myRamSize);
+    initializeRAM(myRAM, myRamSize);
 
   initializeStartBank(getStartBank());
 
@@ -245,38 +247,40 @@ bool CartridgeEnhanced::bank(uInt16 bank, uInt16 segment)
     const uInt16 romBank = bank % romBankCount();
     // Remember what bank is in this segment
     const uInt32 bankOffset = myCurrentSegOffset[segment] = romBank << myBankShift;
-    const uInt16 hotspot = this->hotspot();
-    const uInt16 hotSpotAddr = (hotspot & 0x1000) ? (hotspot & ~System::PAGE_MASK) : 0xFFFF;
-    const uInt16 plusROMAddr = (myPlusROM->isValid()) ? (0x1FF0 & ~System::PAGE_MASK) : 0xFFFF;
 
     // Skip extra RAM; if existing it is only mapped into first segment
     const uInt16 fromAddr = (ROM_OFFSET + segmentOffset + (segment == 0 ? myRomOffset : 0)) & ~System::PAGE_MASK;
     // for ROMs < 4_KB, the whole address space will be mapped.
     const uInt16 toAddr   = (ROM_OFFSET + segmentOffset + (mySize < 4_KB ? 4_KB : myBankSize)) & ~System::PAGE_MASK;
 
-    System::PageAccess access(this, System::PageAccessType::READ);
     // Setup the page access methods for the current bank
-    for(uInt16 addr = fromAddr; addr < toAddr; addr += System::PAGE_SIZE)
-    {
-      const uInt32 offset = bankOffset + (addr & myBankMask);
+    mapPages(fromAddr, toAddr,
+             &myRomPageAccess[bankOffset >> System::PAGE_SHIFT], myBankMask);
 
-      if(myDirectPeek && addr != hotSpotAddr && addr != plusROMAddr)
-        access.directPeekBase = &myImage[offset];
-      else
-        access.directPeekBase = nullptr;
-      access.romAccessBase = &myRomAccessBase[offset];
-      access.romPeekCounter = &myRomAccessCounter[offset];
-      access.romPokeCounter = &myRomAccessCounter[offset + myAccessSize];
-      mySystem->setPageAccess(addr, access);
+    // The hotspot pages must not be peeked directly
+    if(myDirectPeek)
+    {
+      const uInt16 hotspot = this->hotspot();
+      const uInt16 hotSpotAddr = (hotspot & 0x1000) ? (hotspot & ~System::PAGE_MASK) : 0xFFFF;
+      const uInt16 plusROMAddr = (myPlusROM->isValid()) ? (0x1FF0 & ~System::PAGE_MASK) : 0xFFFF;
+
+      for(const uInt16 addr: {hotSpotAddr, plusROMAddr})
+        if(addr >= fromAddr && addr < toAddr)
+        {
+          System::PageAccess access = mySystem->getPageAccess(addr);
+
+          access.directPeekBase = nullptr;
+          mySystem->setPageAccess(addr, access);
+        }
     }
   }
   else
   {
     // Setup RAM bank
     const uInt16 ramBank = (bank - romBankCount()) % myRamBankCount;
-    // The RAM banks follow the ROM banks and are half the size of a ROM bank
-    const uInt32 bankOffset = static_cast<uInt32>(mySize) +
-      (ramBank << myRamBankShift);
+    // Offset of the RAM bank into the RAM; usually half the size of a ROM bank
+    const uInt32 bankOffset = ramBank << myRamBankShift;
+    const size_t ramPages = myRamSize >> System::PAGE_SHIFT;
 
     // Remember what bank is in this segment
     myCurrentSegOffset[segment] = static_cast<uInt32>(mySize) +
@@ -287,36 +291,80 @@ bool CartridgeEnhanced::bank(uInt16 bank, uInt16 segment)
     uInt16 fromAddr = (ROM_OFFSET + segmentOffset + myWriteOffset) & ~System::PAGE_MASK;
     uInt16 toAddr   = (ROM_OFFSET + segmentOffset + myWriteOffset
       + (myBankSize >> (myBankShift - myRamBankShift))) & ~System::PAGE_MASK;
-    System::PageAccess access(this, System::PageAccessType::WRITE);
-
-    for(uInt16 addr = fromAddr; addr < toAddr; addr += System::PAGE_SIZE)
-    {
-      const uInt32 offset = bankOffset + (addr & myRamMask);
 
-      access.romAccessBase = &myRomAccessBase[offset];
-      access.romPeekCounter = &myRomAccessCounter[offset];
-      access.romPokeCounter = &myRomAccessCounter[offset + myAccessSize];
-      mySystem->setPageAccess(addr, access);
-    }
+    mapPages(fromAddr, toAddr,
+             &myRamPageAccess[bankOffset >> System::PAGE_SHIFT], myRamMask);
 
     // Set the page accessing method for the RAM reading pages
     fromAddr = (ROM_OFFSET + segmentOffset + myReadOffset) & ~System::PAGE_MASK;
     toAddr   = (ROM_OFFSET + segmentOffset + myReadOffset
       + (myBankSize >> (myBankShift - myRamBankShift))) & ~System::PAGE_MASK;
-    access.type = System::PageAccessType::READ;
 
-    for(uInt16 addr = fromAddr; addr < toAddr; addr += System::PAGE_SIZE)
+    mapPages(fromAddr, toAddr,
+             &myRamPageAccess[ramPages + (bankOffset >> System::PAGE_SHIFT)], myRamMask);
+  }
+  if(segment == 0)
+    updateSharedBank(bank);
+
+  return myBankChanged = true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void CartridgeEnhanced::buildPageAccess()
+{
+  // ROM pages
+  const size_t romPages = mySize >> System::PAGE_SHIFT;
+  System::PageAccess access(this, System::PageAccessType::READ);
+
+  myRomPageAccess = make_unique<System::PageAccess[]>(romPages);
+  for(size_t page = 0; page < romPages; ++page)
+  {
+    const size_t offset = page << System::PAGE_SHIFT;
+
+    access.directPeekBase = myDirectPeek ? &myImage[offset] : nullptr;
+    access.romAccessBase = &myRomAccessBase[offset];
+    access.romPeekCounter = &myRomAccessCounter[offset];
+    access.romPokeCounter = &myRomAccessCounter[offset + myAccessSize];
+    myRomPageAccess[page] = access;
+  }
+
+  // Banked RAM pages, the write ports followed by the read ports
+  if(myRamBankCount > 0)
+  {
+    const size_t ramPages = myRamSize >> System::PAGE_SHIFT;
+
+    myRamPageAccess = make_unique<System::PageAccess[]>(ramPages * 2);
+    for(size_t page = 0; page < ramPages; ++page)
     {
-      const uInt32 offset = bankOffset + (addr & myRamMask);
+      const size_t offset = mySize + (page << System::PAGE_SHIFT);
 
-      access.directPeekBase = &myRAM[offset - mySize];
+      access.type = System::PageAccessType::WRITE;
+      access.directPeekBase = nullptr;
       access.romAccessBase = &myRomAccessBase[offset];
       access.romPeekCounter = &myRomAccessCounter[offset];
       access.romPokeCounter = &myRomAccessCounter[offset + myAccessSize];
-      mySystem->setPageAccess(addr, access);
+      myRamPageAccess[page] = access;
+
+      access.type = System::PageAccessType::READ;
+      access.directPeekBase = &myRAM[offset - mySize];
+      myRamPageAccess[ramPages + page] = access;
     }
   }
-  return myBankChanged = true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void CartridgeEnhanced::mapPages(uInt16 fromAddr, uInt16 toAddr,
+                                 const System::PageAccess* access, uInt16 mask)
+{
+  while(fromAddr < toAddr)
+  {
+    const uInt16 page  = (fromAddr & mask) >> System::PAGE_SHIFT;
+    const uInt16 pages = std::min<uInt16>(((mask + 1) >> System::PAGE_SHIFT) - page,
+                                          (toAddr - fromAddr) >> System::PAGE_SHIFT);
+
+    mySystem->setPageAccess(fromAddr, access + page, pages);
+    fromAddr += pages << System::PAGE_SHIFT;
+  }
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -397,7 +445,7 @@ bool CartridgeEnhanced::save(Serializer& out) const
   {
     out.putIntArray(myCurrentSegOffset.get(), myBankSegs);
     if(myRamSize > 0)
-      out.putByteArray(myRAM.get(), myRamSize);
+      out.putByteArray(myRAM, myRamSize);
 
     if(myPlusROM->isValid() && !myPlusROM->save(out))
       return false;
@@ -418,7 +466,7 @@ bool CartridgeEnhanced::load(Serializer& in)
   {
     in.getIntArray(myCurrentSegOffset.get(), myBankSegs);
     if(myRamSize > 0)
-      in.getByteArray(myRAM.get(), myRamSize);
+      in.getByteArray(myRAM, myRamSize);
 
     if(myPlusROM->isValid() && !myPlusROM->load(in))
       return false;
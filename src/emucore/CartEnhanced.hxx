@@ -18,10 +18,9 @@
 #ifndef CARTRIDGEENHANCED_HXX
 #define CARTRIDGEENHANCED_HXX
 
-class System;
-
 #include "bspf.hxx"
 #include "Cart.hxx"
+#include "System.hxx"
 #include "PlusROM.hxx"
 #ifdef DEBUGGER_SUPPORT
   #include "CartEnhancedWidget.hxx"
@@ -261,8 +260,8 @@ class CartridgeEnhanced : public Cartridge
     // Indicates whether to use direct ROM peeks or not
     bool myDirectPeek{true};
 
-    // Pointer to a dynamically allocated RAM area of the cartridge
-    ByteBuffer myRAM{nullptr};
+    // Pointer to the RAM area of the cartridge (see createSharedRAM())
+    uInt8* myRAM{nullptr};
 
     // The size of the ROM image
     size_t mySize{0};
@@ -270,6 +269,11 @@ class CartridgeEnhanced : public Cartridge
     // Handle PlusROM functionality, if available
     unique_ptr<PlusROM> myPlusROM;
 
+    // Page access entries for each page of the ROM image, and for the write
+    // and read ports of the banked RAM, prebuilt once in install()
+    unique_ptr<System::PageAccess[]> myRomPageAccess;
+    unique_ptr<System::PageAccess[]> myRamPageAccess;
+
   protected:
     // The mask for 6507 address space
     static constexpr uInt16 ADDR_MASK = 0x1FFF;
@@ -313,6 +317,24 @@ class CartridgeEnhanced : public Cartridge
     virtual uInt16 calcNumSegments() const;
 
   private:
+    /**
+      Build the page access entries for all ROM and RAM banks.
+    */
+    void buildPageAccess();
+
+    /**
+      Map the pages from 'fromAddr' up to 'toAddr' using consecutive
+      prebuilt page access entries.  The entries wrap around every
+      'mask + 1' bytes, for areas which are mirrored.
+
+      @param fromAddr  The address of the first page
+      @param toAddr    The address after the last page
+      @param access    The entries for the bank to map
+      @param mask      The mask for an address inside the bank
+    */
+    void mapPages(uInt16 fromAddr, uInt16 toAddr,
+                  const System::PageAccess* access, uInt16 mask);
+
     /**
       Get the ROM's startup bank.
 
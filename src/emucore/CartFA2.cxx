@@ -120,11 +120,11 @@ uInt8 CartridgeFA2::ramReadWrite()
       {
         try
         {
-          serializer.getByteArray(myRAM.get(), myRamSize);
+          serializer.getByteArray(myRAM, myRamSize);
         }
         catch(...)
         {
-          std::fill_n(myRAM.get(), myRamSize, 0);
+          std::fill_n(myRAM, myRamSize, 0);
         }
         myRamAccessTimeout += 500;  // Add 0.5 ms delay for read
       }
@@ -132,7 +132,7 @@ uInt8 CartridgeFA2::ramReadWrite()
       {
         try
         {
-          serializer.putByteArray(myRAM.get(), myRamSize);
+          serializer.putByteArray(myRAM, myRamSize);
         }
         catch(...)
         {
@@ -185,18 +185,18 @@ void CartridgeFA2::flash(uInt8 operation)
     {
       try
       {
-        serializer.getByteArray(myRAM.get(), myRamSize);
+        serializer.getByteArray(myRAM, myRamSize);
       }
       catch(...)
       {
-        std::fill_n(myRAM.get(), myRamSize, 0);
+        std::fill_n(myRAM, myRamSize, 0);
       }
     }
     else if(operation == 2)  // write
     {
       try
       {
-        serializer.putByteArray(myRAM.get(), myRamSize);
+        serializer.putByteArray(myRAM, myRamSize);
       }
       catch(...)
       {
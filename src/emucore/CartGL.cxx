@@ -50,11 +50,11 @@ void CartridgeGL::reset()
 
   myOrgAccess = mySystem->getPageAccess(0x1fc0);
 
-  initializeRAM(myRAM.get(), myRamSize);
+  initializeRAM(myRAM, myRamSize);
   if(myInitialRAM != nullptr)
   {
     // Copy the RAM image into my RAM buffer
-    std::copy_n(myInitialRAM.get(), 2_KB, myRAM.get());
+    std::copy_n(myInitialRAM.get(), 2_KB, myRAM);
   }
 }
 
@@ -15,6 +15,7 @@
 // this file, and for a DISCLAIMER OF ALL WARRANTIES.
 //============================================================================
 
+#include "MappedFile.hxx"
 #include "Serializer.hxx"
 #include "Serializable.hxx"
 #include "System.hxx"
@@ -45,6 +46,10 @@ namespace {
   constexpr int BACK_SECONDS = 10;
 
   constexpr int TITLE_CYCLES = 1000000;
+
+  // Number of fields read ahead, in the direction of playback
+  constexpr size_t READ_AHEAD_FIELDS = 32;
+  constexpr size_t MAX_READ_AHEAD_SIZE = 1024_KB;
 } // namespace
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -57,6 +62,16 @@ class StreamReader : public Serializable
     StreamReader() { myBuffer1.fill(0);  myBuffer2.fill(0); }
 
     bool open(string_view path) {
+      // Prefer a memory mapping, which allows reading ahead in the
+      // background, so that playback doesn't wait for the disk
+      myMappedFile = make_unique<MappedFile>(string{path}, true);
+      if(myMappedFile->isValid())
+      {
+        myFileSize = myMappedFile->size();
+        return true;
+      }
+      myMappedFile.reset();
+
       myFile = Serializer(path, Serializer::Mode::ReadOnly);
       myFileSize = myFile ? myFile.size() : 0;
 
@@ -158,18 +173,23 @@ class StreamReader : public Serializable
     }
 
     bool readField(uInt32 fnum, bool index) {
-      if(myFile)
+      const size_t offset = static_cast<size_t>(fnum) * CartridgeMVC::MVC_FIELD_SIZE;
+
+      if(offset + CartridgeMVC::MVC_FIELD_SIZE <= myFileSize)
       {
-        const size_t offset = ((fnum + 0) * CartridgeMVC::MVC_FIELD_SIZE);
+        uInt8* buffer = index ? myBuffer1.data() : myBuffer2.data();
 
-        if(offset + CartridgeMVC::MVC_FIELD_SIZE <= myFileSize)
+        if(myMappedFile)
+        {
+          std::copy_n(myMappedFile->data() + offset, CartridgeMVC::MVC_FIELD_SIZE,
+                      buffer);
+          readAhead(fnum);
+          return true;
+        }
+        if(myFile)
         {
           myFile.setPosition(offset);
-          if(index)
-            myFile.getByteArray(myBuffer1.data(), myBuffer1.size());
-          else
-            myFile.getByteArray(myBuffer2.data(), myBuffer2.size());
-
+          myFile.getByteArray(buffer, CartridgeMVC::MVC_FIELD_SIZE);
           return true;
         }
       }
@@ -240,6 +260,27 @@ class StreamReader : public Serializable
       return true;
     }
 
+  private:
+    /**
+      Have the fields following the given one read in the background.  The
+      fields are expected in the direction and at the speed (fields skipped
+      while seeking) of the last move.
+    */
+    void readAhead(uInt32 fnum) {
+      const Int64 step = static_cast<Int64>(fnum) - myLastField;
+      myLastField = fnum;
+
+      const size_t size = std::min<size_t>(
+        std::max<size_t>(std::abs(step), 1) * READ_AHEAD_FIELDS * CartridgeMVC::MVC_FIELD_SIZE,
+        MAX_READ_AHEAD_SIZE);
+      const size_t offset = static_cast<size_t>(fnum) * CartridgeMVC::MVC_FIELD_SIZE;
+
+      if(step >= 0)
+        myMappedFile->willNeed(offset + CartridgeMVC::MVC_FIELD_SIZE, size);
+      else
+        myMappedFile->willNeed(offset - std::min(offset, size), std::min(offset, size));
+    }
+
   private:
     const uInt8*  myAudio{nullptr};
 
@@ -259,8 +300,10 @@ class StreamReader : public Serializable
     uInt8         myOverscanLines{30};
     uInt8         myEmbeddedFrame{0};
 
-    Serializer myFile;
+    unique_ptr<MappedFile> myMappedFile;
+    Serializer myFile;  // used if the file cannot be memory-mapped
     size_t myFileSize{0};
+    uInt32 myLastField{0};
 };
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -59,6 +59,7 @@
 #include "FrameLayout.hxx"
 #include "AudioQueue.hxx"
 #include "AudioSettings.hxx"
+#include "FrameCapture.hxx"
 #include "DevSettingsHandler.hxx"
 #include "frame-manager/FrameManager.hxx"
 #include "frame-manager/FrameLayoutDetector.hxx"
@@ -113,12 +114,14 @@ namespace {
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 Console::Console(OSystem& osystem, unique_ptr<Cartridge>& cart,
-                 const Properties& props, AudioSettings& audioSettings)
+                 const Properties& props, AudioSettings& audioSettings,
+                 const RomCatalogue::Entry& catalogued)
   : myOSystem{osystem},
     myEvent{osystem.eventHandler().event()},
     myProperties{props},
     myCart{std::move(cart)},
-    myAudioSettings{audioSettings}
+    myAudioSettings{audioSettings},
+    myCatalogueEntry{catalogued}
 {
   // Create subsystems for the console
   my6502 = make_unique<M6502>(myOSystem.settings());
@@ -183,7 +186,21 @@ Console::Console(OSystem& osystem, unique_ptr<Cartridge>& cart,
 
   if(myDisplayFormat == "AUTO" || myOSystem.settings().getBool("rominfo"))
   {
-    autodetectFrameLayout();
+    // Use the result of an earlier autodetection, if the detection
+    // settings are still the same
+    const string flags = RomCatalogue::formatFlags(
+      myOSystem.settings().getBool("detectpal60"),
+      myOSystem.settings().getBool("detectntsc50"));
+
+    if(!myOSystem.settings().getBool("rominfo") &&
+       !myCatalogueEntry.format.empty() && myCatalogueEntry.formatFlags == flags)
+      myDisplayFormat = myCatalogueEntry.format;
+    else
+    {
+      autodetectFrameLayout();
+      myCatalogueEntry.format = myDisplayFormat;
+      myCatalogueEntry.formatFlags = flags;
+    }
 
     if(myProperties.get(PropType::Display_Format) == "AUTO")
     {
@@ -892,6 +909,11 @@ void Console::createAudioQueue()
     myEmulationTiming.audioQueueCapacity(),
     useStereo
   );
+  myAudioQueue->setCaptureCallback(
+    [this](const Int16* fragment, uInt32 size, bool stereo) {
+      myOSystem.capture().addAudio(fragment, size, stereo);
+    }
+  );
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -929,14 +951,31 @@ void Console::setControllers(string_view romMd5)
     const bool swappedPorts =
         myProperties.get(PropType::Console_SwapPorts) == "YES";
 
-    // Try to detect controllers
+    // Try to detect controllers, unless they have been detected before
+    const auto detectType = [&](Controller::Type type, Controller::Jack port)
+    {
+      const bool rominfo = myOSystem.settings().getBool("rominfo");
+      string& cached = port == Controller::Jack::Left
+        ? myCatalogueEntry.leftPort : myCatalogueEntry.rightPort;
+
+      if(type == Controller::Type::Unknown && !rominfo && !cached.empty())
+        return Controller::getType(cached);
+
+      const Controller::Type detectedType = ControllerDetector::detectType(
+          image, size, type, port, myOSystem.settings());
+      if(type == Controller::Type::Unknown || rominfo)
+        cached = Controller::getPropName(detectedType);
+
+      return detectedType;
+    };
+
     if(image != nullptr && size != 0)
     {
       Logger::debug(myProperties.get(PropType::Cart_Name) + ":");
-      leftType = ControllerDetector::detectType(image, size, leftType,
-          !swappedPorts ? Controller::Jack::Left : Controller::Jack::Right, myOSystem.settings());
-      rightType = ControllerDetector::detectType(image, size, rightType,
-          !swappedPorts ? Controller::Jack::Right : Controller::Jack::Left, myOSystem.settings());
+      leftType = detectType(leftType,
+          !swappedPorts ? Controller::Jack::Left : Controller::Jack::Right);
+      rightType = detectType(rightType,
+          !swappedPorts ? Controller::Jack::Right : Controller::Jack::Left);
     }
 
     unique_ptr<Controller>
@@ -42,6 +42,7 @@ class DevSettingsHandler;
 #include "EventHandlerConstants.hxx"
 #include "EmulationTiming.hxx"
 #include "ConsoleTiming.hxx"
+#include "RomCatalogue.hxx"
 #include "frame-manager/AbstractFrameManager.hxx"
 
 /**
@@ -69,12 +70,14 @@ class Console : public Serializable, public ConsoleIO
       Create a new console for emulating the specified game using the
       given game image and operating system.
 
-      @param osystem  The OSystem object to use
-      @param cart     The cartridge to use with this console
-      @param props    The properties for the cartridge
+      @param osystem     The OSystem object to use
+      @param cart        The cartridge to use with this console
+      @param props       The properties for the cartridge
+      @param catalogued  The results of earlier autodetection for the ROM
     */
     Console(OSystem& osystem, unique_ptr<Cartridge>& cart,
-            const Properties& props, AudioSettings& audioSettings);
+            const Properties& props, AudioSettings& audioSettings,
+            const RomCatalogue::Entry& catalogued = RomCatalogue::Entry{});
     ~Console() override;
 
   public:
@@ -167,6 +170,12 @@ class Console : public Serializable, public ConsoleIO
     */
     const ConsoleInfo& about() const { return myConsoleInfo; }
 
+    /**
+      Get the autodetection results for the ROM, to be stored in the
+      ROM catalogue.
+    */
+    const RomCatalogue::Entry& catalogueEntry() const { return myCatalogueEntry; }
+
     /**
       Timing information for this console.
     */
@@ -503,6 +512,9 @@ class Console : public Serializable, public ConsoleIO
     // The audio settings
     AudioSettings& myAudioSettings;
 
+    // The autodetection results for the ROM, cached in the ROM catalogue
+    RomCatalogue::Entry myCatalogueEntry;
+
   private:
     // Following constructors and assignment operators not supported
     Console() = delete;
@@ -2309,7 +2309,6 @@ static constexpr BSPF::array2D<const char*, DEF_PROPS_SIZE, 30> DefProps = {{
   { "9fa0c664b157a0c27d10319dbbca812c", "Chris Walton, Justin Hairgrove, Tony Morse", "", "Hunchy II (2005)", "Homebrew", "", "", "", "", "", "https://atariage.com/store/index.php?l=product_detail&p=330", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "" },
   { "9fa61e79ac8ccf05103fc95bf415a7de", "Tron", "", "River Raid (Tron)", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "" },
   { "9fc2d1627dcdd8925f4c042e38eb0bc9", "Atari - GCC, John Allred, Mike Feinstein", "CX2688, CX2688P", "Jungle Hunt (1983) (Atari) (PAL)", "", "", "", "", "", "{\"score_addresses\":[\"0x85\",\"0x84\",\"0x83\"],\"score_digits\":6,\"variations_address\":\"0x8b\",\"variations_count\":2,\"variations_zero_based\":true}", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "" },
-  { "E68E28752D3C54EDD3CCDA42C27E320C", "Xonox - K-Tel Software, Anthony R. Henderson", "99007, 6240", "Tomarc the Barbarian (1983) (Xonox)", "Genesis controller (B is jump and throw, C switches between players)", "Hack of Tomarc the Barbarian", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "" },
   { "a0028f057d496f22b549fd8deecc6f78", "Joe Grand", "", "SCSIcide Pre-release 6 (Joe Grand)", "", "New Release", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "SCSIcide (USA) (Unl)" },
   { "a00ec89d22fcc0c1a85bb542ddcb1178", "CCE", "C-1012", "Phoenix (1983) (CCE)", "", "", "", "", "", "{\"score_addresses\":[\"0xc9\",\"0xc8\",\"0xc7\"],\"score_digits\":6,\"variations_count\":1}", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "" },
   { "a00ee0aed5c8979add4c170f5322c706", "Barry Laws Jr.", "", "Egghead (Barry Laws Jr.) (Hack)", "Hack of Pac-Man", "Hack", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "YES", "", "" },
@@ -3315,6 +3314,7 @@ static constexpr BSPF::array2D<const char*, DEF_PROPS_SIZE, 30> DefProps = {{
   { "e6508b878145187b87b9cded097293e7", "", "", "Oystron (V2.8) (Piero Cavina) (PD)", "", "New Release", "", "", "", "{\"score_addresses\":[\"0xd4\",\"0xd3\"],\"score_digits\":5,\"score_trailing_zeroes\":1,\"variations_address\":\"0xe5\",\"variations_count\":3,\"variations_zero_based\":true}", "https://atariage.com/store/index.php?l=product_detail&p=134", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "" },
   { "e66e5af5dea661d58420088368e4ef0d", "Activision, Bob Whitehead", "AG-011", "Stampede (1981) (Activision) (4K)", "", "", "", "", "", "{\"score_addresses\":[\"0xbc\",\"0xb8\"],\"variations_address\":\"0x99\",\"variations_count\":8,\"variations_zero_based\":true}", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "" },
   { "e67b0ed32fd9d28d12ab3775d52e8c3a", "Atari, Omegamatrix", "", "Video Olympics Menu (2020) (Hack)", "Hack of Video Olympics", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "YES", "13", "13", "AUTO 60", "", "", "", "", "Video Olympics (USA)" },
+  { "e68e28752d3c54edd3ccda42c27e320c", "Xonox - K-Tel Software, Anthony R. Henderson", "99007, 6240", "Tomarc the Barbarian (1983) (Xonox)", "Genesis controller (B is jump and throw, C switches between players)", "Hack of Tomarc the Barbarian", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "" },
   { "e6d5948f451a24994dfaaca51dfdb4e1", "Jone Yuan Telephonic Enterprise Co", "", "Football (Jone Yuan) (4K)", "2600 Screen Search Console", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "YES", "", "" },
   { "e6de4ef9ab62e2196962aa6b0dedac59", "Imagic, Wilfredo Aguilar, Michael Becker, Dennis Koble", "720113-2A, 13206", "Solar Storm (1983) (Imagic) (PAL)", "Uses the Paddle Controllers", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "20", "20", "01 45", "", "", "", "", "" },
   { "e6e5bb0e4f4350da573023256268313d", "Thomas Jentzsch", "", "Missile Control (Thomas Jentzsch)", "NTSC Conversion", "Homebrew", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "" },
@@ -3698,4 +3698,3936 @@ static constexpr BSPF::array2D<const char*, DEF_PROPS_SIZE, 30> DefProps = {{
   { "ffebb0070689b9d322687edd9c0a2bae", "", "", "Spitfire Attack (1983) (Milton Bradley) [h1]", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "" }
 }};
 
+/**
+  The MD5 of each entry in DefProps in binary form, as the most and
+  least significant 64 bits.
+*/
+static constexpr BSPF::array2D<uInt64, DEF_PROPS_SIZE, 2> DefPropsKeys = {{
+  { 0x000509d1ed2b8d30, 0xa9d94be1b3b5febb },
+  { 0x0060a89b4c956b9c, 0x703a59b181cb3018 },
+  { 0x007d18dedc1f0565, 0xf09c42aa61a6f585 },
+  { 0x008543ae43497af0, 0x15e9428a5e3e874e },
+  { 0x00b7b4cbec815706, 0x42283e7fc1ef17af },
+  { 0x00ce0bdd43aed84a, 0x983bef38fe7f5ee3 },
+  { 0x00ce76ad69cdc2fa, 0x36ada01ae092d5a6 },
+  { 0x00dc28b881989c39, 0xa6cf87a892bd3c6b },
+  { 0x00e19ebf9d0817cc, 0xfb057e262be1e5af },
+  { 0x00e55b27fe2e9635, 0x4cd21b8b698d1e31 },
+  { 0x00eaee22034aff60, 0x2f899b684c107d77 },
+  { 0x00f7985c20b8bdf3, 0xc557fac4d3f26775 },
+  { 0x012020625a322781, 0x5e47b37fd025e480 },
+  { 0x01293bd90a4579ab, 0xb7aed2f7d440681f },
+  { 0x01297d9b450455dd, 0x716db9658efb2fae },
+  { 0x012b8e6ef3b5fd5a, 0xabc94075c527709d },
+  { 0x0164f26f6b38a342, 0x08cd4a2d0212afc3 },
+  { 0x0173675d40a8d975, 0x763ee493377ca87d },
+  { 0x01abcc1d2d3cba87, 0xa3aa0eb97a9d7b9c },
+  { 0x01b09872dcd95564, 0x27761f0ed64aa42a },
+  { 0x01cb3e8dfab7203a, 0x9c62ba3b94b4e59f },
+  { 0x01e5c81258860dd8, 0x2f77339d58bc5f5c },
+  { 0x01e60a109a6a67c7, 0x0d3c0528381d0187 },
+  { 0x01f584bf67b0e464, 0x014a8c8b5ea470e3 },
+  { 0x02066b17f2908241, 0x2c6754c1a2d6302e },
+  { 0x021dbeb7417cac4e, 0x5f8e867393e742d6 },
+  { 0x024365007a87f213, 0xcbe8ef5f2e8e1333 },
+  { 0x025668e36a788e8a, 0xf8ac4f1be7e72043 },
+  { 0x026180bf641ff17d, 0x8577c33facf0edea },
+  { 0x0277c449fae63f6f, 0x1c8f94dedfcf0058 },
+  { 0x027a59a575b78860, 0xaed780b2ae7d001d },
+  { 0x028024fb8e5e5f18, 0xea586652f9799c96 },
+  { 0x02811151906e477d, 0x47c135db5b1699c6 },
+  { 0x02a5fc90a0d183f8, 0x70e8eebac1f16591 },
+  { 0x02ab2c47bc21e7fe, 0xafa015f90d7df776 },
+  { 0x02b71d3860126d9d, 0xe21073d237e502db },
+  { 0x02ced7ea2b7cb509, 0x748db6bfa227ebec },
+  { 0x02cee0b140d2f1a1, 0xefcfb1d482a5c392 },
+  { 0x02dcba28c614fec7, 0xca25955327128abb },
+  { 0x02e3f4ba156fb578, 0xbef7d7a0bf3400c1 },
+  { 0x033e21521e0bf4e5, 0x4e8816873943406d },
+  { 0x034c1434280b0f2c, 0x9f229777d790d1e1 },
+  { 0x0375f589f7da06d2, 0xd2be532e0d4d4b94 },
+  { 0x0383dc02cb82302d, 0xa3d155fd108bfe3a },
+  { 0x038e1e79c3d4410d, 0xefde4bfe0b99cc32 },
+  { 0x039cf18b459d33b8, 0xa8fca31d06c4c244 },
+  { 0x03b1051c93746783, 0x63c899914412cfc5 },
+  { 0x03c3f7ba4585e349, 0xdd12bfa7b34b7729 },
+  { 0x03fbcee0bc80e31f, 0x27254aea3d920510 },
+  { 0x03ff9e8a7af437f1, 0x6447fe88cea3226c },
+  { 0x04014d563b094e79, 0xac8974366f616308 },
+  { 0x041b5e56bbc650db, 0x574bd8db3fae2696 },
+  { 0x043f165f384fbea3, 0xea89393597951512 },
+  { 0x0443cfa9872cdb49, 0x069186413275fa21 },
+  { 0x045035f995272eb2, 0xdeb8820111745a07 },
+  { 0x047ac3b9faea6452, 0x2b7a23c4465a7aa8 },
+  { 0x04856e3006a4f5f7, 0xb4638da71dad3d88 },
+  { 0x049626cbfb1a5f7a, 0x5dc885a0c4bb758e },
+  { 0x04b488d4eef622d0, 0x22a0021375e7e339 },
+  { 0x04cf9e6898007024, 0x622ed6a0b295961f },
+  { 0x04dfb4acac1d0909, 0xe4c360fd2ac04480 },
+  { 0x04e737c9d53cd84b, 0xfd5ee679954e4706 },
+  { 0x04fccc7735155a6c, 0x1373d453b110c640 },
+  { 0x0519f395d5f7d76b, 0xe813b834aa51c0be },
+  { 0x0546f4e6b946f389, 0x56799dd00caab3b1 },
+  { 0x056f5d886a4e7e6f, 0xdd83650554997d0d },
+  { 0x056ff67dd9715faf, 0xa91fb8b0ddcc4a46 },
+  { 0x05824fcbe615dbca, 0x836d061a140a50e0 },
+  { 0x05aedf04803c43eb, 0x5e09dfd098d3fd01 },
+  { 0x05aff8f626ef8704, 0x32ae3b3d9d5aa301 },
+  { 0x05b45ba09c05befa, 0x75ac70476829eda0 },
+  { 0x05c60458ec69e7fe, 0x8b1be973852d84f1 },
+  { 0x05c765a63e61882a, 0xbd1c2d627b652225 },
+  { 0x05ccf96247af12ee, 0xf59698f1a060a54f },
+  { 0x05d61b925d3d2474, 0xbab83f0a79bb5df1 },
+  { 0x05eb4347f0ec8f47, 0x83983ca35ffd8d1b },
+  { 0x05ebd183ea854c0a, 0x1b56c218246fbbae },
+  { 0x05f11fb2e45c4e47, 0x424d3cb25414d278 },
+  { 0x060c865c782debb0, 0x47e6fd101c8923fc },
+  { 0x0614ed51acd027d5, 0x31e7c85c4f435292 },
+  { 0x0619e1c3286bbfba, 0xce040b8c3ec5add2 },
+  { 0x0651216c4a4a9c9a, 0xc5ada3013a317c72 },
+  { 0x0653285db2167550, 0x85bd025b93ea6a25 },
+  { 0x06742cf522f23797, 0x157f215a1dc8a1a9 },
+  { 0x0685bd0bcb975cee, 0xf7041749a5454a48 },
+  { 0x069c17beb1e8e055, 0x7adb8539fdcf6cba },
+  { 0x06b0194ce992584c, 0x365278e0d7323279 },
+  { 0x06b6c5031b8353f3, 0xa424a5b86b8fe409 },
+  { 0x06cfd57f0559f38b, 0x9293adae9128ff88 },
+  { 0x06d2f7674cea9776, 0x07f74c464ce600a2 },
+  { 0x06db908011065e5e, 0xbb37f4e253c2a0b0 },
+  { 0x06e5dc181a8eda1c, 0x31cc7c581c68b6ef },
+  { 0x071f84d10b343c7c, 0x05ce3e32af631687 },
+  { 0x072a6ea2181ca0df, 0x88ac0dedc67b239d },
+  { 0x073cb76b006af034, 0xfd150be3f5e0e7e6 },
+  { 0x073d7aff37b76014, 0x31e4f742c36c0dc1 },
+  { 0x074ec425ec20579e, 0x64a7ded592155d48 },
+  { 0x075069ad80cde15e, 0xca69e3c98bd66714 },
+  { 0x0751f342ee4cf28f, 0x2c9a6e8467c901be },
+  { 0x07973be3ecfd5523, 0x5bf59aa56bdef28c },
+  { 0x079fe9103515d15b, 0xc108577e234a484d },
+  { 0x07a3af1e18b63765, 0xb6807876366f5e8a },
+  { 0x07c76f2d88552d20, 0xad2c0ed7aef406c6 },
+  { 0x07f42847a79e4f5a, 0xe55cc03304b18c25 },
+  { 0x07f5004d26ea2b77, 0x6169bbfc41cc05a8 },
+  { 0x07f84db31e97ef8d, 0x08dc9fa8a5250755 },
+  { 0x07f91e33e76f53bb, 0x9d2731fd5d8a35a5 },
+  { 0x0805366f1b165a64, 0xb6d4df20d2c39d25 },
+  { 0x08188785e2b83009, 0x83529946dbeff4d2 },
+  { 0x081e2c114c9c20b6, 0x1acf25fc95c71bf4 },
+  { 0x082fdc8bd47fef01, 0x482ce5883c4ffdb8 },
+  { 0x0832fb2ee654bf93, 0x82bc57d2b16d2ffc },
+  { 0x083e7cae41a874b2, 0xf9b61736c37d2ffe },
+  { 0x085322bae40d904f, 0x53bdcc56df0593fc },
+  { 0x0856f202b18cd46e, 0x44fd1dc3b42e9bfb },
+  { 0x0866e22f6f56f92e, 0xa1a14c8d8d01d29c },
+  { 0x0891252ee4e30768, 0x9febccf3cfd8a8ab },
+  { 0x0894aa7be77521f9, 0xdf562be8d9555fe6 },
+  { 0x08989fa4ff537f5d, 0xbd611aff4019521a },
+  { 0x08bd4c1dcc843f6a, 0x0b563d9fd80b3b11 },
+  { 0x08bf437d012db07b, 0x05ff57a0c745c49e },
+  { 0x08d1b6d75206edb9, 0x99252caf542a2c7f },
+  { 0x08d60a58a691c7f6, 0x90162850302dc0e1 },
+  { 0x08e5960bb52d9a3e, 0x2c9954677b5e4472 },
+  { 0x08ea2fdaa22e5802, 0xc839ee7dfb0483dc },
+  { 0x08f4dc6f118f7c98, 0xe2406c180c08e78e },
+  { 0x08f853e8e01e7119, 0x19e734d85349220d },
+  { 0x0906c6e0e4bda9c1, 0x0cfa4c5fc64d2f4b },
+  { 0x090f0a7ef8a3f885, 0x048d213faa59b2f8 },
+  { 0x09274c3fc1c43bf1, 0xe362fda436651fd8 },
+  { 0x09388bf390cd9a86, 0xdc0849697b96c7dc },
+  { 0x0945081a6bd00345, 0xff3d58eb7a07330a },
+  { 0x0956285e24a18efa, 0x10c68a33846ca84d },
+  { 0x0963aa9f7f6cf5a3, 0x6ff700001583624e },
+  { 0x096649575e451508, 0x006b17e0353259a5 },
+  { 0x097074f24cde141f, 0xe6a0f26a10333265 },
+  { 0x097936b07e0e0117, 0xb9026ae6835eb168 },
+  { 0x09abfe9a312ce7c9, 0xf661582fdf12eab6 },
+  { 0x09e1ecf9bd2a3030, 0xd5670dba7a65e78d },
+  { 0x09e9ba0762fd0c3c, 0xf3c2e072cff79cac },
+  { 0x09f89bbfa2ab00f1, 0x964d200e12d7ced0 },
+  { 0x0a1b98937911d621, 0xb004b1617446d124 },
+  { 0x0a981c03204ac2b2, 0x78ba392674682560 },
+  { 0x0aa208060d7c140f, 0x20571e3341f5a3f8 },
+  { 0x0abf64ca504a116a, 0xdca80f77f85e00fb },
+  { 0x0ac0d491763153fa, 0xc75f5337ce32a9d6 },
+  { 0x0acaf71e60b89f6b, 0x6eab63db6ab84510 },
+  { 0x0aceb7c3bd13fe04, 0x8b77a1928ed4267d },
+  { 0x0ad9a358e361256b, 0x94f3fb4f2fa5a3b1 },
+  { 0x0adb21206de92e8a, 0xec5ef295805ebb90 },
+  { 0x0ae3497e731ca0bf, 0x6a77b23441d9d9f9 },
+  { 0x0af51ceb4aecc7a8, 0xfc89781ac44a1973 },
+  { 0x0afe6ae18966795b, 0x89314c3797dd2b1e },
+  { 0x0b01909ba84512fd, 0xaf224d3c3fd0cf8d },
+  { 0x0b1056f1091cfdc5, 0xeb0e2301f47ac6c3 },
+  { 0x0b170a67e97f0c3f, 0xd908e7529a218ae9 },
+  { 0x0b17ed42984000da, 0x8b727ca46143f87a },
+  { 0x0b24658714f8dff1, 0x10a693a2052cc207 },
+  { 0x0b33252b680b6500, 0x1e91a411e56e72e9 },
+  { 0x0b4e793c94251754, 0x98f5a65a3e960086 },
+  { 0x0b55399cf640a2a0, 0x0ba72dd155a0c140 },
+  { 0x0b577e63b0c64f97, 0x79f315dca8967587 },
+  { 0x0b8d3002d8f744a7, 0x53ba434a4d39249a },
+  { 0x0be9ad4729ecd50c, 0xadece9200f324a43 },
+  { 0x0bf19e40d5cd8aa5, 0xafb33b16569313e6 },
+  { 0x0bf1e354304f46c0, 0xcaf8fc0f6f5e9525 },
+  { 0x0bfabf1e98bdb180, 0x643f35f2165995d0 },
+  { 0x0c0392db94a20e4d, 0x006d885abbe60d8e },
+  { 0x0c336f83b0e6e3bc, 0x86c77f368448e77b },
+  { 0x0c35806ff0019a27, 0x0a7acae68de89d28 },
+  { 0x0c48e820301251fb, 0xb6bcdc89bd3555d9 },
+  { 0x0c54811cf3b1f157, 0x3c9164d5f19eca65 },
+  { 0x0c72cc3a6658c1ab, 0xd4b735ef55fa72e4 },
+  { 0x0c7926d660f903a2, 0xd6910c254660c32c },
+  { 0x0c7bd935d9a7f252, 0x2155e48315f44fa0 },
+  { 0x0c80751f6f7a3b37, 0x0cc9e9f39ad533a7 },
+  { 0x0cb7af80fd0ddef8, 0x4844481d85e5d29b },
+  { 0x0cc8224ff1edfe45, 0x8e8629e9e5fe3f5b },
+  { 0x0cdd9cc692e8b04b, 0xa8eb31fc31d72e5e },
+  { 0x0cebb0bb45a856b2, 0x3f56d21ce7d1bc34 },
+  { 0x0cec9e46a25d338b, 0xf595a29aa2606516 },
+  { 0x0cfdd2f3b243cac2, 0x1f38a0f09f54bead },
+  { 0x0d07d2c1be1a5eaa, 0xea235a533bcda781 },
+  { 0x0d08558f34a47e4e, 0xaa39d01c8efb81f0 },
+  { 0x0d09cff0d28033c0, 0x2c3290edfc3a5cea },
+  { 0x0d1b3abf681a2fc9, 0xa6aa31a9b0e8b445 },
+  { 0x0d27c7f5db349b59, 0x2f70f68daf5e8f3b },
+  { 0x0d35618b6d76ddd4, 0x6d2626e9e3e40db5 },
+  { 0x0d5af65ad3f19558, 0xe6f8e29bf2a9d0f8 },
+  { 0x0d6b974fe58a1bdd, 0x453600401c407856 },
+  { 0x0d786a41695e5fc8, 0xcffd05a6dbb3f659 },
+  { 0x0d7e630a14856f4d, 0x52c9666040961d4d },
+  { 0x0d90a0ee73d55539, 0xb7def24c88caa651 },
+  { 0x0db4f4150fecf77e, 0x4ce72ca4d04c052f },
+  { 0x0dd0658ace9a31a5, 0x71a9de966985a068 },
+  { 0x0dd4c69b5f9a7ae9, 0x6a7a08329496779a },
+  { 0x0de53160a8b54c3a, 0xa5aed8d68c970b62 },
+  { 0x0dfbdadf8f1bc718, 0xe7e1bb3ccd5fef3d },
+  { 0x0e0808227ef41f68, 0x25c06f25082c2e56 },
+  { 0x0e08cd2c5bcf11c6, 0xa7e5a009a7715b6a },
+  { 0x0e224ea74310da4e, 0x7e2103400eb1b4bf },
+  { 0x0e23d0ed4c33b201, 0x1ab4cc93a7619683 },
+  { 0x0e4b2b6e014a93ef, 0x8be896823da0d4ec },
+  { 0x0e713d4e272ea732, 0x2c5b27d645f56dd0 },
+  { 0x0e7e73421606873b, 0x544e858c59dc283e },
+  { 0x0e86470791b26292, 0xabe1c64545c47985 },
+  { 0x0ec93f519bb769e0, 0xd9f80e61f6cc8023 },
+  { 0x0ecdb07bf9b36ef1, 0x8f3780ef48e6c709 },
+  { 0x0eebfb60d437796d, 0x536039701ec43845 },
+  { 0x0eecb5f58f55de9d, 0xb4eedb3a0f6b74a8 },
+  { 0x0ef64cdbecccb704, 0x9752a3de0b7ade14 },
+  { 0x0efc91e45f61023c, 0xda9d086a7d3c402f },
+  { 0x0effef4a341f8eeb, 0xab65621c60c48787 },
+  { 0x0f14c03050b35d6b, 0x1d8850b07578722d },
+  { 0x0f24ca5668b4ab5d, 0xfaf217933c505926 },
+  { 0x0f2e09c71cc216f7, 0x9d22a804152ba24b },
+  { 0x0f341d1f4e144e31, 0x63d9a5fc5a662b79 },
+  { 0x0f39fc03d579d0d9, 0x3a6b729a3746843e },
+  { 0x0f604cd4c9d2795c, 0xf5746e8af7948064 },
+  { 0x0f643c34e40e3f1d, 0xaafd9c524d3ffe64 },
+  { 0x0f6676b05621f80c, 0x670966e2995b227a },
+  { 0x0f738dc444375576, 0x24eb277ed7ad91c9 },
+  { 0x0f8043715d66a4bb, 0xed394ef801d99862 },
+  { 0x0f95264089c99fc2, 0xa839a19872552004 },
+  { 0x0fba7d8c3520bdb6, 0x81f75494e498ec36 },
+  { 0x0fbf618be43d4396, 0x856d4244126fe7dc },
+  { 0x0fc161704c46e16f, 0x7483f92b06c1558d },
+  { 0x0fcff6fe3b0769ad, 0x5d0cf82814d2a6d9 },
+  { 0x0fd72a13b3b6103f, 0xc825a692c71963b4 },
+  { 0x0fee596b974c9d3e, 0x70b367a3671599b6 },
+  { 0x101ab60f4000a5d1, 0x3792ef0abad5f74b },
+  { 0x102672bbd7e25cd7, 0x9f4384dd7214c32b },
+  { 0x103e9d616328969f, 0x5d7b4e0a381b25d5 },
+  { 0x103f1756d9dc0dd2, 0xb16b53ad0f0f1859 },
+  { 0x104468e44898b8e9, 0xfa4a1500fde8d4cb },
+  { 0x106326c262dfd3e8, 0xeaeabd961d2a0519 },
+  { 0x106855474c69d08c, 0x8ffa308d47337269 },
+  { 0x107cc025334211e6, 0xd29da0b6be46aec7 },
+  { 0x1086ff69f82b68d6, 0x776634f336fb4857 },
+  { 0x10958cd0a1a81d59, 0x9005f1797ab0e51d },
+  { 0x10a3cd14e5dcfdde, 0x6ff216a14ce7b7dd },
+  { 0x10af8728f975aa35, 0xa99d0965de8f714c },
+  { 0x10c47acca2ecd212, 0xb900ad3cf6942dbb },
+  { 0x10c8cfd8c37522f1, 0x1d47540ff024e5f9 },
+  { 0x10eae73a07b3da04, 0x4b72473d8d366267 },
+  { 0x10f0ecaf962aef1f, 0xc28abed870b01b65 },
+  { 0x10f62443f1ae087d, 0xc588a77f9e8f43e9 },
+  { 0x110ac8ecaf1b69f4, 0x1bc94c59dfcb8b2d },
+  { 0x111029770226b319, 0x524134193886a10e },
+  { 0x112afb9c6777d652, 0x968f31328a327a01 },
+  { 0x11330eaa5dd26290, 0x52fac37cfe1a0b7d },
+  { 0x113cd09c9771ac27, 0x8544b7e90efe7df2 },
+  { 0x114c599454d32f74, 0xc728a6e1f71012ba },
+  { 0x11ad7b3e15c8cb32, 0x23d5349795bef4ad },
+  { 0x11bcf5c752088b5a, 0xaf86d6c7a6a11e8d },
+  { 0x11e30ddeb4004385, 0xb7079dc96a50459d },
+  { 0x11e7e0d9437ec98f, 0xa085284cf16d0eb4 },
+  { 0x11f55cdbb4e059f5, 0xca56c509c57cb510 },
+  { 0x11f9532557e4c956, 0x9f4b242164006161 },
+  { 0x1201c18cf00d2c23, 0x6f42e4d7d8c86aa1 },
+  { 0x12080205f669b8e7, 0x783b976f8cf3d8bb },
+  { 0x12123b534bdee79e, 0xd7563b9ad74f1cbd },
+  { 0x1228c01cd3c4b9c4, 0x77540c5adb306d2a },
+  { 0x1266b3fd632c981f, 0x3ef9bdbf9f86ce9a },
+  { 0x1267e3c6ca951ff1, 0xdf6f222c8f813d97 },
+  { 0x126f7f64b7b00e25, 0xdcf5e3710b4cf8b8 },
+  { 0x1278f74ca1dfaa91, 0x22df3eca3c5bcaad },
+  { 0x1287535256bf5dff, 0x404839ac9e25c3e7 },
+  { 0x12937db3d4a80da5, 0xc4452b752891252d },
+  { 0x12bca8305d5ab8ea, 0x51fe1cfd95d7ab0e },
+  { 0x12d7e0d6b187889f, 0x8d150bf7034d1db2 },
+  { 0x130c5742cd6cbe48, 0x77704d733d5b08ca },
+  { 0x1323c45d660f5a5b, 0x6d5ea45c6c4cbe4a },
+  { 0x133456269a03e3fd, 0xae6cddd65754c50d },
+  { 0x133a4234512e8c4e, 0x9e8c5651469d4a09 },
+  { 0x133b56de011d562c, 0xbab665968bde352b },
+  { 0x1343de49c2a50d99, 0x176255f99f0d0234 },
+  { 0x13448eb5ba575e8d, 0x7b8d5b280ea6788f },
+  { 0x1345e972dbe08ea3, 0xe70850902e20e1a5 },
+  { 0x1351c67b42770c1b, 0xd758c3e42f553fea },
+  { 0x135708b9a7dd2057, 0x6c1b66ab2a41860d },
+  { 0x13584411da0a8d43, 0x1991035423fdc0dc },
+  { 0x1367e41858be5257, 0x10eb04d0dab53505 },
+  { 0x136f75c4dd02c292, 0x83752b7e5799f978 },
+  { 0x137373599e9b7bf2, 0xcf162a102eb5927f },
+  { 0x13895ef15610af0d, 0x0f89d588f376b3fe },
+  { 0x13a37cf8170a3a34, 0xce311b89bde82032 },
+  { 0x13a991bc9c2ff037, 0x53aeb322d3e3e2e5 },
+  { 0x13aa1f9ac4249947, 0xe4af61319d9a08f2 },
+  { 0x13abc32f803165c4, 0x58bb086fa57195fb },
+  { 0x13ccc692f111d52f, 0xec75d83df16192e2 },
+  { 0x13d8326bf5648db4, 0xdafce45d25e62ddd },
+  { 0x13dfb095e519a555, 0xa5b60b7d9d7169f9 },
+  { 0x13e133a1efc1b55f, 0xcd76cbb3ae7cf333 },
+  { 0x140909d204abd684, 0x1c64cdad4d7765b4 },
+  { 0x14163eb2a3ddd355, 0x76bd8527eae3b45e },
+  { 0x1423f560062c4f3c, 0x669d55891a2bcbe7 },
+  { 0x1428029e76279706, 0x9ad795ce7c6a1a93 },
+  { 0x143918368f4f4dff, 0xf90999188c0197c9 },
+  { 0x1442d1b35a6478fb, 0xa22ae7dd1fcb5634 },
+  { 0x148471144ccebd7f, 0x6aa9aa9215896533 },
+  { 0x149b543c917c180a, 0x1b02d33c12415206 },
+  { 0x14a56b493a8d9d10, 0xe94a3e100362e3a2 },
+  { 0x14b1e30982962c72, 0xf426e2e763eb4274 },
+  { 0x14c2548712099c22, 0x0964d7f044c59fd9 },
+  { 0x14d365bbfaac3d20, 0xc6119591f57acca4 },
+  { 0x14dbb3686dd31964, 0x332dc2ef0c55cad0 },
+  { 0x151c33a71b99e6bc, 0xffb34b43c6f0ec23 },
+  { 0x151fa3218d8d7600, 0x114eb5bcd79c85cb },
+  { 0x152c253478b009c2, 0x75e18cd731b48561 },
+  { 0x153f40e335e5cb90, 0xf5ce02e54934ab62 },
+  { 0x1542662f665d2ffa, 0xa77b4b897dd2e2af },
+  { 0x155fa7f479dcba3b, 0x10b1494e236d6010 },
+  { 0x157356f80c709ab6, 0x75961d8b8b207e20 },
+  { 0x157bddb7192754a4, 0x5372be196797f284 },
+  { 0x159e5cd6ccb96801, 0x5f49aed5adbc91eb },
+  { 0x15a0d59304dece2c, 0x7d0580f3ea3527f0 },
+  { 0x15b498199ed0ed28, 0x057bf0dbdce9b8d8 },
+  { 0x15b9f5e2439bfaa0, 0x8874b5184261c777 },
+  { 0x15bcd74f2f1f2a63, 0xe1aa93e90d2c0555 },
+  { 0x15bf2ef7583bfcbb, 0xba630847a1dc5539 },
+  { 0x15c11ab6e4502b20, 0x10b18366133fc322 },
+  { 0x15dd21c2608e0d7d, 0x9f54c0d3f08cca1f },
+  { 0x15fe28d0c8893be9, 0x223e8cb2d032e557 },
+  { 0x1619bc27632f9148, 0xd8480cd813aa74c3 },
+  { 0x161ded4a85d3c78e, 0x44fffd40426f537f },
+  { 0x16229d61d7b0c89b, 0x01853660a8da22bb },
+  { 0x163e7e757e2dc444, 0x69123ff0e5daec5e },
+  { 0x169d4c7bd3a4d09e, 0x184a3b993823d048 },
+  { 0x16baafb06c06aa47, 0x5aa671f234399e05 },
+  { 0x16cb43492987d2f3, 0x2b423817cdaaf7c4 },
+  { 0x16cc6d1b4ddce51c, 0x767a1ba8e5ff196c },
+  { 0x16d69f71bf584663, 0x9be5ff16483f0498 },
+  { 0x16e04823887c547d, 0xc24bc70dff693df4 },
+  { 0x16ee443c990215f6, 0x1f7dd1e55a0d2256 },
+  { 0x16f494f20af5dc80, 0x3bc35939ef924020 },
+  { 0x170e7589a48739cf, 0xb9cc782cbb0fe25a },
+  { 0x171cd6b55267573e, 0x6a9c2921fb720794 },
+  { 0x171ebf135b13ba90, 0x7f462c10d88a2c25 },
+  { 0x1733772165d7b886, 0xa94e2b4ed0f74ccd },
+  { 0x1738b2e3f25ab3ee, 0xf3cecb95e1d0d957 },
+  { 0x17512d0c38f44871, 0x2f49f36f9d185c4e },
+  { 0x17515a4d0b7ea502, 0x9ffff7dfa8456671 },
+  { 0x176d3fba7d687f2b, 0x23158098e103c34a },
+  { 0x177504abd4260c42, 0x65e1338955e9fa47 },
+  { 0x1782929e1c214b70, 0xfb6884f77c207a55 },
+  { 0x17ba72433dd41383, 0x065d4aa6dedb3d91 },
+  { 0x17badbb3f54d1fc0, 0x1ee68726882f26a6 },
+  { 0x17bbe288c3855c23, 0x5950fea91c9504e9 },
+  { 0x17c0a63f9a680e7a, 0x61beba81692d9297 },
+  { 0x17d000a2882f9fda, 0xa8b4a391ad367f00 },
+  { 0x17ee158d15e4a34f, 0x57a837bc1ce2b0ce },
+  { 0x17ee23e5da931be8, 0x2f733917adcb6386 },
+  { 0x1802cc46b879b229, 0x272501998c5de04f },
+  { 0x183020a80848e06a, 0x1238a1ab74079d52 },
+  { 0x1862fca4f98e66f3, 0x63308b859b5863af },
+  { 0x18a970bea7ac4d29, 0x707c8d5cd559d03a },
+  { 0x18b28b386abdadb3, 0xa700ac8fb68e639a },
+  { 0x18b476a34ce5e6db, 0x2c032029873ac39b },
+  { 0x18b6a3e2b53596c1, 0x5f64d1834ba1ed34 },
+  { 0x18be8981b8201638, 0xf3ed8ae92bb4c215 },
+  { 0x18bebbbd41c234f8, 0x2b1717b1905e6027 },
+  { 0x18d26111cef66dff, 0x0c8af8cf0e117843 },
+  { 0x18dc28bc22402f21, 0xe1c9b81344b3b8c5 },
+  { 0x18ed63e3ce5bc3dd, 0x2d8bd188b807f1a2 },
+  { 0x18f299edb5ba709a, 0x64c80c8c9cec24f2 },
+  { 0x19098c46da0640f2, 0xb5763167dea6c716 },
+  { 0x191449e40b0c5641, 0x1c70772706f79224 },
+  { 0x19162393786098d5, 0x0587827588198a86 },
+  { 0x191ac4eec767358e, 0xe3ec3756c120423a },
+  { 0x192aa2e8c795c9e1, 0x0a7913e5d41feb81 },
+  { 0x193f060553ba0a2a, 0x2676f91d9ec0c555 },
+  { 0x1942bdb7abc75e41, 0x2068330a9082b0ff },
+  { 0x1986f864e32e3e8d, 0x198b5becf3022257 },
+  { 0x199985cae1c0123a, 0xb1aef921daace8be },
+  { 0x199eb0b8dce1408f, 0x3f7d46411b715ca9 },
+  { 0x19a9d3f9fa1b1358, 0xfb53009444247aaf },
+  { 0x19abaf2144b6a7b2, 0x81c4112cff154904 },
+  { 0x19b3b80750765351, 0x6985ba95da92499d },
+  { 0x19d6956ff17a959c, 0x48fcd8f4706a848d },
+  { 0x19d9b5f8428947ea, 0xe6f8e97c7f33bf44 },
+  { 0x19e739c2764a5ab9, 0xed08f9095aa2af0b },
+  { 0x19e761e53e5ec8e9, 0xf2fceea62715ca06 },
+  { 0x19f2680259c02945, 0xa221627e2ffec18a },
+  { 0x1a23540d91f87584, 0xa04f184304a00648 },
+  { 0x1a613ce60fc834d4, 0x970e1e674b9196b3 },
+  { 0x1a624e236526c4c8, 0xf31175e9c89b2a22 },
+  { 0x1a8204a2bcd793f5, 0x39168773d9ad6230 },
+  { 0x1aa7344b563c597e, 0xecfbfcf8e7093c27 },
+  { 0x1b0f3d7af668eeea, 0x38ddd6182d8f48fb },
+  { 0x1b1daaa9aa5cded3, 0xd633bfcbeb06479c },
+  { 0x1b22a3d79ddd7933, 0x5b69c94dd9b3e44e },
+  { 0x1b4b06c2a14ed3ee, 0x73b7d0fd61b6aaf5 },
+  { 0x1b5a8da0622bffce, 0xe4c5b42aed4e0ef0 },
+  { 0x1b8c3c0bfb815b2a, 0x1010bba95998b66e },
+  { 0x1b8d35d93697450e, 0xa26ebf7ff17bd4d1 },
+  { 0x1bb91bae919ddbd6, 0x55fa25c54ea6f532 },
+  { 0x1bc2427ac9b032a5, 0x2fe527c7b26ce22c },
+  { 0x1bef389e3dd2d4ca, 0x4f2f60d42c932509 },
+  { 0x1bf503c724001b09, 0xbe79c515ecfcbd03 },
+  { 0x1bfae770e089fa81, 0x412d04eb299f4c3f },
+  { 0x1c3f3133a3e5b023, 0xc77ecba94fd65995 },
+  { 0x1c5796d277d9e4df, 0x3f6648f7012884c4 },
+  { 0x1c666ba5aac19b81, 0x671357e76062989b },
+  { 0x1c6eb740d3c48576, 0x6cade566abab8208 },
+  { 0x1c85c0fc480bbd69, 0xdc301591b6ecb422 },
+  { 0x1c8c42d1aee5010b, 0x30e7f1992d69216e },
+  { 0x1cad3b56cc0e6e85, 0x8554e46d08952861 },
+  { 0x1cafa9f3f9a2fce4, 0xaf6e4b85a2bbd254 },
+  { 0x1cca2197d95c5a41, 0xf2add49a13738055 },
+  { 0x1cf59fc7b11cdbce, 0xfe931e41641772f6 },
+  { 0x1d1d2603ec139867, 0xc1d1f5ddf83093f1 },
+  { 0x1d284d6a3f850baf, 0xb25635a12b316f3d },
+  { 0x1d2a28eb8c95da0d, 0x6d6b18294211839f },
+  { 0x1d4e0a034ad1275b, 0xc4d75165ae236105 },
+  { 0x1d5eac85e67b8cff, 0x1377c8dba1136929 },
+  { 0x1d67c50baff2df77, 0x1c32e2f915879176 },
+  { 0x1d6ed6fe9dfbde32, 0x708e8353548cbb80 },
+  { 0x1d72cc6ee466a4af, 0x1b27587b900ed430 },
+  { 0x1da2da7974d2ca73, 0xa823523f82f517b3 },
+  { 0x1db3bc4601f22cf4, 0x3be7ce015d74f59a },
+  { 0x1e060a8025512ad2, 0x127e3da11e212ccc },
+  { 0x1e0ef01e330e5b91, 0x387f75f700ccaf8f },
+  { 0x1e1290ea102e12d7, 0xac52820961457e2b },
+  { 0x1e272d09c0e55f5e, 0xf14fcb76a735f6d7 },
+  { 0x1e31b3a48865ba98, 0xd4d1aa5205115983 },
+  { 0x1e587ca91518a477, 0x53a28217cd4fd586 },
+  { 0x1e750000af77cc76, 0x232f4d040f4ab060 },
+  { 0x1e85f8bccb4b866d, 0x4daa9fcf89306474 },
+  { 0x1e89f722494608d6, 0xea15a00d99f81337 },
+  { 0x1ea1abcd2d3d3d62, 0x8f59a99a9d41b13b },
+  { 0x1ea980574416bfd5, 0x04f62575ba524005 },
+  { 0x1ec57bbd27bdbd08, 0xb60c391c4895c1cf },
+  { 0x1ec5bef77b91e593, 0x13cba205f15b06d7 },
+  { 0x1ede4f365ce1386d, 0x58f121b15a775e24 },
+  { 0x1ee2cfc7d0333b96, 0xbd11f7f3ec8ce8bc },
+  { 0x1ee9c1ba95cef2cf, 0x987d63f176c54ac3 },
+  { 0x1eebb6c3ad8153b4, 0x6bf45b17d879d2e5 },
+  { 0x1ef04e7e508296a8, 0xd9eb61cc7dae2e5d },
+  { 0x1f21666b8f78b650, 0x51b7a609f1d48608 },
+  { 0x1f2ae0c70a04c980, 0xc838c2cdc412cf45 },
+  { 0x1f349dd41c3f93c4, 0x214e5e308dccb056 },
+  { 0x1f40eefc7447336a, 0xe6cd8ffa5eb325be },
+  { 0x1f562b89d081e36d, 0x58e6fc943512ec05 },
+  { 0x1f5a2927a0b2faf8, 0x7540b01d9d7d7fd1 },
+  { 0x1f60e48ad98b659a, 0x05ce0c1a8e999ad9 },
+  { 0x1f773a94d919b2a3, 0xc647172bbb97f6b4 },
+  { 0x1fa58679d4a39052, 0xbd9db059e8cda4ad },
+  { 0x1fa7a42c2c7d6b7a, 0x0c6a05d38c7508f4 },
+  { 0x1fa86282403fa35d, 0x103ab88a9d603c31 },
+  { 0x1fab68fd67fe5a86, 0xb2c0a9227a59bb95 },
+  { 0x200309c8fba0f248, 0xc13751ed4fc69bab },
+  { 0x2008c76deba59532, 0x01ef75a09b2ff7dc },
+  { 0x200a9d2a7cb4441c, 0xe4f002df6aa47e38 },
+  { 0x2016726db38ad6a6, 0x8b4c48ba6fe51557 },
+  { 0x203049f4d8290bb4, 0x521cc4402415e737 },
+  { 0x203abb713c00b088, 0x4206dcc656caa48f },
+  { 0x203b1efc6101d4b9, 0xd83bb6cc1c71f67f },
+  { 0x205070b6a0d45496, 0x1dd9196a8e81d877 },
+  { 0x2058cf3fefad4d2b, 0xc03ed817cedddcd4 },
+  { 0x2091af29b4e7b869, 0x14d79d9aaa4cbd20 },
+  { 0x20ae62fb69c6cc6e, 0x8098cca8cd080487 },
+  { 0x20d4457ba2251725, 0x3fcb62967af11b37 },
+  { 0x20dca534b997bf60, 0x7d658e77fbb3c0ee },
+  { 0x20edcc3aa6c18925, 0x9fa7e2f044a99c49 },
+  { 0x211774f4c5739042, 0x618be8ff67351177 },
+  { 0x211f76dff0b7dad3, 0xf6fcac9d938ee61a },
+  { 0x211fbbdbbca1102d, 0xc5b43dc8157c09b3 },
+  { 0x2124cf92978c4668, 0x4b6c39ccc2e33713 },
+  { 0x21299c8c3ac1d54f, 0x8289d88702a738fd },
+  { 0x212d0b200ed8b45d, 0x8795ad899734d7d7 },
+  { 0x213e5e82ecb42af2, 0x37cfed8612c128ac },
+  { 0x2162266b906c939b, 0x35c84ff9a0f50ad1 },
+  { 0x2179dfd7edee76ef, 0xafe698c1bc763735 },
+  { 0x217b1452881264ac, 0x75126bf77b8d0db8 },
+  { 0x218b76f5a4142dc2, 0xea9051a768583d70 },
+  { 0x218c0fe53dfaaa37, 0xf3c823f66eafd3fc },
+  { 0x21a96301bb0df27f, 0xde2e7eefa49e0397 },
+  { 0x21b09c40295c2d70, 0x74a83ae040f22edf },
+  { 0x21d2c435bcccde77, 0x92d82844b3cf60f4 },
+  { 0x21d7334e406c2407, 0xe69dbddd7cec3583 },
+  { 0x2228c67d25e50760, 0x3d4873d3934f0757 },
+  { 0x22319be7a640af53, 0x14ec3c482cceb676 },
+  { 0x2240655247d6de1c, 0x585564004a853ab7 },
+  { 0x225522777dc71556, 0x27808bde0c1d0ef0 },
+  { 0x22675cacd9b71dea, 0x21800cbf8597f000 },
+  { 0x227532d82505c3c1, 0x85a878273c285d5f },
+  { 0x22abbdcb094d0143, 0x88d529352abe9b4b },
+  { 0x22b22c4ce2403030, 0x12e8a9596ae8d189 },
+  { 0x22f6b40fc82110d6, 0x8e50a1208ae0bb97 },
+  { 0x2319922df4d0c820, 0xb3e5f15faa870cc3 },
+  { 0x2327456f86d7e0de, 0xda94758c518d05b3 },
+  { 0x2351d26d0bfdee30, 0x95bec9c05cbcf7b0 },
+  { 0x2353725ec98e0f00, 0x73462109e886efd7 },
+  { 0x235436ab0832370e, 0x73677c9c6f0c8b06 },
+  { 0x2365e1534d67f94d, 0x8670394ab99150ce },
+  { 0x238976ea238ba2f6, 0xd85ad30d5ac50280 },
+  { 0x23d445ea19a18fb7, 0x8d5035878d9fb649 },
+  { 0x23e4ca038aba1198, 0x2e1694559f3be10f },
+  { 0x23fad5a125bcd446, 0x3701c8ad8a0043a9 },
+  { 0x240bfbac5163af4d, 0xf5ae713985386f92 },
+  { 0x2418fa5ecfb685f7, 0xbb70bc4527e9d966 },
+  { 0x2432f33fd278dea5, 0xfe6ae94073627fcc },
+  { 0x2434102f30eeb477, 0x92cf0825e368229b },
+  { 0x24385ba7f5109fbe, 0x76aadc0a375de573 },
+  { 0x2447e17a4e18e6b6, 0x09de498fe4ab52ba },
+  { 0x244c6de27faff527, 0x886fc7699a41c3be },
+  { 0x2450dfa1df70d12b, 0x60683185775efed8 },
+  { 0x24544ee5d76f5799, 0x92d9522e9b238955 },
+  { 0x245f07c8603077a0, 0xcaf5f83ee6cf8b43 },
+  { 0x24759be31e8fe55d, 0x2829fd86bdf3181f },
+  { 0x247fa1a29ad90e64, 0x069ee13d96fea6d6 },
+  { 0x248668b364514de5, 0x90382a7eda2c9834 },
+  { 0x2496d404bfc561a4, 0x0a80bea6a69695c3 },
+  { 0x24ad538291eb5f5c, 0xac4b9998f3b851c3 },
+  { 0x24aff972d58990f9, 0xb88a6d787c796f1e },
+  { 0x24b5f4bbdb853eca, 0x38ea0cae2dfe73a1 },
+  { 0x24b9adac1b4f85b0, 0xbac9bf9b9e180906 },
+  { 0x24d018c4a6de7e5b, 0xd19a36f2b879b335 },
+  { 0x24d9a55d8f0633e8, 0x86a1b33ee1e0e797 },
+  { 0x24df052902aa9de2, 0x1c2b2525eb84a255 },
+  { 0x24fbf8250a71611e, 0x40ef18552e61b009 },
+  { 0x2516f4f4b811ede4, 0xecf6fbeb5d54a299 },
+  { 0x2517827950fee41a, 0x3b9de60275c8aa6a },
+  { 0x25265d0e7f88b302, 0x6003809f25ee025e },
+  { 0x25472dfdeef6a425, 0x81a231d631d6b04d },
+  { 0x25710bde8fa181b0, 0xc5cf0846b983bec1 },
+  { 0x257bc3b72a6b5db3, 0xfd0d47619125b387 },
+  { 0x25a21c47afe925a3, 0xca0806876a2b4f3f },
+  { 0x25b52bf8dd215bcb, 0xd59c9abdb55c44f8 },
+  { 0x25b6dc012cdba637, 0x04ea9535c6987beb },
+  { 0x25bb080457351be7, 0x24aac8a02021aa92 },
+  { 0x25d4be3309b89583, 0xc6b39d9f93bf654f },
+  { 0x25e73efb9a6edf11, 0x9114718bd2f646ba },
+  { 0x25f2e760cd7f56b8, 0x8aac88d63757d41b },
+  { 0x25f879ff678130fe, 0xa615ac418e7943f1 },
+  { 0x25f9cf703575c5d6, 0x3048c222f5463758 },
+  { 0x260c787e8925bf36, 0x49c8aeae5b97dcc0 },
+  { 0x262ccb882ff617d9, 0xb4b51f24aee02cbe },
+  { 0x265a85f66544eaf9, 0x5fda06c3d9e48abf },
+  { 0x265c74a956500bd3, 0x1efd24adc6d5ccf6 },
+  { 0x2683d29a282dd059, 0x535ac3bb250f540d },
+  { 0x268f46038e293015, 0x68fa9e443e16e960 },
+  { 0x26bc2bdf447a1737, 0x6aea7ef187ff6e44 },
+  { 0x26f4f8b098609164, 0xeffef7809e0121e1 },
+  { 0x270229c6d5578446, 0xe6a588492e4e5910 },
+  { 0x2712e91f6f1dc55e, 0x90e2b14b27c042ac },
+  { 0x271bfd5dc2673d38, 0x2019f1fb6cab9332 },
+  { 0x273ce50db5a0d6da, 0x7ea827a54f44dee9 },
+  { 0x274d17ccd825ef9c, 0x728d68394b4569d2 },
+  { 0x277c7281ac945b83, 0x31e2e6fcad560c11 },
+  { 0x277cca62014fceeb, 0xb46c549bac25a2e3 },
+  { 0x277fa4b9a6bb7a8d, 0xcea2c5f38a4c25f0 },
+  { 0x278155fc9956e9b6, 0xef2359eb238f7c7f },
+  { 0x2783006ee6519f15, 0xcbc96adae031c9a9 },
+  { 0x278531cc31915747, 0x018d22145823d2c9 },
+  { 0x278f14887d601b5e, 0x5b620f1870bc09f6 },
+  { 0x27a5d2d0c74c8e4b, 0x2c05b94c9f098eea },
+  { 0x27baecd618e7e53d, 0xc11f2a9c559f529d },
+  { 0x27c4c2af4b46394b, 0xb98638af8e0f6e9d },
+  { 0x27c6a2ca16ad7d81, 0x4626ceea62fa8fb4 },
+  { 0x27f9e2e1b92af9dc, 0x17c6155605c38e49 },
+  { 0x2808dc745ff4321d, 0xc5c8122abef6711f },
+  { 0x28148a52b1955ce1, 0x2c7a74d3a3e620a4 },
+  { 0x281ff9bd04706438, 0x53de5cbd6d9e17f5 },
+  { 0x2823364702595fee, 0xa24a3fbee138a243 },
+  { 0x2825f4d068feba69, 0x73e61c84649489fe },
+  { 0x282a77841cb3d33a, 0xf5b56151acba770e },
+  { 0x283cb03ee031c842, 0xbeabdad1aa4e7dbc },
+  { 0x283dee88f295834c, 0x4c077d788f151125 },
+  { 0x284ca61b2407bdba, 0x3938048b0a559015 },
+  { 0x2854e5dfb84173fa, 0xfc5bf485c3e69d5a },
+  { 0x2880c6b59bd54b15, 0x3174676e465167c7 },
+  { 0x28a2bea8f84936cb, 0x2e063f857414cda0 },
+  { 0x28a4cd87fb9de4ee, 0x91693a38611cb53c },
+  { 0x28d5df3ed036ed63, 0xd33a31d0d8b85c47 },
+  { 0x2903896d88a34151, 0x1586d69fcfc20f7d },
+  { 0x291bcdb05f2b37cd, 0xf9452d2bf08e0321 },
+  { 0x291cc37604bc899e, 0x8e065c30153fc4b9 },
+  { 0x291dd47588b9158b, 0xeebe4accc3a093a6 },
+  { 0x292a0bb975b2587f, 0x9ac784c960e1b453 },
+  { 0x292f2446a0325b7b, 0x423e88a2ebfeb5a0 },
+  { 0x29396db58406084e, 0x416032c372734a3e },
+  { 0x2942680c47beb9bf, 0x713a910706ffabfe },
+  { 0x294762000e853b43, 0x19f9991c1ced5dfc },
+  { 0x295f3679bdf91ca5, 0xe37da3f787b29997 },
+  { 0x29630a20d356fb58, 0x685b150bfa8f00c3 },
+  { 0x297236cb9156be35, 0x679f83c4e38ee169 },
+  { 0x297c405afd01f3ac, 0x48cdb67b00d273fe },
+  { 0x2982e655dffc89d2, 0x18a0a3072cfc6811 },
+  { 0x298387b0637173d2, 0x002770a649b4fbca },
+  { 0x29843f43b81f3736, 0xbf35c00b1bb88fb2 },
+  { 0x29949f893ef6cb9e, 0x8ecb368b9e99eee4 },
+  { 0x29dfa26b7988af99, 0x84d617708e4fc6e2 },
+  { 0x2a0ba55e56e7a596, 0x146fa729acf0e109 },
+  { 0x2a10053fd08664c7, 0xcfbbb104386ed77f },
+  { 0x2a1b454a5c3832b0, 0x240111e7fd73de8a },
+  { 0x2a2f46b3f4000495, 0x239cbdad70f17c59 },
+  { 0x2a33e21447bf9e13, 0xdcfed85077ff6b40 },
+  { 0x2a360bc85bf22de4, 0x38651cf92ffda1de },
+  { 0x2a9f9001540c55a3, 0x02befd8e9d54b47b },
+  { 0x2aa5e56d36c2e58b, 0x6f2856109f2099a9 },
+  { 0x2aba6a1b01a5859e, 0x96d6a66d2286772f },
+  { 0x2abc3d46b3f21401, 0x60759e2e10bc86d9 },
+  { 0x2ac3a08cfbf1942b, 0xa169c3e9e6c47e09 },
+  { 0x2ae700c9dba843a6, 0x8dfdca40d7d86bd6 },
+  { 0x2aeedcc6eb1602ef, 0xb77161b0cef832ab },
+  { 0x2b1589c7e1f394ae, 0x6a1c046944f06688 },
+  { 0x2b27eb194e13f3b3, 0x8d23c879cc1e3abf },
+  { 0x2b42da79a682ed6e, 0x2d735facbf70107e },
+  { 0x2b430c00dc79e495, 0x762ac59b2f9b4fcd },
+  { 0x2b71a59a53be5883, 0x399917bf582b7772 },
+  { 0x2ba02f509a4991aa, 0x176ba8d9e540df3d },
+  { 0x2bb0a1f1dee5226d, 0xe648eb5f1c97f067 },
+  { 0x2bb9f4686f7e08c5, 0xfcc69ec1a1c66fe7 },
+  { 0x2bc26619e31710a9, 0x884c110d8430c1da },
+  { 0x2bc6c53b19e0097a, 0x242f22375a6a60ff },
+  { 0x2bee7f226d506c21, 0x7163bad4ab1768c0 },
+  { 0x2bf34b6ad7d2317a, 0x2d0808b3fb93571b },
+  { 0x2c0dc885d5ede94a, 0xa664bf3081add34e },
+  { 0x2c29182edf0965a7, 0xf56fe0897d2f84ba },
+  { 0x2c2aea31b01c6126, 0xc1a43e10cacbfd58 },
+  { 0x2c3b2843295c9d6b, 0x16996971180a3fe9 },
+  { 0x2c3b9c171e214e9e, 0x46bbaa12bdf8977e },
+  { 0x2c45c3eb819a7972, 0x37820a1816c532eb },
+  { 0x2c6caeb16c310230, 0x8015ca9f0a400365 },
+  { 0x2c8835aed7f52a0d, 0xa9ade5226ee5aa75 },
+  { 0x2c8c11295d8613f8, 0x75b7bcf5253ab9bb },
+  { 0x2c9fadd510509cc7, 0xf28f1ccba931855f },
+  { 0x2ca6445204ffb768, 0x6ddee3e33ba64d5b },
+  { 0x2cb42cf62b2f25f5, 0x9f909b5447821b14 },
+  { 0x2cc3049b7feb8e92, 0xf1870f1972629757 },
+  { 0x2cccc079c15e9af9, 0x4246f867ffc7e9bf },
+  { 0x2cefa695df2ed020, 0x899a7df7bb1e3a95 },
+  { 0x2cf20f82abcae2de, 0xcff88db99331e071 },
+  { 0x2cfb188c1091cc7e, 0xc2a7e60064d2a758 },
+  { 0x2d15b092e8350912, 0xec4b2e5e750fa1c6 },
+  { 0x2d16a8b59a225ea5, 0x51667be45f554652 },
+  { 0x2d1af6442d6d5f15, 0xde37e47dd5a78411 },
+  { 0x2d1cf85fbc732856, 0xbf76470cd4060f4a },
+  { 0x2d2c5f0761e609e3, 0xc5228766f446f7f8 },
+  { 0x2d33a44e82f88d05, 0xf6c50577218c0cae },
+  { 0x2d38a96f92952b30, 0x1eefdf25a5e6976b },
+  { 0x2d405da70af82b20, 0xa6b3ecc3d1d2c4ec },
+  { 0x2d6388a8389f1d59, 0x108fd169c3356d79 },
+  { 0x2d63b452f897818c, 0x52b3fceeb080a4d0 },
+  { 0x2d6741cda3000230, 0xf6bbdd5e31941c01 },
+  { 0x2d69a5f23784f1c2, 0x230143292a073b53 },
+  { 0x2d6da0eb85eabc93, 0x270e5bb8a466ca51 },
+  { 0x2d76c5d1aad50644, 0x2b9e9fb67765e051 },
+  { 0x2d9e5d8d083b6367, 0xeda880e80dfdfaeb },
+  { 0x2d9e65959808a609, 0x8c16c82a59c9d9dc },
+  { 0x2dbc92688f9ba92a, 0x7e086d62be9df79d },
+  { 0x2dbdca3058035d2b, 0x40c734dcf06a86d9 },
+  { 0x2dcf9ce486393cd3, 0x6ca0928cd53b96cb },
+  { 0x2de41a11c6767e54, 0xa5ee9ebaffec72af },
+  { 0x2dfec1615c49501f, 0xefc02165c81955e6 },
+  { 0x2e0aed5bb619edce, 0xfa3fafb4fbe7c551 },
+  { 0x2e2acef8513edcca, 0x991e7e5149412e11 },
+  { 0x2e3728f3086dc3e7, 0x1047ffd6b2d9f015 },
+  { 0x2e5b184da8a27c4d, 0x362b5a81f0b4a68f },
+  { 0x2e663eaa0d6b723b, 0x645e643750b942fd },
+  { 0x2e7e9c6dcfcceaff, 0xc6fa73f0d08a402a },
+  { 0x2e82a1628ef6c735, 0xc0ab8fa92927e9b0 },
+  { 0x2e842c2ee22e9dad, 0x9df16eed091315c4 },
+  { 0x2eaf8fa9e9fdf1fc, 0xfc896926a4bdbf85 },
+  { 0x2ec6b045cfd7bc52, 0xd9cdfd1b1447d1e5 },
+  { 0x2eda6a49a49fcb2b, 0x674ea9e160b6a617 },
+  { 0x2ef36341d1bf42e0, 0x2c7ea2f71e024982 },
+  { 0x2f0546c4d238551c, 0x7d64d884b618100c },
+  { 0x2f0a8bb4e18839f9, 0xb1dcaa2f5d02fd1d },
+  { 0x2f11ba54609777e2, 0xc6a5da9b302c98e8 },
+  { 0x2f16663b01591539, 0x624d0ef52934a17d },
+  { 0x2f2f9061398a74c8, 0x0420b99ddecf6448 },
+  { 0x2f66ebf037321ed0, 0x442ac4b89ce22633 },
+  { 0x2f7772879a1ed04f, 0x660aa9d77a86a4bd },
+  { 0x2f77f015fc880b05, 0xf28e84156f989a0c },
+  { 0x2f7949f71076db42, 0x480d3f5036b4a332 },
+  { 0x2facd460a6828e0e, 0x476d3ac4b8c5f4f7 },
+  { 0x3025bdc30b5aec9f, 0xb40668787f67d24c },
+  { 0x303242c239474f2d, 0x7763b843de58c1c3 },
+  { 0x304512528a5530a9, 0x361e8a231ed9a6de },
+  { 0x30512e0e83903fc0, 0x5541d2f6a6a62654 },
+  { 0x30516cfbaa1bc3b5, 0x335ee53ad811f17a },
+  { 0x3051b6071cb26377, 0xcd428af155e1bfc4 },
+  { 0x30685b9b6ebd9ba7, 0x1536dd7632a1e3b6 },
+  { 0x3091af0ef1a61e80, 0x1f4867783c21d45c },
+  { 0x3095f60d0d9a054b, 0xdef5c43c4ad4ac1c },
+  { 0x30997031b668e371, 0x68d4d0e299ccc46f },
+  { 0x30c92c685224dc7a, 0x72b9bbe5eb62d004 },
+  { 0x30e012e8d50330c8, 0x972f126b8e913bc4 },
+  { 0x30e0ab8be713208a, 0xe9a978b34e9e8e8c },
+  { 0x30f0b49661cfcfd4, 0xec63395fab837dc3 },
+  { 0x3105967f7222cc36, 0xa5ac6e5f6e89a0b4 },
+  { 0x310ba30e25ea8957, 0xe58180b663503c0c },
+  { 0x31235a27b065c286, 0x3048fa84db330dc6 },
+  { 0x313243fc41e49ef6, 0xbd3aa9ebc0d372dd },
+  { 0x31512cdfadfd82bf, 0xb6f196e3b0fd83cd },
+  { 0x3177cc5c04c1a408, 0x0a927dfa4099482b },
+  { 0x317a4cdbab090dcc, 0x996833d07cb40165 },
+  { 0x318046ae3711c05f, 0xd16e479b298e5fcc },
+  { 0x318a9d6dda791268, 0xdf92d72679914ac3 },
+  { 0x319a142aab626084, 0x2ab616382848c204 },
+  { 0x31bb9b8ceed46cb3, 0xe506777a9e65f3ce },
+  { 0x31c5fd55a39db5ff, 0x30a0da065f86c140 },
+  { 0x31d08cb465965f80, 0xd3541a57ec82c625 },
+  { 0x31df1c50c4351e14, 0x4c9a378adb8c10ba },
+  { 0x31e518debba46df6, 0x226b535fa8bd2543 },
+  { 0x31f4692ee2ca07a7, 0xce1f7a6a1dab4ac9 },
+  { 0x31fcbce1cfa6ec9f, 0x5b6de318e1f57647 },
+  { 0x32199271dc980eb3, 0x1a2cc96e10a9e244 },
+  { 0x321c3451129357af, 0x42a375d12afd4450 },
+  { 0x32244e55ce6ec6bf, 0xbd763f33384bdc2e },
+  { 0x3225676f5c0c577a, 0xeccfaa7e6bedd765 },
+  { 0x322b29e84455aa41, 0xe7cc9af463bffa89 },
+  { 0x324cb4a749bcac4f, 0x3db9da842b85d2f7 },
+  { 0x327468d6c19697e6, 0x5ab702f06502c7ed },
+  { 0x3276c777cbe97cdd, 0x2b4a63ffc16b7151 },
+  { 0x3278158e5c1f7eb5, 0xc5d28ccfd7285250 },
+  { 0x327fe8cf94f3a45c, 0x35a840a453df1235 },
+  { 0x328949872e454181, 0x223a80389d03c122 },
+  { 0x32ae78abbb5e677e, 0x2aabae5cc86cec29 },
+  { 0x32d1260ea682e1bb, 0x10850fa94c04ec5f },
+  { 0x32dcd1b535f564ee, 0x38143a70a8146efe },
+  { 0x32e65d1e4dfcbcd9, 0xb57fee72cafe074c },
+  { 0x32ecb5a652eb73d2, 0x87e883eea751d99c },
+  { 0x32f4e47a71601ab0, 0x6cfb59e1c6a0b846 },
+  { 0x3316ee2f887e9cb9, 0xb54dd23c5b98c3e2 },
+  { 0x331938989f0f33ca, 0x39c10af4c09ff640 },
+  { 0x332f01fd18e99c65, 0x84f61aa45ee7791e },
+  { 0x3347a6dd59049b15, 0xa38394aa2dafa585 },
+  { 0x335793736cbf6fc9, 0x9c9359ed2a32a49d },
+  { 0x335a7c5cfa6fee0f, 0x35f5824d1fa09aed },
+  { 0x3367eeba3269aa04, 0x720abe6169767502 },
+  { 0x336ea20d38f98926, 0x919d4b4651d1a03f },
+  { 0x3391f7c4c656793f, 0x92299f4187e139f7 },
+  { 0x33cac5e767a534c9, 0x5d292b04f439dc37 },
+  { 0x33d68c3cd74e5bc4, 0xcf0df3716c5848bc },
+  { 0x33ed6dfac4b9ea2f, 0x81f778ceddbb4a75 },
+  { 0x340f546d59e72fb3, 0x58c49ac2ca8482bb },
+  { 0x34340c8eecd1e557, 0x314789cc6477e650 },
+  { 0x345488d3b014b684, 0xa181108f0ef823cb },
+  { 0x345758747b893e4c, 0x9bdde8877de47788 },
+  { 0x345769d085113d57, 0x937198262af52298 },
+  { 0x346555779a2d51b4, 0x8833463b5433472f },
+  { 0x348615ffa30fab3c, 0xec1441b5a76e9460 },
+  { 0x34b269387fa1aa5a, 0x396636f5ecdd63dd },
+  { 0x34c808ad6577dbfa, 0x46169b73171585a3 },
+  { 0x34ca2fcbc8ba4a0b, 0x544acd94991cfb50 },
+  { 0x34e37eaffc0d34e0, 0x5e40ed883f848b40 },
+  { 0x34f4b1d809aa705a, 0xce6e46b13253fd3b },
+  { 0x34fd4fcb40ff5bab, 0xce67f8b806d5969c },
+  { 0x350e0f7b562ec5e4, 0x57b3f5af013648db },
+  { 0x35156407e54f67eb, 0x1f625450d5c093e1 },
+  { 0x35163b56f4a692a2, 0x32ae96ad3e23310f },
+  { 0x3545eb3b8b1e7dc1, 0x9f87d231ab0b1d4c },
+  { 0x3556e125681aea86, 0x4e17b09f3f3b2a75 },
+  { 0x3576037c92816566, 0x55fa114a835be553 },
+  { 0x3577e19714921912, 0x685bb0e32ddf943c },
+  { 0x3584222eec8152f2, 0xfeae3902bab2595f },
+  { 0x35ae903dff738975, 0x5ad4a07f2fb7400c },
+  { 0x35b10a248a7e6749, 0x3ec43aeb9743538c },
+  { 0x35b43b54e83403bb, 0x3d71f519739a9549 },
+  { 0x35be55426c1fec32, 0xdfb503b4f0651572 },
+  { 0x35fa32256982774a, 0x4f134c3347882dff },
+  { 0x360ba640f6810ec9, 0x02b01a09cc8ab556 },
+  { 0x360c0dcb11506e73, 0xbd0b77207c81bc62 },
+  { 0x3619786f6a32efc1, 0xe4a262d5aca8a070 },
+  { 0x3624e5568368929f, 0xabb55d7f9df1022e },
+  { 0x36306070f0c90a72, 0x461551a7a4f3a209 },
+  { 0x36547bc6faa5132b, 0x87504e18d088e1d7 },
+  { 0x367411b781192992, 0x34772c08df10e134 },
+  { 0x3685060707df27d4, 0x091ba0ea2dc4b059 },
+  { 0x368d88a6c071caba, 0x60b4f778615aae94 },
+  { 0x36a701c60a9f9768, 0xd057bc2a83526a80 },
+  { 0x36b20c427975760c, 0xb9cf4a47e41369e4 },
+  { 0x36c29ceee2c151b2, 0x3a1ad7aa04bd529d },
+  { 0x36c31bb5daeb103f, 0x488c66de67ac5075 },
+  { 0x36c993dc328933e4, 0xdd6374a8ffe224f4 },
+  { 0x36e47ed74968c365, 0x121eab60f48c6517 },
+  { 0x36edef446ab4c239, 0x5666efc672b92ed0 },
+  { 0x36f9a953ebdd9a8b, 0xe97ccf27a2041903 },
+  { 0x37252757a79dc5b1, 0x74e3c03d6ea0bdcb },
+  { 0x372bddf113d088bc, 0x572f94e98d8249f5 },
+  { 0x373b8a081acd98a8, 0x95db0cb02df35673 },
+  { 0x3750f2375252b6a2, 0x0e4628692e94e8b1 },
+  { 0x37527966823ee924, 0x3d34c7da8302774f },
+  { 0x376944889dcfa96c, 0x73d3079f308e3d32 },
+  { 0x3783f12821b88b08, 0x814da8adb1a9f220 },
+  { 0x378a62af6e9c12a7, 0x60795ff4fc939656 },
+  { 0x378c118b3bda502c, 0x73e76190ca089eef },
+  { 0x37ab3affc7987995, 0x784b59fcd3fcbd31 },
+  { 0x37b98344c8e0746c, 0x486caf5aaeec892a },
+  { 0x37e828675d556775, 0xae8285c0caf7d11c },
+  { 0x37f42ab500184971, 0x14f6b0f4f01aa9a1 },
+  { 0x37fd7fa52d358f66, 0x984948999f1213c5 },
+  { 0x384db97670817103, 0xdd8c0bbdef132445 },
+  { 0x384f5fbf57b5e92e, 0xd708935ebf8a8610 },
+  { 0x3856b9425cc0185e, 0xd770376a62af0282 },
+  { 0x386ff28ac5e254ba, 0x1b1bac6916bcc93a },
+  { 0x3882224adbd0ca7c, 0x748b2a1c9b87263e },
+  { 0x3889351c6c2100b9, 0xf3aef817a7e17a7a },
+  { 0x3897744dd3c756ea, 0x4b1542e5e181e02a },
+  { 0x38bd172da8b2a3a1, 0x76e517c213fcd5a6 },
+  { 0x38c362dcd5cad5a6, 0x2e73ae52631bd9d8 },
+  { 0x38cf93eacfb2fa9a, 0x2c5e39059ff35a74 },
+  { 0x38de7b68379770b9, 0xbd3f7bf000136eb0 },
+  { 0x391764720140c432, 0xaec454a468f77a40 },
+  { 0x392d34c0498075dd, 0x58df0ce7cd491ea2 },
+  { 0x392f00fd1a074a3c, 0x15bc96b0a57d52a1 },
+  { 0x393948436d1f4cc3, 0x192410bb918f9724 },
+  { 0x393e41ca8bdd35b5, 0x2bf6256a968a9b89 },
+  { 0x3947eb7305b0c904, 0x256cdbc5c5956c0f },
+  { 0x396f7bc90ab4fa49, 0x75f8c74abe4e81f0 },
+  { 0x3974e2d1f614fbd3, 0xa092533ecae2e84d },
+  { 0x39790a2e9030751d, 0x7db414e13f1b6960 },
+  { 0x39a6a5a2e1f6297c, 0xceaa48bb03af02e9 },
+  { 0x39b94d41bd3b01c1, 0x2b4054c1a8733783 },
+  { 0x39c78d682516d791, 0x30b379fa9deb8d1c },
+  { 0x39d36366ae7e6dfd, 0x53393fb9ebab02a0 },
+  { 0x39da69ff9833f8c1, 0x43f03b6e0e7a996b },
+  { 0x39fe316952134b12, 0x77b6a81af8e05776 },
+  { 0x3a10562937a766cb, 0xbb77203d029b00e1 },
+  { 0x3a2e2d0c6892aa14, 0x544083dfb7762782 },
+  { 0x3a35d7f1dc2a3356, 0x5c8dca52baa86bc4 },
+  { 0x3a51a6860848e36e, 0x6d06ffe01b71fb13 },
+  { 0x3a521b7e29123b2d, 0x38e34e3ff8dc255c },
+  { 0x3a526e6a1f9fe918, 0xaf0f2ce997dfea73 },
+  { 0x3a53963f053b2259, 0x9db6ac9686f7722f },
+  { 0x3a771876e4b61d42, 0xe3a3892ad885d889 },
+  { 0x3a98b97b3df21715, 0x816b6ad62e843dad },
+  { 0x3aad0ef62885736a, 0x5b8c6ccac0dbe00c },
+  { 0x3ab5d138e26d88c8, 0x190e7cc629a89493 },
+  { 0x3ac6c50a8e62d4ce, 0x71595134cbd8035e },
+  { 0x3ad3dc799211ccd4, 0x24d7c6d454401436 },
+  { 0x3ad58b53a1e97239, 0x6890bd86c735e78d },
+  { 0x3b040ed7d1ef8acb, 0x4efdeebebdaa2052 },
+  { 0x3b097a7ed5bd2a84, 0xdc3d3ed361e9c31c },
+  { 0x3b10106836565e5d, 0xb28c7823c0898fbb },
+  { 0x3b2c32fcd331664d, 0x037952bcaa62df94 },
+  { 0x3b5751a8d20f7de4, 0x1eb069f76fecd5d7 },
+  { 0x3b64a00ce147c3c2, 0x9f7f8f8e531d08d8 },
+  { 0x3b69f8929373598e, 0x1752f43f8da61aa4 },
+  { 0x3b6dba1a24bb2893, 0xbd3bd0593f92016b },
+  { 0x3b76242691730b2d, 0xd22ec0ceab351bc6 },
+  { 0x3b80b8f52a0939e1, 0x6b5059f93a3fc19a },
+  { 0x3b86a27132fb74d9, 0xb35d4783605a1bcb },
+  { 0x3b8aacf5f5638492, 0xb926b5124de19f18 },
+  { 0x3b91c347d8e6427e, 0xdbe942a7a405290d },
+  { 0x3b9480bb6fb1e358, 0xc9c0a64e86945aee },
+  { 0x3b966bf3c2ca34ac, 0x6ca1de4cf6383582 },
+  { 0x3bb9793c60c92911, 0x895cf44530846136 },
+  { 0x3c21a89bc38d8cd0, 0xb010a2916bcff5c2 },
+  { 0x3c3a2bb776dec245, 0xc7d6678b5a56ac10 },
+  { 0x3c4223316c835cea, 0xad619651e25df0f9 },
+  { 0x3c4a6f613ca8ba27, 0xce9e43c6c92a3128 },
+  { 0x3c57748c8286cf9e, 0x821ecd064f21aaa9 },
+  { 0x3c72ddaf41158fdd, 0x66e4f1cb90d4fd29 },
+  { 0x3c7a7b3a0a7e6319, 0xb2fa0f923ef6c9af },
+  { 0x3c7a96978f52b2b1, 0x5426cdd50f2c4048 },
+  { 0x3c82e808fe0e6a00, 0x6dc0c4e714d36209 },
+  { 0x3c853d864a1d5534, 0xed0d4b325347f131 },
+  { 0x3c8e57a246742fa5, 0xd59e517134c0b4e6 },
+  { 0x3ca51b5c08f5a0ec, 0xfb17d0c1ec6d0942 },
+  { 0x3caa902ac0ce4509, 0x308990645876426a },
+  { 0x3cbdf71bb9fd261f, 0xbc433717f547d738 },
+  { 0x3cdd91e1c28d28e8, 0x56c0063d602da166 },
+  { 0x3d1e83afdb4265fa, 0x2fb84819c9cfd39c },
+  { 0x3d2367b2b09c28f1, 0x659c082bb46a7334 },
+  { 0x3d2652cbea462a88, 0x6a41791dd7c8d073 },
+  { 0x3d48b8b586a09bdb, 0xf49f1a016bf4d29a },
+  { 0x3d6fc7a19be76d80, 0x8aa233415cb583fc },
+  { 0x3d7749fb9c2f91a2, 0x76dfe494495234c5 },
+  { 0x3d7aad37c5569281, 0x4211c8b590a0334c },
+  { 0x3d8a2d6493123a53, 0xade45e3e2c5cafa0 },
+  { 0x3d934bb980e2e63e, 0x1ead3e7756928ccd },
+  { 0x3d9c2fccf8b11630, 0x762ff00811c19277 },
+  { 0x3da7cc7049d73d34, 0x920bb73817bd05a9 },
+  { 0x3dfb7c1803f937fa, 0xdc652a3e95ff7dc6 },
+  { 0x3e03086da53ecc29, 0xd855d8edf10962cb },
+  { 0x3e1682ddaec486d8, 0xb6b90b527aaa0fc4 },
+  { 0x3e22c7eaf6459b67, 0x388602e4bebbb3a8 },
+  { 0x3e33ac10dcf2dff0, 0x14bc1decf8a9aea4 },
+  { 0x3e49da621193d261, 0x1a4ea152d5d5ca3a },
+  { 0x3e4b1137433cc1e6, 0x17b5508619e13063 },
+  { 0x3e5ca1afaa27c5da, 0x3c54c9942fec528b },
+  { 0x3e6dab92009d6034, 0x618cb6b7844c5216 },
+  { 0x3e7d10d0a911afc4, 0xb492d06c99863e65 },
+  { 0x3e88cca5b860d0bd, 0x8947479e74c44284 },
+  { 0x3e899eba0ca8cd29, 0x72da1ae5479b4f0d },
+  { 0x3e90cf23106f2e08, 0xb2781e41299de556 },
+  { 0x3eae062a9b722bda, 0x1255d474a87eca5c },
+  { 0x3eb1e34a4f0eec36, 0xf12e7336badcecf2 },
+  { 0x3eb21313ea5d5764, 0xc5ed9160a5a55a83 },
+  { 0x3ec12372ca3e870b, 0x11ca70edc7ec26a4 },
+  { 0x3eccf9f363f5c5de, 0x0c8b174a535dc83b },
+  { 0x3ef9573536730dcd, 0x6d9c20b6822dbdc4 },
+  { 0x3f01bd6d059396f4, 0x95a4cde7de0ab180 },
+  { 0x3f039981255691d3, 0x859d04ef813a1264 },
+  { 0x3f251c50aa7237e6, 0x1a38ab42315ebed4 },
+  { 0x3f3ad2765c874ca1, 0x3c015ca6a44a40a1 },
+  { 0x3f540a30fdee0b20, 0xaed7288e4a5ea528 },
+  { 0x3f58f972276d1e4e, 0x0e09582521ed7a5b },
+  { 0x3f5a43602f960ede, 0x330cd2f43a25139e },
+  { 0x3f6938aa6ce66e6f, 0x42e582c1eb19b18c },
+  { 0x3f6dbf448f25e2bd, 0x06dea44248eb122d },
+  { 0x3f75a5da3e40d486, 0xb21dfc1c8517adc0 },
+  { 0x3f9431cc8c5e2f22, 0x0b2ac14bbc8231f4 },
+  { 0x3f96eb711928a6fa, 0xc667c04ecd41f59f },
+  { 0x3f9cb1aba8ec20e2, 0xc243ae642f9942bf },
+  { 0x3fd1f9d66a418c9f, 0x787fc5799174ddb7 },
+  { 0x3fd53bfeee39064c, 0x945a769f17815a7f },
+  { 0x3fe43915e5655cf6, 0x9485364e9f464097 },
+  { 0x3ff5165378213dab, 0x531ffa4f1a41ae45 },
+  { 0x4026ad38ba5ce486, 0xe88383dc27d7a46f },
+  { 0x402b1ca3c230a60f, 0xb279d4a2a10fa677 },
+  { 0x402d876ec4a73f9e, 0x3133f8f7f7992a1e },
+  { 0x405f8591b6941cff, 0x56c9b392c2d5e4e5 },
+  { 0x4066309eb3fa3e7a, 0x725585b9814bc375 },
+  { 0x4066d7d88ec4a2c6, 0x56127a67fa52dcf1 },
+  { 0x407a0c6cc0ff777f, 0x67b669440d68a242 },
+  { 0x4093382187f8387e, 0x6d011883e8ea519b },
+  { 0x40aa851e8d0f1c55, 0x5176a5e209a5fabb },
+  { 0x40b1832177c63ebf, 0x81e6c5b61aaffd3a },
+  { 0x40b59249e05135bc, 0xa33861e383735e9e },
+  { 0x40d8ed6a5106245a, 0xa79f05642a961485 },
+  { 0x40d9f5709877ecf3, 0xdd1184f9791dd35e },
+  { 0x40e12c008037a323, 0xa1290c8fa4d2fe7f },
+  { 0x40eb4e263581b3df, 0xec6dd8920b68e00f },
+  { 0x413c925c5fdcea62, 0x842a63a4c671a5f2 },
+  { 0x4153dd2beed648e9, 0xdc082140ebe8e836 },
+  { 0x415c11fcac66bbd2, 0xace2096687774b5a },
+  { 0x4181087389a79c7f, 0x59611fb51c263137 },
+  { 0x41810dd94bd0de11, 0x10bedc5092bef5b0 },
+  { 0x41818738ab1745e8, 0x79024a17784d71f5 },
+  { 0x4189adfc1b30c121, 0x248876e3a1a3ac7e },
+  { 0x418a849f977db940, 0x62c459b7f636c8d1 },
+  { 0x4191b671bcd8237f, 0xc8e297b4947f2990 },
+  { 0x41b554c6970b1867, 0x0acc7b6baef8ed2e },
+  { 0x41c4e3d45a06df9d, 0x21b7aae6ae7e9912 },
+  { 0x41f252a66c6301f1, 0xe8ab3612c19bc5d4 },
+  { 0x4209e9dcdf05614e, 0x290167a1c033cfd2 },
+  { 0x42249ec8043a9a02, 0x03dde0b5bb46d8c4 },
+  { 0x4233eb824c2b4811, 0xabef9b6d00355ae9 },
+  { 0x4251b4557ea6953e, 0x88afb22a3a868724 },
+  { 0x425ee444a41d2185, 0x98893d6b6e03431a },
+  { 0x4279485e922b34f1, 0x27a88904b31ce9fa },
+  { 0x428b2d36f5d71676, 0x5460701f7016ac91 },
+  { 0x42ae81ae8ac51e5c, 0x238639f9f77d91ae },
+  { 0x42b2c3b4545f1499, 0xa083cfbc4a3b7640 },
+  { 0x42b3ab3cf661929b, 0xdc77b621a8c37574 },
+  { 0x42b5e3a35b032f03, 0x3809afb0ea28802d },
+  { 0x42cdd6a9e42a3639, 0xe190722b8ea3fc51 },
+  { 0x42dcc02777b0bcfa, 0xcd85aeb61d33558a },
+  { 0x42e0ec5ab8f5deba, 0x53e4169ff2a5efbe },
+  { 0x4311a4115fb7bc68, 0x477c96cf44cebacf },
+  { 0x4326edb70ff20d0e, 0xe5ba58fa5cb09d60 },
+  { 0x435fd469f088468c, 0x4d66be6b5204d887 },
+  { 0x438968a26b7cfe14, 0xa499f5bbbbf844db },
+  { 0x43adf60ebdd6b5a0, 0xfae21594ecf17154 },
+  { 0x43c6cfffeddab6b3, 0x787357fed9d44529 },
+  { 0x43f33c6dfdeaf513, 0x8ce6e6968ad7c5ce },
+  { 0x43f8459d39fb4edd, 0xf9186d62722ff795 },
+  { 0x442602713cb45b93, 0x21ee93c6ea28a5d0 },
+  { 0x4427f06085bb4c22, 0xff047027f7acecc2 },
+  { 0x442b7863683e5f08, 0x4716fda050474feb },
+  { 0x4431428a7500c96f, 0xc0e2798a5dbd36d6 },
+  { 0x4474b3ad3bf6aabe, 0x719a2d7f1d1fb4cc },
+  { 0x4476c39736090dab, 0xac09f6caf835fc49 },
+  { 0x448c2a175afc8df1, 0x74d6ff4cce12c794 },
+  { 0x44e9c4a047c348db, 0xeb7ace60f45484b4 },
+  { 0x44f71e70b89dcc7c, 0xf39dfd622cfb9a27 },
+  { 0x45027dde2be5bdd0, 0xcab522b80632717d },
+  { 0x45040679d72b1011, 0x89c298a864a5b5ba },
+  { 0x4543b7691914dfd6, 0x9c3755a5287a95e1 },
+  { 0x456453a54ca65191, 0x781aef316343ae00 },
+  { 0x4565c1a7abce773e, 0x53c75b35414adefd },
+  { 0x457b03cd48ff6d89, 0x5795ef043c6b0f1e },
+  { 0x457e7d4fcd56ebc4, 0x7f5925dbea3ee427 },
+  { 0x457f4ad2cda5f480, 0x3f122508bfbde3f5 },
+  { 0x458883f1d952cd77, 0x2cf0057abca57497 },
+  { 0x45a095645696a217, 0xe416e4bd2baea723 },
+  { 0x45a4f55bb9a5083d, 0x470ad479afd8bca2 },
+  { 0x45beef9da1a7e45f, 0x37f3f445f769a0b3 },
+  { 0x45c4413dd703b9cf, 0xea49a13709d560eb },
+  { 0x45cb0f41774b78de, 0xf53331e4c3bf3362 },
+  { 0x4605a00f5b44a9cb, 0xd5803a7a55de150e },
+  { 0x461029ab23800833, 0xe9645be3e472d470 },
+  { 0x46258bd92b1f66f4, 0xcb47864d7654f542 },
+  { 0x463dd4770506e6c0, 0xef993a40c52c47be },
+  { 0x463e66ad98806a49, 0x106cffa49c08e2ed },
+  { 0x467340a18158649a, 0xa5e02a4372dcfccd },
+  { 0x468483e15091818b, 0x493983399e00d8f8 },
+  { 0x4689081b73637218, 0x58756fe781cc7713 },
+  { 0x468f2dec984f3d41, 0x14ea84f05edf82b6 },
+  { 0x4690fdb70c86604b, 0xb35da26696818667 },
+  { 0x469473ff6fed8cc8, 0xd65f3c334f963aab },
+  { 0x46c021a3e9e2fd00, 0x919ca3dd1a6b76d8 },
+  { 0x46c43fdcbce8fde3, 0xa91ebeafc05b7cbd },
+  { 0x46dc526773808c8b, 0x9bb2111f24e5704c },
+  { 0x46e9428848c9ea71, 0xa4d8f91ff81ac9cc },
+  { 0x4702d8d9b48a3327, 0x24af198aeac9e469 },
+  { 0x470878b9917ea034, 0x8d64b5750af149aa },
+  { 0x471f7bdc933e8db0, 0xe44aa3dde2dd92af },
+  { 0x47464694e9cce07f, 0xdbfd096605bf39d4 },
+  { 0x47585c047802dd9a, 0xf888b998fb921f32 },
+  { 0x4767356fa0ed3ebe, 0x21437b4473d4ee28 },
+  { 0x47711c44723da5d6, 0x7047990157dcb5dd },
+  { 0x47911752bf113a24, 0x96dbb66c70c9e70c },
+  { 0x4799a40b6e889370, 0xb7ee55c17ba65141 },
+  { 0x47aad247cce2534f, 0xd70c412cb483c7e0 },
+  { 0x47abfb993ff14f50, 0x2f88cf988092e055 },
+  { 0x47aef18509051bab, 0x493589cb2619170b },
+  { 0x47b82d47e491ac7f, 0xdb5053a88fccc832 },
+  { 0x47cd61f83457a089, 0x0de381e478f5cf5f },
+  { 0x481d20ec22e7a63e, 0x818d5ef9679d548b },
+  { 0x481f9a742052801c, 0xc5f3defb41cb638e },
+  { 0x48287a9323a0ae6a, 0xb15e671ac2a87598 },
+  { 0x4834b7b28ea86222, 0x7ac7e40053fb52a5 },
+  { 0x48411c9ef7e2cef1, 0xd6b2bee0e6055c27 },
+  { 0x484b0076816a1048, 0x75e00467d431c2d2 },
+  { 0x4857f8bb88bb63c6, 0x40d3ea5aac7f5d6d },
+  { 0x4868a81e1b6031ed, 0x66ecd60547e6ec85 },
+  { 0x487193a7b7fe57a1, 0xbbc2f431f628bd5f },
+  { 0x4884b1297500bd12, 0x43659e43c7e7579e },
+  { 0x4892b85c248131d6, 0xa42c66a4163a40d0 },
+  { 0x48bcf2c5a8c80f18, 0xb24c55db96845472 },
+  { 0x48e5c4ae4f2d3b62, 0xb35a87bca18dc9f5 },
+  { 0x48f18d69799a5f54, 0x51a5f0d17876acef },
+  { 0x4901c05068512828, 0x367fde3fb22199fe },
+  { 0x4904a2550759b9b4, 0x570e886374f9d092 },
+  { 0x490e3cc59d82f85f, 0xae817cdf767ea7a0 },
+  { 0x490eed07d4691b27, 0xf473953fbea6541a },
+  { 0x49366f41aa7a54ba, 0xf263426e99ce4312 },
+  { 0x493daaf9fb1ba450, 0xeba6b8ed53ffb37d },
+  { 0x493de059b32f84ab, 0x29cde6213964aeee },
+  { 0x493e90602a4434b1, 0x17c91c95e73828d1 },
+  { 0x4947c9de2e28b2f5, 0xf3b0c40ce7e56d93 },
+  { 0x494cda91cc640551, 0xb4898c82be058dd9 },
+  { 0x49571b26f46620a8, 0x5f93448359324c28 },
+  { 0x497c811026367c08, 0xfd838c9c59e5041d },
+  { 0x497f3d2970c43e52, 0x24be99f75e97cbbb },
+  { 0x4981cefe5493ea51, 0x2284e7f9f27d1e54 },
+  { 0x4999b45be0ab5a85, 0xbac1b7c0e551542b },
+  { 0x499b612f6544ae71, 0xd4915aa63e403e10 },
+  { 0x49f2cef5269fd062, 0x18be9f9474c74f8d },
+  { 0x4a196713a21ef07a, 0x3f74cf51784c6b12 },
+  { 0x4a2fe6f0f6317f00, 0x6fd6d4b34515448b },
+  { 0x4a45c6d75b1ba131, 0xf94a9c13194d8e46 },
+  { 0x4a5fddf898013366, 0x37ac8e57a7c9a881 },
+  { 0x4a6be79310f86f0b, 0xebc7dfcba4d74161 },
+  { 0x4a7eee19c2dfb6ae, 0xb4d9d0a01d37e127 },
+  { 0x4a8c743396b8ad69, 0xd97e6fd3dd3e3132 },
+  { 0x4a9009620038f7f3, 0x0aaeb2a00ae58fde },
+  { 0x4ab2ebd95a8f861e, 0xa451abebdad914a5 },
+  { 0x4ab4af3adcdae8cd, 0xacc3d06084fc8d6a },
+  { 0x4abb4c87a4c5f5d0, 0xc14ead2bb36251be },
+  { 0x4ac9f40ddfcf194b, 0xd8732a75b3f2f214 },
+  { 0x4ae8c76cd6f24a2e, 0x181ae874d4d2aa3d },
+  { 0x4af4103759d603c8, 0x2b1c9c5acd2d8faf },
+  { 0x4afa7f377eae1caf, 0xb4265c68f73f2718 },
+  { 0x4afe528a082f0d00, 0x8e7319ebd481248d },
+  { 0x4b09877f0700425e, 0xe964a166d5c192cb },
+  { 0x4b143d7dcf6c9679, 0x6c37090cba045f4f },
+  { 0x4b205ef73a5779ac, 0xc5759bde3f6d33ed },
+  { 0x4b27f5397c442d25, 0xf0c418ccdacf1926 },
+  { 0x4b379b885e2694f9, 0x92c6cc932f18327f },
+  { 0x4b71197153d65148, 0x0830638cb6a03249 },
+  { 0x4b753a97aee91e4b, 0x3e4e02f5e9758c72 },
+  { 0x4b854623357e511c, 0x2fac852529f0ae2c },
+  { 0x4b94fd272785d7ec, 0x6c95fb7279d0f522 },
+  { 0x4b9581c3100a1ef0, 0x5eac1535d25385aa },
+  { 0x4baada22435320d1, 0x85c95b7dd2bcdb24 },
+  { 0x4bcc7f6ba501a26e, 0xe785b7efbfb0fdc8 },
+  { 0x4bdae9246d6ee258, 0xc26665512c1c8de3 },
+  { 0x4bdf54a454470ba0, 0x15a217a8f5e61320 },
+  { 0x4c030667d07d1438, 0xf0e5c458a90978d8 },
+  { 0x4c0fb2544ae0f8b5, 0xf7ae8bce7bd7f134 },
+  { 0x4c205f166157154d, 0xf2f1ef60d87e552f },
+  { 0x4c39a2c97917d3d7, 0x1739b3e21f60bba5 },
+  { 0x4c462b2b6fb0a19a, 0x1437eb2c3dc20783 },
+  { 0x4c4ba1549830e9fc, 0xa5e2c110f4ebe47f },
+  { 0x4c4ce802cbfd160f, 0x7b3ec0f13f2a29df },
+  { 0x4c606235f4ec5d2a, 0x4b89139093a69437 },
+  { 0x4c6afb8a44adf8e2, 0x8f49164c84144bfe },
+  { 0x4c8832ed387bbafc, 0x055320c05205bc08 },
+  { 0x4c8970f6c294a0a5, 0x4c9c45e5e8445f93 },
+  { 0x4c9307de724c36fd, 0x487af6c99ca078f2 },
+  { 0x4ca0959f846d2bea, 0xda18ecf29efe137e },
+  { 0x4ca73eb959299471, 0x788f0b685c3ba0b5 },
+  { 0x4ca90ba45eced6f5, 0xad560ea8938641b2 },
+  { 0x4cabc895ea546022, 0xc2ecaa5129036634 },
+  { 0x4cd796b5911ed3f1, 0x062e805a3df33d98 },
+  { 0x4d06f72cc3d89345, 0x79c11ff8f375c260 },
+  { 0x4d0a28443f7df5f8, 0x83cf669894164cfa },
+  { 0x4d2cef8f19cafeec, 0x72d142e34a1bbc03 },
+  { 0x4d38e1105c3a5f0b, 0x3119a805f261fcb5 },
+  { 0x4d502d6fb5b992ee, 0x0591569144128f99 },
+  { 0x4d5f6db55f7f44fd, 0x0253258e810bde21 },
+  { 0x4d7517ae69f95cfb, 0xc053be01312b7dba },
+  { 0x4d77f291dca1518d, 0x7d8e47838695f54b },
+  { 0x4d8396deeabb40b5, 0xe8578276eb5a8b6d },
+  { 0x4dbd7e8b30e715ef, 0xc8d71d215aec7fe7 },
+  { 0x4dbf47c7f5ac767a, 0x3b07843a530d29a5 },
+  { 0x4dcc7e7c2ec0738e, 0x26c817b9383091af },
+  { 0x4dd6c7ab9ef77f2b, 0x4950d8fc7cd42ee1 },
+  { 0x4df6124093ccb4f0, 0xb6c26a719f4b7706 },
+  { 0x4df9d7352a56a458, 0xabb7961bf10aba4e },
+  { 0x4e01d9072c500331, 0xe65bb87c24020d3f },
+  { 0x4e02880beeb8dbd4, 0xda724a3f33f0971f },
+  { 0x4e15ddfd48bca4f0, 0xbf999240c47b49f5 },
+  { 0x4e2c884d04b57b43, 0xf23a5a2f4e9d9750 },
+  { 0x4e37992a37ea3648, 0x9283f7eb90913bbc },
+  { 0x4e4895c3381aa422, 0x0f8c2795d6338237 },
+  { 0x4e4a263ca1f7fd37, 0xb04b9c4d7416f151 },
+  { 0x4e66c8e7c6705325, 0x69c70d205f615dad },
+  { 0x4e86866d9cde738d, 0x1630e2e35d7288ce },
+  { 0x4e99ebd65a967cab, 0xf350db54405d577c },
+  { 0x4eb4fd544805baba, 0xfc375dcdb8c2a597 },
+  { 0x4edb251f5f287c22, 0xefc64b3a2d095504 },
+  { 0x4f0071946e80ca68, 0xedfdccbac86dcce0 },
+  { 0x4f2d47792a06da22, 0x4ba996c489a87939 },
+  { 0x4f32b24869d8c131, 0x0fecf039c6424db6 },
+  { 0x4f618c2429138e02, 0x80969193ed6c107e },
+  { 0x4f634893d54e9cab, 0xe106e0ec0b7bdcdf },
+  { 0x4f64d6d0694d9b7a, 0x1ed7b0cb0b83e759 },
+  { 0x4f6702c3ba6e0ee2, 0xe2868d054b00c064 },
+  { 0x4f781f0476493c50, 0xdc578336f1132a67 },
+  { 0x4f7a6ba1baac8d25, 0xce524eb660cca78d },
+  { 0x4f7b07ec2bef5ccf, 0xfe06403a142f80db },
+  { 0x4f82d8d78099dd71, 0xe8e169646e799d05 },
+  { 0x4f89b897444e7c3b, 0x36aed469b8836839 },
+  { 0x4fae08027365d31c, 0x558e400b687adf21 },
+  { 0x4faeb04b1b7fb0fa, 0x25db05753182a898 },
+  { 0x4fbe0f10a6327a76, 0xf83f83958c3cbeff },
+  { 0x4fc1b85b8074b4b9, 0x436d097900e34f29 },
+  { 0x50200f697aeef38a, 0x3ce31c4f49739551 },
+  { 0x502044b1ac111b39, 0x4e6fbb0d821fca41 },
+  { 0x502168660bfd9c1d, 0x2649d415dc89c69d },
+  { 0x504688d49a41bf03, 0xd8a955512609f3f2 },
+  { 0x50568c80ac61cab7, 0x89d9923c9b05b68e },
+  { 0x5061a82ea69e329a, 0x46b120cfac328fef },
+  { 0x5069fecbe4706371, 0xf17737b0357cfa68 },
+  { 0x5079bfbc7b8f5770, 0xf84215ed2e3bdd1b },
+  { 0x50a410a5ded0fc9a, 0xa6576be45a04f215 },
+  { 0x50c7edc9f9dc0369, 0xabcdab3b4efeb5e9 },
+  { 0x50ef88f9a5e0e1e6, 0xb86e175362a27fdb },
+  { 0x512e874a240731d7, 0x378586a05f28aec6 },
+  { 0x5131ab3797fe8c12, 0x7e3e135b18b4d2c8 },
+  { 0x514f911ecff2be5e, 0xeff2f39c49a9725c },
+  { 0x515046e3061b7b18, 0xaa3a551c3ae12673 },
+  { 0x516ffd008057a1d7, 0x8d007c851e6eff37 },
+  { 0x517592e6e0c71731, 0x019c0cebc2ce044f },
+  { 0x517923e655755086, 0xa3b72c0b17b430e6 },
+  { 0x5188fee071d3c5ef, 0x0d66fb45c123e4a5 },
+  { 0x519f007c0e14fb90, 0x208dbb5199dfb604 },
+  { 0x51c1ddc9d6d597f7, 0x1fb7efb56012abec },
+  { 0x51de328e79d919d7, 0x234cf19c1cd77fbc },
+  { 0x51e390424f20e468, 0xd2b480030ce95d7b },
+  { 0x51f15b39d9f502c2, 0x361b6ba6a73464d4 },
+  { 0x51f211c8fc879391, 0xfee26edfa7d3f11c },
+  { 0x521f4dd1eb84a09b, 0x2b19959a41839aad },
+  { 0x522b27a8afeb951b, 0x5a5a667f8d1a46a1 },
+  { 0x522c9cf684ecd72d, 0xb2f85053e6f6f720 },
+  { 0x52385334ac9e9b71, 0x3e13ffa4cc5cb940 },
+  { 0x523f5cbb992f121e, 0x2d100f0f9965e33f },
+  { 0x524693b337f7ecc9, 0xe8b9126e04a232af },
+  { 0x5256f68d1491986a, 0xae5cfdff539bfeb5 },
+  { 0x525ea747d746f3e8, 0x0e3027720e1fa7ac },
+  { 0x525f2dfc8b21b018, 0x6cff2568e0509bfc },
+  { 0x52615ae358a68de6, 0xe76467e95eb404c7 },
+  { 0x528400fad9a77fd5, 0xad7fc5fdc2b7d69d },
+  { 0x52a0003efb3b1c49, 0xfcde4dbc2c685d8f },
+  { 0x52a207c2ac6b4dc8, 0x7d5650f1d7bf5dfa },
+  { 0x52b448757081fd9f, 0xabf859f4e2f91f6b },
+  { 0x52bae1726d2d7a53, 0x1c9ca81e25377fc3 },
+  { 0x52e1954dc01454c0, 0x3a336b30c390fb8d },
+  { 0x52e6c8551e38b901, 0x472293339a360fa2 },
+  { 0x52e9db3fe8b5d336, 0x843acac234aaea79 },
+  { 0x52ec33be79c05b92, 0x18c9b55f7ccc1bfa },
+  { 0x5305f69fbf772fac, 0x4760cdcf87f1ab1f },
+  { 0x5324cf5b6dc17af4, 0xc64bf8696c39c2c1 },
+  { 0x533661e9bccd8a9f, 0x80ce3765f282c92f },
+  { 0x5336f86f6b982cc9, 0x25532f2e80aa1e17 },
+  { 0x534e23210dd1993c, 0x828d944c6ac4d9fb },
+  { 0x5355f80cacf0e63a, 0x49cbf4ade4e27034 },
+  { 0x5360693f1eb90856, 0x176bd1c0a7b17432 },
+  { 0x536bf56baa70acb1, 0x7113884ac41f2820 },
+  { 0x537ed1e0d80e6c9f, 0x752b33ea7acbe079 },
+  { 0x5385cf2a04de1d36, 0xab55c73174b84db0 },
+  { 0x539d26b6e9df0da8, 0xe7465f0f5ad863b7 },
+  { 0x539f3c42c4e15f45, 0x0ed93cb96ce93af5 },
+  { 0x53b66f11f67c3b53, 0xb2995e0e02017bd7 },
+  { 0x53bd1c7c972ae634, 0xc912331a9276c6e3 },
+  { 0x53d181cde2e0219b, 0x5754caad246fcb66 },
+  { 0x53e03df47e76329b, 0x701641f8bdc206f5 },
+  { 0x53f147b9746fdc99, 0x7c62f3dd67888ee5 },
+  { 0x540075f657d4b244, 0xa1f74da1b9e4bf92 },
+  { 0x5409d20c1aea0b89, 0xc56993aec5dc5740 },
+  { 0x541cac55ebcf7891, 0xd9d51c415922303f },
+  { 0x5428cdfada281c56, 0x9c74c7308c7f2c26 },
+  { 0x542c6dd5f7280179, 0xb51917a4cba4faff },
+  { 0x5438e84b90e50a53, 0x62f01cc843b358d4 },
+  { 0x543b4b8ff1d616fa, 0x250c648be428a75c },
+  { 0x545048ccb045f9ef, 0xc6cf2b125cd0dfa8 },
+  { 0x54785fa29e28aae6, 0x038929ba29d33d38 },
+  { 0x54836a8f23913e9a, 0x77c7f2665baf36ac },
+  { 0x5485d2da13415128, 0x40054ec02ac3b6a8 },
+  { 0x5494b9ee403d9757, 0xf0fd1f749e80214a },
+  { 0x54a1c1255ed45eb8, 0xf71414dadb1cf669 },
+  { 0x54bafc299423f5a5, 0x0b8bc3a797914706 },
+  { 0x54da3b0b3f43f5b3, 0x7911c135b9432b49 },
+  { 0x54f7efa6428f14b9, 0xf610ad0ca757e26c },
+  { 0x551a64a945d7d6ec, 0xe81e9c1047acedbc },
+  { 0x5524718a19107a04, 0xec3265c93136a7b5 },
+  { 0x553dbf9358cfd219, 0x5e2fa0e08b01fb6a },
+  { 0x554fd5775ca6d544, 0x818c96825032cf0d },
+  { 0x557e893616648c37, 0xa27aab5a47acbf10 },
+  { 0x559317712f989f09, 0x7ea464517f1a8318 },
+  { 0x55949cb7884f9db0, 0xf8dfcf8707c7e5cb },
+  { 0x55ace3c775f42eb4, 0x6f08bb1dca9114e7 },
+  { 0x55ef6ab2321ca0c3, 0xd369e63d59c059c8 },
+  { 0x55ef7b6506642836, 0x7844342ed59f956c },
+  { 0x56210a3b9ea6d5dd, 0x8f417a357ed8ca92 },
+  { 0x56300ed31fef018b, 0xd96768ccc982f7b4 },
+  { 0x5641c0ff707630d2, 0xdd829b26a9f2e98f },
+  { 0x5643ee916f7dc760, 0x148fca4db3aa7d10 },
+  { 0x5678ebaa09ca3b69, 0x9516dba4671643ed },
+  { 0x568371fbae6f5e5b, 0x936af80031cd8888 },
+  { 0x56f72247eb9ebfd3, 0x3bfd0cca23ab7ef4 },
+  { 0x571c6d9bc71cb976, 0x17422851f787f8fe },
+  { 0x572d0a4633d6a940, 0x7d3ba83083536e0f },
+  { 0x575c0fb61e66a31d, 0x982c95c9dea6865c },
+  { 0x57939b326df86b74, 0xca6404f64f89fce9 },
+  { 0x579baa6a4aa44f03, 0x5d245908ea7a044d },
+  { 0x57a66b6db7efc5df, 0x17b0b0f2f2c2f078 },
+  { 0x57c5b351d4de0217, 0x85cf8ed8191a195c },
+  { 0x5835a78a88f97ace, 0xa38c964980b7dbc6 },
+  { 0x5846b1d34c296bf7, 0xafc2fa05bbc16e98 },
+  { 0x58513bae774360b9, 0x6866a07ca0e8fd8e },
+  { 0x585600522b1f22f6, 0x17652c962e358a5d },
+  { 0x585f73010e205ae5, 0xb04ee5c1a67e632d },
+  { 0x5864cab0bc21a60b, 0xe3853b6bcd50c59f },
+  { 0x58746219d8094edf, 0xf869f0f5c2aeaad5 },
+  { 0x5894c9c0c1e7e29f, 0x3ab86c6d3f673361 },
+  { 0x589c73bbcd77db79, 0x8cb92a992b4c06c3 },
+  { 0x58a82e1da64a692f, 0xd727c25faef2ecc9 },
+  { 0x58af1e991b557104, 0x86a9868f75b15cf0 },
+  { 0x58c396323ea3e856, 0x71e34c98eb54e2a4 },
+  { 0x58d331c23297ed98, 0x663d11b869636f16 },
+  { 0x58e313e2b5613b24, 0x39b5f12bb41e3eef },
+  { 0x590ac71fa5f71d3e, 0xb29c41023b09ade9 },
+  { 0x59135f13985b84c4, 0xf13cc9e55eec869a },
+  { 0x594437a35603c3e8, 0x57b5af75b9718b61 },
+  { 0x594dbc80b93fa580, 0x4e0f1368c037331d },
+  { 0x5961d259115e99c3, 0x0b64fe7058256bcf },
+  { 0x59734e1cc4182237, 0x3845a09c51e6ba21 },
+  { 0x598a4e6e12f8238b, 0x7e7555f5a7777b46 },
+  { 0x599cbf919d47a05a, 0xf975ad447df29497 },
+  { 0x59b70658f9dd0e20, 0x75770b07be1a35cf },
+  { 0x59d33e00c0766539, 0x5209c1e55da0b139 },
+  { 0x59e53894b3899ee1, 0x64c91cfa7842da66 },
+  { 0x59e96de9628e8373, 0xd1c685f5e57dcf10 },
+  { 0x59f596285d174233, 0xc84597dee6f34f1f },
+  { 0x5a0ff99ba10bd26d, 0x542e1d6f59f56850 },
+  { 0x5a17e30e6e911e74, 0xccd7b716d02b16c6 },
+  { 0x5a272012a62becab, 0xcd52920348c7c60b },
+  { 0x5a2f2dcd77520753, 0x6d9299e768bcd2df },
+  { 0x5a4205aeedd3b058, 0x8f973f38bbd9dfd4 },
+  { 0x5a5390f91437af99, 0x51a5f8455b61cd43 },
+  { 0x5a6febb9554483d8, 0xc71c86a84a0aa74e },
+  { 0x5a734779d797ccef, 0x25dc8acfa47244c7 },
+  { 0x5a80b857eb8b908a, 0xb477ec4ef902edc8 },
+  { 0x5a81ad4e18405085, 0x1e63c8e16e3dac77 },
+  { 0x5a8afe5422abbfb0, 0xa342fb15afd7415f },
+  { 0x5a93265095146458, 0xdf2baf2162014889 },
+  { 0x5a9685c4d51a6c1d, 0x6a9544946d9e8dc3 },
+  { 0x5a9d188245aff829, 0xefde816fcade0b16 },
+  { 0x5acf9865a72c0ce9, 0x44979f76ff9610f0 },
+  { 0x5ae73916fa1da8d3, 0x8ceff674fa25a78a },
+  { 0x5aea9974b975a6a8, 0x44e6df10d2b861c4 },
+  { 0x5af9cd346266a1f2, 0x515e1fbc86f5186a },
+  { 0x5b124850de9eea66, 0x781a50b2e9837000 },
+  { 0x5b1e05ba56ad9345, 0xd39f261d4dadb88c },
+  { 0x5b574faa56836da0, 0x866ba32ae32547f2 },
+  { 0x5b5d04887922b430, 0xde0b7b2a21f9cd25 },
+  { 0x5b6f5bcbbde42fc7, 0x7d0bdb3146693565 },
+  { 0x5b7ea6aa6b35dc94, 0x7c65ce665fde624b },
+  { 0x5b85e987e2b16187, 0x69d97ba9182333d0 },
+  { 0x5b92a93b23523ff1, 0x6e2789b820e2a4c5 },
+  { 0x5b98e0536c3f6054, 0x7dd708ae22adb04b },
+  { 0x5b9c2e0012fbfd29, 0xefd3306359bbfc4a },
+  { 0x5babe0cad3ec99d7, 0x6b0aa1d36a695d2f },
+  { 0x5bba254e18257e57, 0x8c245ed96f6b003b },
+  { 0x5bbab3f3e4b47e3e, 0x23f9820765dbb45c },
+  { 0x5bbb75b49b2bccef, 0x9c91ff84bb249c80 },
+  { 0x5bc9998b7e9a970e, 0x31d2cb60e8696cc4 },
+  { 0x5bcc83677d68f7ef, 0x74c1b4a0697ba2a8 },
+  { 0x5bd79139a0c03b63, 0xf6f2cf00a7d385d2 },
+  { 0x5be03a1fe7b2c114, 0x725150be04b38704 },
+  { 0x5c0227ad63300670, 0xa647fcebf595ea37 },
+  { 0x5c0520c00163915a, 0x4336e481ca4e7ef4 },
+  { 0x5c19f6da638c4c7c, 0x1f98d09e63df43e4 },
+  { 0x5c1b1aa78b7609d4, 0x3c5144c3b3b60adf },
+  { 0x5c3a6d27c026f59a, 0x96b7af91e8b1bf26 },
+  { 0x5c5a382f4c181318, 0x74ed64d23f6a12ad },
+  { 0x5c618a50dfa23daa, 0xc97ba459b9ff5206 },
+  { 0x5c73693a89b06e5a, 0x09f1721a13176f95 },
+  { 0x5c86e938e0845b9d, 0x61f458539e9a552b },
+  { 0x5cbd7c31443fb9c3, 0x08e9f0b54d94a395 },
+  { 0x5ce98f22ade91510, 0x8860424d8dde0d35 },
+  { 0x5ced13931c21ef4f, 0xc77d3fe801a1cbfa },
+  { 0x5d0e8a25cbd23e76, 0xf843c75a86b7e15b },
+  { 0x5d132d121aabc523, 0x5dd039dfc46aa024 },
+  { 0x5d25df9dc2cde746, 0xceac48e834cf84a7 },
+  { 0x5d2cc33ca798783d, 0xee435eb29debf6d6 },
+  { 0x5d7293f1892b66c0, 0x14e8d222e06f6165 },
+  { 0x5d799bfa9e1e7b62, 0x24877162accada0d },
+  { 0x5d8f1ab95362acdf, 0x3426d572a6301bf2 },
+  { 0x5d8fb14860c2f198, 0x472b233874f6b0c9 },
+  { 0x5d9592756425192e, 0xc621d2613d0e683d },
+  { 0x5da8fd0b5ed33a36, 0x0bff37f8b5d0cd58 },
+  { 0x5dae540347cf0a55, 0x9962d62604ecf750 },
+  { 0x5db9e5bf663cad6b, 0xf159bc395f6ead53 },
+  { 0x5dccf215fdb9bbf5, 0xd4a6d0139e5e8bcb },
+  { 0x5dd08e85fd7b928d, 0xf16f59df92a9d983 },
+  { 0x5de8803a59c36725, 0x888346fdc6e7429d },
+  { 0x5df32450b9fbcaf4, 0x3f9d83bd66bd5a81 },
+  { 0x5df559a36347d857, 0x2f9a6e8075a31322 },
+  { 0x5e0c37f534ab5ccc, 0x4661768e2ddf0162 },
+  { 0x5e1b4629426f4992, 0xcf3b2905a696e1a7 },
+  { 0x5e1b7a6078af428e, 0xf056fe85a37a95ca },
+  { 0x5e1cd11a6d41fc15, 0xcf4792257400a31e },
+  { 0x5e201d6bfc520424, 0xa28f129ee5e56835 },
+  { 0x5e2495d43b981010, 0x304af55efed1e798 },
+  { 0x5e43c0391f7412ae, 0x64fae6f3742d6ee9 },
+  { 0x5e99aa93d0acc741, 0xdcda8752c4e813ce },
+  { 0x5ec73ac7d2ac95ac, 0x9530c6d33e713d14 },
+  { 0x5eeb81292992e057, 0xb290a5cd196f155d },
+  { 0x5ef303b9f0aa8cf2, 0x0720c560e5f9baa1 },
+  { 0x5f1b7d5fa73aa071, 0xba0a3c2819511505 },
+  { 0x5f2b4c155949f01c, 0x06507fb32369d42a },
+  { 0x5f316973ffd107f7, 0xab9117e93f50e4bd },
+  { 0x5f39353f7c692577, 0x9b0169a87ff86f1e },
+  { 0x5f3e92916a3d1c06, 0x38e9665781119551 },
+  { 0x5f46d1ff6d7cdeb4, 0xb09c39d04dfd50a1 },
+  { 0x5f4ebf8a1e5f5f7b, 0x9ff3e3c6affff3e6 },
+  { 0x5f56083739638745, 0x5c9dcb05cdd4b053 },
+  { 0x5f681403b1051a08, 0x22344f467b05a94d },
+  { 0x5f708ca39627697e, 0x859d1c53f8d8d7d2 },
+  { 0x5f73e7175474c1c2, 0x2fb8030c3158e9b3 },
+  { 0x5f786b67e05fb998, 0x5b77d4beb35e06ee },
+  { 0x5f7ae9a7f8d79a3b, 0x37e8fc841f65643a },
+  { 0x5f7de62a408b9de3, 0xa1168898298fd31d },
+  { 0x5f950a2d1eb331a1, 0x276819520705df94 },
+  { 0x5f9b62350b31be8b, 0xd270d9a241cbd50e },
+  { 0x5faffe1c4c574309, 0x78dec5ced32b9f4a },
+  { 0x5fb71cc60e293fe1, 0x0a5023f11c734e55 },
+  { 0x5fd4239051c76563, 0xeed086f512b4cd48 },
+  { 0x600d48eef5c0ec27, 0xdb554b7328b3251c },
+  { 0x6015a9cef783e97e, 0x98a2aa2cf070ae06 },
+  { 0x60246884418a559d, 0x6c23d3a6baee9e8f },
+  { 0x60358edf0c2cc76b, 0x1e549e031e50e130 },
+  { 0x603c7a0d12c935df, 0x5810f400f3971b67 },
+  { 0x6041f400b45511aa, 0x3a69fab4b8fc8f41 },
+  { 0x604e09724555807c, 0x28108049efe34a13 },
+  { 0x6058e40ce79d7434, 0xc7f7477b29abd4a5 },
+  { 0x605dcb73d22f4efd, 0xb90ef9da2f290f7c },
+  { 0x605fd59bfef88901, 0xc8c4794193a4cbad },
+  { 0x606c2c1753051e03, 0xc1f1ac096c9d2832 },
+  { 0x6076b187a5d8ea7a, 0x2a05111c19b5d5cd },
+  { 0x60a61da9b2f43dd7, 0xe13a5093ec41a53d },
+  { 0x60bbd425cb7214dd, 0xb9f9a31948e91ecb },
+  { 0x60cd61a2dfccb0e2, 0x736434f9792c1672 },
+  { 0x60d304582d33e295, 0x7b73eb300a7495bb },
+  { 0x60e0ea3cbe0913d3, 0x9803477945e9e5ec },
+  { 0x613abf596c304ef6, 0xdbd8f3351920c37a },
+  { 0x6141c095d0aee4e7, 0x34bebfaac939030a },
+  { 0x61426cee013306e7, 0xf7367534ab124747 },
+  { 0x615a3bf251a38eb6, 0x638cdc7ffbde5480 },
+  { 0x61621a556ad3228f, 0x0234f5feb3ab135c },
+  { 0x61631c2f96221527, 0xe7da9802b4704f93 },
+  { 0x61719a8bdafbd8da, 0xb3ca9ce7b171b9e2 },
+  { 0x61728c6cfb052e62, 0xa9ed088c5bf407ba },
+  { 0x619de46281eb2e0a, 0xdbb98255732483b4 },
+  { 0x61baadddc2c8f6e5, 0xfaa57d4d0f285462 },
+  { 0x61dbe94f110f30ca, 0x4ec524ae5ce2d026 },
+  { 0x61e0f5e1cc207e98, 0x704d0758c68df317 },
+  { 0x61ef8c2fc43be9a0, 0x4fe13fdb79ff2bd9 },
+  { 0x6205855cc848d1f6, 0xc4551391b9bfa279 },
+  { 0x6238ac888871fec3, 0x01d1b9fc4fc613c9 },
+  { 0x623c0a85245738af, 0x3954ff14591a8773 },
+  { 0x624e0a77f9ec67d6, 0x28211aaf24d8aea6 },
+  { 0x626d67918f4b5e3f, 0x961e4b2af2f41f1d },
+  { 0x6272f348a9a7f2d5, 0x00a4006aa93e0d08 },
+  { 0x62899430338e0538, 0xee93397867d85957 },
+  { 0x62921652f6634eb1, 0xa0940ed5489c7e18 },
+  { 0x62992392ea651a16, 0xaa724a92e4596ed6 },
+  { 0x62d1f50219edf9a4, 0x29a9f004c19f31b3 },
+  { 0x62ee2b8f59e9cd62, 0x85bbdb674a952e8b },
+  { 0x62f74a2736841191, 0x135514422b20382d },
+  { 0x62ffd175cac3f781, 0xef6e4870136a2520 },
+  { 0x63166867f75869a3, 0x592b7a94ea62d147 },
+  { 0x6333ef5b5cbb77ac, 0xd47f558c8b7a95d3 },
+  { 0x6337927ad909aa73, 0x9d6d0044699a916d },
+  { 0x6339d28c9a7f9205, 0x4e70029eb0375837 },
+  { 0x6342afe9c9ad1b61, 0x20b8f6fb040d0926 },
+  { 0x6354f9c7588a2710, 0x9c66905b0405825b },
+  { 0x6358f7f8bf048340, 0x2a080efccf250d61 },
+  { 0x635cc7a0db337739, 0x59d739d04eff96c2 },
+  { 0x6362396c8344eec3, 0xe86731a700b13abf },
+  { 0x637efac676ff063f, 0x2fbb0abff77c4fa5 },
+  { 0x63811ed69bdbc35c, 0x69d8aa7806c3d6e9 },
+  { 0x638cc82ea96f6767, 0x4595ba9ae05da6c6 },
+  { 0x63a6eda1da304465, 0x69ac76211d0f861c },
+  { 0x63a7445b1d3046d3, 0xcdcdbd488dca38d9 },
+  { 0x63c5fef3208bb142, 0x4d26cf1ab984b40c },
+  { 0x63c7395d412a3cd0, 0x95ccdd9b5711f387 },
+  { 0x63d6247f35902ba3, 0x2aa49e7660b0ecaa },
+  { 0x63e42d5768000864, 0x88679490a833e097 },
+  { 0x63e783994df824ca, 0xf289b69a084cbf3e },
+  { 0x63e9e612bbee3104, 0x5f8d184a4e53f8ec },
+  { 0x640a08e9ca019172, 0xd612df22a9190afb },
+  { 0x64198bb6470c78ac, 0x24fcf13fe76ab28c },
+  { 0x643e6451eb6b8ab7, 0x93eb60ba9c02e000 },
+  { 0x645bf7f9146f0e48, 0x11ff9c7898f5cd93 },
+  { 0x6468d744be9984f2, 0xa39ca9285443a2b2 },
+  { 0x647162cceb550fd4, 0x9820e2206d9ee7e8 },
+  { 0x64b8e19c767191cc, 0xdc97acc6904c397b },
+  { 0x64ca518905311d2d, 0x9aeb56273f6caa04 },
+  { 0x64d43859258dc8ca, 0x54949e9ff4174202 },
+  { 0x64fab9d15df93791, 0x5b1c392fc119b83b },
+  { 0x650df778c6ce22d3, 0xfd1a7c33c565bcc3 },
+  { 0x651d2b6743a3a18b, 0x426bce2c881af212 },
+  { 0x6522717cfd75d1db, 0xa252cbde76992090 },
+  { 0x6538e454b0498ad2, 0xbefe1ef0f87815c0 },
+  { 0x65490d61922f3e38, 0x83ee1d583ce10855 },
+  { 0x65562f686b267b21, 0xb81c4dddc129d724 },
+  { 0x655c84e5b951258c, 0x9d20f0bf2b9d496d },
+  { 0x656dc247db287176, 0x6dffd978c71da80c },
+  { 0x6588d192d9a8afce, 0x27b44271a2072325 },
+  { 0x65917ae29a8c9785, 0xbb1f2acb0d6aafd0 },
+  { 0x65949de96b741046, 0x269379289189b3de },
+  { 0x6596b3737ae4b976, 0xe4aadb68d836c5c7 },
+  { 0x659a20019de4a23c, 0x748ec2292ea5f221 },
+  { 0x65a6f1255fe22468, 0xa8bf84ff28a4d289 },
+  { 0x65b106eba3e45f3d, 0xab72ea907f39f8b4 },
+  { 0x65ba1a4c643d1ab4, 0x4481bdddeb403827 },
+  { 0x65bd29e8ab1b8473, 0x09775b0de6b2e4fe },
+  { 0x65c6406f5af93459, 0x0097c8c032ebb482 },
+  { 0x6604f72a966ca6b2, 0xdf6a94ee4a68eb82 },
+  { 0x660c378803503a44, 0x3556525ddda08648 },
+  { 0x662eca7e3d89175b, 0xa0802e8e3425dedb },
+  { 0x66362890eb78d6ea, 0x65301592cce65f5b },
+  { 0x663ef22eb399504d, 0x5204c543b8a86bcd },
+  { 0x664d9bfda6f32511, 0xf6b4aa0159fd87f5 },
+  { 0x6651e2791d38edc0, 0x2c5a5fd7b47a1627 },
+  { 0x665aa428027579c9, 0xf08e2094c18dc819 },
+  { 0x665b8f8ead0eef22, 0x0ed53886fbd61ec9 },
+  { 0x66706459e62514d0, 0xc39c3797cbf73ff1 },
+  { 0x6672de8f82c4f7b8, 0xf7f1ef8b6b4f614d },
+  { 0x667a70b028f581d8, 0x7648693b873bc962 },
+  { 0x668dc528b7ea9345, 0x140f4fcfbecf7066 },
+  { 0x6697f177847c7050, 0x5824422e76aad586 },
+  { 0x669840b0411bfbab, 0x5c05b786947d55d4 },
+  { 0x66b89ba44e7ae0b5, 0x1f9ef000ebba1eb7 },
+  { 0x66b92ede655b73b4, 0x02ecd1f4d8cd9c50 },
+  { 0x66bc1bef269ea590, 0x33928bac2d1d81e6 },
+  { 0x66c2380c71709efa, 0x7b166621e5bb4558 },
+  { 0x66c4e0298d4120df, 0x333bc2f3e163657e },
+  { 0x66f49b3248791b98, 0x03fa3e2f4165d072 },
+  { 0x66fcf7643d554f5e, 0x15d4d06bab59fe70 },
+  { 0x6706a00f9635508c, 0xfeda20639156e66e },
+  { 0x672012d40336b403, 0xedea4a98ce70c76d },
+  { 0x673268cfaa8ff3f6, 0x55b9e34d75e6a90c },
+  { 0x675ae9c23fa1aae3, 0x76cea86cad96f9a5 },
+  { 0x67631ea5cfe44066, 0xa1e76ddcb6bcb512 },
+  { 0x67684a1d18c85ffa, 0x5d82dab48fd1cb51 },
+  { 0x678c1d71a1616d9d, 0x022f03d8545b64bb },
+  { 0x67931b0d37dc99af, 0x250dd06f1c095e8d },
+  { 0x679d30c7886b283c, 0xbe1db4e7dbe5f2a6 },
+  { 0x679e910b27406c6a, 0x2072f9569ae35fc8 },
+  { 0x67bd3d4dc5ac6a42, 0xa99950b4245bdc81 },
+  { 0x67c05ae94bf8b83a, 0x666c3ae2c4bc14de },
+  { 0x67cdde4176e0447f, 0xc45a71e0a1cdd288 },
+  { 0x67ce6cdf788d3249, 0x35fd317d064ed842 },
+  { 0x67cf913d1df0bf2d, 0x7ae668060d0b6694 },
+  { 0x67f90d74fd0b72fd, 0xc6d9b92436780ea9 },
+  { 0x6803fa7c2c094b42, 0x8b859a58dc1dd06a },
+  { 0x6805734a0b7bcc89, 0x25d9305b071bf147 },
+  { 0x681206a6bde73e71, 0xc19743607e96c4bb },
+  { 0x6833c26f385e866f, 0x3a0fa0dff311216e },
+  { 0x683bb0d0f0c5df58, 0x557fba9dffc32c40 },
+  { 0x683dc64ef7316c13, 0xba04ee4398e2b93a },
+  { 0x68449e4aaba677ab, 0xcd7cde4264e02168 },
+  { 0x6847ce70819b74fe, 0xbcfd03e99610243b },
+  { 0x68489e60268a5e6e, 0x052bad9c62681635 },
+  { 0x68597264c8e57ada, 0x93be3a5be4565096 },
+  { 0x685e9668dc270b6d, 0xeeb9cfbfd4d633c3 },
+  { 0x68760b82fc5dcf3f, 0xedf84376a4944bf9 },
+  { 0x687c23224e26f81c, 0x56e431c24faea36d },
+  { 0x68878250e106eb6c, 0x7754bc2519d780a0 },
+  { 0x689f49e31cac68db, 0x8a2cf8f44fa7a01a },
+  { 0x68ac69b8e1ba83af, 0x8792f693f5ae7783 },
+  { 0x68c80e7e1d30df98, 0xa0cf67ecbf39cc67 },
+  { 0x68c938a2a2b45c37, 0xdb50509f1037fe6e },
+  { 0x68cd2adc6b1fc9a1, 0xf263ab4561112f30 },
+  { 0x68feb6d6ff63e80d, 0xf1302d8547979aec },
+  { 0x690a6049db78b940, 0x0c13521646708e9c },
+  { 0x6913c90002636c14, 0x87538d4004f7cac2 },
+  { 0x691d67910b08b63d, 0xe8631901d1887c1f },
+  { 0x692202772d8b38cc, 0xf85a90c8003a1324 },
+  { 0x693137592a7f5ccc, 0x9baae2d1041b7a85 },
+  { 0x6936aa6763835f62, 0xac13d1aaa79b9f91 },
+  { 0x6979f30204149be3, 0xe227558cffe21c1d },
+  { 0x6982854657a2cc87, 0xd712f718e402bf85 },
+  { 0x69877da5caded483, 0x15e3e45882a303d5 },
+  { 0x698f569eab5a9906, 0xeec3bc7c6b3e0980 },
+  { 0x69974dd5d6420b90, 0x898cde50aec5ef39 },
+  { 0x69df0411d4d176e5, 0x58017f961f5c5849 },
+  { 0x69e79b1352b9ee17, 0x54bbe63b4a7062c3 },
+  { 0x69ebf910ab9b63e5, 0xb8345f016095003b },
+  { 0x69edfb4e1810a523, 0x311b3e250fc1e275 },
+  { 0x69fac82cd2312dd9, 0xce5d90e22e2f070a },
+  { 0x6a03c28d505bab71, 0x0bf20b954e14d521 },
+  { 0x6a07836c382195dd, 0x5305ce61d992aaa6 },
+  { 0x6a091b8ffeacd093, 0x9850da2094b51564 },
+  { 0x6a222c26bcece3a5, 0x10ddda21398f72c6 },
+  { 0x6a2c68f7a77736ba, 0x02c0f21a6ba0985b },
+  { 0x6a3b0c33cf74b1e2, 0x13a629e3c142b73c },
+  { 0x6a76d5f0ed721639, 0x474aa9bbde69ebf0 },
+  { 0x6a82b8ecc663f371, 0xb19076d99f46c598 },
+  { 0x6a882fb1413912d2, 0xce5cf5fa62cf3875 },
+  { 0x6a8c6940d3be6fd0, 0x1274363c4d4b298e },
+  { 0x6a9b30ca46b0dba9, 0xe719f4cbd340e01c },
+  { 0x6a9e0c72fab92df7, 0x0084eccd9061fdbd },
+  { 0x6aa66e9c3eea76a0, 0xc40ef05513497c40 },
+  { 0x6ac3fd31a5173035, 0x8708c7fdc62487f8 },
+  { 0x6aca52e11b597ab8, 0x4b33d5252e1cd9d1 },
+  { 0x6ae4dc6d7351dacd, 0x1012749ca82f9a56 },
+  { 0x6b01a519b413f8cf, 0xa2f399f4d2841b42 },
+  { 0x6b1fc959e28bd71a, 0xed7b89014574bdc2 },
+  { 0x6b4eb5b3df80995b, 0x8d9117cb7e9aeb3c },
+  { 0x6b683be69f92958a, 0xbe0e2a9945157ad5 },
+  { 0x6b6ca32228ae352b, 0x4267e4bd2cddf10c },
+  { 0x6b71f20c857574b7, 0x32e7a8e840bd3cb2 },
+  { 0x6b72b691ea86f614, 0x38ed0d84c4d711de },
+  { 0x6b75f8fa4fd011a6, 0x698c58315f83d2ac },
+  { 0x6b7a56b6ac2ca4bf, 0x9254474bf6ed7d80 },
+  { 0x6b7e1c11448c4d3f, 0x28160d2de884ebc8 },
+  { 0x6b8fb021bb2e1f1e, 0x9bd7ee57f2a8e709 },
+  { 0x6bb09bc915a7411f, 0xe160d0b2e4d66047 },
+  { 0x6bb22efa892b89b6, 0x9b9bf5ea547e62b8 },
+  { 0x6bc89b25d541a6da, 0x465d2e2c0b527941 },
+  { 0x6bde3f6ac31aceef, 0x447ce57d4d2c2ec0 },
+  { 0x6c128bc950fcbdbc, 0xaf0d99935da70156 },
+  { 0x6c1553ca90b413bf, 0x762dfc65f2b881c7 },
+  { 0x6c1f3f2e359dbf55, 0xdf462ccbcdd2f6bf },
+  { 0x6c25f58fd184632c, 0xa76020f589bb3767 },
+  { 0x6c449db9bbbd9097, 0x2ad1932d6af87330 },
+  { 0x6c658b52d03e0182, 0x8b9d2d4718a998ac },
+  { 0x6c76fe09aa8b39ee, 0x52035e0da6d0808b },
+  { 0x6c85098518d3f94f, 0x7622c42fd1d819ac },
+  { 0x6c91ac51421cb9fc, 0x72c9833c4f440d65 },
+  { 0x6c9a32ad83bcfde3, 0x774536e52be1cce7 },
+  { 0x6cab04277e7cd552, 0xa3e40b3c0e6e1e3d },
+  { 0x6cbe945e16d9f827, 0xd0d295546ac11b22 },
+  { 0x6ccd8ca17a0e4429, 0xb446cdcb66327bf1 },
+  { 0x6cd1dc960e3e8d5c, 0x5e0fbe67ab49087a },
+  { 0x6cd506509e8fd562, 0x7f55603780e862a8 },
+  { 0x6ce2110ac5dd89ab, 0x398d9452891752ab },
+  { 0x6cea35ded079863a, 0x846159c3a1101cc7 },
+  { 0x6ceb7d6a54e9a5e6, 0x2d26874d1cc88dbc },
+  { 0x6cf054cd23a02e09, 0x298d2c6f787eb21d },
+  { 0x6d218dafbf5a6910, 0x45cdc1f67ceb6a8f },
+  { 0x6d475019ea30d0b2, 0x9f695e9dcfd8f730 },
+  { 0x6d74ebaba914a5cf, 0xc868de9dd1a5c434 },
+  { 0x6d842c96d5a01967, 0xbe9680080dd5be54 },
+  { 0x6d8a04ee15951480, 0xcb7c466e5951eee0 },
+  { 0x6d9afd70e9369c2a, 0x6bff96c4964413b7 },
+  { 0x6dda84fb8e442ecf, 0x34241ac0d1d91d69 },
+  { 0x6de924c2297c8733, 0x524952448d54a33c },
+  { 0x6dfad2dd2c7c16ac, 0x0fa257b6ce0be2f0 },
+  { 0x6e179eee3d4631a7, 0x434d40cf7aeea6e8 },
+  { 0x6e19428387686a77, 0xd8c8d2f731cb09e0 },
+  { 0x6e372f076fb9586a, 0xff416144f5cfe1cb },
+  { 0x6e59dd52f88c00d5, 0x060eac56c1a0b0d3 },
+  { 0x6e5d5ba193d2540a, 0xec2e847aafb2a5fb },
+  { 0x6e7ed74082f39ad4, 0x166c823765a59909 },
+  { 0x6e7efb0ed13ec28a, 0x00d19572de9c9f03 },
+  { 0x6eb10fd23c716175, 0x1d18b9e8484c0004 },
+  { 0x6ed5012793f5ddf4, 0x353a48c11ea9b8d3 },
+  { 0x6ed6bda5c42b2eb7, 0xa21c54e5b3ace3e3 },
+  { 0x6efe876168e2d45d, 0x4719b6a61355e5fe },
+  { 0x6f05cbc85eb3d439, 0x036f8155090accc0 },
+  { 0x6f084daf265599f6, 0x5422ef4173b69bc7 },
+  { 0x6f2aaffaaf53d23a, 0x28bf6677b86ac0e3 },
+  { 0x6f3e3306da2aa6e7, 0x4a5e046ff43bf028 },
+  { 0x6f744f14aac04f7e, 0x1ea0d3f4bafcb3e4 },
+  { 0x6f74ed915ffe73b5, 0x24ef0f63819e2a1d },
+  { 0x6fa0ac6943e33637, 0xd8e77df14962fbfc },
+  { 0x6fac680fc9a72e0e, 0x54255567c72afe34 },
+  { 0x6fbd05b0ad65b2a2, 0x61fa154b34328a7f },
+  { 0x6fc0176ccf53d7bc, 0xe249aeb56d59d414 },
+  { 0x6fc27a9233fc69d2, 0x8d3f190b4ff80f03 },
+  { 0x6fc394dbf21cf541, 0xa60e3b3631b817f1 },
+  { 0x6fd7c7057eeab273, 0xb29c7aafc7429a96 },
+  { 0x6fe67f525c39200a, 0x798985e419431805 },
+  { 0x6ff4156d10b357f6, 0x1f09820d03c0f852 },
+  { 0x6ffc95108e5add6f, 0x9b8abcaf330be835 },
+  { 0x700a786471c8a91e, 0xc09e2f8e47f14a04 },
+  { 0x703d32062436e4c2, 0x0c48313dff30e257 },
+  { 0x703f0f7af350b0fa, 0x29dfe5fbf45d0d75 },
+  { 0x705fe719179e65b0, 0xaf328644f3a04900 },
+  { 0x706e3cc4931f9844, 0x47213b92d1417aff },
+  { 0x707ecd80030e8575, 0x1ef311ced66220bc },
+  { 0x7095858d35ca36e7, 0xa8f46bea46bb46da },
+  { 0x7096a198531d3f16, 0xa99d518ac0d7519a },
+  { 0x709910c2e83361bc, 0x4bf8cd0c20c34fbf },
+  { 0x70a43fbdb1c03928, 0x3ee5048d99842469 },
+  { 0x70a8480cfaf08776, 0xe5420365732159d2 },
+  { 0x70ce036e59be9282, 0x1c4c7fd735ec6f68 },
+  { 0x70d14c66c319683b, 0x4c19abbe0e3db57c },
+  { 0x710497df2caab69c, 0xdcc45e919c69e13f },
+  { 0x7128e72bc1b707ef, 0x63f7a95177e96c39 },
+  { 0x713fde2af865b6ec, 0x464dfd72e2ebb83e },
+  { 0x71464c54da46adae, 0x9447926fdbfc1abe },
+  { 0x714e13c08508ee9a, 0x7785ceac908ae831 },
+  { 0x715dbf2e39ba8a52, 0xc5fe5cdd927b37e0 },
+  { 0x715dd9e0240638d4, 0x41a3add49316c018 },
+  { 0x7187118674ff3c0b, 0xb932e049d9dbb379 },
+  { 0x718ae62c70af4e5f, 0xd8e932fee216948a },
+  { 0x718ee85ea7ec27d5, 0xbea60d11f6d40030 },
+  { 0x7197b6cbde6ecd10, 0x376155e6b848e80d },
+  { 0x71b193f46c88fb23, 0x4329855452dfac5b },
+  { 0x71ba6aefca094248, 0x99441db9ae14ee04 },
+  { 0x71d005b60cf6e608, 0xd04efb99a37362c3 },
+  { 0x71edab64f5478313, 0x2536bef7c141a63f },
+  { 0x71f09f128e76eb14, 0xe244be8f44848759 },
+  { 0x71f8bacfbdca0191, 0x13f3f0801849057e },
+  { 0x72097e9dc366900b, 0xa2da73a47e3e80f5 },
+  { 0x721a5567f76856f6, 0xb50a6707aa8f8316 },
+  { 0x7224947dce1130f7, 0x0de83f25b446e4e4 },
+  { 0x72305c997f2cec41, 0x4fe6f8c946172f83 },
+  { 0x724613effaf7743c, 0xbcd695fab469c2a8 },
+  { 0x726af33d9acfc861, 0x6a8df05de4f560af },
+  { 0x728152f5ae6fdd0d, 0x3a9b88709bee6c7a },
+  { 0x72876fd7c7435f41, 0xd571f1101fc456ea },
+  { 0x72a46e0c21f82551, 0x8b7261c267ab886e },
+  { 0x72a5b5052272ac78, 0x5fa076709d16cef4 },
+  { 0x72a63bcb5eb31bd0, 0xfd5e98ed05125ec1 },
+  { 0x72b342fbaacdb62f, 0x0fcf90e6e29c4920 },
+  { 0x72b7ce89859d2405, 0x58a5baf57b06c8dd },
+  { 0x72bda70c75dfa236, 0x5b3f8894bace9e6a },
+  { 0x72d0acb5de0db662, 0xde0360a6fc59334d },
+  { 0x72db1194b1cc7d45, 0xb242f25eb1c148d3 },
+  { 0x72fd08deed1d6195, 0x942e0c6f392e9848 },
+  { 0x72ffbef6504b75e6, 0x9ee1045af9075f66 },
+  { 0x73158ea51d77bf52, 0x1e1369311d26c27b },
+  { 0x73521c6b9fed6a24, 0x3d9b7b161a0fb793 },
+  { 0x736388d73198552d, 0x77d423962000006f },
+  { 0x73a710e621d44e97, 0x039d640071908aef },
+  { 0x73aa02458b413091, 0xac940c0489301710 },
+  { 0x73b4e8f8b04515d9, 0x1937510e680214bc },
+  { 0x73c545db2afd5783, 0xd37c46004e4024c2 },
+  { 0x73c839aff6a05564, 0x3044d2ce16b3aaf7 },
+  { 0x73cb1f1666f3fd30, 0xb52b4f3d760c928f },
+  { 0x73e66e82ac22b305, 0xeb4d9578e866236e },
+  { 0x73efa9f3cbe197f2, 0x6e0fb87132829232 },
+  { 0x74023e0f2e739fc5, 0xa9ba7caaeeee8b6b },
+  { 0x740a7fa80f52cc72, 0x87ba37677afb6b21 },
+  { 0x740b47df422372fb, 0xef700b42cea4e0bf },
+  { 0x740f39e71104e904, 0x16c29a73560b9c6b },
+  { 0x7412f6788087d7e9, 0x12c33ba03b36dd1b },
+  { 0x742de93b8d849220, 0xf266b627fbabba82 },
+  { 0x7450ae4e10ba8380, 0xc55b259d7c2b13e8 },
+  { 0x7454786af7126ccc, 0x7a0c31fcf5af40f1 },
+  { 0x745820765bd159c5, 0xbf5222fb859769d8 },
+  { 0x7465b06b6e25a4a6, 0xc6d77d02242af6d6 },
+  { 0x7481f0771bff1388, 0x5b2ff2570cf90d7b },
+  { 0x749fec9918160921, 0x576f850b2375b516 },
+  { 0x74d072e8a34560c3, 0x6cacbc57b2462360 },
+  { 0x74ebaca101cc428c, 0xf219f15dda84b6f8 },
+  { 0x74f623833429d353, 0x41b7a84bc09793c0 },
+  { 0x75028162bfc4cc8e, 0x74b04e320f9e6a3f },
+  { 0x7511c34518a9a124, 0xea773f5b0b5c9a48 },
+  { 0x75169c08b56e4e6c, 0x36681e599c4d8cc5 },
+  { 0x752da1c0acd7d132, 0xccfb0b1067f53cf6 },
+  { 0x753375d183c713cf, 0xa0aa7298d1f3067b },
+  { 0x7550b821ee56fb58, 0x33dca2be88622d5a },
+  { 0x75511bb694662301, 0xc9e71df645f4b5a7 },
+  { 0x755fed16b48e81de, 0x05130708a905d00d },
+  { 0x756ca07a65a4fbbe, 0xdeb5f0ddfc04d0be },
+  { 0x75723c16a975afb9, 0xda92022583fa802d },
+  { 0x7574480ae2ab0d28, 0x2c887e9015fdb54c },
+  { 0x7576dd46c2f8d8ab, 0x159d97e3a3f2052f },
+  { 0x757f529026696e13, 0x838364dea382a4ed },
+  { 0x75893a9dc5de4b91, 0xcc426959b82a1da0 },
+  { 0x75a303fd46ad1245, 0x7ed8e853016815a0 },
+  { 0x75b22fdf632d76e2, 0x46433db1ebccd3c4 },
+  { 0x75b557be7f08db84, 0xec5b242207b9f241 },
+  { 0x75e276ba12dc4504, 0x659481c31345703a },
+  { 0x75e8d8b9e9c5c67c, 0x2226dbfd77dcfa7d },
+  { 0x75ea128ba96ac6db, 0x8edf54b071027c4e },
+  { 0x75ea60884c05ba49, 0x6473c23a58edf12f },
+  { 0x75ee371ccfc4f43e, 0x7d9b8f24e1266b55 },
+  { 0x7608abdfd9b26f4a, 0x0ecec18b232bea54 },
+  { 0x76226fa2eb33e796, 0xd1e7c7bb8f22a91e },
+  { 0x7623a639a6fffdb2, 0x46775fe2eabc8d01 },
+  { 0x7628d3cadeee0fd2, 0xe41e68b3b8fbe229 },
+  { 0x7648e72a5b589907, 0x6688df18a1ddcf72 },
+  { 0x764ce6801f28a9ad, 0x36f11de3e57c053b },
+  { 0x76809eb1ee0db8a3, 0x18308a5cdda0f4e2 },
+  { 0x769ddc995dbb9edb, 0x8167efcea9f34a7c },
+  { 0x76a9bf05a6de8418, 0xa3ebc7fc254b71b4 },
+  { 0x76c685d1a60c0107, 0xaa54a772113a2972 },
+  { 0x76c88341017eae66, 0x0efc6e49c4b6ab40 },
+  { 0x76ee917d817ef9a6, 0x54bc4783e0273ac4 },
+  { 0x76f53abbbf39a006, 0x3f24036d6ee0968a },
+  { 0x76f66ce3b83d7a10, 0x4a899b4b3354a2f2 },
+  { 0x77057d9d14b99e46, 0x5ea9e29783af0ae3 },
+  { 0x7732e4e4cc2644f1, 0x63d6650ddcc9d9df },
+  { 0x7761418d46af069b, 0x8cd80c29fe6cd814 },
+  { 0x7778ac65d775a079, 0xf537e97cbdad541c },
+  { 0x777aece98d737399, 0x8ffb8bc0b5eff1a2 },
+  { 0x77887e4192a6b0a7, 0x81530e6cf9be7199 },
+  { 0x77be57d872e3f5b7, 0xecf8d19d97f73281 },
+  { 0x77cd9a9dd810ce80, 0x42bdb9d40e256dfe },
+  { 0x77d0a577636e1c92, 0x12aeccde9d0baa4b },
+  { 0x78297db7f416af30, 0x52dd793b53ff014e },
+  { 0x7836794b79e8060c, 0x2b8326a2db74eef0 },
+  { 0x784176346e942273, 0x3d55c427230e5bad },
+  { 0x784abfdb31d5341e, 0x5bd404d8d2a71c3b },
+  { 0x7860716fa5dbc0ff, 0xfab93fb9a4cb4132 },
+  { 0x7867ee819b53d69c, 0xfcfe740f7ddca574 },
+  { 0x787ebc2609a31eb5, 0xc57c4a18837d1aee },
+  { 0x78821ef76ebc3934, 0x850d1bc1b9e4f4b0 },
+  { 0x78963290052fd17c, 0x6c7998305ab3a6a0 },
+  { 0x78b84cfb1c57b048, 0x8d674d2374e656e6 },
+  { 0x78c2de58e42cd1fa, 0xac2ea7df783eaeb3 },
+  { 0x79004f84bdeee78d, 0x142e445057883169 },
+  { 0x791bc8aceb6b0f4d, 0x9990d6062b30adfa },
+  { 0x791c88eca9836af8, 0xc34bf32b07cb58a7 },
+  { 0x7926083ad423ed68, 0x5de3b3a04a914315 },
+  { 0x792b1d93eb1d8045, 0x260c840b0688ec8f },
+  { 0x7972e5101fa548b9, 0x52d852db24ad6060 },
+  { 0x798b8921276eec9e, 0x332dfcb47a2dbb17 },
+  { 0x798cc114f1623c14, 0x085868cd3494fe8e },
+  { 0x7991e1797e5e9f31, 0x1fd957e62d889dff },
+  { 0x7996b8d07462a192, 0x59baa4c811c2b4b4 },
+  { 0x79ab4123a83dc11d, 0x468fb2108ea09e2e },
+  { 0x79b649fb812c50b4, 0x347d12e7ddbb8400 },
+  { 0x79c27f90591e3fdc, 0x7d2ed020ecbedeb3 },
+  { 0x79d4af56036ec28f, 0x298cad964a2e2494 },
+  { 0x79d6f61da3c64688, 0xac8e075667f8a39f },
+  { 0x79e5338dbfa6b640, 0x08bb0d72a3179d3c },
+  { 0x79fcdee6d71f23f6, 0xcf3d01258236c3b9 },
+  { 0x7a09299f473105ae, 0x1ef3ad6f9f2cd807 },
+  { 0x7a2af383014f5d81, 0x0ad26d322823549d },
+  { 0x7a48dd03d839da08, 0x2dc2287ede070383 },
+  { 0x7a5463545dfb2dcf, 0xdafa6074b2f2c15e },
+  { 0x7a63d7ea3f2851bc, 0xf04f0bb4ba1a3929 },
+  { 0x7a64a8b727c8215d, 0x945e37d565ca95a5 },
+  { 0x7a64b5a6e90619c6, 0xaacf244cdd7502f8 },
+  { 0x7a7f6ab9215a3a6b, 0x5940b8737f116359 },
+  { 0x7a93d0c029eaa722, 0x36523eedc3f19645 },
+  { 0x7ab0917107b6ec76, 0x8a5ebaadf28c497a },
+  { 0x7ab210f448de518f, 0xa61a5924120ba872 },
+  { 0x7ab2f190d4e59e87, 0x42e76a6e870b567e },
+  { 0x7ac4f4fb425db382, 0x88fa07fb8ff4b21d },
+  { 0x7ad257833190bc60, 0x277c1ca475057051 },
+  { 0x7ad782952e5147b8, 0x8b65a25cadcdf9e0 },
+  { 0x7adbcf78399b1959, 0x6671edbffc3d34aa },
+  { 0x7af40c1485ce9f29, 0xb1a7b069a2eb04a7 },
+  { 0x7b24bfe1b61864e7, 0x58ada1fe9adaa098 },
+  { 0x7b33407b2b198af7, 0x4906b936ce1eecbb },
+  { 0x7b3cf0256e1fa0fd, 0xc538caf3d5d86337 },
+  { 0x7b43c32e3d4ff593, 0x2f39afcb4c551627 },
+  { 0x7b4be337ac4d73ed, 0xa75c848355f6f480 },
+  { 0x7b5207e68ee85b16, 0x998bea861987c690 },
+  { 0x7b57318c489ff178, 0xf7ff500da1ec9e8c },
+  { 0x7b6f3348dbf71ada, 0x88db0fdaf7feefe0 },
+  { 0x7b79beb378d1b447, 0x1def90ceccf413de },
+  { 0x7b7b4ac05232490c, 0x28f9b680c72998f9 },
+  { 0x7b8a481e0c5aa781, 0x50b5555dff01f64e },
+  { 0x7b938c7ddf18e836, 0x2949b62c7eaa660a },
+  { 0x7ba07d4ea18bf3b3, 0x245c374d8720ad30 },
+  { 0x7bb286cb659d146a, 0xf3966d699b51f509 },
+  { 0x7bc4fd254ec8c0a2, 0x5a13f02fd3f762ff },
+  { 0x7c00e7a205d3fda9, 0x8eb20da7c9c50a55 },
+  { 0x7c4a499d343fca0c, 0xef2d59dd16af621a },
+  { 0x7c757bb151269b2a, 0x626c907a22f5dae7 },
+  { 0x7c7a4a2d505c2d0c, 0x75337c44711d8d54 },
+  { 0x7c9b3b8b25acf2fe, 0x3b8da834f69629c6 },
+  { 0x7ca7a471d70305c6, 0x73fedd08174a81e8 },
+  { 0x7cc77f6745e1f2b2, 0x0df4a4327d350545 },
+  { 0x7ccf350354ee15cd, 0x9b85564a2014b08c },
+  { 0x7cd379da92c93679, 0xf3b6d2548617746a },
+  { 0x7cd900e9eccbb240, 0xfe9c37fa28f917b5 },
+  { 0x7ced6709f091e79a, 0x2ab9575d3516a4ac },
+  { 0x7cedffa0db65d610, 0x568b90aeca705ac6 },
+  { 0x7cf3a9267cdb95ab, 0xa91abc5838d61cc5 },
+  { 0x7d0b49ea4fe3a5f1, 0xe119a6d14843db17 },
+  { 0x7d1034bcb38c9b74, 0x6ea2c0ae37d9dff2 },
+  { 0x7d24f3054be9950a, 0xa263e005581c4786 },
+  { 0x7d3cdde63b16fa63, 0x7c4484e716839c94 },
+  { 0x7d483b702c44ee65, 0xcd2df22cbcc8b7ed },
+  { 0x7d5c3b7b908752b9, 0x8e30690e2a3322c2 },
+  { 0x7d726fa494f70678, 0x4bafeb1b50d87f23 },
+  { 0x7d8287e8423a56d4, 0xf8cef10435d97179 },
+  { 0x7d903411807704e7, 0x25cf3fafbeb97255 },
+  { 0x7d93071b3e361609, 0x3a6b5a98b0315751 },
+  { 0x7d940d749e55b96b, 0x7b746519fa06f2de },
+  { 0x7d9c96b215d1941e, 0x87b6fb412eb9204f },
+  { 0x7da9de8d62fcdd3a, 0x2c545b2e720c2a61 },
+  { 0x7dbc8fa2e488e3f6, 0xb87fbe0f76c5b89f },
+  { 0x7dc03a1f56d0e6a8, 0xaae3e3e50d654a08 },
+  { 0x7dcbfd2acc013e81, 0x7f011309c7504daa },
+  { 0x7dd9c5284422f729, 0x066ab22a284c8283 },
+  { 0x7ded20e88b17c814, 0x9b4de0d55c795d37 },
+  { 0x7dfd100bda9abb0f, 0x3744361bc7112681 },
+  { 0x7e2fe40a788e5676, 0x5fe56a3576019968 },
+  { 0x7e464186ba384069, 0x582d9f0c141f7491 },
+  { 0x7e4783a59972ae2c, 0xd8384f231757ea0b },
+  { 0x7e51a58de2c0db7d, 0x33715f518893b0db },
+  { 0x7e52a95074a66640, 0xfcfde124fffd491a },
+  { 0x7e7c4c59d55494e6, 0x6eef5e04ec1c6157 },
+  { 0x7e8aa18bc9502eb5, 0x7daaf5e7c1e94da7 },
+  { 0x7e9da5cb84d5bc86, 0x9854938fe3e85ffa },
+  { 0x7e9f088e15b2af9f, 0xf3411991393e6b1f },
+  { 0x7eab0284a0cd1043, 0x461d446a08d08cec },
+  { 0x7ead257e8b5a44ca, 0xc538f5f54c7a0023 },
+  { 0x7eaf009a892f03d9, 0x0682dc1e67e85f07 },
+  { 0x7eafc9827e8d5b13, 0x36905939e097aae7 },
+  { 0x7eba20c2291a9822, 0x14cc7cbe8d0b47cd },
+  { 0x7ed61a18cebdeca0, 0xa93be1f5461731e5 },
+  { 0x7ed7130a6e402016, 0x1836414332b11983 },
+  { 0x7edc8fcb319b3fb6, 0x1cac87614afd4ffa },
+  { 0x7ef3ca08abde439c, 0x6ccca84693839c57 },
+  { 0x7ef74879d7cb9fa0, 0xef161b91ad55b3bb },
+  { 0x7f0209cfcc3d1817, 0x15463f4d6451cecf },
+  { 0x7f07cd2e89dda5a3, 0xa90d3ab064bfd1f6 },
+  { 0x7f430c33044e0354, 0x815392b53a9a772d },
+  { 0x7f525b07bc98080c, 0xc8950f7284e52ede },
+  { 0x7f54fa6aa824001a, 0xf415503c313262f2 },
+  { 0x7f5da5dc44bb5e0b, 0x959507bb0ea31cd6 },
+  { 0x7f6533386644c7d6, 0x358f871666c86e79 },
+  { 0x7f790939f7eaa8c4, 0x7a246c4283981f84 },
+  { 0x7f819454734ddf93, 0xf83fefcffcd3e212 },
+  { 0x7f9fbe3e00a21ea0, 0x6e6ae5e0e5db2143 },
+  { 0x7fcd1766de75c614, 0xa3ccc31b25dd5b7a },
+  { 0x7fcd5fb59e88fc7b, 0x8473c641f44226c3 },
+  { 0x7ff53f6922708119, 0xe7bf478d7d618c86 },
+  { 0x7ffc2d80fd49a124, 0x808315306d19868e },
+  { 0x801ba40f3290fc41, 0x3e8c816c467c765c },
+  { 0x803393ed29a9e934, 0x6569dd1bf209907b },
+  { 0x804ed85eadf1ce3e, 0x93721547cbea7592 },
+  { 0x8055b9c2622136fd, 0x91edfea6df642daf },
+  { 0x805f9a32ef97ac25, 0xf999a25014dc5c23 },
+  { 0x8068e07b484dfd66, 0x1158b3771d6621ca },
+  { 0x807841df228ee8aa, 0xb0a06ee639ce5a8a },
+  { 0x807a8ff6216b00d5, 0x2aba2dfea5d8d860 },
+  { 0x808c3b1e60ee0e7c, 0x65205fa4bd772221 },
+  { 0x80cd42881e670e4b, 0x74a9ccd10d0d7b2e },
+  { 0x80cec82239913cb8, 0xc4016eb13749de44 },
+  { 0x80dcbe1b55f12be7, 0x31a224a53ee4ad5f },
+  { 0x80e1410ec98089e0, 0x733cc09e584dba4b },
+  { 0x80e52315919bd8a8, 0xb82a407ccd9bb13f },
+  { 0x80e5400470ac7881, 0x43e6db9bc8dd88cf },
+  { 0x80f7bf7418a462e8, 0x687ecefeaf6eb9c2 },
+  { 0x8101efafcf0af32f, 0xedda4579c941e6f4 },
+  { 0x81073d0377a2bade, 0xf8d5e74fc44fc323 },
+  { 0x8108162bc88b5a14, 0xadc3e031cf4175ad },
+  { 0x8108ad2679bd055a, 0xfec0a35a1dca46a4 },
+  { 0x810d8952af5a6036, 0xfca8d0c4e1b23db6 },
+  { 0x81254ebce88fa46c, 0x4ff5a2f4d2bad538 },
+  { 0x81341f00b61ab37d, 0x19d1529f483d496d },
+  { 0x813985a940aa739c, 0xc28df19e0edd4722 },
+  { 0x81414174f1816d5c, 0x1e583af427ac89fc },
+  { 0x814210c0e121f7db, 0xc25661b93c06311c },
+  { 0x81591a2214190240, 0x60b890665beb0fb8 },
+  { 0x8190b403d67bf979, 0x2fe22fa5d22f3556 },
+  { 0x819aeeb9a2e11deb, 0x54e6de334f843894 },
+  { 0x81a010abdba1a640, 0xf7adf7f84e13d307 },
+  { 0x81b3bf17cf01039d, 0x311b4cd738ae608e },
+  { 0x81e44e968a4b3cd8, 0x5b4a0f9a60d25dcd },
+  { 0x81f4f0285f651399, 0xa12ff2e2f35bab77 },
+  { 0x822a950f27ff0122, 0x870558a89a49cad3 },
+  { 0x82337e5fe0f418ca, 0x9484ca851dfc226a },
+  { 0x826481f6fc53ea47, 0xc9f272f7050eedf7 },
+  { 0x827a22b9dffee24e, 0x93ed0df09ff8414a },
+  { 0x8290daea8391f96d, 0x7c8e1482e184d19c },
+  { 0x82bf0dff20cee6a1, 0xed4bb834b00074e6 },
+  { 0x82c25d1c35e6ac6f, 0x893d1d7c2fc2f9c8 },
+  { 0x82c9b068826f7f57, 0xc6dc710606b3e8b5 },
+  { 0x82cf4ed270125ea3, 0xb0f85c4b8b2bf08b },
+  { 0x82d5ada7c61833d1, 0x7ca0604eb1e3709f },
+  { 0x82de957d155fc041, 0xfc6afb8315a28550 },
+  { 0x82e7aab602c378cf, 0xfdd8186a099e807e },
+  { 0x82ee056af81203af, 0x58092ff2e6cf079d },
+  { 0x82efe7984783e23a, 0x7c55266a5125c68e },
+  { 0x834a2273e97aec31, 0x81ee127917b4b269 },
+  { 0x83531415b25531b4, 0x7d23cf205961e51f },
+  { 0x835759ff95c2cdc2, 0x324d7c1e7c5fa237 },
+  { 0x8372eec01a08c60d, 0xbed063c5524cdfb1 },
+  { 0x8388d6fe59c38c0b, 0x3a6ab2c58420036a },
+  { 0x838e691e97d753d2, 0x8320a932cf3fd6b3 },
+  { 0x83b8c01c72306d60, 0xdd9b753332ebd276 },
+  { 0x83bdc819980db99b, 0xf89a7f2ed6a2de59 },
+  { 0x83d15fb9843d9f84, 0xaa3710538403f434 },
+  { 0x83e1b9f22f292596, 0x79e1018bc04cc018 },
+  { 0x83f05ececae8be59, 0xba1e51135f4bdcbf },
+  { 0x83f50fa0fbae545e, 0x4b88bb53b788c341 },
+  { 0x83fafd7bd12e3335, 0x166c6314b3bde528 },
+  { 0x840a5a2eaea24d95, 0xd289f514fd12f9bb },
+  { 0x841057f83ce3731e, 0x6bbfda1707cbca58 },
+  { 0x841b7bc1cad05f54, 0x08302308777d49dc },
+  { 0x84290e333ff7567c, 0x2380f179430083b8 },
+  { 0x843435eb360ed720, 0x85f7ab9374f9749a },
+  { 0x84535afb9a69712e, 0xc0af4947329e08b8 },
+  { 0x8454ed9787c9d821, 0x1748ccddb673e920 },
+  { 0x8490e1014c2baa0d, 0x3a3a08854e5d68b3 },
+  { 0x84db818cd4111542, 0xa15c2a795369a256 },
+  { 0x850ffd5849c91194, 0x6b24544ea1e60496 },
+  { 0x851cc1f3c64eaedd, 0x10361ea26345acea },
+  { 0x85227160f37aaa29, 0xf5e3a6c7a3219f54 },
+  { 0x8530caaaf40acbdc, 0xd118c282b5f8a37a },
+  { 0x8538c5e3ee832677, 0x74480649f83fa8d6 },
+  { 0x853c11c4d07050c2, 0x2ef3e0721533e0c5 },
+  { 0x85470dcb7989e5e8, 0x56f36b962d815537 },
+  { 0x85478bb289dfa5c6, 0x3726b9153992a920 },
+  { 0x854b68b93e7123a3, 0xbe42b5a2a41f75d7 },
+  { 0x85502d69fe46b7f5, 0x4ef2598225678b47 },
+  { 0x85564dd0665aa0a1, 0x359037aef1a48d58 },
+  { 0x8556b42aa05f94bc, 0x29ff39c39b11bff4 },
+  { 0x855a42078b14714b, 0xcfd490d2cf57e68d },
+  { 0x8597f66dd37d9c85, 0x5663804669d69d7a },
+  { 0x85a4133f6dcf4180, 0xe36e70ad0fca0921 },
+  { 0x85b1bca93e69f139, 0x05107cc802a02470 },
+  { 0x85b6071974aca39e, 0x980d48064ae5e847 },
+  { 0x85bbefb90e16bf38, 0x6b304c1e9a1f6084 },
+  { 0x85e48d68c8d802e3, 0xba9d494a47d6e016 },
+  { 0x85e564dae5687e43, 0x1955056fbda10978 },
+  { 0x86128001e69ab049, 0x937f265911ce7e8a },
+  { 0x8619da7f6796cedf, 0xf59e5aa20712fb4e },
+  { 0x862cf669cbced78f, 0x9ed31a5d375b2ebe },
+  { 0x8644352b806985ef, 0xde499ae6fc7b0fec },
+  { 0x8654d7f0fb351960, 0x016e06646f639b02 },
+  { 0x866e5150c995c4ae, 0x5172e5207ba948c7 },
+  { 0x869abe0426e6e9fc, 0xb6d75a3c2d6e05d1 },
+  { 0x86b4aa76bbeb70e1, 0xa4f9211a9880ba8e },
+  { 0x8712cceec5644aac, 0xc2c21203d9ebe2ec },
+  { 0x8726c17ee7b559cb, 0x7bf2330d20972ad0 },
+  { 0x873fb75a7788ba0f, 0x4ae715229a05545e },
+  { 0x8747ba79cd39fa83, 0xa529bb26010db21b },
+  { 0x8749a0d088df2521, 0x8c149dc325abc7ca },
+  { 0x874c76726f68c166, 0xfcfac48ce78eef95 },
+  { 0x8764462d7d19a33b, 0x0717af22b99fc88f },
+  { 0x87662815bc4f3c3c, 0x86071dc994e3f30e },
+  { 0x876a953daae0e946, 0x620cf05ed41989f4 },
+  { 0x877a5397f3f205bf, 0x6750398c98f33de1 },
+  { 0x8786c1e56ef221d9, 0x46c64f6b65b697e9 },
+  { 0x8786f229b974c393, 0x222874f73a9f3206 },
+  { 0x8786f4609a66fbea, 0x2cd9aa48ca7aa11c },
+  { 0x87b460df21b7bbcf, 0xc57b1c082c6794b0 },
+  { 0x87b6a17132fc32f5, 0x76bc49ea18729506 },
+  { 0x87bea777a34278d2, 0x9b3b6029833c5422 },
+  { 0x87e79cd41ce136fd, 0x4f72cc6e2c161bee },
+  { 0x87f020daa98d0132, 0xe98e43db7d8fea7e },
+  { 0x883258dcd68cefc6, 0xcd4d40b1185116dc },
+  { 0x8874b68751fd2ba6, 0xd3306a263ae57a7d },
+  { 0x8885d0ce11c5b40c, 0x3a8a8d9ed28cefef },
+  { 0x888debb162d7d1ae, 0x71025b4ab794257f },
+  { 0x88a6c9c88cb329ee, 0x5fa7d168bd6c7c63 },
+  { 0x88d300a38bdd7cab, 0x9edad271c18cd02b },
+  { 0x88d7b6b3967de0db, 0x24cdae1c7f7181bd },
+  { 0x88d8a1accab58cf1, 0xabb043613cf185e9 },
+  { 0x88dce4037471424b, 0xb38ab6841aaa8cab },
+  { 0x88ed87c011f699dd, 0x27321dbe404db6c8 },
+  { 0x88f74ec75ef696e7, 0x294b7b6ac5ca465f },
+  { 0x8905d54f48b8024f, 0xc718ed643e9033f7 },
+  { 0x890c13590e0d8d5d, 0x6149737d930e4d95 },
+  { 0x8917f7c1ac5eb05b, 0x82331cf01c495af2 },
+  { 0x8933976f2029c0d8, 0x492ebd8f4eb21492 },
+  { 0x8953bc11352d7944, 0x31d3303e31d3b892 },
+  { 0x896ec58f26e930e0, 0x2f5e4f046602c3a1 },
+  { 0x898143773824663e, 0xfe88d0a3a0bb1ba4 },
+  { 0x898748d5eaac3164, 0xb0391a64ae1e0e32 },
+  { 0x898b5467551d32af, 0x48a604802407b6e8 },
+  { 0x89a65b83203980d5, 0xd4d60f52a584a5b8 },
+  { 0x89a68746eff7f266, 0xbbf08de2483abe55 },
+  { 0x89afff4a10807093, 0xc105740c73e9b544 },
+  { 0x89eaba47a59cbfd2, 0x6e74aad32f553cd7 },
+  { 0x8a159ee58b2f0a54, 0x805162984b0f07e5 },
+  { 0x8a183b6357987db5, 0x170c5cf9f4a113e5 },
+  { 0x8a42e2c7266439d8, 0x997a55d0124c912c },
+  { 0x8a49cf1785e3dea2, 0x012d331a3ad476e1 },
+  { 0x8a6c84f481acf42a, 0xbcb78ba5064ad755 },
+  { 0x8a8e401369e2b63a, 0x13e18a4d685387c6 },
+  { 0x8a9d874a38608964, 0xf33ec0c35cab618d },
+  { 0x8a9d953ac3db52a3, 0x13a90d6a9b139c76 },
+  { 0x8aad33da907bed78, 0xb76b87fceaa838c1 },
+  { 0x8ac18076d01a6b63, 0xacf6e2cab4968940 },
+  { 0x8ad3b8e7436816db, 0x03e7824406bdc670 },
+  { 0x8af58a9b90b25907, 0xda0251ec0facf3b8 },
+  { 0x8b04e9d132b8e30d, 0x447acaa6bd049c32 },
+  { 0x8b40a9ca1cfcd148, 0x22e2547eaa9df5c1 },
+  { 0x8b504b417c862616, 0x7a7e02f44229f0e7 },
+  { 0x8b556c3d9ca8e5e6, 0xe665bd759b93ffae },
+  { 0x8b5b1e3a434ebbdc, 0x2c2a49dc68f46360 },
+  { 0x8b7ca29a55432f88, 0x6cee3d452fb00481 },
+  { 0x8b8152d6081f3136, 0x5406cb716bd95567 },
+  { 0x8b8789c6669a4cee, 0x86c579a65332f852 },
+  { 0x8bb5030d01519443, 0x5c3f01f220f23977 },
+  { 0x8bbfd951c89cc09c, 0x148bfabdefa08bec },
+  { 0x8bc0d2052b4f259e, 0x7a50a7c771b45241 },
+  { 0x8bd8f65377023bdb, 0x7c5fcf46ddda5d31 },
+  { 0x8bebac6145711359, 0x33116045204f0f00 },
+  { 0x8c103a79b007a2fd, 0x5af602334937b4e1 },
+  { 0x8c136e97c0a4af66, 0xda4a249561ed17db },
+  { 0x8c146c61817edd37, 0x6bc1354c7f1ddc63 },
+  { 0x8c1cc284edba6911, 0x39d6626d062c606f },
+  { 0x8c2fa33048f055f3, 0x8358d51eefe417db },
+  { 0x8c36ed2352801031, 0x516695d1eeefe617 },
+  { 0x8c7e5e2329f4f4e0, 0x6cbcc994a30fd352 },
+  { 0x8c8a26ed57870dab, 0xa8e13162d497bad1 },
+  { 0x8c8b15b3259e6075, 0x7987ed13cdd74d41 },
+  { 0x8c941fa32c7718a1, 0x0061d8c328909577 },
+  { 0x8ccaa442d26b0913, 0x9685f5b22bf189c4 },
+  { 0x8ccf63141a029603, 0x572d1056e772990e },
+  { 0x8cd26dcf249456fe, 0x4aeb8db42d49df74 },
+  { 0x8ce9126066f2ddd5, 0x173e9f1f9ce1494e },
+  { 0x8cf0d333bbe85b95, 0x49b1e6b1e2390b8d },
+  { 0x8d00a38f4c8f8800, 0xf1c237215ac243fc },
+  { 0x8d1e2a6d2885966e, 0x6d86717180938f87 },
+  { 0x8d2a818e0255c660, 0x40802defe32c341a },
+  { 0x8d8b7d7b983f75de, 0xbbdaac651e814768 },
+  { 0x8d9a06101ebb0f14, 0x7936356e645309b8 },
+  { 0x8da51e0c4b6b46f7, 0x619425119c7d018e },
+  { 0x8db152458abaef3c, 0xfa7a4e420ddbda59 },
+  { 0x8dda212b5d92a3b2, 0x1812890b472f0e7a },
+  { 0x8df4be9ddc54ac36, 0x3b13dc57ceaf161a },
+  { 0x8e0ab801b1705a74, 0x0b476b7f588c6d16 },
+  { 0x8e42674972d68050, 0x68fc653e014370fd },
+  { 0x8e48ea6ea53709b9, 0x8e6f4bd8aa018908 },
+  { 0x8e4cd60d93fcde80, 0x65c1a2b972a26377 },
+  { 0x8e4fa8c6ad8d8dce, 0x0db8c991c166cdaa },
+  { 0x8e512ad450680045, 0x8f99dec084fc2c64 },
+  { 0x8e7241bfc8380aac, 0x3c0ef1b6881cdded },
+  { 0x8e737a88a566cc94, 0xbd50174c2d019593 },
+  { 0x8e822b39a71c84ac, 0x875f0107fb61d6f0 },
+  { 0x8e879aa58db41edb, 0x67cbf318b77766c4 },
+  { 0x8e887d1ba5f3a71a, 0xe8a0ea16a4af9fc9 },
+  { 0x8ea7e1c23b7c0367, 0xd0d5de27dbb6da39 },
+  { 0x8ed5a746c59571fe, 0xb255eaa7d6d0cf98 },
+  { 0x8ed73106e2f42f91, 0x447fb90b6f0ea4a4 },
+  { 0x8ee3f64dc0f349ad, 0xc893fe93df5245d8 },
+  { 0x8ef96ace4a1d6dfb, 0x65926c1e868b0188 },
+  { 0x8f08c777b424c308, 0x5eece73774335962 },
+  { 0x8f33bce5ba1053dc, 0xf4cea9c1c69981e4 },
+  { 0x8f53a3b925f0fd96, 0x1d9b8c4d46ee6755 },
+  { 0x8f5ac5139419c5d4, 0x9bacc296e342a247 },
+  { 0x8f60551db6d1535e, 0xf0030f155018c738 },
+  { 0x8f613ea7c32a587d, 0x6741790e32872ddd },
+  { 0x8f88309afad10893, 0x6ca70f8b2b084718 },
+  { 0x8f90590dba143d78, 0x3df5a6cff2000e4d },
+  { 0x8f98519a91dbbf48, 0x64f135a10050d9ed },
+  { 0x8fa47e5242776e84, 0x1df7e708b12eb998 },
+  { 0x8fbabaa87941cdf3, 0xa377c15e95bdb0f3 },
+  { 0x8fe00172e7fff4c1, 0x878dabcf11bb8dce },
+  { 0x8febdd9142960d08, 0x4ab6eeb1d3e88969 },
+  { 0x8fffc8f15bb2e6d2, 0x4e211884a5479aa5 },
+  { 0x9007c3cbb55ce05a, 0xd7d1c34d4906750a },
+  { 0x9048ccb7e0802cd8, 0xfa5bfc2609f292d8 },
+  { 0x9057694dce844952, 0x1e6164d263702185 },
+  { 0x90578a63441de452, 0x0be5324e8f015352 },
+  { 0x9072c142728a3a3d, 0x994956d03bfacba2 },
+  { 0x90a3c3255f2a5422, 0x5cdcb50831f8793a },
+  { 0x90b1799dddb8bf74, 0x8ee286d22e609480 },
+  { 0x90b647bfb6b18af3, 0x5fcf613573ad2eec },
+  { 0x90ccf4f30a5ad8c8, 0x01090b388ddd5613 },
+  { 0x90d77e966793754a, 0xb4312c47b42900b1 },
+  { 0x90f502cbf4438a95, 0xf69f848cef36eb64 },
+  { 0x910dd9bf98cc5bc0, 0x80943e5128b15bf5 },
+  { 0x911d385ee0805ff5, 0xb8f96c5a63da7de5 },
+  { 0x913d5d959b5021f8, 0x79033c89797bab5e },
+  { 0x914a8feaf6d0a1bb, 0xed9eb61d33817679 },
+  { 0x91925abce3a29e33, 0xb6a8b81482f4f5af },
+  { 0x9193b6fff6897d43, 0x274741d4f9855b6d },
+  { 0x91a3749ff7b7e72b, 0x7fa09e05396a0e7b },
+  { 0x91b007f33f9b790b, 0xe64f57220ec52e80 },
+  { 0x91c2098e88a6b13f, 0x977af8c003e0bca5 },
+  { 0x91d1c82ceaf8af2a, 0xdd3973a3c34bc0cb },
+  { 0x91f0a708eeb93c13, 0x3e9672ad2c8e0429 },
+  { 0x91fdb6541f70c40b, 0x16aabf8308123be8 },
+  { 0x9222b25a0875022b, 0x412e8da37e7f6887 },
+  { 0x9245a84e9851565d, 0x565cb6c9fac5802b },
+  { 0x927a409c01600c64, 0xc7fe3565b409dba6 },
+  { 0x927d422d6335018d, 0xa469a9a07cd80390 },
+  { 0x9281eccd7f6ef4b3, 0xebdcfd2204c9763a },
+  { 0x9295570a141cdec1, 0x8074c55dc7229d08 },
+  { 0x929e8a84ed50601d, 0x9af8c49b0425c7ea },
+  { 0x92a1a605b7ad56d8, 0x63a56373a866761b },
+  { 0x92d1b6cb8a1b6152, 0x66c4088a58464779 },
+  { 0x92d1f6ac179ebe59, 0x63868d6bc1bdda8d },
+  { 0x92e72f7cc569584c, 0x44c9530d645ae04e },
+  { 0x93096a1038cd558e, 0xd0b48741bbf17c64 },
+  { 0x931b91a8ea2d39fe, 0x4dca1a23832b591a },
+  { 0x9333172e3c4992ec, 0xf548d3ac1f2553eb },
+  { 0x93420cc4cb1af1f2, 0x175c63e52ec18332 },
+  { 0x9364ad51c321e0f1, 0x5c96a8c0aff47ceb },
+  { 0x936ef1d6f8a57b9f, 0xf575dc195ee36b80 },
+  { 0x936f555b4b1a2cd0, 0x61b659ff63f4f5f2 },
+  { 0x937736d899337036, 0xde818391a87271e0 },
+  { 0x939ce554f5c0e74c, 0xc6e4e62810ec2111 },
+  { 0x93acd5020ae8eb56, 0x73601e2edecbc158 },
+  { 0x93b9229fc0ea4fb9, 0x59d604f83f8f603c },
+  { 0x93c4b910f7649b3e, 0x998bb6d8527c6f4a },
+  { 0x93c52141d3c4e1b5, 0x574d072f1afde6cd },
+  { 0x93c8d9d24f9c5f1f, 0x570694848d087df7 },
+  { 0x93c9f9239a4e5c95, 0x6663dd7affa70da2 },
+  { 0x93db185c3b3dc382, 0xf3aecd6a2fea7fd9 },
+  { 0x93dc15d15e77a7b2, 0x3162467f95a5f22d },
+  { 0x93e276172b521c44, 0x91097f8b1393eea7 },
+  { 0x93eb1795c8b1065b, 0x1b3d62bb9ec0ccdc },
+  { 0x94102febc53b4a78, 0x342d11b645342ed4 },
+  { 0x9433770890f087bf, 0xcf3e50122694d8c0 },
+  { 0x9436b7ad131b5a1f, 0x7753ce4309ba3dee },
+  { 0x943798452ceba935, 0x7e2c56303cadb4f7 },
+  { 0x9446940866c9417f, 0x210f8552cf6c3078 },
+  { 0x94507dee401b0a07, 0x2a481c00d7699ffe },
+  { 0x9469d18238345d87, 0x768e8965f9f4a6b2 },
+  { 0x947317a89af38a49, 0xc4864d6bdd6a91fb },
+  { 0x94b92a882f6dbaa6, 0x993a46e2dcc58402 },
+  { 0x94d90f63678e086f, 0x6b6d5e1bc6c4c8c2 },
+  { 0x94e3fbc19107a169, 0x909e274187247a9d },
+  { 0x94e4c9b924286038, 0x527f49cdc20fda69 },
+  { 0x94e7cc6342d11e50, 0x8e7e8b2ddf53c255 },
+  { 0x94ff6b7489ed401d, 0xcaaf952fece10f67 },
+  { 0x951e8cec7a1a1d6c, 0x01fd649e7ff7743a },
+  { 0x9526e3db3bdfbc27, 0x989a9cbfd0ee34bf },
+  { 0x952a63b8305154a7, 0x969743c7b8671243 },
+  { 0x95351b46fa9c4547, 0x1d852d28b9b4e00b },
+  { 0x955c408265ad6994, 0xf61f9b66657bbae9 },
+  { 0x956496f81775de0b, 0x69a116a0d1ad41cc },
+  { 0x956b99511c0f47b3, 0xa11d18e8b7ac8d47 },
+  { 0x95956108289a917f, 0x80667eccd3ce98a9 },
+  { 0x95a69cf8c08ef152, 0x2b050529464f0bca },
+  { 0x95a89d1bf767d7cc, 0x9d0d5093d579ba61 },
+  { 0x95e1d834c57cdd52, 0x5dd0bd6048a57f7b },
+  { 0x95e542a7467c94b1, 0xe4ab24a3ebe907f1 },
+  { 0x95fd6097dc27c206, 0x66f039cfe34f7c69 },
+  { 0x961112b74a920a52, 0x42e233480326c356 },
+  { 0x9628554ab40db736, 0x17a621a2266a1a7f },
+  { 0x962ffd3eaf865230, 0xa7a312b80e6c5cfd },
+  { 0x96662271ae50b685, 0x9017bffbdda75525 },
+  { 0x96670d0bf3610da2, 0xafcabd8e21d8eabf },
+  { 0x966b11d3c147d894, 0xdd9e4ebb971ea309 },
+  { 0x966c955e4aaca708, 0x2d9ffb9a68e3f3ed },
+  { 0x9671b658286e276c, 0xc4a3d02aa25931d2 },
+  { 0x968efc79d500dce5, 0x2a906870a97358ab },
+  { 0x969b968383d9f0e9, 0xd8ffd1056bcaef49 },
+  { 0x96bcb3d97ce4ff75, 0x86326d183ac338a2 },
+  { 0x96e798995af6ed9d, 0x8601166d4350f276 },
+  { 0x96eccc2277043508, 0xa6c481ea432d7dd9 },
+  { 0x96f806fc62005205, 0xd851e758d050dfca },
+  { 0x9713537765b4c653, 0x2f6ee40025d8f182 },
+  { 0x97184b2637227487, 0x57cfdc41107ca5c0 },
+  { 0x9718b85ac5a55cbc, 0x7348963c63ffa35a },
+  { 0x9724861109336230, 0x39a3581db308fda6 },
+  { 0x97327d6962f8c64e, 0x6f926f79cd01c6b9 },
+  { 0x977294ae6526c31c, 0x7f9a166ee00964ad },
+  { 0x9784290f422e7aee, 0xab4d542318bd9a1f },
+  { 0x97842fe847e8eb71, 0x263d6f92f7e122bd },
+  { 0x97933c9f20873446, 0xe4c1f8a4da21575f },
+  { 0x97a9bb5c3679d67f, 0x5c2cd17f30b85d95 },
+  { 0x97cd63c483fe3c68, 0xb7ce939ab8f7a318 },
+  { 0x97d0151beb84acbe, 0x82aa6db18cd91b98 },
+  { 0x97d079315c09796f, 0xf6d95a06e4b70171 },
+  { 0x97e47512f89e7981, 0x8d988d078dc90410 },
+  { 0x97f4da9f1031486f, 0x4e588f1e53572e53 },
+  { 0x9813b9e4b8a6fd91, 0x9c86a40c6bda8c93 },
+  { 0x9831efc7f4cb8ffb, 0x4df0082bab2f07a3 },
+  { 0x9848b5ef7a0c02fe, 0x808b920a2ac566d2 },
+  { 0x9853089672116117, 0x258097dbbdb939b7 },
+  { 0x98555b95cb38e0e0, 0xb22b482b2b60a5b6 },
+  { 0x989a48c6ed5893c3, 0x66c9592f7568c1e8 },
+  { 0x98ba601a60172cb4, 0x6c5bf9a962fd5b1f },
+  { 0x98ccd15345b1aee6, 0xcaf51e05955f0261 },
+  { 0x98e5e4d5c4dd9a98, 0x6d30fd62bd2f75ae },
+  { 0x98e6e34af45a0664, 0x597972c3bb31180f },
+  { 0x98e7caaab8ec2375, 0x58378d2776c66616 },
+  { 0x98ea10c47c13f1b3, 0x306c7b13db304865 },
+  { 0x98ec0fa4199b9c01, 0xf7b8fa3732e43372 },
+  { 0x98ef1593624b409b, 0x9fb83a1c272a0aa7 },
+  { 0x98f63949e656ff30, 0x9cefa672146dc1b8 },
+  { 0x98fa3ad778a668a7, 0x9449350de4b3b95b },
+  { 0x9905f9f4706223da, 0xdee84f6867ede8e3 },
+  { 0x9912d06eea42200a, 0x198dd3e2be18c601 },
+  { 0x991d57bbcd529ad6, 0x2925098e0aec1241 },
+  { 0x9945a22f60bbaf6d, 0x04a8d73b3cf3db75 },
+  { 0x9947f1ebabb56fd0, 0x75a96c6d37351efa },
+  { 0x9962034ea7b3d4a9, 0x05d0991804670087 },
+  { 0x9989f974c3cf9c64, 0x1db6c8a70a2a2267 },
+  { 0x99a24d7bb31d49b7, 0x20b422550b32c35f },
+  { 0x99ac89241365b692, 0x255ba95d745edd91 },
+  { 0x99f7c6c26046bbe9, 0x5f1c604b25da8360 },
+  { 0x9a01115206f32eb0, 0xb539c7e5a47ccafa },
+  { 0x9a165c39af3f050f, 0xdee6583fdfcdc9be },
+  { 0x9a21fba9ee9794e0, 0xfadd7c7eb6be4e12 },
+  { 0x9a25b3cfe2bbb847, 0xb66a97282200cca2 },
+  { 0x9a36d828f413fdd3, 0x70faee2295cdb07b },
+  { 0x9a4274409216ff09, 0xecde799f2a56ac73 },
+  { 0x9ab72d3fd2cc1a0c, 0x9adb504502579037 },
+  { 0x9ad362179c2eea4e, 0xa115c7640b4b003e },
+  { 0x9ad36e699ef6f45d, 0x9eb6c4cf90475c9f },
+  { 0x9aeb5206c5bf9748, 0x92a9cc59f1478db3 },
+  { 0x9af615951e9719df, 0x2244bc77fc50cb95 },
+  { 0x9afdfe1cff7f37f1, 0xc971fe3f0c900606 },
+  { 0x9b150a42fc788960, 0xfbb4cbe250259ee2 },
+  { 0x9b21d8fc78cc4308, 0x990d99a4d906ec52 },
+  { 0x9b246683f44c963a, 0x50e41d6b485bee77 },
+  { 0x9bb136b62521c67a, 0xc893213e01dd338f },
+  { 0x9bd4e0d5f28ba6da, 0x417c26649171f8e4 },
+  { 0x9be58a14e055b0e7, 0x581fc4d6c2f6b31d },
+  { 0x9c27ef3bd01c611c, 0xdb80182a59463a82 },
+  { 0x9c40bf810f761ffc, 0x9c1b69c4647a8b84 },
+  { 0x9c6d65bd3b477aac, 0xe0376f705b354d68 },
+  { 0x9c6faa4ff7f2ae54, 0x9bbcb14f582b70e4 },
+  { 0x9c6fd6ed3599978a, 0xb7b6f900484b9be6 },
+  { 0x9c729017dd2f9ccb, 0xadcb511187f80e6b },
+  { 0x9c7fa3cfcaaafb4e, 0x6daf1e2517d43d88 },
+  { 0x9ca2deb61318eba4, 0xfb784d4bf7441d8b },
+  { 0x9cbb07f1993a027b, 0xc2f87d5205457ec9 },
+  { 0x9d0befa555f00306, 0x9a21d2f6847ad962 },
+  { 0x9d1556ae5890398b, 0xe7e3d57449774b40 },
+  { 0x9d2938eb2b17bb73, 0xe9a79bbc06053506 },
+  { 0x9d2f05d0fe8b2dfc, 0xf770b02eda066fc1 },
+  { 0x9d33d31fb1de58c5, 0x460d8a67b57b36da },
+  { 0x9d37a1be4a6e8980, 0x26414b8fee2fc826 },
+  { 0x9d4bc7c6fe9a7c8c, 0x4aa24a237c340adb },
+  { 0x9d522a3759aa8556, 0x68e75962c84546f7 },
+  { 0x9d7f04618bb4043f, 0x531d087e3aaa7ac8 },
+  { 0x9de0d45731f90a0a, 0x922ab09228510393 },
+  { 0x9dec0be14d899e1a, 0xac4337acef5ab94a },
+  { 0x9e01f7f95cb85967, 0x65e03b9a36e8e33c },
+  { 0x9e135f5dce61e343, 0x5314f5cddb33752f },
+  { 0x9e192601829f5f5c, 0x2d3b51f8ae25dbe5 },
+  { 0x9e2c7299c69b6024, 0x43d327c7dad51cbf },
+  { 0x9e437229136f1c5e, 0x6ef4c5f36178ed18 },
+  { 0x9e5007131695621d, 0x06902ab3c960622a },
+  { 0x9e6fde3b65726c11, 0x6c3e5110c3d1dedf },
+  { 0x9e792a59f8795664, 0xcbaaff1ba152d731 },
+  { 0x9e904e2eaa471c05, 0x0c491289b8b80f60 },
+  { 0x9ea8ed9dec030829, 0x73244a080941e58a },
+  { 0x9ec1b259a1bcffa6, 0x3042a3c2b3b90f0a },
+  { 0x9eca521db1959156, 0xa115dee85a405194 },
+  { 0x9ed0f2aa226c34d4, 0xf55f661442e8f22a },
+  { 0x9eeb40f04a27efb1, 0xc68ba1d25e606607 },
+  { 0x9efa877a98dd5a07, 0x5e058214da428abb },
+  { 0x9efb4e1a15a6cdd2, 0x86e4bcd7cd94b7b8 },
+  { 0x9f2d58dce1b81c6b, 0xa201ed103507c025 },
+  { 0x9f48eeb47836cf14, 0x5a15771775f0767a },
+  { 0x9f5096a6f1a5049d, 0xf87798eb59707583 },
+  { 0x9f52271759f8a200, 0x4d207b2247ae0bb3 },
+  { 0x9f59eddf9ba91a7d, 0x93bce7ee4b7693bc },
+  { 0x9f8fad4badcd7be6, 0x1bbd2bcaeef3c58f },
+  { 0x9f901509f0474bf9, 0x760e6ebd80e629cd },
+  { 0x9f93734c68f6479e, 0xb022cab40814142e },
+  { 0x9f982421b9b4320e, 0xde00fe4aa2e812f4 },
+  { 0x9f9ee0f60c119c83, 0x1e80694b6678ca1a },
+  { 0x9fa0c664b157a0c2, 0x7d10319dbbca812c },
+  { 0x9fa61e79ac8ccf05, 0x103fc95bf415a7de },
+  { 0x9fc2d1627dcdd892, 0x5f4c042e38eb0bc9 },
+  { 0xa0028f057d496f22, 0xb549fd8deecc6f78 },
+  { 0xa00ec89d22fcc0c1, 0xa85bb542ddcb1178 },
+  { 0xa00ee0aed5c8979a, 0xdd4c170f5322c706 },
+  { 0xa0185c06297b2818, 0xf786d11a3f9e42c3 },
+  { 0xa025a8f83a42a4d6, 0xd46c4887e799bfac },
+  { 0xa0297c4788f9e91d, 0x43e522f4c561b4ad },
+  { 0xa0563dd6d8215c38, 0xc488fbbd61435626 },
+  { 0xa0675883f9b09a35, 0x95ddd66a6f5d3498 },
+  { 0xa075ad332942740c, 0x386f4c3814925ece },
+  { 0xa0d502dc8b90b1d7, 0xdaa5f6effb10d349 },
+  { 0xa0e2d310e3e98646, 0x268200c8f0f08f46 },
+  { 0xa100eff2d7ae61ca, 0x2b8e65baf7e2aae8 },
+  { 0xa11099b6ec24e4b0, 0x0b8795744fb12005 },
+  { 0xa1403fef01641dcd, 0x3980cac9f24d63f9 },
+  { 0xa14d8a388083c602, 0x83e00592b18d4c6c },
+  { 0xa15b5831a1fab52e, 0x4c416068c85ec011 },
+  { 0xa174cece06b3abc0, 0xaec3516913cdf9cc },
+  { 0xa1770ef47146ab7b, 0x12e2c4beccd68806 },
+  { 0xa184846d89043968, 0x30951217b47d13d9 },
+  { 0xa189f280521f4e52, 0x24d345efb4e75506 },
+  { 0xa1bcbe0bfe6570da, 0x2661fc4de2f74e8a },
+  { 0xa1ca372388b6465a, 0x693e4626cc98b865 },
+  { 0xa1ead9c181d67859, 0xaa93c44e40f1709c },
+  { 0xa1f9159121142d42, 0xe63e6fb807d337aa },
+  { 0xa204cd4fb1944c86, 0xe800120706512a64 },
+  { 0xa20b7abbcdf90fbc, 0x29ac0fafa195bd12 },
+  { 0xa20d931a8fddcd6f, 0x6116ed21ff5c4832 },
+  { 0xa2170318a8ef4b50, 0xa1b1d38567c220d6 },
+  { 0xa2276822c772f720, 0x73a8a40a72a1ca52 },
+  { 0xa2424c1a0c783d75, 0x85d701b1c71b5fdc },
+  { 0xa256ebbfefdc7b5f, 0xf8cc6697a868ec3a },
+  { 0xa25bb76e9e773117, 0xe567fd4300b1bb23 },
+  { 0xa28d872fc50fa6b6, 0x4eb35981d0f4bb8d },
+  { 0xa29df35557f31dfe, 0xa2e2ae4609c6ebb7 },
+  { 0xa29fc854838e08c2, 0x47553a7d883dd65b },
+  { 0xa2a384d3a16d5be5, 0x0afd12906f146827 },
+  { 0xa2aae759e4e76f85, 0xc8afec3b86529317 },
+  { 0xa2d7cc2e5419a9e4, 0xab91fdb26339b726 },
+  { 0xa2de0fc855488712, 0x79ed2a3c1325c13e },
+  { 0xa2eb84cfeed55acd, 0x7fece7fefdc83fbb },
+  { 0xa2f296ea2d6d4b59, 0x979bac5dfbf4edf0 },
+  { 0xa2f9e3b6aaa23b6d, 0xc06099cdd5b51b31 },
+  { 0xa302b922a8dbec47, 0x743f28b7f91d4cd8 },
+  { 0xa30ece6dc4787e47, 0x4fbc4090512838dc },
+  { 0xa310494ad5ba2b5b, 0x221a30d7180a0336 },
+  { 0xa336beac1f0a8356, 0x14200ecd9c41fd70 },
+  { 0xa34560841e0878c7, 0xb14cc65f79f6967d },
+  { 0xa3486c0b8110d9d4, 0xb1db5d8a280723c6 },
+  { 0xa35d47898b2b16ec, 0x641d1dfa8a45c2b7 },
+  { 0xa3873d7c544af459, 0xf40d58dfcfb78887 },
+  { 0xa3b9d2be822eab07, 0xe7f4b10593fb5eaa },
+  { 0xa3c1c70024d7aabb, 0x41381adbfb6d3b25 },
+  { 0xa3d7c299fbcd7b63, 0x7898ee0fdcfc47fc },
+  { 0xa3f2a0fcf74bbc5f, 0xa763b0ee979b05b1 },
+  { 0xa3f8aebb38182749, 0xcb8da85cfbc63d7c },
+  { 0xa3fee8ce15525ea0, 0x0d45a06f04c215d1 },
+  { 0xa406d2f6d84e61d8, 0x42f4cb13b2b1cfa7 },
+  { 0xa412c8577b2d57b0, 0x9185ae51739ac54f },
+  { 0xa41450333f8dd0e9, 0x6e5e9f0af3770ae9 },
+  { 0xa422194290c64ef9, 0xd444da9d6a207807 },
+  { 0xa428068d3e514989, 0x07d97cec40000515 },
+  { 0xa47878a760f5fa3a, 0xa99f95c3fdc70a0b },
+  { 0xa4790224bd5afabd, 0x53cbe93e46a7f241 },
+  { 0xa47e26096de6f648, 0x7bf5dd2d1cced294 },
+  { 0xa484638990de7b12, 0xc62947c79dafa4c6 },
+  { 0xa499d720e7ee35c6, 0x2424de882a3351b6 },
+  { 0xa4aa7630e4c0ad7e, 0xbb9837d2d81de801 },
+  { 0xa4ab331e8768eafd, 0xc20ce8b0411ff77a },
+  { 0xa4b9423877a0b86c, 0xa35b52ca3c994ac5 },
+  { 0xa4b99aa5ed85cfdb, 0x7d101923147de035 },
+  { 0xa4c08c4994eb9d24, 0xfb78be1793e82e26 },
+  { 0xa4d026a5c200ef98, 0x518ebb77719fe8dc },
+  { 0xa4e885726af9d97b, 0x12bb5a36792eab63 },
+  { 0xa4ecb54f877cd945, 0x15527b11e698608c },
+  { 0xa4f1cea2c8479284, 0xe2a2292f8d51b5fa },
+  { 0xa4ff39d513b99315, 0x9911efe01ac12eba },
+  { 0xa50f921c2000760b, 0x099dcf1ed353895f },
+  { 0xa511f7ee13e4b355, 0x12f9217a677b4028 },
+  { 0xa5262fe6d01d6a12, 0x53692682a47f79dd },
+  { 0xa537879d8e82e106, 0x1d3ad800479d3b84 },
+  { 0xa539b9fd1ba57e46, 0x442b3e9351e6383b },
+  { 0xa56b642a3d3ab9bb, 0xeee63cd44eb73216 },
+  { 0xa5855d73d304d83e, 0xf07dde03e379619f },
+  { 0xa58b11148c18d85e, 0x4c2aef4ff46ade67 },
+  { 0xa591b5e8587aae0d, 0x984a0f6fe2cc7d1c },
+  { 0xa5b7f420ca6cc138, 0x4da0fed523920d8e },
+  { 0xa5c96b046d5f8b7c, 0x96daaa12f925bef8 },
+  { 0xa5e9ed3033fb2836, 0xe80aa7a420376788 },
+  { 0xa60598ad7ee9c5cc, 0xad42d5b0df1570a1 },
+  { 0xa6127f470306eed3, 0x59d85eb4a9cf3c96 },
+  { 0xa6239810564638de, 0x7e4c54e66b3014e4 },
+  { 0xa62e3e19280ff958, 0x407e05ca0a2d5ec7 },
+  { 0xa6737c81542a99ee, 0x71cb5f5ff14703d9 },
+  { 0xa69f5b1761a8a11c, 0x98e706ec7204937f },
+  { 0xa6ed8d72ed691fd3, 0xaad5b6974fa17978 },
+  { 0xa74689a08746a667, 0xa299b0507e1e6dd9 },
+  { 0xa7523db9a33e9417, 0x637be0e71fa4377c },
+  { 0xa767380906806210, 0x6db8e9d10b56a5b3 },
+  { 0xa779b9fa02c62d00, 0xd7c31ed51268f18a },
+  { 0xa7a58e9291aefa10, 0x64e933071f60d4ef },
+  { 0xa7b584937911d60c, 0x120677fe0d47f36f },
+  { 0xa7b96a8150600b3e, 0x800a4689c3ec60a2 },
+  { 0xa7bf8353f77caca4, 0x07ef85c2698fdff2 },
+  { 0xa7cf2b9afdbb3a16, 0x1bf418dbcf0321dc },
+  { 0xa7d2e9408bb7cd70, 0x139ecced407ff238 },
+  { 0xa7ed7dc5cbc90138, 0x8afa59030fb11d26 },
+  { 0xa7ef44ccb5b9000c, 0xaf02df3e6da71a92 },
+  { 0xa8101cb667e50a46, 0x165c6fb48c608b6b },
+  { 0xa81697b0c8bbc338, 0xae4d0046ede0646b },
+  { 0xa81b29177f258494, 0xb499fbac69789cef },
+  { 0xa83b070b485cf1fb, 0x4d5a48da153fdf1a },
+  { 0xa8435ec570141de5, 0xd833c4abec499e55 },
+  { 0xa8633050a686270f, 0xcf6c0cc4dcbad630 },
+  { 0xa867b76098786c40, 0x91dba2fcee5084c3 },
+  { 0xa875f0a919129b4f, 0x1b5103ddd200d2fe },
+  { 0xa8916734ff8c64ec, 0x3342f4c73fd5b57d },
+  { 0xa89a3e0547d68872, 0x79c34aba4b17a560 },
+  { 0xa8a703e073183a89, 0xc94d4d99b9661b7f },
+  { 0xa8b3ea6836b99bea, 0x77c8f603cf1ea187 },
+  { 0xa8c447efbec3a2b5, 0xd08b05a09999bd92 },
+  { 0xa8c48b4e0bf35fe9, 0x7cc84fdd2c507f78 },
+  { 0xa8d0a4a77cd71ac6, 0x01bd71df5a060e4c },
+  { 0xa8d4a9500b18b0a0, 0x67a1f272f869e094 },
+  { 0xa8e49d7e24ce2936, 0x29ca29614862821b },
+  { 0xa91d0858a52de3a2, 0xe6468437212d93e8 },
+  { 0xa936d80083e99d48, 0x752ad15c2b5f7c96 },
+  { 0xa93e8ea1f565c3c1, 0xe86b708cf0dc2fa9 },
+  { 0xa94528ae05dd0518, 0x94e945d4d2349b3b },
+  { 0xa94b8ca630f467b5, 0x74b614808d813919 },
+  { 0xa9531c7630774643, 0x07086ec9a1fd057d },
+  { 0xa957dbe7d85ea891, 0x33346ad56fbda03f },
+  { 0xa97733b0852ee309, 0x6300102cb0689175 },
+  { 0xa9784c24cddb33bd, 0x0d14442b97784f3d },
+  { 0xa98b649912b6ca19, 0xeaf5c2d2faf38562 },
+  { 0xa995b6cbdb1f0433, 0xabc74050808590e6 },
+  { 0xa9cb638cd2cb2e8e, 0x0643d7a67db4281c },
+  { 0xa9d9e19d0c89fb31, 0x780b5d63e1f8c6a4 },
+  { 0xa9e3c23599c0d771, 0x51602f8e31daf879 },
+  { 0xaa1c41f86ec44c0a, 0x44eb64c332ce08af },
+  { 0xaa2c4b32656bde9a, 0x75042a4d158583e1 },
+  { 0xaa5cfe3b20395aba, 0x1d479135943ad85c },
+  { 0xaa7bb54d2c189a31, 0xbb1fa20099e42859 },
+  { 0xaa8c75d6f9954830, 0x9949916ad6cf33bc },
+  { 0xaa8e4b2cb8a78ffe, 0x6b20580033f4dec9 },
+  { 0xaaac0d277eda0548, 0x61e613c59c2e4ff2 },
+  { 0xaab840db22075aa0, 0xf6a6b83a597f8890 },
+  { 0xaad61898633f470c, 0xe528e3d7ef3d0adb },
+  { 0xaad91be0bf78d33d, 0x29758876d999848a },
+  { 0xaaea37b65db9e492, 0x798f0105a6915e96 },
+  { 0xaafc79ffc32c4c9b, 0x2d73c8ada7602cfe },
+  { 0xab10f2974dee73da, 0xb4579f0cab35fca6 },
+  { 0xab2cfcaad3daaf67, 0x3b2b14fdbb8dac33 },
+  { 0xab2ea35dcc1098c8, 0x7455bb8210b018cf },
+  { 0xab301d3d7f2f4fe3, 0xfdd8a3540b7a74f5 },
+  { 0xab434f4c942d6472, 0xe75d5490cc4dd128 },
+  { 0xab48c4af46c8b34c, 0x3613d210e1206132 },
+  { 0xab4ac994865fb16e, 0xbb85738316309457 },
+  { 0xab56f1b2542a05be, 0xbc4fbccfc4803a38 },
+  { 0xab5bf1ef5e463ad1, 0xcbb11b6a33797228 },
+  { 0xab60ea7b707c58d3, 0x56cad858eb18db43 },
+  { 0xab8d318da4addd39, 0xc65b7f9c408df2a6 },
+  { 0xabb740bea0a68428, 0x31b4f53112fb8145 },
+  { 0xabb741c83f665d73, 0xc86d90a7d9292a9b },
+  { 0xabc64037ca5d5b04, 0xae8a7eedbca3ed74 },
+  { 0xabe40542e4ff2d1c, 0x51aa2bb033f09984 },
+  { 0xac05c0e53a5e7009, 0xddd75ed4b99949fc },
+  { 0xac0ddbcff34d0640, 0x09591607746e33b8 },
+  { 0xac26d7d37248d1d8, 0xeac5eccacdbef8db },
+  { 0xac3dd22dd945724b, 0xe705ddd2785487c2 },
+  { 0xac53b83e1b57a601, 0xeeae9d3ce1b4a458 },
+  { 0xac5f78bae0638cf3, 0xf2a0c8d07eb4df69 },
+  { 0xac7c226037897561, 0x4192ca2bc3d20e0b },
+  { 0xac9adbd6de786a24, 0x2e19d4bec527982b },
+  { 0xaca09ffea77174b1, 0x48b96b205109db4d },
+  { 0xacaa27d214039d89, 0xd7031609aafa55c3 },
+  { 0xacb6787b938079f4, 0xe74313a905ec3ceb },
+  { 0xacb7750b4d0c4bd3, 0x4969802a7deb2990 },
+  { 0xacb962473185d7a6, 0x52f90ed6591ae13b },
+  { 0xace319dc4f765486, 0x59876741a6690d57 },
+  { 0xad2e6bfb3b9b9b36, 0xba8bf493ce764c49 },
+  { 0xad42e3ca3144e215, 0x9e26be123471bffc },
+  { 0xad72d616030a1763, 0x4ff29ce8680d3c4c },
+  { 0xad7e97c19bd25d5a, 0xa3999430845c755b },
+  { 0xad8072675109d13f, 0xdd31a2e0403d5cff },
+  { 0xadb770ff70e9adf0, 0x8bbb907a7eccd240 },
+  { 0xadb79f9ac1a633cd, 0xd44954e2eac14774 },
+  { 0xadf1afac3bdd7b36, 0xd2eda5949f1a0fa3 },
+  { 0xadfbd2e8a38f96e0, 0x3751717f7422851d },
+  { 0xae047e9468bda961, 0xd8e9e9d8ff52980f },
+  { 0xae0d4f3396cb49de, 0x0fabdff03cb2756f },
+  { 0xae10527840a1ac24, 0xde43730645ed508d },
+  { 0xae18c11e4d7ed243, 0x7f0bf5d167c0e96c },
+  { 0xae2f1f69bb383553, 0x95c1c75c81acc644 },
+  { 0xae465044dfba287d, 0x344ba468820995d7 },
+  { 0xae4be3a36b285c1a, 0x1dff202157e2155d },
+  { 0xae682886058cd698, 0x1c4b8e93e7b019cf },
+  { 0xae6cb335470788b9, 0x4beb5787976e8818 },
+  { 0xae83541cf4a4c0bc, 0xe0adccd2c1bf6288 },
+  { 0xae97cf8ed21f4154, 0xb4360a3cf6c95c5e },
+  { 0xaeb104f1e7b166bc, 0x0cbaca0a968fde51 },
+  { 0xaec9b885d0e8b24e, 0x871925630884095c },
+  { 0xaed0b7bd64cc384f, 0x85fdea33e28daf3b },
+  { 0xaed82052f7589df0, 0x5a3f417bb4e45f0c },
+  { 0xaf6ab88d3d7c7417, 0xdb2b3b3c70b0da0a },
+  { 0xaf6f3e9718bccfcd, 0x8afb421f96561a34 },
+  { 0xafb3bc45c6a82739, 0xcc82582127cd96e6 },
+  { 0xafc194534c1b3466, 0x09ef05eff6d3cef6 },
+  { 0xafd2cf258d51ae49, 0x65ee21abba3627ab },
+  { 0xafe4eefc7d885c27, 0x7fc0649507fbcd84 },
+  { 0xafe776db50e3378c, 0xd6f29c7cdd79104a },
+  { 0xafe88aae81d99e09, 0x47c0cfb687b16251 },
+  { 0xaff8cba0f2d2eb23, 0x9953dd7116894a08 },
+  { 0xb00088418fc891f3, 0xfaa3d4ddde6ace94 },
+  { 0xb00a8bc9d7fe7080, 0x980a514005cbad13 },
+  { 0xb00e8217633e870b, 0xf39d948662a52aac },
+  { 0xb011d8fdc450597c, 0x0762c2c0010a9b17 },
+  { 0xb018c51949fcf78b, 0x76b3bac7d3bcb1ae },
+  { 0xb049fc8ac50be7c2, 0xf28418817979c637 },
+  { 0xb06050f686c6b857, 0xd0df1b79fea47bb4 },
+  { 0xb061e98a4c854a67, 0x2aadefa233236e51 },
+  { 0xb095009004df3413, 0x86d22b2a3fae3c81 },
+  { 0xb09b79c9628878be, 0x051e89f7f1e77378 },
+  { 0xb0a9c6f6c8014c40, 0x23e0341ba11ca35e },
+  { 0xb0ba51723b933079, 0x7985808db598fc31 },
+  { 0xb0c47e426c7f799a, 0xee2c40422df8f56a },
+  { 0xb0c9cf89a6d4e612, 0x524f4fd48b5bb562 },
+  { 0xb0e1ee07fbc73493, 0xeac5651a52f90f00 },
+  { 0xb1276417fb0f79bc, 0x52e741bb8f4d8360 },
+  { 0xb129d7541cff79eb, 0xe33852a83057c524 },
+  { 0xb12a7f63787a6bb0, 0x8e683837a8ed3f18 },
+  { 0xb1339c56a9ea6312, 0x2232fe4328373ac5 },
+  { 0xb1486e12de717013, 0x376447ac6f7f3a80 },
+  { 0xb15026b43c675860, 0x9667468434766dd8 },
+  { 0xb16cd97845892193, 0x91c839cb68c47b9c },
+  { 0xb17b9cc4103844dc, 0xda54f77f44acc93a },
+  { 0xb182d9708e007098, 0x30caab9cf8205ca0 },
+  { 0xb1a6c96e90933521, 0x06bc335e96caa154 },
+  { 0xb1b20536aef4eed9, 0xc79dc5804f077862 },
+  { 0xb1c14b5ac896400c, 0xc91c8e5dd67acb59 },
+  { 0xb1d1e083dc9e7d9a, 0x5dc1627869d2ade7 },
+  { 0xb1e2d5dc1353af6d, 0x56cd2fe7cfe75254 },
+  { 0xb1fd0b71de9f6eeb, 0x5143a97963674cb6 },
+  { 0xb227175699e372b8, 0xfe10ce243ad6dda5 },
+  { 0xb23ebf427713dd01, 0x98b7ef47dbd07ef4 },
+  { 0xb24f6a5820a4b776, 0x3a3d547e3e07441d },
+  { 0xb25841173f058380, 0xb1771aacd5e7cdf3 },
+  { 0xb26506fbf411009e, 0x5e3f7365f442960e },
+  { 0xb2737034f974535f, 0x5c0c6431ab8caf73 },
+  { 0xb2761efb8a11fc59, 0xb00a3b9d78022ad6 },
+  { 0xb290c2b139344fcf, 0xf5b312c71b9ac3b2 },
+  { 0xb29359f7de62fed6, 0xe6ad4c948f699df8 },
+  { 0xb29f3cb4b393fccc, 0x4a225ec893f83317 },
+  { 0xb2a6f31636b699ae, 0xda900f07152bab6e },
+  { 0xb2ab209976354ad4, 0xa0e1676fc1fe5a82 },
+  { 0xb2d1e63f7f228640, 0x96b7b6c154151d55 },
+  { 0xb2d3bcee001cff2b, 0xd2d8a21b2cb55109 },
+  { 0xb2d5d200f0af8485, 0x413fad957828582a },
+  { 0xb2f0d7217147160b, 0x2f481954cedf814b },
+  { 0xb2ff4327d305fb47, 0x3dfa474e0dc3701b },
+  { 0xb3017e397f74efd5, 0x3caf8fae0a38e3fe },
+  { 0xb311ab95e85bc016, 0x2308390728a7361d },
+  { 0xb31dc989f594764e, 0xacfa7931cead0050 },
+  { 0xb31e9487efc06f18, 0xdfc3d7ebadf54416 },
+  { 0xb31f178aa0d569cc, 0xcac7959f84e0a724 },
+  { 0xb3203e383b435f7e, 0x43f9492893c7469f },
+  { 0xb36040a2f9ecafa7, 0x3d835d804a572dbf },
+  { 0xb37f0fe822b92ca8, 0xf5e330bf62d56ea9 },
+  { 0xb392964e8b1c9c2b, 0xed12246f228011b2 },
+  { 0xb3e1987b96318269, 0xb5ac9f06d22cd48d },
+  { 0xb4030c38a720dd84, 0xb84178b6ce1fc749 },
+  { 0xb40dea357d41c540, 0x8546e4e4d5f27779 },
+  { 0xb41fdd4a522e1d5a, 0x2721840028684ac2 },
+  { 0xb42df8d92e3118dc, 0x594cecd575f515d7 },
+  { 0xb4362c4eb535eda5, 0x8079e2a1a6a45707 },
+  { 0xb438a6aa9d4b9b8f, 0x0b2ddb51323b21e4 },
+  { 0xb451307b8b5e29f1, 0xc5f2cf064f6c7227 },
+  { 0xb49331b237c8f11d, 0x5f36fe2054a7b92b },
+  { 0xb4a4c87840613f10, 0x2acb5b3a647d0a67 },
+  { 0xb4daedb43511521d, 0xb9036d503b3c1b69 },
+  { 0xb4e2fd27d3180f0f, 0x4eb1065afc0d7fc9 },
+  { 0xb4f05e544834d023, 0x8a0c263491775edf },
+  { 0xb4f31ea8a6cc9f1f, 0xd4d5585a87c3b487 },
+  { 0xb4f87ce75f7329c1, 0x8301a2505fe59cd3 },
+  { 0xb50ae55aac93fbed, 0x258bc5a873edd2cb },
+  { 0xb5110f55ed99d527, 0x9f18266d001a8cd5 },
+  { 0xb56264f738b2eb2c, 0x8f7cf5a2a75e5fdc },
+  { 0xb5657d4c1c732fbb, 0x6af150668464247f },
+  { 0xb59417d083b0be2d, 0x49a7d93769880a4b },
+  { 0xb59fd465abf76f64, 0xc85652ff29d5952d },
+  { 0xb5a1a189601a785b, 0xdb2f02a424080412 },
+  { 0xb5cb9cf6e668ea3f, 0x4cc2be00ea70ec3c },
+  { 0xb5cdbab514ea726a, 0x14383cff6db40e26 },
+  { 0xb5efe0271d2214e4, 0xd5dc798881486884 },
+  { 0xb6166f15720fdf19, 0x2932f1f76df5b65d },
+  { 0xb64426e787f04ff2, 0x3ee629182c168603 },
+  { 0xb65d4a38d6047735, 0x824ee99684f3515e },
+  { 0xb676a9b7094e0345, 0xa76ef027091d916b },
+  { 0xb6812eaf87127f04, 0x3e78f91f2028f9f4 },
+  { 0xb6821ac51c4c1dcb, 0x283f01be2f047dc1 },
+  { 0xb6960be26bee87d5, 0x3ba4e2e71cfe772f },
+  { 0xb6d52a0cf53ad421, 0x6feb04147301f87d },
+  { 0xb6e40bce550672e5, 0x495a8cdde7075b8b },
+  { 0xb702641d698c60bc, 0xdc922dbd8c9dd49c },
+  { 0xb719ada17771a8d2, 0x06c7976553825139 },
+  { 0xb731d35e4ac6b3b4, 0x7eba5dd0991f452f },
+  { 0xb7345220a0c587f3, 0xb0c47af33ebe533c },
+  { 0xb76fbadc8ffb1f83, 0xe2ca08b6fb4d6c9f },
+  { 0xb77468d586957d1b, 0x7fb4cccda2684f47 },
+  { 0xb77dc19183a8fb85, 0x7c601074f53f6d81 },
+  { 0xb7903268e235310d, 0xc346a164af4c7022 },
+  { 0xb79fe32320388a19, 0x7ac3a0b932cc2189 },
+  { 0xb7a7e34e304e4b7b, 0xc565ec01ba33ea27 },
+  { 0xb7b1d3ce07e75976, 0xc43a2dca3866237e },
+  { 0xb7d0aae399781b3c, 0x18679debda6d32b1 },
+  { 0xb7d7c76e37f372f4, 0xe4979b380ed95a58 },
+  { 0xb7e459d5416eeb19, 0x6aaa8e092db14463 },
+  { 0xb7f184013991823f, 0xc02a6557341d2a7a },
+  { 0xb80d50ecee73919a, 0x507498d0a4d922ae },
+  { 0xb816296311019ab6, 0x9a21cb9e9e235d12 },
+  { 0xb822fba8b7c8a97e, 0xa4e92aeb2c455ef9 },
+  { 0xb83579c4450fcbdf, 0x2b108903731fa734 },
+  { 0xb83df1f32b4539c3, 0x24bdf94851b4db55 },
+  { 0xb86552198f52cfce, 0x721bafb496363099 },
+  { 0xb86a12e53ab107b6, 0xcaedd4e0272aa034 },
+  { 0xb879e13fd99382e0, 0x9bcaf1d87ad84add },
+  { 0xb8865f05676e64f3, 0xbec72b9defdacfa7 },
+  { 0xb897f9e3f939b9f2, 0x1566d56db812a84e },
+  { 0xb8e715223ba65cf7, 0x16b3620a90ca3ec1 },
+  { 0xb8ed78afdb1e6cfe, 0x44ef6e3428789d5f },
+  { 0xb9232c1de494875e, 0xfe1858fc8390616d },
+  { 0xb9336ed6d94a5cc8, 0x1a16483b0a946a73 },
+  { 0xb9429824ab7ce3c1, 0xa83438f32af3f4e1 },
+  { 0xb955eb0e2baf7a43, 0x7c186bddd4c49958 },
+  { 0xb958d5fd9574c5cf, 0x9ece4b9421c28ecd },
+  { 0xb95a6274ca0e0c77, 0x3bfdc06b4c3daa42 },
+  { 0xb966ad0c62523441, 0x62add8a3b1f8e3b4 },
+  { 0xb98cc2c6f7a0f051, 0x76f74f0f62c45488 },
+  { 0xb98cea78c084434f, 0x226993d5f6c8059a },
+  { 0xb9b4612358a0b2c1, 0xb4d66bb146767306 },
+  { 0xb9d1e3be30b13132, 0x4482345959aed5e5 },
+  { 0xb9f6fa399b8cd386, 0xc235983ec45e4355 },
+  { 0xb9f9c0fed0db08c3, 0x4346317f3957a945 },
+  { 0xba0d6ac9158a5c6a, 0x59431658d0df9486 },
+  { 0xba257438f8a78862, 0xa9e014d831143690 },
+  { 0xba317f83cdfcd58c, 0xbc65aac1ccb87bc5 },
+  { 0xba3a17efd26db8b4, 0xf09c0cf7afdf84d1 },
+  { 0xba3b0eebccc7b791, 0x107de5b4abb671b4 },
+  { 0xba657d940a11e807, 0xff314bba2c8b389b },
+  { 0xbac28d06dfc03d3d, 0x2f4a7c13383e84ee },
+  { 0xbae1a23f9b6acdad, 0xf465cfb330ba0acb },
+  { 0xbae66907c3200bc6, 0x3592efe5a9a69dbb },
+  { 0xbaf4ce885aa281fd, 0x31711da9b9795485 },
+  { 0xbb18189021d58362, 0xd9e4d317cd2e28b7 },
+  { 0xbb268fde5a210622, 0xa09e52af539930ed },
+  { 0xbb2b83fff97604f7, 0x4ada565e0b5bae94 },
+  { 0xbb5049e4558daade, 0x0f87fed69a244c59 },
+  { 0xbb579404924c40ca, 0x378b4aff6ccf302d },
+  { 0xbb6a5a2f7b67bee5, 0xd1f237f62f1e643f },
+  { 0xbb745c893999b0ef, 0xc96ea9029e3c62ca },
+  { 0xbb756aa98b847ddd, 0xc8fc170bc79f92b2 },
+  { 0xbb9112d478a1a922, 0xd2c289a752bba695 },
+  { 0xbbdbcc6d81f6c57d, 0x1c100fd0ab321e3d },
+  { 0xbbe40e0a59628a35, 0xe9288fe8b3de7b9f },
+  { 0xbbf8c7c9ed280151, 0x934aabe138e41ba7 },
+  { 0xbc24440b59092559, 0xa1ec26055fd1270e },
+  { 0xbc3057a35319aae3, 0xa5cd87a203736abe },
+  { 0xbc33c685e6ffced8, 0x3abe7a43f30df7f9 },
+  { 0xbc4cf38a4bee4575, 0x2dc466c98ed7ad09 },
+  { 0xbc526185ad324241, 0x782dc68ba5d0540b },
+  { 0xbc5389839857612c, 0xfabeb810ba7effdc },
+  { 0xbc593f2284c67b7d, 0x8716d110f541953f },
+  { 0xbc703ea6afb20bc0, 0x89f04d8c9d79a2bd },
+  { 0xbc97d544f1d4834c, 0xc72bcc92a37b8c1b },
+  { 0xbcb31f22856b0028, 0xc00d12f0e4c0a952 },
+  { 0xbcb73b534ed7c613, 0xac379ecd726effb5 },
+  { 0xbccb4e2cfad5efc9, 0x3f6d55dc992118ce },
+  { 0xbce4c291d0007f16, 0x997faa5c4db0a6b8 },
+  { 0xbce93984b920e9b5, 0x6cf24064f740fe78 },
+  { 0xbcef7880828a391c, 0xf6b50d5a6dcef719 },
+  { 0xbd1bd6f6b928df17, 0xa702def0302f46f4 },
+  { 0xbd39598f067a1193, 0xae81bd6182e756d1 },
+  { 0xbd430c2193045c68, 0xd1a20a018a976248 },
+  { 0xbd551ff1264f5c36, 0x7a3ad7cf0d2f266c },
+  { 0xbda1463e02ae3a6e, 0x1107ffe1b572efd2 },
+  { 0xbdb4b584ddc90c9d, 0x2ec7e21632a236b6 },
+  { 0xbdbaeff1f7132358, 0xea64c7be9e46c1ac },
+  { 0xbdbfd5f85421fd2a, 0x713258503123a4bc },
+  { 0xbdc381baf7c252c6, 0x3739c5e9ed087a5c },
+  { 0xbdc6ecf341705ab3, 0xae4113a1a902fca3 },
+  { 0xbde78ccb64786641, 0x90921b6951ec7919 },
+  { 0xbdecc81f74020078, 0x0db04a107c3a1eba },
+  { 0xbdf1996e2dd64baf, 0x8eff5511811ca6ca },
+  { 0xbe060a704803446c, 0x02e6f039ab12eb91 },
+  { 0xbe1922bd8e09d74d, 0xa471287e1e968653 },
+  { 0xbe2870a0120fd28d, 0x25284e9ccdcbdc99 },
+  { 0xbe35d8b37bbc0384, 0x8a5f020662a99909 },
+  { 0xbe3f0e827e2f7488, 0x19dac2a22d6ac823 },
+  { 0xbe41463cd918daef, 0x107d249f8cde3409 },
+  { 0xbe561b286b6432ca, 0xc71bccbae68002f7 },
+  { 0xbe7011581614ffb0, 0xc38f79f99ae67b4f },
+  { 0xbe929419902e21bd, 0x7830a7a7d746195d },
+  { 0xbecd908f9d7bb361, 0x982c3dc02d6475c6 },
+  { 0xbedfbde71fb60660, 0x1f936b5b057f26f7 },
+  { 0xbefce0de2012b24f, 0xd6cb8b53c17c8271 },
+  { 0xbf1970b692275b42, 0xc4ec0683588eb062 },
+  { 0xbf52327c2197d9d2, 0xc4544be053caded1 },
+  { 0xbf84f528de44225d, 0xd733c0e6a8e400a0 },
+  { 0xbf976cf80bcf52c5, 0xf164c1d45f2b316b },
+  { 0xbfa58198c6b9cd80, 0x62ee76a2b38e9b33 },
+  { 0xbfb73aabb2489316, 0xcd5882c3cd11d9f9 },
+  { 0xbfe14ea890d3a4e2, 0x293568c0fcce726f },
+  { 0xbff8f8f53a8aeb1e, 0xe804004ccbb08313 },
+  { 0xbffe34516aaa3cbf, 0x5d307eab382a7e95 },
+  { 0xc00734a2233ef683, 0xd9b6e622ac97a5c8 },
+  { 0xc00b65d1bae0aef6, 0xa1b5652c9c2156a1 },
+  { 0xc02e1afa0671e438, 0xfd526055c556d231 },
+  { 0xc032c2bd7017fdfb, 0xba9a105ec50f800e },
+  { 0xc033dc1d7b6fde41, 0xb9cadce9638909bb },
+  { 0xc0589bb738589243, 0x89077fa3c2e9441a },
+  { 0xc05f367fa4767ceb, 0x27abadf0066df7f4 },
+  { 0xc07e9a1af18261a8, 0x0db55d0280a0fa95 },
+  { 0xc08d0cee43077d30, 0x55febb00e5745c1d },
+  { 0xc0a68837c60e15d1, 0xfc5a40c9a62894bc },
+  { 0xc0c7eddefce90153, 0x46db88ade3e1e096 },
+  { 0xc0d2434348de72fa, 0x6edcc6d8e40f28d7 },
+  { 0xc1034a5bfb0bb13c, 0xc5bdf86cc58989a7 },
+  { 0xc118854d670289a8, 0xb5d5156aa74b0c49 },
+  { 0xc11e8473c652619a, 0xc6166900150ce215 },
+  { 0xc126656df6badfa5, 0x19cc63e681fb3596 },
+  { 0xc15042e54c740849, 0x8f051d782aaa8945 },
+  { 0xc150c76cbde2c9b5, 0xa97eb5399d46c64f },
+  { 0xc16c79aad6272baf, 0xfb8aae9a7fff0864 },
+  { 0xc16cc583860bee0b, 0x928ef7fbd0010b4e },
+  { 0xc16fbfdbfdf5590c, 0xc8179e4b0f5f5aeb },
+  { 0xc17bdc7d14a36e10, 0x837d039f43ee5fa3 },
+  { 0xc1a83f44137ea914, 0xb495fc6ac036c493 },
+  { 0xc1b038ce5cb6d85e, 0x956c5509b0e0d0d8 },
+  { 0xc1b1049b88bcd984, 0x37d8872d1d62ba31 },
+  { 0xc1b7aeabc3ec4155, 0x6d924c8372a9ba5b },
+  { 0xc1cb228470a87beb, 0x5f36e90ac745da26 },
+  { 0xc1e6e4e7ef5f1463, 0x88a090f1c469a2fa },
+  { 0xc1f209d80f0624da, 0xda5866ce05dd3399 },
+  { 0xc1f9f70ae527093b, 0x6af3b6531860e75d },
+  { 0xc1fdd44efda91641, 0x4be3527a47752c75 },
+  { 0xc20f15282a1aa872, 0x4d70c117e5c9709e },
+  { 0xc21450c21efb7715, 0x746e9fa87ad6f145 },
+  { 0xc216b91f5db21a09, 0x3ded6a5aaec85709 },
+  { 0xc221607529cabc93, 0x450ef25dbac6e8d2 },
+  { 0xc225379e7c4fb6f8, 0x86ef9c8c522275b4 },
+  { 0xc225abfb584960ef, 0xe1f359fc94b73379 },
+  { 0xc2410d03820e0ff0, 0xa449fa6170f51211 },
+  { 0xc246e05b52f68ab2, 0xe9aee40f278cd158 },
+  { 0xc2778507b83d9540, 0xe9be5713758ff945 },
+  { 0xc28b29764c2338b0, 0xcf95537cc9aad8c9 },
+  { 0xc29d17eef6b0784d, 0xb4586c12cb5fd454 },
+  { 0xc29f8db680990cb4, 0x5ef7fef6ab57a2c2 },
+  { 0xc2a37f1c7603c5fd, 0x97df47d6c562abfa },
+  { 0xc2b5c50ccb598168, 0x67036d7cf730bf75 },
+  { 0xc2bcd8f2378c3779, 0x067f3a551f662bb7 },
+  { 0xc2c7a11717e25559, 0x3e54d0acaf653ee5 },
+  { 0xc2c8eb642765137b, 0xb82b83a65232961f },
+  { 0xc2dea467f4a02fa1, 0xf06d66f52bc12e6e },
+  { 0xc2fbef02b6eea37d, 0x8df3e91107f89950 },
+  { 0xc31a17942d162b80, 0x962cb1f7571cd1d5 },
+  { 0xc3205e3707f646e1, 0xa106e09c5c49c1bf },
+  { 0xc3472fa98c3b452f, 0xa2fd37d1c219fb6f },
+  { 0xc370c3268ad95b32, 0x66d6e36ff23d1f0c },
+  { 0xc37f6143299acc47, 0xa8db2e8e8135a96e },
+  { 0xc3a9550f6345f4c2, 0x5b372c42dc865703 },
+  { 0xc3aeb796fdaf9429, 0xe8cd6af6346f337e },
+  { 0xc3bbc673acf2701b, 0x5275e85d9372facf },
+  { 0xc3e4aa718f462913, 0x11f1cce53e6ccd79 },
+  { 0xc3ef5c4653212088, 0xeda54dc91d787870 },
+  { 0xc3f53993ade534b0, 0x982ca3a286c85bb5 },
+  { 0xc405655354a9b674, 0x203b97f22fc31d8f },
+  { 0xc4060a31d61ba857, 0xe756430a0a15ed2e },
+  { 0xc41e7735f6701dd5, 0x0e84ee71d3ed1d8f },
+  { 0xc43bd363e1f128e7, 0x3ba5f0380b6fd7e3 },
+  { 0xc446288fe62c0c27, 0x37639fd788ae4a21 },
+  { 0xc450a285daa7a3b6, 0x5188c2c3cf04fb3e },
+  { 0xc469151655e33379, 0x3472777052013f4f },
+  { 0xc471b97446a85304, 0xbbac021c57c2cb49 },
+  { 0xc47244f5557ae12c, 0x61e8e01c140e2173 },
+  { 0xc47b7389e76974fd, 0x0de3f088fea35576 },
+  { 0xc482f8eebd45e0b8, 0xd479d9b71dd72bb8 },
+  { 0xc49fe437800ad7fd, 0x9302f3a90a38fb7d },
+  { 0xc4b73c35bc2f54b6, 0x6cd786f55b668a82 },
+  { 0xc4bbbb0c8fe203cb, 0xd3be2e318e55bcc0 },
+  { 0xc4bc8c2e130d7634, 0x6ebf8eb544991b46 },
+  { 0xc4cdd90fab655d3e, 0x91933289dd1d8753 },
+  { 0xc4d888bcf532e7c9, 0xc5fdeafbb145266a },
+  { 0xc504a71c411a601d, 0x1fc3173369cfdca4 },
+  { 0xc5124e7d7a8c768e, 0x5a18bde8b54aeb1d },
+  { 0xc517144e3d3ac5c0, 0x6f2f682ebf212dd7 },
+  { 0xc529e63013698064, 0x149b9e0468afd941 },
+  { 0xc52d9bbdc5530e1e, 0xf8e8ba7be692b01e },
+  { 0xc5301f549d072204, 0x9bb0add6b10d1e09 },
+  { 0xc5387fc1aa71f11d, 0x2fa82459e189a5f0 },
+  { 0xc53c0d10c74325de, 0xae9ba84074281983 },
+  { 0xc541a5f6fc23b40a, 0x211196dd78233780 },
+  { 0xc54b4207ce1d4bf7, 0x2fadbb1a805d4a39 },
+  { 0xc560a3ecb7b75102, 0x1953819efcfe5b41 },
+  { 0xc569e57dca93d3be, 0xe115a49923057fd7 },
+  { 0xc58708c09ccb6162, 0x5cda9d15ddcd8be6 },
+  { 0xc5930d0e8cdae3e0, 0x37349bfa08e871be },
+  { 0xc59633dbebd926c1, 0x50fb6d30b0576405 },
+  { 0xc5a76bafc4676edb, 0x76e0126fb9f0fb2d },
+  { 0xc5bab953ac13dbb2, 0xcba03cd0684fb125 },
+  { 0xc5bf03028b2e8f49, 0x50ec8835c6811d47 },
+  { 0xc5c7cc66febf2d4e, 0x743b4459de7ed868 },
+  { 0xc5d2834bf98e9024, 0x5e545573eb7e6bbc },
+  { 0xc5dd8399257d8862, 0xf3952be75c23e0eb },
+  { 0xc5f71dfbdca9cc96, 0xb28643ff4d06aa6f },
+  { 0xc5fe45f2734afd47, 0xe27ca3b04a90213c },
+  { 0xc63a98ca404aa5ee, 0x9fcff1de488c3f43 },
+  { 0xc6556e082aac0426, 0x0596b4045bc122de },
+  { 0xc6688781f4ab8448, 0x52f4e3352772289b },
+  { 0xc67ff409f28f4488, 0x3bd5251cea79727d },
+  { 0xc689148ad9275667, 0x924ab334107b517e },
+  { 0xc68a6bafb667bad2, 0xf6d020f879be1d11 },
+  { 0xc6ae21caceaad734, 0x987cb24243793bd5 },
+  { 0xc6c63da3bc2e4729, 0x1f63280e057061d0 },
+  { 0xc6d48c6ae6461e0e, 0x82753540a985ac9e },
+  { 0xc6d7fe7a46dc46f9, 0x62fe8413c6f53fc9 },
+  { 0xc6db733e0b108c25, 0x80a1d65211f06dbf },
+  { 0xc738fc3f5aae1e8f, 0x86f7249f6c82ac81 },
+  { 0xc73ae5ba5a0a3f3a, 0xc77f0a9e14770e73 },
+  { 0xc745487828a1a6a7, 0x43488ecebc55ad44 },
+  { 0xc74bfd02c7f1877b, 0xbe712c1da5c4c194 },
+  { 0xc7600d72247c5dfa, 0x1ec1a88d23e6c85e },
+  { 0xc77c35a6fc3c0f12, 0xbf9e8bae48cba54b },
+  { 0xc77d3b47f2293e69, 0x419b92522c6f6647 },
+  { 0xc7900a7fe95a47ee, 0xf3b325072ad2c232 },
+  { 0xc7d5819b26b480a4, 0x9eb26aeb63cc831e },
+  { 0xc7e43ad79c5e5c02, 0x9d9f5ffde23e32cf },
+  { 0xc7eab66576696e11, 0xe3c11ffff92e13cc },
+  { 0xc7f13ef38f61ee23, 0x67ada94fdcc6d206 },
+  { 0xc82ec00335cbb4b7, 0x4494aecf31608fa1 },
+  { 0xc830f6ae7ee58bcc, 0x2a6712fb33e92d55 },
+  { 0xc866c995c0d2ca7d, 0x017fef0fc0c2e268 },
+  { 0xc880c659cdc0f84c, 0x4a66bc818f89618e },
+  { 0xc89c3138a99fd1fd, 0x54367d65f75b0244 },
+  { 0xc8bae949b488dca3, 0xcf2cf92bf4260c98 },
+  { 0xc8c7da12f087e8d1, 0x6d3e6a21b371a5d3 },
+  { 0xc8e90fc944596718, 0xc84c82b55139b065 },
+  { 0xc8fa5d69d9e555eb, 0x16068ef87b1c9c45 },
+  { 0xc90788d9aa71a78b, 0xcc78c015edb22c54 },
+  { 0xc9196e28367e46f8, 0xa55e04c27743148f },
+  { 0xc92cfa54b5d02263, 0x7fdcbdc1ef640d82 },
+  { 0xc98e8c918a40b4d3, 0xa243dd6c49196330 },
+  { 0xc9b7afad3bfd922e, 0x006a6bfc1d4f3fe7 },
+  { 0xc9c25fc536de9a7c, 0xdc5b9a916c459110 },
+  { 0xc9d02d3cfeef8b48, 0xfb71cb4520a4aa84 },
+  { 0xc9e721eb29c940c2, 0xe743485b044c0a3f },
+  { 0xc9f6e521a49a2d15, 0xdac56b6ddb3fb4c7 },
+  { 0xca09fa7406b7d2ae, 0xa10d969b6fc90195 },
+  { 0xca4f8c5b4d6fb9d6, 0x08bb96bc7ebd26c7 },
+  { 0xca50cc4b21b01552, 0x55e066fcd6396331 },
+  { 0xca53fc8fd8b3c4a7, 0xdf89ac86b222eba0 },
+  { 0xca54de69f7cdf4d7, 0x996e86f347129892 },
+  { 0xca7aaebd861a9ef4, 0x7967d31c5a6c4555 },
+  { 0xca7abc774a2fa950, 0x14688bc0849eee47 },
+  { 0xca7f166a94eed1a3, 0x49dec6d6a358bcad },
+  { 0xcac9928a84e10018, 0x17b223f0cecaa3f2 },
+  { 0xcad982c9b45bc5ef, 0xf34e4ea982d5f1ca },
+  { 0xcade123747426df6, 0x9570a2bc871d3baf },
+  { 0xcae8f83c06831ec7, 0xbb6a3c07e98e9342 },
+  { 0xcb18d8d5fbdcb1cd, 0x7bd36c5423348859 },
+  { 0xcb24210dc86d92df, 0x97b38cf2a51782da },
+  { 0xcb4a7b507372c24f, 0x8b9390d22d54a918 },
+  { 0xcb8399dc0d409ff1, 0xf531ef86b3b34953 },
+  { 0xcb9626517b440f09, 0x9c0b6b27ca65142c },
+  { 0xcb96b0cf90ab7777, 0xa2f6f05e8ad3f694 },
+  { 0xcb9b2e9806a7fbab, 0x3d819cfe15f0f05a },
+  { 0xcb9e924160a4df52, 0x0456fbe745d61959 },
+  { 0xcba56e939252b05d, 0xf7b7de87307d12ca },
+  { 0xcbad928e10aeee84, 0x8786cc55394fb692 },
+  { 0xcbb0ee17c1308148, 0x823cc6da85bff25c },
+  { 0xcbc373fbcb1653b4, 0xc56bfabba33ea50d },
+  { 0xcbced209dd0575a2, 0x7212d3eee6aee3bc },
+  { 0xcbd981a23c592fb9, 0xab979223bb368cd5 },
+  { 0xcbe5a166550a8129, 0xa5e6d374901dffad },
+  { 0xcbeafd37f15e0ddd, 0xb0540dbe15c545a4 },
+  { 0xcc03c68b8348b623, 0x31964d7a3dbec381 },
+  { 0xcc12581e079cd183, 0x30a89902625b8347 },
+  { 0xcc1939e4769d0c15, 0x7ace326efcfdcf80 },
+  { 0xcc2973680c150886, 0xcce1ed8693c3aca2 },
+  { 0xcc3d942c6958bd16, 0xb1c602623f59e6e1 },
+  { 0xcc7138202cd8f677, 0x6212ebfc3a820ecc },
+  { 0xcc724ebe74a109e3, 0x9c0b2784ddc980ca },
+  { 0xcc74ddb45d7bc4d0, 0x4c2e6f1907416699 },
+  { 0xcc75d0c727e5e4af, 0x4fa366a78b0f60d2 },
+  { 0xcca33ae30a58f39e, 0x3fc5d80f94dc0362 },
+  { 0xccb56107ff049223, 0x2065b85493daa635 },
+  { 0xccb5fa954fb76f09, 0xcaae9a8c66462190 },
+  { 0xccb807eb79b0ed0f, 0x5fdc460445ef703a },
+  { 0xccbd36746ed45258, 0x21a8083b0d6d2c2c },
+  { 0xcccfe9e9a11b1dad, 0x04beba46eefb7351 },
+  { 0xccd6ce508eee4b3f, 0xca67212833edcd85 },
+  { 0xccd92a269a4c2bd6, 0x4d58cf2c0114423c },
+  { 0xcd032ab6764b5543, 0x8a7b0bfb5e78595a },
+  { 0xcd139ae6d09f3665, 0xad09eb79da3f9e49 },
+  { 0xcd34b3b3ef9e4852, 0x01e841ba71beb253 },
+  { 0xcd38ad19f51b1048, 0xd8e5e99c86a2a655 },
+  { 0xcd399bc422992a36, 0x1ba932cc50f48b65 },
+  { 0xcd3e26786136a469, 0x2fd2cb2dfbc1927e },
+  { 0xcd4423bd9f076340, 0x9bae9111f888f7c2 },
+  { 0xcd4ded1ede63c4dd, 0x09f3dd01bda7458c },
+  { 0xcd568d6acb2f1447, 0x7ebf7e59fb382292 },
+  { 0xcd5af682685cfecb, 0xc25a983e16b9d833 },
+  { 0xcd68a9f79d4822a2, 0xe8f694d551642213 },
+  { 0xcd88ef1736497288, 0xc4533bcca339f881 },
+  { 0xcd8fa2e9f6255ef3, 0xd3b9b5a4f24a54f7 },
+  { 0xcd98be8a48ebf610, 0xc9609a688b9c57f2 },
+  { 0xcd9fea12051e414a, 0x6dfe17052067da8e },
+  { 0xcda38714267978b9, 0xa8b0b24bee3529ae },
+  { 0xcdadb57b34438805, 0xee322ff05bd3d43e },
+  { 0xcdb81bf33d830ee4, 0xee0606ee99e84dba },
+  { 0xcdc1a5c61d7488ea, 0xdc9aba36166b253d },
+  { 0xcdd4a538c420358a, 0xb64767d326921bf6 },
+  { 0xcddabfd68363a76c, 0xd30bee4e8094c646 },
+  { 0xce17325834bf8b0a, 0x0d0d8de08478d436 },
+  { 0xce1cbe159b9ae599, 0x2dacf09371de5e13 },
+  { 0xce243747bf34a2de, 0x366f846b3f4ca772 },
+  { 0xce4bbe11d682c15a, 0x490ae15a4a8716cf },
+  { 0xce5524bb18e3bd8e, 0x092273ef22d36cb9 },
+  { 0xce5cc62608be2cd3, 0xed8abd844efb8919 },
+  { 0xce64812eb83c9572, 0x3b04fb56d816910b },
+  { 0xce6c4270f605ad3c, 0xe5e82678b0fc71f8 },
+  { 0xce82a675c773ff21, 0xe0ffc0a4d1c90a71 },
+  { 0xce8467ae2a3a5bc8, 0x8ca72a2ce44ce28c },
+  { 0xce89529d6e98a13d, 0xdf3d84827bbdfe68 },
+  { 0xce904c0ae58d36d0, 0x85cd506989116b0b },
+  { 0xcea9f72036dc6f7a, 0xf5eff52459066290 },
+  { 0xceba7965a93c689b, 0xdecdb46a5b2ac0c1 },
+  { 0xcedbd67d1ff321c9, 0x96051eec843f8716 },
+  { 0xcee0177142b348b3, 0x23877983d4ea38dc },
+  { 0xcef01595000627ee, 0x50863d4290372c27 },
+  { 0xcef2287d5fd80216, 0xb2200fb2ef1adfa8 },
+  { 0xcf0c593c563c84fd, 0xaf0f741adb367445 },
+  { 0xcf3a9ada2692bb42, 0xf81192897752b912 },
+  { 0xcf3c2725f736d4bc, 0xb84ad6f42de62a41 },
+  { 0xcf507910d6e74568, 0xa68ac949537bccf9 },
+  { 0xcf63ffac9da89ef0, 0x9c6c973083061a47 },
+  { 0xcf9069f92a43f719, 0x974ee712c50cd932 },
+  { 0xcfad2b9ca8b8fec7, 0xfb1611d656cc765b },
+  { 0xcfb3260c603b0341, 0xd49ddfc94051ec10 },
+  { 0xcfb83a3b0513acaf, 0x8be4cae1512281dc },
+  { 0xcfc226d04d7490b6, 0x9e155abd7741e98c },
+  { 0xcfce5596a7e8ca13, 0x529e9804cad693ef },
+  { 0xcfd5518c71552b8b, 0xb853b0e461e328d7 },
+  { 0xcfd6a8b23d12b046, 0x2baf6a05ef347cd8 },
+  { 0xcfdb4d0427a1ea80, 0x85c6bc6eb90259d8 },
+  { 0xcfe2185f84ce8501, 0x933beb5c5e1fd053 },
+  { 0xcfe62ed7125ff9fa, 0xe99b4c8a367c0399 },
+  { 0xcfee10bd7119f10b, 0x136921ced2ee8972 },
+  { 0xcfef1a2d1f6a5ee7, 0xa5e1f43f3056f112 },
+  { 0xcff1e9170bdbc298, 0x59b815203edf18fa },
+  { 0xcff578e5c60de8ca, 0xecbee7f2c9bbb57b },
+  { 0xcff9950d4e650094, 0xf65f40d179a9882d },
+  { 0xcfffc4b97d01cc3e, 0x7b9f47575f7b11ec },
+  { 0xd00f6f8ba89559e4, 0xb20972a478fc0370 },
+  { 0xd010e3dfe7366e47, 0x561c088079a59439 },
+  { 0xd026716b3c5be2c9, 0x51cc4c064317c524 },
+  { 0xd0498baca989e792, 0xdb4b8270a02b9624 },
+  { 0xd071d2ec86b9d52b, 0x585cc0382480b351 },
+  { 0xd078674afdf24a45, 0x47b4b32890fdc614 },
+  { 0xd078d25873c5b99f, 0x78fa267245a2af02 },
+  { 0xd0796a0317abf901, 0x8d6745086bef411f },
+  { 0xd08fccfbebaa531c, 0x4a4fa7359393a0a9 },
+  { 0xd090836f0a4ea8db, 0x9ac7abb7d6adf61e },
+  { 0xd09935802d6760ae, 0x58253685ff649268 },
+  { 0xd09a7504ee8c8717, 0xac3e24d263e7814d },
+  { 0xd09f1830fb316515, 0xb90694c45728d702 },
+  { 0xd0a379946ed77b1b, 0x126230ca68461333 },
+  { 0xd0af33865512e9b6, 0x900714c26db5fa23 },
+  { 0xd0b26e908370683a, 0xd99bc6b52137a784 },
+  { 0xd0b9df57bfea6637, 0x8c0418ec68cfe37f },
+  { 0xd0b9f705aa5f61f4, 0x7a748a66009ae2d2 },
+  { 0xd0cb28e1b7bd6c7f, 0x683a0917b59f707e },
+  { 0xd0cdafcb000b9ae0, 0x4ac465f17788ad11 },
+  { 0xd0e05ba5f10e3df3, 0x023c5ee787f760ef },
+  { 0xd0e15a3ce322c5af, 0x60f07343594392af },
+  { 0xd0e9beb2347595c6, 0xc7d158e9d83d2da8 },
+  { 0xd100b11be34a1e5b, 0x7832b1b53f711497 },
+  { 0xd15655fe355fa57d, 0xd541487dc5725145 },
+  { 0xd1680f0bb8e6a277, 0x3fe712bb3f480a18 },
+  { 0xd170317ae4c7d997, 0xa989c7d6567c2840 },
+  { 0xd175258b2973b917, 0xa05b46df4e1cf15d },
+  { 0xd17a671029b1532b, 0x197defca5f3649a7 },
+  { 0xd17a8c440d6be79f, 0xae393a4b46661164 },
+  { 0xd1a1841b7f2007a2, 0x4439ac248374630a },
+  { 0xd1a9478b99d6a55e, 0x13a9fd4262da7cd4 },
+  { 0xd1b4075925e8d303, 0x1a7616d2f02fdd1f },
+  { 0xd1c3520b57c348bc, 0x21d543699bc88e7e },
+  { 0xd1ca47b262f95241, 0x3c1234117c4e4e21 },
+  { 0xd1d704a7146e9570, 0x9b57b6d4cac3f788 },
+  { 0xd20e61c86ed72978, 0x0feca162166912ca },
+  { 0xd214c7a734e133a5, 0xc18e93229435b57a },
+  { 0xd223bc6f13358642, 0xf02ddacfaf4a90c9 },
+  { 0xd245e2f27c840160, 0x41e9496b66b722fe },
+  { 0xd25018349c544320, 0xbf3fd5092ee072bc },
+  { 0xd28afe0517a04626, 0x5c418181fa9dd9a1 },
+  { 0xd2901c34bb6496bb, 0x96c7bc78a9e6142a },
+  { 0xd2c4f8a4a98a905a, 0x9deef3ba7380ed64 },
+  { 0xd2c8e6aa8172b16c, 0x8aa9aae739ac9c5e },
+  { 0xd2c957dd7746521b, 0x51bb09fde25c5774 },
+  { 0xd2d8c4f1ea7f347c, 0x8bcc7d24f45aa338 },
+  { 0xd2deddb77c8b823e, 0x4be9c57cb3c69adc },
+  { 0xd2f713c78a9ebba9, 0xda6d10aeefc6f20f },
+  { 0xd3171407c3a8bb40, 0x1a3a62eb578f48fb },
+  { 0xd326db524d93fa28, 0x97ab69c42d6fb698 },
+  { 0xd339b95f273f8c35, 0x50dc4daa67a4aa94 },
+  { 0xd341d39774277cee, 0x6a1d378a013f92ac },
+  { 0xd3423d7600879174, 0xc038f53e5ebbf9d3 },
+  { 0xd3456b4cf1bd1a7b, 0x8fb907af1a80ee15 },
+  { 0xd34b933660e29c0a, 0x0a04004f15d7e160 },
+  { 0xd36308387241e98f, 0x813646f346e7f9f7 },
+  { 0xd39e29b03af3c286, 0x41084dd1528aae05 },
+  { 0xd3bb42228a6cd452, 0xc111c1932503cc03 },
+  { 0xd44d90e7c389165f, 0x5034b5844077777f },
+  { 0xd45bf71871b19602, 0x2829aa3b96bfcfd4 },
+  { 0xd45ebf130ed9070e, 0xa8ebd56176e48a38 },
+  { 0xd47387658ed450db, 0x77c3f189b969cc00 },
+  { 0xd4806775693fcaaa, 0x24cf00fc00edcdf3 },
+  { 0xd483f65468d9a265, 0x661917bae1a54f3e },
+  { 0xd4942f4b55313ff2, 0x69488527d84ce35c },
+  { 0xd49aff83f77a1b90, 0x41ad7185df3c2277 },
+  { 0xd4aa89e96d290269, 0x2f5c45f36903d336 },
+  { 0xd4c590ccfb611a73, 0xb3331359700c01a3 },
+  { 0xd541b20eae221a8e, 0xe321375e5971e766 },
+  { 0xd54cd41ecfd59e4b, 0x72d2c086152b9a75 },
+  { 0xd5618464dbdc2981, 0xf6aa8b955828eeb4 },
+  { 0xd563ba38151b8204, 0xc9f5c9f58e781455 },
+  { 0xd573089534ca596e, 0x64efef474be7b6bc },
+  { 0xd57913088e0c49ac, 0x3a716bf9837b284f },
+  { 0xd57eb282d7540051, 0xbc9b5427cf966f03 },
+  { 0xd597d35c6022c590, 0xd6e75e865738558a },
+  { 0xd5aa7472e7f2cc17, 0xe893a1a36f8dadf0 },
+  { 0xd5c6b81212ad86fd, 0x9542a1fedaf57cae },
+  { 0xd5d2d44fb7378599, 0x6ccc24ae3a0f5cef },
+  { 0xd5e17022d1ecc20f, 0xd9b53dc464c302f1 },
+  { 0xd5e27051512c1e74, 0x45a9bf91501bda09 },
+  { 0xd5e5b3ec074fff89, 0x76017ef121d26129 },
+  { 0xd5f965c159e26a1f, 0xb49a22a47fbd1dd0 },
+  { 0xd605ed12f4eaaaec, 0x3dcd5aa909a4bad7 },
+  { 0xd61629bbbe035f45, 0x552e31cef7d591b2 },
+  { 0xd62283aed0f4199a, 0xdb2333de4c263e9c },
+  { 0xd62d7d1a974c31c5, 0x803f96a8c1552510 },
+  { 0xd632b74fea533d59, 0x3af82cf16e7c5e4a },
+  { 0xd65028524761ef52, 0xfbbdebab46f79d0f },
+  { 0xd65900fefa7dc18a, 0xc3ad99c213e2fa4e },
+  { 0xd69559f9c9dc6ef5, 0x28d841bf9d91b275 },
+  { 0xd6a44277c3eb4f9d, 0x039185e0ecf7bfa6 },
+  { 0xd6acff6aed0f0469, 0x0fe4024d58ff4ce3 },
+  { 0xd6b8beeb05e5b730, 0x084d4b8f381bbf8d },
+  { 0xd6d1ddd21e9d17ea, 0x5f325fa09305069c },
+  { 0xd6d5dd8fd322d3cf, 0x874e651e7b6c1657 },
+  { 0xd6dc9b4508da407e, 0x2437bfa4de53d1b2 },
+  { 0xd726621c676552af, 0xa503b7942af5afa2 },
+  { 0xd73ad614f1c23579, 0x97c88f37e75b18fe },
+  { 0xd74a81fcd89c5cf0, 0xbd4c88eb207ebd62 },
+  { 0xd763e3a9cdcdd56c, 0x715ec826106fab6a },
+  { 0xd7759fa91902edd9, 0x3f1568a37dc70cdb },
+  { 0xd782543818b6320e, 0x4f60d77da2b596de },
+  { 0xd787ec6785b0ccfb, 0xd844c7866db9667d },
+  { 0xd7891b0faa4c7f76, 0x4482762d0ed427a5 },
+  { 0xd7b2259f6bb57bf3, 0x7eac82365c1f8ad6 },
+  { 0xd7b58303ec8d8c4d, 0xbcbf54d3b9734c7e },
+  { 0xd7dd56677e4ec1e6, 0x627419478a4a9668 },
+  { 0xd7f5bf138cfc7fea, 0xb7b8ef1534c8b477 },
+  { 0xd816fea559b47f9a, 0x672604df06f9d2e3 },
+  { 0xd81bb6965e6c99b3, 0xbe99ffd8978740e4 },
+  { 0xd82675ce67caf16a, 0xfe5ed6b6fac8aa37 },
+  { 0xd8295eff5dcc4336, 0x0afa87221ea6021f },
+  { 0xd82c8a58098a6b46, 0xc5b81c16180354d1 },
+  { 0xd85f1e35c5445ac8, 0x98746719a3d93f09 },
+  { 0xd86deb100c6abed1, 0x588aa84b2f7b3a98 },
+  { 0xd88691c995008b9a, 0xb61a44bb686b32e4 },
+  { 0xd89262907e70c13d, 0xff23356c4a9055d0 },
+  { 0xd89fedded0436fde, 0xda7c3c37e2fb7cf1 },
+  { 0xd8acaa980cda94b6, 0x5066568dd04d9eb0 },
+  { 0xd8b2c81cea5af04f, 0x795eb3dc6573d72b },
+  { 0xd8df256c0d89e494, 0xa9fb3e9abb8e44ac },
+  { 0xd8e4c8e2d210270c, 0xd1e0f6d1b4582b91 },
+  { 0xd90205e29bb73a4c, 0xdf28ea7662ba0c3c },
+  { 0xd912312349d90e9d, 0x41a9db0d5cd3db70 },
+  { 0xd9548ad44e67edec, 0x202d1b8b325e5adf },
+  { 0xd968de2b4ff18bfe, 0x4a95066cde310578 },
+  { 0xd97e3d0b4575ce0b, 0x9a6132e19cfeac6e },
+  { 0xd97fd5e6e1daacd9, 0x09559a71f189f14b },
+  { 0xd9ab6b67a17da51e, 0x5ad13717e93fa2e2 },
+  { 0xd9b49f0678776e04, 0x916fa5478685a819 },
+  { 0xd9bd343533b61389, 0xb270c0787210943b },
+  { 0xd9c9cece2e769c79, 0x85494b1403a25721 },
+  { 0xd9da2ae7c7894a29, 0xb43b3c6b79f3b7a2 },
+  { 0xd9fbf1113114fb3a, 0x3c97550a0689f10f },
+  { 0xda0fb2a484d0d2d8, 0xf79d6e063c94063d },
+  { 0xda4e3396aa2db3bd, 0x667f83a1cb9e4a36 },
+  { 0xda5096000db5fdaa, 0x8d02db57d9367998 },
+  { 0xda6465a34d2e44d2, 0x6aa9a2a0cd1bce4d },
+  { 0xda66d75e4b47fab9, 0x9733529743f86f4f },
+  { 0xda732c57697ad7d7, 0xaf414998fa527e75 },
+  { 0xda79aad11572c80a, 0x96e261e4ac6392d0 },
+  { 0xda7a17dcdaa62d69, 0x71393c0a6faf202a },
+  { 0xdab844deed4c7526, 0x32b5e786b0f47999 },
+  { 0xdac38b4dd3da73bb, 0x7b2e9d70c61d2b7c },
+  { 0xdac5c0fe74531f07, 0x7c105b396874a9f1 },
+  { 0xdac762e4d01d445b, 0xdef20b7771f6570e },
+  { 0xdad2ab5f66f98674, 0xf12c92abcfbf3a20 },
+  { 0xdaeb54957875c501, 0x98a7e616f9cc8144 },
+  { 0xdaef7d8e5a09981c, 0x4aa81573d4dbb380 },
+  { 0xdafc3945677ccc32, 0x2ce323d1e9930beb },
+  { 0xdb1753cc702c18d3, 0x917ec7f3b0e8659f },
+  { 0xdb339aea2b65b84c, 0x7cfe0eeab11e110a },
+  { 0xdb4eb44bc5d652d9, 0x192451383d3249fc },
+  { 0xdb5073bd75eb05f7, 0xd62a7268396d1e77 },
+  { 0xdb76f7a0819659d9, 0xe585f2cdde9175c7 },
+  { 0xdb80d8ef9087af47, 0x64236f7b5649fa12 },
+  { 0xdb971b6afc9d243f, 0x614ebf380af0ac60 },
+  { 0xdba270850ae99796, 0x9a18ee0001675821 },
+  { 0xdbabb80e92ff18d8, 0xeecf615c0539151e },
+  { 0xdbb10b904242fcfb, 0x8428f372e00c01af },
+  { 0xdbba14a0f69f0e13, 0xfdccb3fde3baedca },
+  { 0xdbc7485ad5814d46, 0x6de780a3e7ed3b46 },
+  { 0xdbc8829ef6f12db8, 0xf463e30f60af209f },
+  { 0xdbdaf82f4f0c415a, 0x94d1030271a9ef44 },
+  { 0xdbdd21e1ee3d7211, 0x9e8cd14d943c585b },
+  { 0xdc13df8420ec6984, 0x1a7c51e41b9fbba5 },
+  { 0xdc33479d66615a3b, 0x09670775de4c2a38 },
+  { 0xdc81c4805bf23959, 0xfcf2c649700b82bf },
+  { 0xdc905b22de0f191a, 0x029df13eddfcabc4 },
+  { 0xdc97cbcf091a5ef4, 0xca7fe95dc0848036 },
+  { 0xdca90ea1084a2fdb, 0xe300d7178ca1a138 },
+  { 0xdca941dab5c6f859, 0xb71883b13ade9744 },
+  { 0xdcba0e33aa4aed67, 0x630a4b292386f405 },
+  { 0xdcc2956c7a39fdbf, 0x1e861fc5c595da0d },
+  { 0xdcec46a98f45b193, 0xf07239611eb878c2 },
+  { 0xdd08e18cfee87a0e, 0x7fc19a684b36e124 },
+  { 0xdd0cbe5351551a53, 0x8414fb9e37fc56e8 },
+  { 0xdd0de0f61af2a2a4, 0x878e377b880a3933 },
+  { 0xdd10b5ee37fdbf90, 0x9423f2998a1f3179 },
+  { 0xdd13a16d14100819, 0xf79b1ce3a5bf499c },
+  { 0xdd1422ffd538e2e3, 0x3b339ebeef4f259d },
+  { 0xdd17711a30ad6010, 0x9c8beace0d4a76e8 },
+  { 0xdd1842ba0f3f9d94, 0xdccb21eaa0f069b7 },
+  { 0xdd45e370aceff765, 0xf1e72c619efd4399 },
+  { 0xdd4f4e0fbd817625, 0x33e39e6f5b55bb3a },
+  { 0xdd7598b8bcb81590, 0x428900f71b720efb },
+  { 0xdd7884b4f93cab42, 0x3ac471aa1935e3df },
+  { 0xdd8a2124d4eda200, 0xdf715c698a6ea887 },
+  { 0xdd92d6ad50976f88, 0x1d86b52d38616118 },
+  { 0xdda23757407c4e21, 0x7f64962c87ad0c82 },
+  { 0xddd1efc1862cd3eb, 0x3baf4cba81ff5050 },
+  { 0xdde55d9868911407, 0xfe8b3fefef396f00 },
+  { 0xde0173ed6be9de6f, 0xd049803811e5f1a8 },
+  { 0xde07e9cb43ad8d06, 0xa35f6506e22c62e9 },
+  { 0xde1a636d098349be, 0x11bbc2d090f4e9cf },
+  { 0xde1e9fb700baf8d2, 0xe5ae242bffe2dbda },
+  { 0xde24f700fd28d5b8, 0x381de13abd091db9 },
+  { 0xde29e46dbea003c3, 0xc09c892d668b9413 },
+  { 0xde3d0e37729d85af, 0xcb25a8d052a6e236 },
+  { 0xde4436eaa41e5d7b, 0x7609512632b90078 },
+  { 0xde5aab22e5aba5ed, 0xcb29a3e7491ff319 },
+  { 0xde61a0b171e909a5, 0xa4cfcf81d146dbcb },
+  { 0xde62f8a30298e232, 0x5249fe112ecb5c10 },
+  { 0xde78b3a064d37439, 0x0ac0710f95edde92 },
+  { 0xde7a64108074098b, 0xa333cc0c70eef18a },
+  { 0xde7bca4e569ad9d3, 0xfd08ff1395e53d2d },
+  { 0xde8443ff47283e7b, 0x274a7838cb071fb6 },
+  { 0xdea0ade296f7093e, 0x71185e802b500db8 },
+  { 0xdeb39482e77f984d, 0x4ce73be9fd8adabd },
+  { 0xded26e1cb17f875a, 0x9c17515c900f9933 },
+  { 0xdf12953b919844da, 0xd2070ed2e70c9fa2 },
+  { 0xdf2745d585238780, 0x101df812d00b49f4 },
+  { 0xdf3e6a9b6927cf59, 0xb7afb626f6fd7eea },
+  { 0xdf40af244a8d68b4, 0x92bfba9e97dea4d6 },
+  { 0xdf5cc5cccdc140eb, 0x7107f5b8adfacda1 },
+  { 0xdf62a658496ac98a, 0x3aa4a6ee5719c251 },
+  { 0xdf6a28a89600affe, 0x36d94394ef597214 },
+  { 0xdf6a46714960a3e3, 0x9b57b3c3983801b5 },
+  { 0xdf753cb87d3af4d0, 0x3f694ab848638108 },
+  { 0xdf91277a3569344b, 0x89e6e8bd5bebc8d1 },
+  { 0xdf9384d371588cd0, 0x400b29b03350eb62 },
+  { 0xdf95e4af466c8096, 0x19299f49ece92365 },
+  { 0xdfad86dd85a11c80, 0x259f3ddb6151f48f },
+  { 0xdfafa3fa58f5cc3f, 0x0342cca475df6095 },
+  { 0xdfc03ef371cf5163, 0xf54c50d8ee73c8cf },
+  { 0xdfc3dbbb39f05d7d, 0xd8ee3ac987478970 },
+  { 0xdfcdd6f593bb7b05, 0xdbc2e8e1fc6ee0de },
+  { 0xdfe034297200dff6, 0x72df9533ed1449a9 },
+  { 0xdfe6aa7443bb813c, 0xefa35a4cf4887422 },
+  { 0xdfe885fb877a0f8f, 0xa604b7d99a6deaad },
+  { 0xdff33523ccd2fdc8, 0x912e84cab8e0d982 },
+  { 0xe01e00504e6d4b88, 0xfa743c0bbe8a96e5 },
+  { 0xe020f612255e266a, 0x8a6a9795a4df0c0f },
+  { 0xe02156294393818f, 0xf872d4314fc2f38e },
+  { 0xe0221c95aa657f57, 0x64eeeb64c8429258 },
+  { 0xe03b0b091bea5bc9, 0xd3f14ee0221e714d },
+  { 0xe040df95a055b18e, 0xbdb094e904cb71b2 },
+  { 0xe04f1c1e4401d584, 0xd3f4343410a5bcc4 },
+  { 0xe0b24c3f40a46cda, 0x52e29835ab7ad660 },
+  { 0xe0cbfc33f4926022, 0xccaf6d0d0e920a0e },
+  { 0xe0cf2dcc4c1348c4, 0x68f5bb1e421c9164 },
+  { 0xe0de3773f5b86779, 0x5db557be7b8a703e },
+  { 0xe0eff071f578ecf1, 0x9edc2ab276644e46 },
+  { 0xe1029676edb3d35b, 0x76ca943da7434da8 },
+  { 0xe10bf1af6bf3b4a2, 0x53c5bef6577fe923 },
+  { 0xe10d2c785aadb42c, 0x06390fae0d92f282 },
+  { 0xe1143b72a30d4d3f, 0xee385eec38b4aa4d },
+  { 0xe12e32dee68201b6, 0x765fcd0ed54d6646 },
+  { 0xe13818a5c0cb2f84, 0xdd84368070e9f099 },
+  { 0xe13c7627b2e136b9, 0xc449d9e8925b4547 },
+  { 0xe1486c7822c07117, 0xb4f94a32e5ed68c1 },
+  { 0xe14dc36b24fe22c0, 0x4fa076e298f2e15f },
+  { 0xe14feddeb82f5160, 0xed5cf9ca4078e58d },
+  { 0xe150f0d14f013a10, 0x4b032305c0ce23ef },
+  { 0xe15b5525cf8f7729, 0x7b322838df8d999c },
+  { 0xe171558c51bb3bac, 0x97bfa79fa2c1a19c },
+  { 0xe17699a54c90f3a5, 0x6ae4820f779f72c4 },
+  { 0xe18abe87035379c5, 0x6b435bfe8175077b },
+  { 0xe1a51690792838c5, 0xc687da80cd764d78 },
+  { 0xe1b90f1e01b1a316, 0xd7bbf141525cc00e },
+  { 0xe1d5c8213e828201, 0x28fa9c4775f1e166 },
+  { 0xe1d79e4e7c150f38, 0x61256c541ec715a1 },
+  { 0xe1e09e2f280e8e14, 0x2121a377d0dc1b46 },
+  { 0xe1efe2ef7664bb67, 0x58b1a22ff8ea16a1 },
+  { 0xe1f88da6da8a7d52, 0x1ca1dcbf2bc6978b },
+  { 0xe21ee3541ebd2c23, 0xe817ffb449939c37 },
+  { 0xe227be19f572f690, 0x0e314213ae9a4deb },
+  { 0xe237ee91514d5ed5, 0x35c95a14fc608c11 },
+  { 0xe2389c0be5b5b84e, 0x0d3ca36ec7e67514 },
+  { 0xe24d7d879281ffec, 0x0641e9c3f52e505a },
+  { 0xe25e173740f7ecc0, 0xe23025445c4591f3 },
+  { 0xe275cbe7d4e11e62, 0xc3bfcfb38fca3d49 },
+  { 0xe27d518993b0a010, 0xf16e92b971ecdcdd },
+  { 0xe28113d10c0c14cc, 0x3b5f430b0d142fcb },
+  { 0xe2846af3e4d172b2, 0x51ab77cbdd01761e },
+  { 0xe2904748da63dfef, 0xc8816652b924b642 },
+  { 0xe2b36d0781d5a5be, 0x64dad87fe20e0de3 },
+  { 0xe2b682f6e6d76b35, 0xc180c7d847e93b4f },
+  { 0xe2c1b60eaa8eda13, 0x1632d73e4e0c146b },
+  { 0xe2c89f270f72cd25, 0x6ed667507fa038a2 },
+  { 0xe2ca84a2bb63d1a2, 0x10ebb659929747a9 },
+  { 0xe2eccbbe963f80f2, 0x91cb1f18803bf557 },
+  { 0xe30f3a37032da52d, 0x7815b5a409f6d4b4 },
+  { 0xe313e8f1d19b433e, 0xc37e586b918f4df8 },
+  { 0xe314b42761cd13c0, 0x3def744b4afc7b1b },
+  { 0xe34c236630c94508, 0x9fcdef088c4b6e06 },
+  { 0xe3533684a7ef930a, 0x7fbd0c4dd8ec4847 },
+  { 0xe3600be9eb98146a, 0xdafdc12d91323d0f },
+  { 0xe363e467f605537f, 0x3777ad33e74e113a },
+  { 0xe377c3af4f54a51b, 0x85efe37d4b7029e6 },
+  { 0xe37c8055d70979af, 0x354251ebe9f1b7dd },
+  { 0xe38dc1f81a02e325, 0x562cd285123f579b },
+  { 0xe39843c56b7a4a08, 0xb18fa7949ec3ee6b },
+  { 0xe39a13b13dc82c5f, 0xdbfbbfd55ba1230e },
+  { 0xe3c0451d29dad724, 0x231bc5818ec4bae0 },
+  { 0xe3c35eac23453739, 0x6a865d23bafb1c84 },
+  { 0xe3ed4ba336175697, 0x0f076e46e9cad1d2 },
+  { 0xe40a818dac4dd851, 0xf3b4aafbe2f1e0c1 },
+  { 0xe42b937c30c61724, 0x1ca9e01e4510c3f6 },
+  { 0xe434c0e161dd3c3f, 0xb435eb6bad2e182c },
+  { 0xe48d3a4056ede939, 0x3586421996db1ae8 },
+  { 0xe49ac0ec879a0d78, 0x20bc2598fc2cfcd4 },
+  { 0xe4a0b28befaaa291, 0x5df1fa01238b1e29 },
+  { 0xe4afe157c09962cf, 0x39cdb25845d83d47 },
+  { 0xe4b12deaafd1dbf5, 0xac31afe4b8e9c233 },
+  { 0xe4bff1d5df70163c, 0x0428a1ead309c22d },
+  { 0xe4c00beb17fdc588, 0x1757855f2838c816 },
+  { 0xe4c2077a18e3c27f, 0x4819aa7757903aa0 },
+  { 0xe4c666ca0c36928b, 0x95b13d33474dbb44 },
+  { 0xe4d41f2d59a56a9d, 0x917038682b8e0b8c },
+  { 0xe4e9125a87419775, 0x83776729359614e1 },
+  { 0xe4f05d50e3042bc5, 0x12f7ff459ade59bb },
+  { 0xe4fa739c81b003c9, 0x2bea7da5e84c7feb },
+  { 0xe505bd8e59e31aae, 0xd20718d47b15c61b },
+  { 0xe51030251e440cff, 0xaab1ac63438b44ae },
+  { 0xe51c23389e43ab32, 0x8ccfb05be7d451da },
+  { 0xe5359cbbbff9c6d7, 0xfe8aeff5fb471b46 },
+  { 0xe549f1178e038fa8, 0x8dc6d657dc441146 },
+  { 0xe556e07cc06c803f, 0x2955986f53ef63ed },
+  { 0xe558be88eef569f3, 0x3716e8e330d2f5bc },
+  { 0xe56da674188ba2f0, 0x2c7a0a343a01236f },
+  { 0xe59d022d524d05ac, 0xc19515598c831e4d },
+  { 0xe5a6e0bb7d56e2f0, 0x8b237e15076e5699 },
+  { 0xe5bacf526036d3c8, 0xc99db5b030cf00e7 },
+  { 0xe5d5085123a98c1e, 0x61818caa2971e999 },
+  { 0xe5d72ff8bab4450b, 0xe57785cc9e83f3c0 },
+  { 0xe5ecd78edd24326a, 0x968809decbc7b916 },
+  { 0xe5f17b3e62a21d0d, 0xf1ca9aee1aa8c7c5 },
+  { 0xe5f360226dc552ab, 0xa3e7e9b202330f48 },
+  { 0xe5f84930aa468db3, 0x3c0d0f7b26dd8293 },
+  { 0xe5fcc62e1d73706b, 0xe7b895e887e90f84 },
+  { 0xe600f5e98a20fafa, 0x47676198efe6834d },
+  { 0xe609e8a007127b8f, 0xcff79ffc380da6b1 },
+  { 0xe61210293b14c9c4, 0xecc91705072c6a7e },
+  { 0xe62e60a3e6cb5563, 0xf72982fcd83de25a },
+  { 0xe63a87c231ee9a50, 0x6f9599aa4ef7dfb9 },
+  { 0xe63efdfda9a4003d, 0xcd77a854a781a06a },
+  { 0xe643aaec9a9e1c8a, 0xb7fe1eae90bc77d7 },
+  { 0xe64a800881232785, 0x3877a37befeb6465 },
+  { 0xe6508b878145187b, 0x87b9cded097293e7 },
+  { 0xe66e5af5dea661d5, 0x8420088368e4ef0d },
+  { 0xe67b0ed32fd9d28d, 0x12ab3775d52e8c3a },
+  { 0xe68e28752d3c54ed, 0xd3ccda42c27e320c },
+  { 0xe6d5948f451a2499, 0x4dfaaca51dfdb4e1 },
+  { 0xe6de4ef9ab62e219, 0x6962aa6b0dedac59 },
+  { 0xe6e5bb0e4f4350da, 0x573023256268313d },
+  { 0xe6f49a1053c79211, 0xf82be4d90dc9fe3d },
+  { 0xe723ad8f406cb258, 0xb89681ef4cef0eff },
+  { 0xe72eb8d4410152bd, 0xcb69e7fba327b420 },
+  { 0xe72ee2d6e501f07e, 0xc5e8a0efbe520bee },
+  { 0xe73838c43040bcbc, 0x83e4204a3e72eef4 },
+  { 0xe74022cfe31ec890, 0x8844718dfbdedf7a },
+  { 0xe77ec259e1387bc3, 0x08b0534647a89198 },
+  { 0xe77f332b71f13884, 0xc84771e7a121182d },
+  { 0xe784a9d26707cfcd, 0x170a4c1c60422a72 },
+  { 0xe7864caaf9ec49ed, 0x67b1904ce8602690 },
+  { 0xe7a758bb0b43d0f7, 0x004e92b9abf4bc83 },
+  { 0xe7dd8c2e6c100044, 0x002c1086d02b366e },
+  { 0xe7f005ddb6902c64, 0x8de098511f6ae2e5 },
+  { 0xe800e4aec7c6c54c, 0x9cf3db0d1d030058 },
+  { 0xe80a4026d29777c3, 0xc7993fbfaee8920f },
+  { 0xe823b13751e4388f, 0x1f2a375d3560a8d7 },
+  { 0xe879b7093ac4cfad, 0x74c88d636ca97d00 },
+  { 0xe88340f5bd2f03e2, 0xe9ce5ecfa9c644f5 },
+  { 0xe88b0962a1c951e0, 0x2f3fa2b8038b9d02 },
+  { 0xe8a3473bf786cf79, 0x6d1336d2d03a0008 },
+  { 0xe8aa36e3d49e9bfa, 0x654c25dcc19c74e6 },
+  { 0xe8e7b9bdf4bf0493, 0x0c2bcaa0278ee637 },
+  { 0xe8f7679359c4f532, 0xf5d5e93af7d8a985 },
+  { 0xe9034b41741dcee6, 0x4ab6605aba9de455 },
+  { 0xe908611d99890733, 0xbe31733a979c62d8 },
+  { 0xe91d2ecf8803ae52, 0xb55bbf105af04d4b },
+  { 0xe923001015bedd79, 0x01569f035d9c592c },
+  { 0xe927ecf80f3784d7, 0x45abd8368d78f2f3 },
+  { 0xe932f44fad2a66b6, 0xd5faec9addec208e },
+  { 0xe94632b0d863dd76, 0x459d689a9865bb33 },
+  { 0xe957eb4612d6bd59, 0x40d3492dfa749668 },
+  { 0xe959b5a2c882ccaa, 0xcb43c32790957c2d },
+  { 0xe97eafd0635651d3, 0x999cece953c06bd5 },
+  { 0xe9be3e8e4a7e73dd, 0x63ed4235a3a1a25f },
+  { 0xe9c5d04643855949, 0xa23ff29349af74ea },
+  { 0xe9c71f8cdba60375, 0x21c9a3c70819d171 },
+  { 0xe9cb18770a41a16d, 0xe63b124c1e8bd493 },
+  { 0xe9db2f91efe6ff7e, 0xa3546e2c2578fb09 },
+  { 0xe9e646f730b8400c, 0xd5da08c849ef3e3b },
+  { 0xe9e6ad30549a6e2c, 0xd89fe93b7691d447 },
+  { 0xe9f25c7af4f27c9e, 0x1b5b8f6fe6141e8c },
+  { 0xea38fcfc06ad87a0, 0xaed1a3d1588744e4 },
+  { 0xea6d40db5498d638, 0x6571a76df448aa4c },
+  { 0xea7e25ade3fe68f5, 0xb786ee0aa82b1fe5 },
+  { 0xea832e2cb6aae6f5, 0x25f07452c381fa48 },
+  { 0xea86176b27ab0da8, 0xcce8f0179884bfaa },
+  { 0xeaacfcdc1d4ee125, 0x8429b7ae7f084125 },
+  { 0xead60451c28635b5, 0x5ca8fea198444e16 },
+  { 0xeada0dd61ce13f83, 0x17de774dc1e68604 },
+  { 0xeae0c06ee61c63b8, 0x1cd016096fc901b0 },
+  { 0xeae6a5510055341d, 0x3abeb45667bb3e9b },
+  { 0xeaf744185d5e8def, 0x899950ba7c6e7bb5 },
+  { 0xeafe8b40313a6579, 0x2e88ff9f2fe2655c },
+  { 0xeb3d680699f8762f, 0x71f38e28e321234d },
+  { 0xeb4252faff7a4f2b, 0xa5284a98b8f78d1a },
+  { 0xeb46e99ec15858f8, 0xcd8c91cef384ce09 },
+  { 0xeb503cc64c3560cd, 0x78b7051188b7ba56 },
+  { 0xeb634650c3912132, 0x092b7aee540bbce3 },
+  { 0xeb6d6e22a16f3068, 0x7ade526d7a6f05c5 },
+  { 0xeb71743c6c7ccce5, 0xb108fad70a326ad9 },
+  { 0xeb7934360658a29c, 0x50aeaff20bfda23b },
+  { 0xeb92193f06b645df, 0x0b2a15d077ce435f },
+  { 0xeb9712e423b57f0b, 0x07ccd315bb9abf61 },
+  { 0xeb9f8b84c193d9d9, 0x3a58fca112aa39ed },
+  { 0xebcb084a91d41865, 0xb2c1915779001ca7 },
+  { 0xebcbc8a181a738e1, 0x3df6216e5c329230 },
+  { 0xebd2488dcace4047, 0x4c1a78fa53ebfadf },
+  { 0xebdc5716b85c4ff4, 0x4fa357cb697d6cef },
+  { 0xebf2dff78a087332, 0x51bf3838f02f7938 },
+  { 0xebf9038e927e6a0d, 0xb3e0d170c59911e6 },
+  { 0xec3beb6d8b5689e8, 0x67bafb5d5f507491 },
+  { 0xec407a206b718a0a, 0x9f69b03e920a0185 },
+  { 0xec44dcf2ddb43199, 0x62fc43b725a902e8 },
+  { 0xec5c861b487a5075, 0x876ab01155e74c6c },
+  { 0xecd78ba4a9441866, 0xe7be2abd6aaef662 },
+  { 0xece463abde92e8b8, 0x9bcd867ec71751b8 },
+  { 0xece908d77ab944f7, 0xbac84322b9973549 },
+  { 0xecf51385384b4688, 0x34611d44a8429c03 },
+  { 0xecfa04523dde82fe, 0x42cdc7315a8f61b6 },
+  { 0xed014beeeb77dbb2, 0xbbcf9b5f6850b2f4 },
+  { 0xed0451010d022b96, 0xa464febcba70b9c4 },
+  { 0xed0ab909cf7b30af, 0xf6fc28c3a4660b8e },
+  { 0xed1306436ce237af, 0xc5a7ed3f77134202 },
+  { 0xed1492d4cafd7ebf, 0x064f0c933249f5b0 },
+  { 0xed1a784875538c78, 0x71d035b7a98c2433 },
+  { 0xed2218b3075d15ea, 0xa34e3356025ccca3 },
+  { 0xed5ccfc93ad45610, 0x75436ee42a15438a },
+  { 0xed637054c93e82e4, 0x36618bcc687e8777 },
+  { 0xed8f319e82d35583, 0x2195eb7715644795 },
+  { 0xeddef10fdc002930, 0x1064115ae0cd41d4 },
+  { 0xede4ab11ca346bd0, 0x23b2c21d941e0c50 },
+  { 0xede7e8bf865b0afb, 0x4744f86d13624f9a },
+  { 0xedf69b123e06eaf8, 0x663cc78d8aeba06e },
+  { 0xee28424af389a7f3, 0x672182009472500c },
+  { 0xee456542b93fa8d7, 0xe6a8c689b5a0413c },
+  { 0xee4c186123d31a27, 0x9ed7a84d3578df23 },
+  { 0xee659ae50e9df886, 0xac4f8d7ad10d046a },
+  { 0xee6665683ebdb539, 0xe89ba620981cb0f6 },
+  { 0xee67dc0b01746372, 0xd2b983d88f48e24f },
+  { 0xee681f566aad6c07, 0xc61bbbfc66d74a27 },
+  { 0xee6cbedf6c0aac90, 0xfaa0a8dbc093ffbe },
+  { 0xee8027d554d14c8d, 0x0b86f94737d2fdcc },
+  { 0xee84bdc5dae268e2, 0x27e407c7b5e6b6b7 },
+  { 0xee9caee4eb958284, 0xfb10c277b14537f1 },
+  { 0xeea0da9b987d6612, 0x64cce69a7c13c3bd },
+  { 0xeeb92f3f46df8414, 0x87d1504f2896d61a },
+  { 0xeec61cc4250df709, 0x39d48fe02d7122ac },
+  { 0xeed9eaf1a0b6a2b9, 0xbc4c8032cb43e3fb },
+  { 0xeee7695ae3eea781, 0x8321df0b790b31f3 },
+  { 0xef263d40a23483ab, 0x339cac44d9515a56 },
+  { 0xef3a4f64b6494ba7, 0x70862768caf04b86 },
+  { 0xef60b06fddb675b0, 0xd783afbfa5fc5232 },
+  { 0xef66af1908408714, 0x09fe1702d2483554 },
+  { 0xef71e9fb0d8d4772, 0x26d8d42261fbf0a7 },
+  { 0xef76ea05655a0b62, 0xcb1018c92b9b4b7d },
+  { 0xefa1098c7d091b94, 0x0c2543abe372f036 },
+  { 0xefb47d70b2965ce6, 0x89e2c5757616b286 },
+  { 0xefd387430a35a659, 0xff569a9a0ec22209 },
+  { 0xefefc02bbc525881, 0x5457f7a5b8d8750a },
+  { 0xeffa3a7ce078c6d8, 0x3bf43174a7bfdb1f },
+  { 0xefffafc17b7cb01b, 0x9ca35324aa767364 },
+  { 0xf02ba8b5292bf301, 0x7d10553c9b7b2861 },
+  { 0xf032b2f2d8323404, 0xa6b4541f92dd1825 },
+  { 0xf047df70d3d08e33, 0x1122cd2de61d6af8 },
+  { 0xf04ee80011d95798, 0x006378643650aaa7 },
+  { 0xf0510abbfbe24ead, 0x552e92e3841f63f3 },
+  { 0xf0536303f4900680, 0x6bac3aec15738336 },
+  { 0xf0541d2f7cda5ec7, 0xbab6d62b6128b823 },
+  { 0xf060826626aac9e0, 0xd8cda0282f4b7fc3 },
+  { 0xf0631c6675033428, 0x238408885d7e4fde },
+  { 0xf066bea7ab0a37b8, 0x3c83c924a87c5b67 },
+  { 0xf0a6e99f58758912, 0x46c3dbecbf2d2cea },
+  { 0xf0b7db930ca0e548, 0xc41a97160b9f6275 },
+  { 0xf0cacae1d1b79ee9, 0x2f0dc035f42e0560 },
+  { 0xf0d393dbf4164a68, 0x8b2346770c9bbd12 },
+  { 0xf0daaa966199ef2b, 0x49403e9a29d12c50 },
+  { 0xf0de4f49e95d5295, 0x69e8788d5a7b4d30 },
+  { 0xf0e0addc07971561, 0xab80d9abe1b8d333 },
+  { 0xf0ef9a1e5d4027a1, 0x57636d7f19952bb5 },
+  { 0xf10e3f45fb01416c, 0x87e5835ab270b53a },
+  { 0xf1127ade54037236, 0xe75a133b1dfc389d },
+  { 0xf11cfab087fcbd93, 0x0ab8b0becc5b2e5a },
+  { 0xf12afbffa080dd3b, 0x2801dd14d4837cf6 },
+  { 0xf137211537438b1f, 0xce3d811baef25457 },
+  { 0xf1489e27a4539a0c, 0x6c8529262f9f7e18 },
+  { 0xf14d5e96ec3380ae, 0xf57a4b70132c6677 },
+  { 0xf1554569321dc933, 0xc87981cf5c239c43 },
+  { 0xf16c709df0a6c52f, 0x47ff52b9d95b7d8d },
+  { 0xf16ef574d2042ed8, 0xfe877d6541f4dba4 },
+  { 0xf1929bb9b5db22d9, 0x8dd992aa3fe72920 },
+  { 0xf19aba18f86e4158, 0x12480ad2be221425 },
+  { 0xf1a0a23e6464d954, 0xe3a9579c4ccd01c8 },
+  { 0xf1ae6305fa33a948, 0xe36deb0ef12af852 },
+  { 0xf1b2ea568b3e156e, 0x3f2849dac83591f6 },
+  { 0xf1b7edff81ceef5a, 0xf7ae1fa76c8590fc },
+  { 0xf1beca5a198cf081, 0x90487e5c27b8e540 },
+  { 0xf1e375d921858467, 0x166e53bcec05803f },
+  { 0xf1eeeccc4bba6999, 0x345a2575ae96508e },
+  { 0xf1fe06ebe2900eac, 0x4cdd17799389a102 },
+  { 0xf20675c8b9851836, 0x7b9f5b8ee6f7c8ea },
+  { 0xf20bd756f3990e06, 0xc492f53cd0168e68 },
+  { 0xf21813aa050437f0, 0xdbc8479864acec6d },
+  { 0xf23d19b73dac50cc, 0x6149316912b8ee53 },
+  { 0xf240ba9f8092d2e8, 0xa4c7d82c554bf509 },
+  { 0xf280976d69d6e27a, 0x48506bd6bad11dcd },
+  { 0xf283cc294ece520c, 0x2badf9da20cfc025 },
+  { 0xf28c07767b3e90a2, 0x689ade5b5e305874 },
+  { 0xf2d40c70cf3e1d03, 0xbc112796315888d9 },
+  { 0xf2d4d6187903cac2, 0xd5ea8ed90dad120d },
+  { 0xf2e4fb2d3600c0f7, 0x6d05864e658cc57b },
+  { 0xf2f2cb35fdef063c, 0x966c1f5481050ea2 },
+  { 0xf2f59629d7341c97, 0x644405daeac08845 },
+  { 0xf303630a2d731678, 0x7aecd67fff6b2e33 },
+  { 0xf3213a8a702b0646, 0xd2eaf9ee0722b51c },
+  { 0xf33f1d0f7819c741, 0x48dacb48cbf1c597 },
+  { 0xf344ac1279152157, 0xd63e64aa39479599 },
+  { 0xf34dd3b8156aaf11, 0x3cb621b2e51d90b8 },
+  { 0xf34f08e5eb96e500, 0xe851a80be3277a56 },
+  { 0xf367e58667a30e74, 0x82175809e3cec4d4 },
+  { 0xf38358cd8f5ecfed, 0xffd5aca1aa939f18 },
+  { 0xf39e4bc99845edd8, 0x621b0f3c7b8c4fd9 },
+  { 0xf3c431930e035a45, 0x7fe370ed4d230659 },
+  { 0xf3cd0f886201d137, 0x6f3abab2df53b1b9 },
+  { 0xf3dfae774f3bd005, 0xa026e29894db40d3 },
+  { 0xf3f5f72bfdd67f3d, 0x0e45d097e11b8091 },
+  { 0xf3f92aad3a335f0a, 0x1ead24a0214ff446 },
+  { 0xf40e437a9ebf0bdf, 0xe26204152f74f868 },
+  { 0xf4204fc92d17ed4c, 0xb567c40361ad58f1 },
+  { 0xf4469178cd8998cb, 0x437fa110a228eaca },
+  { 0xf45644ff82b533a7, 0x81a1ee50f2e95f3c },
+  { 0xf457674cef449cfd, 0x85f21db2b4f631a7 },
+  { 0xf473f99e47d4026a, 0x7a571184922ebf04 },
+  { 0xf48022230bb774a7, 0xf22184b48a3385af },
+  { 0xf48735115ec302ba, 0x8bb2d2f3a442e814 },
+  { 0xf49a34f1fdd7dc14, 0x7cbf96ce2ce71b76 },
+  { 0xf4a09f906cc37be3, 0x1224433f576d77d3 },
+  { 0xf4ab6bd5f80d8988, 0x141edde4c84b23b5 },
+  { 0xf4b8a47a95b61895, 0xe671c3ec86ffd461 },
+  { 0xf4c2e50b01dff99b, 0xddbe037b3489511c },
+  { 0xf4c6621f1a0b4d27, 0x081123c08d7d1497 },
+  { 0xf4cf6881b65c4240, 0x95dc25dc987f151f },
+  { 0xf4dabd5bcc603e84, 0x64a478208037d423 },
+  { 0xf526d0c519f5001a, 0xdb1fc7948bfbb3ce },
+  { 0xf52f40299fd238c6, 0xffd9e6107050dc76 },
+  { 0xf539e32bf6ce39c8, 0xca47cb0cdd2c5cb8 },
+  { 0xf542b5d0193a3959, 0xb54f3c4c803ba242 },
+  { 0xf5445b52999e229e, 0x3789c39e7ee99947 },
+  { 0xf5a2f6efa33a3e55, 0x41bc680e9dc31d5b },
+  { 0xf5a3e051730d45fe, 0xa518f2e8b926565b },
+  { 0xf5aa6bd10f662199, 0xc42e43863a30106c },
+  { 0xf5d103a9ae36d1d4, 0xee7eef657b75d2b3 },
+  { 0xf610d2bc17283d80, 0x64f7389fdf2ce8d4 },
+  { 0xf613aad84d2163d6, 0xb197b220bfec1b7e },
+  { 0xf661f129644f338b, 0x13d9f4510d816c03 },
+  { 0xf6676e3fe901eb85, 0x15fc7ae310302c3c },
+  { 0xf67181b3a01b9c91, 0x59840b15449b87b0 },
+  { 0xf687ec4b69611a7f, 0x78bd69b8a567937a },
+  { 0xf69a39b215852a0c, 0x2764d2a923c1e463 },
+  { 0xf69bb58b815a6bdc, 0xa548fa4d5e0d5a75 },
+  { 0xf69d4fcf76942fcd, 0x9bdf3fd8fde790fb },
+  { 0xf6a282374441012b, 0x01714e19699fc62a },
+  { 0xf6a9ea814d15b85b, 0xffe980c927df606b },
+  { 0xf6b5ebb65cbb2981, 0xaf4d546c470629d7 },
+  { 0xf6c13e816e58c8c6, 0x2f82b2c8b91a2d67 },
+  { 0xf6d512bef1bf253d, 0xc935d0e13c3d1462 },
+  { 0xf6daebc0424fa0f8, 0xd9aaf26c86df50f4 },
+  { 0xf6efa00ae99aaf33, 0xe427b674bcfd834d },
+  { 0xf6f1b27efc247a0e, 0x8d473ddb4269ff9e },
+  { 0xf7048fa1f9636012, 0x3ddae93cb3600ea2 },
+  { 0xf70e3f3bb2d19ec2, 0xaaec8f78dc43744f },
+  { 0xf714a223954c28ec, 0xcf459295517dcae6 },
+  { 0xf7154add27b95cd9, 0x0464dbed8cfd7557 },
+  { 0xf724d3dd2471ed4c, 0xf5f191dbb724b69f },
+  { 0xf72d7b54973203ca, 0xfabc619582147ed8 },
+  { 0xf736864442164b29, 0x235e8872013180cd },
+  { 0xf73d2d0eff548e8f, 0xc66996f27acf2b4b },
+  { 0xf7424985bac41067, 0x502b4a05b64cb75a },
+  { 0xf74ad642552385c3, 0xdaa203a2a6fc2291 },
+  { 0xf750b5d613796963, 0xacecab1690f554ae },
+  { 0xf75872946e82ad74, 0xd48eae5bc28f5f0e },
+  { 0xf777444fc21a5925, 0xe066b68b1d350575 },
+  { 0xf77f5fc3893da5d0, 0x0198e4cd96544aad },
+  { 0xf7856e324bc56f45, 0xb9c8e6ff062ec033 },
+  { 0xf78c125b5da483c4, 0x1e51522947d6c4ce },
+  { 0xf7a138eed69665b5, 0xcd1bfa796a550b01 },
+  { 0xf7a651972d78f9ba, 0x485b14690452d4be },
+  { 0xf7af41a87533524d, 0x9a478575b0d873d0 },
+  { 0xf7d6592dcb773c81, 0xc278140ed4d01669 },
+  { 0xf7e07080ed8396b6, 0x8f2e5788a5c245e2 },
+  { 0xf7e92eccb2bb0fc3, 0x07f984b4f29ce6df },
+  { 0xf7ec2f2bdbe8fbea, 0x048c0d5fa6503b0b },
+  { 0xf7f50d9c9d28bcc9, 0xf7d3075668b7ac89 },
+  { 0xf7fac15cf54b55c5, 0x597718b6742dbec2 },
+  { 0xf802fa61011dd9eb, 0x6f80b271bac479d0 },
+  { 0xf80cf77164079d77, 0x4b9b0fae33dffca9 },
+  { 0xf8240e62d8c0a64a, 0x61e19388414e3104 },
+  { 0xf825c538481f9a7a, 0x46d1e9bc06200aaf },
+  { 0xf844f4c6f3baaaf5, 0x322657442d6f29eb },
+  { 0xf847fb8dba6c6d66, 0xd13724dbe5d95c4d },
+  { 0xf8582bc6ca7046ad, 0xb8e18164e8cecdbc },
+  { 0xf8648d0c6ad12664, 0x34f6c485ff69ec40 },
+  { 0xf8811d45a9935cca, 0x90c62f924712f8e6 },
+  { 0xf8b2a6a4d73ebff1, 0x0d805a9b59041986 },
+  { 0xf8bfd99163d2c4ec, 0x688357786e6fba28 },
+  { 0xf8c1c4a41303bd40, 0xb0d6c81bfaf8573b },
+  { 0xf8fbe2b07345086f, 0xc867bceeaf38dc48 },
+  { 0xf8ff34b53d86f55b, 0xd52d7a520af6d1dc },
+  { 0xf90b5da189f24d7e, 0x1a2117d8c8abc952 },
+  { 0xf91fb8da3223b79f, 0x1c9a07b77ebfa0b2 },
+  { 0xf93d7fee92717e16, 0x1e6763a88a293ffa },
+  { 0xf9420173efcb4b9f, 0x2b01c2a7b595cca7 },
+  { 0xf954381f9e0f2009, 0xd1ac40dedd777b1a },
+  { 0xf9655ed51462ecfc, 0x690c7b97cec649f9 },
+  { 0xf965cc981cbb0822, 0xf955641f8d84e774 },
+  { 0xf9660ebed66fee8b, 0xdfdf07b4faa22941 },
+  { 0xf9677b2ec8728a70, 0x3eb710274474613d },
+  { 0xf979543df0113fb4, 0x9571dfac8b78b694 },
+  { 0xf97dee1aa2629911, 0xf30f225ca31789d4 },
+  { 0xf98d2276d4a25b28, 0x6135566255aea9d0 },
+  { 0xf98d869f287d2ce4, 0xf8fb36e0686929d9 },
+  { 0xf991e0670b5f67fa, 0xa6b6211e9bd81b91 },
+  { 0xf992a39b46aa4818, 0x8fab12ad3809ae4a },
+  { 0xf9967369943209b4, 0x788d4e92cefc0795 },
+  { 0xf9cef637ea8e905a, 0x10e324e582dd39c2 },
+  { 0xf9d51a4e5f8b48f6, 0x8770c89ffd495ed1 },
+  { 0xf9da42f91a1c5cfa, 0x344d2ff440c6f8d4 },
+  { 0xf9de91d868d6ebfb, 0x0076af9063d7195e },
+  { 0xf9e99596345a8435, 0x8bc5d1fbe877134b },
+  { 0xfa0570561aa80896, 0xf0ead05c46351389 },
+  { 0xfa1b060fd8e0bca0, 0xc2a097dcffce93d3 },
+  { 0xfa2be8125c3c60ab, 0x83e1c0fe56922fcb },
+  { 0xfa3de71841c0841d, 0xb6a741884a6b6b2f },
+  { 0xfa4404fabc094e3a, 0x31fcd7b559cdd029 },
+  { 0xfa529ec88eca679f, 0x6d5fd0ccb2120e46 },
+  { 0xfa6fe97a10efb9e7, 0x4c0b5a816e6e1958 },
+  { 0xfa7ce62e7fd77e02, 0xb3e2198d70742f80 },
+  { 0xfa7e11a3dbea4365, 0x975cd2f094e61d25 },
+  { 0xfa98d48cd609c9ba, 0xbc819e0a1bd8d598 },
+  { 0xfab7b04b9f42df76, 0x1eb6f2bc445eaa99 },
+  { 0xfabca526d57de467, 0x68b392f758f1a008 },
+  { 0xfac28963307b6e85, 0x082ccd77c88325e7 },
+  { 0xfadb89f9b23beb4d, 0x43a7895c532757e2 },
+  { 0xfae0b86934a7c5a3, 0x62281dffebdb43a0 },
+  { 0xfaebcb2ef1f3831b, 0x2fc1dbd39d36517c },
+  { 0xfaed2ef6b44894f8, 0xc83f2b50891c35c6 },
+  { 0xfaffd84f3a8eceee, 0x2fa5ea5b0a3e6678 },
+  { 0xfb09ee4ccd47ae74, 0xa3c314f0d8a40344 },
+  { 0xfb0c32ef7af5b454, 0x86db663510094be8 },
+  { 0xfb0e84cee4c108d2, 0x4253bcb7e382cffd },
+  { 0xfb27afe896e7c928, 0x089307b32e5642ee },
+  { 0xfb4ca865abc02d66, 0xe39651bd9ade140a },
+  { 0xfb531febf8e15532, 0x8ec0cd39ef77a122 },
+  { 0xfb5c8af97bd8ffe8, 0x8323656f462645a7 },
+  { 0xfb833ed50c865a9a, 0x505a125fc9d79a7e },
+  { 0xfb884ffd89013331, 0xa6f01ae3f6abd214 },
+  { 0xfb88baa01afd34e0, 0xe4b601e1d29bc806 },
+  { 0xfb88c400d602fe75, 0x9ae74ef1716ee84e },
+  { 0xfb91da78455d9b16, 0x06913fbf8c859772 },
+  { 0xfb91dfc36cddaa54, 0xb09924ae8fd96199 },
+  { 0xfb978f1c053e8061, 0xcc37a726639f43f7 },
+  { 0xfbac6476e7b2b20d, 0x246202af81662c88 },
+  { 0xfbb0151ea2108e33, 0xb2dbaae14a1831dd },
+  { 0xfbb4f3debf48dc96, 0x1b559384467f2057 },
+  { 0xfbe554aa8f759226, 0xd251ba6b64a9cce4 },
+  { 0xfbfebee9c1469471, 0x9e3eda4854dc42ee },
+  { 0xfc2104dd2dadf9a6, 0x176c1c1c8f87ced9 },
+  { 0xfc2233fc116faef0, 0xd3c31541717ca2db },
+  { 0xfc24a94d4371c69b, 0xc58f5245ada43c44 },
+  { 0xfc6052438f339aea, 0x373bbc999433388a },
+  { 0xfc668a2251dd79cb, 0xd903d4fa0e558f96 },
+  { 0xfc6999c4897af166, 0xa2a8d109306650ee },
+  { 0xfc69ca9c6cf18ec0, 0x03bba9ce9751a77b },
+  { 0xfc92d74f073a44bc, 0x6e46a3b3fa8256a2 },
+  { 0xfc9c1652fe3a2cad, 0xe6188f4d3692481f },
+  { 0xfca4a5be12519270, 0x27f2c24774a02160 },
+  { 0xfcbbd0a407d3ff7b, 0xf857b8a399280ea1 },
+  { 0xfcbdf405f0fc2027, 0xb0ea45bb5af94c1a },
+  { 0xfcea12625c071ddc, 0x49f4e409f4038c60 },
+  { 0xfcf8e306f6615f74, 0xfeba5cb25550038c },
+  { 0xfd0e5148162e8ec6, 0x719445d559f018a9 },
+  { 0xfd10915633aea4f9, 0xcd8b518a25d62b55 },
+  { 0xfd16949913aaab5b, 0xeaefed73bf2ca67c },
+  { 0xfd4f5536fd80f35c, 0x64d365df85873418 },
+  { 0xfd6e507b5df68bee, 0xeddeaf696b6828fa },
+  { 0xfd7464edaa8cc264, 0xb97ba0d13e7f0678 },
+  { 0xfd78f186bdff83fb, 0xad7f97cb583812fe },
+  { 0xfd8b4ee0d57605b3, 0x5e236e814f706ff1 },
+  { 0xfd9b321cee5fbb32, 0xc39ba3ca5d9ec7cf },
+  { 0xfdd4995a50395db1, 0x4f518f63c2d63438 },
+  { 0xfde42e39710e75e9, 0xe4d4d75440f8e4e5 },
+  { 0xfdf0de38517e0cf7, 0xf0885f98ccc95836 },
+  { 0xfdf6680b2b1e8054, 0x293a39700a765692 },
+  { 0xfe0b7f27e3ad50bb, 0xf9ff468ee56d553d },
+  { 0xfe0bc4bb92c1c4de, 0x7d5706aaa8d8c10d },
+  { 0xfe3b461d4c8b179f, 0xe68bc77760294c25 },
+  { 0xfe641247a4ab9bee, 0x970e19ab55f23b25 },
+  { 0xfe67087f9c22655c, 0xe519616fc6c6ef4d },
+  { 0xfe6abc0f63e31e26, 0x46c9c600926b5b7f },
+  { 0xfe870018332a0221, 0xeb59fb18b0c6bccc },
+  { 0xfe9ae625d924b54c, 0x9f8a14ac9a0f6c6d },
+  { 0xfeba8686fd037601, 0x5258d1152923958a },
+  { 0xfec0c2e2ab0588ed, 0x20c750b58cf3baa3 },
+  { 0xfece458a8023a809, 0xa5006867feca40e8 },
+  { 0xfeec54aac9118879, 0x40b47fe8c9f80b11 },
+  { 0xfeedcc20bc3ca348, 0x51cd5d9e38aa2ca6 },
+  { 0xff1523783e0e76a3, 0xb0d1f7f0d1cb3050 },
+  { 0xff3bd0c684f7144a, 0xeaa18758d8281a78 },
+  { 0xff5a9e340d96df6f, 0x5a5b6eb038e923bd },
+  { 0xff7627207e8aa037, 0x30c35c735a82c26c },
+  { 0xff7ebadfb109ef64, 0x867f860f007b9cea },
+  { 0xff8343ce12fa222a, 0x23ab13d7d733e27b },
+  { 0xff86fc8ffa717bb0, 0x95e8471638c1c31c },
+  { 0xff87d58125ae517e, 0xb7b09a0475a1ccdc },
+  { 0xffb1cd548563158c, 0xe33f9d10268187e7 },
+  { 0xffc0ff4305dd46b4, 0xb459885bd1818e2e },
+  { 0xffdc0eb3543404eb, 0x4c353fbdddfa33b6 },
+  { 0xffe51989ba6da2c6, 0xae5a12d277862e16 },
+  { 0xffebb0070689b9d3, 0x22687edd9c0a2bae }
+}};
+
+/**
+  The entries of DefProps whose MD5 starts with the 12 bit prefix 'p'
+  are found in the range [DefPropsIndex[p], DefPropsIndex[p + 1]).
+*/
+static constexpr std::array<uInt16, 4097> DefPropsIndex = {
+  0, 1, 1, 1, 1, 1, 1, 2, 3, 4, 4, 4, 5, 7, 8, 11,
+  12, 12, 12, 16, 16, 16, 16, 17, 18, 18, 18, 19, 20, 21, 21, 23,
+  24, 25, 26, 26, 26, 27, 28, 29, 31, 33, 33, 35, 36, 38, 39, 40,
+  40, 40, 40, 40, 41, 42, 42, 42, 43, 45, 46, 46, 47, 48, 48, 48,
+  50, 51, 52, 52, 53, 54, 55, 55, 56, 57, 58, 58, 59, 60, 61, 62,
+  63, 63, 64, 64, 64, 65, 65, 67, 67, 68, 68, 70, 71, 74, 75, 77,
+  78, 79, 81, 81, 81, 81, 83, 83, 84, 85, 86, 86, 88, 89, 91, 92,
+  92, 92, 93, 94, 96, 97, 99, 99, 99, 99, 101, 102, 102, 103, 103, 103,
+  107, 108, 110, 111, 113, 113, 115, 116, 116, 116, 119, 119, 121, 121, 123, 125,
+  127, 129, 129, 130, 131, 132, 133, 135, 137, 137, 137, 138, 138, 138, 138, 140,
+  141, 141, 142, 142, 142, 142, 142, 142, 142, 142, 143, 144, 145, 148, 150, 151,
+  153, 154, 157, 158, 159, 160, 162, 162, 162, 163, 163, 163, 163, 163, 163, 164,
+  167, 168, 168, 168, 170, 171, 172, 172, 175, 176, 176, 176, 177, 178, 179, 181,
+  182, 185, 186, 187, 188, 188, 189, 190, 192, 192, 193, 193, 194, 194, 196, 197,
+  198, 200, 200, 202, 202, 203, 203, 203, 205, 206, 206, 206, 206, 208, 208, 210,
+  213, 213, 214, 216, 218, 218, 218, 221, 222, 223, 224, 224, 226, 228, 229, 230,
+  230, 230, 231, 232, 234, 235, 235, 237, 238, 239, 240, 242, 242, 244, 244, 245,
+  247, 248, 249, 250, 252, 253, 253, 253, 253, 253, 253, 254, 255, 255, 255, 257,
+  259, 261, 262, 263, 263, 263, 263, 266, 267, 268, 269, 269, 270, 270, 271, 271,
+  271, 272, 272, 273, 276, 279, 282, 284, 285, 286, 286, 290, 290, 291, 293, 294,
+  294, 295, 296, 298, 299, 300, 300, 300, 300, 301, 302, 303, 304, 305, 307, 307,
+  307, 307, 309, 310, 311, 312, 313, 313, 315, 315, 316, 317, 321, 322, 323, 323,
+  324, 324, 326, 327, 328, 328, 328, 328, 328, 328, 329, 329, 330, 332, 333, 335,
+  336, 337, 339, 339, 341, 341, 343, 344, 345, 346, 346, 346, 349, 350, 351, 353,
+  353, 354, 354, 354, 355, 355, 355, 356, 356, 356, 356, 357, 362, 362, 364, 365,
+  366, 367, 370, 371, 372, 373, 373, 373, 373, 374, 376, 378, 379, 379, 381, 383,
+  384, 384, 384, 385, 385, 385, 385, 387, 387, 388, 388, 389, 389, 389, 389, 389,
+  389, 390, 391, 392, 392, 393, 394, 394, 394, 396, 396, 396, 397, 398, 398, 399,
+  401, 401, 401, 401, 402, 402, 403, 405, 405, 407, 407, 409, 409, 410, 410, 410,
+  411, 411, 412, 414, 414, 415, 416, 418, 419, 419, 419, 420, 421, 421, 421, 421,
+  421, 423, 424, 425, 426, 426, 427, 427, 428, 430, 430, 432, 432, 434, 435, 438,
+  439, 439, 439, 441, 442, 443, 445, 446, 447, 447, 447, 451, 451, 451, 451, 451,
+  451, 454, 455, 455, 458, 458, 460, 460, 460, 460, 461, 462, 462, 462, 464, 465,
+  465, 465, 468, 471, 472, 472, 472, 473, 475, 477, 477, 478, 479, 479, 481, 481,
+  481, 481, 481, 482, 483, 484, 485, 486, 487, 487, 487, 488, 489, 489, 489, 489,
+  490, 490, 491, 492, 492, 492, 495, 496, 496, 497, 497, 497, 497, 497, 498, 499,
+  500, 501, 502, 502, 505, 507, 510, 510, 512, 513, 514, 516, 518, 518, 521, 521,
+  522, 522, 524, 525, 525, 526, 526, 526, 528, 528, 528, 529, 532, 532, 533, 534,
+  537, 538, 538, 539, 539, 539, 541, 541, 541, 543, 543, 543, 544, 544, 544, 544,
+  545, 546, 548, 548, 549, 550, 550, 550, 553, 557, 557, 558, 559, 561, 561, 561,
+  562, 563, 565, 568, 570, 571, 572, 572, 572, 573, 573, 575, 575, 575, 576, 576,
+  576, 577, 580, 582, 583, 585, 586, 587, 589, 592, 593, 593, 593, 593, 594, 594,
+  594, 595, 597, 598, 600, 600, 600, 600, 600, 600, 601, 602, 604, 605, 605, 607,
+  607, 607, 608, 609, 609, 611, 611, 611, 612, 612, 612, 613, 615, 617, 617, 618,
+  619, 620, 620, 622, 624, 625, 625, 626, 626, 628, 629, 630, 631, 633, 633, 634,
+  636, 636, 640, 641, 643, 644, 644, 649, 650, 650, 652, 652, 654, 655, 655, 656,
+  657, 658, 658, 659, 660, 660, 661, 662, 663, 665, 665, 666, 666, 667, 668, 668,
+  669, 671, 673, 674, 674, 674, 674, 675, 678, 678, 678, 679, 679, 679, 679, 679,
+  679, 679, 679, 680, 681, 682, 685, 686, 686, 686, 689, 689, 689, 690, 690, 692,
+  693, 695, 695, 696, 697, 697, 698, 698, 700, 702, 703, 703, 704, 705, 707, 708,
+  710, 710, 712, 715, 715, 716, 716, 716, 720, 721, 721, 722, 722, 722, 724, 726,
+  727, 727, 729, 730, 730, 731, 733, 735, 735, 735, 736, 736, 736, 737, 738, 739,
+  739, 740, 740, 740, 741, 741, 744, 745, 745, 746, 746, 746, 747, 749, 749, 750,
+  752, 753, 755, 755, 755, 756, 757, 757, 759, 760, 760, 761, 764, 764, 764, 764,
+  765, 767, 768, 769, 770, 770, 771, 771, 772, 774, 774, 775, 776, 779, 779, 781,
+  782, 782, 782, 784, 785, 785, 787, 788, 788, 791, 791, 792, 793, 793, 793, 794,
+  796, 796, 796, 796, 796, 798, 799, 800, 800, 802, 803, 803, 804, 806, 807, 807,
+  807, 807, 808, 810, 812, 813, 813, 814, 816, 816, 816, 817, 818, 819, 821, 821,
+  822, 822, 823, 824, 825, 825, 829, 829, 830, 830, 831, 832, 833, 834, 836, 836,
+  836, 838, 839, 840, 840, 840, 841, 844, 845, 848, 851, 851, 852, 852, 852, 852,
+  852, 852, 852, 853, 854, 856, 857, 857, 860, 863, 863, 865, 866, 866, 867, 867,
+  867, 867, 868, 870, 870, 871, 871, 872, 874, 875, 877, 878, 878, 878, 878, 878,
+  879, 880, 881, 882, 883, 885, 886, 887, 888, 890, 891, 892, 894, 896, 896, 896,
+  897, 899, 899, 900, 901, 901, 904, 906, 907, 907, 910, 910, 910, 910, 912, 913,
+  914, 914, 914, 917, 917, 917, 918, 920, 921, 921, 922, 923, 925, 925, 927, 929,
+  929, 929, 929, 929, 930, 930, 932, 932, 932, 937, 938, 938, 939, 940, 940, 940,
+  941, 942, 942, 943, 944, 944, 946, 946, 947, 948, 948, 949, 952, 953, 954, 955,
+  955, 955, 956, 957, 957, 957, 958, 958, 958, 959, 959, 960, 960, 961, 961, 961,
+  963, 963, 963, 966, 967, 967, 967, 967, 969, 970, 970, 970, 970, 970, 970, 971,
+  972, 974, 974, 974, 974, 975, 975, 977, 980, 981, 981, 983, 984, 986, 986, 986,
+  986, 987, 988, 989, 991, 991, 991, 991, 992, 995, 997, 997, 997, 999, 1000, 1001,
+  1001, 1003, 1004, 1004, 1004, 1005, 1006, 1007, 1008, 1008, 1010, 1013, 1014, 1015, 1015, 1015,
+  1015, 1015, 1017, 1018, 1019, 1021, 1022, 1023, 1024, 1025, 1026, 1026, 1027, 1027, 1027, 1028,
+  1029, 1033, 1033, 1033, 1037, 1039, 1040, 1040, 1042, 1043, 1045, 1045, 1045, 1045, 1045, 1045,
+  1046, 1046, 1047, 1048, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1054, 1057, 1058, 1058, 1059,
+  1062, 1063, 1064, 1066, 1067, 1067, 1067, 1067, 1069, 1070, 1072, 1073, 1073, 1074, 1076, 1076,
+  1076, 1078, 1078, 1079, 1080, 1083, 1083, 1085, 1085, 1087, 1088, 1092, 1092, 1092, 1093, 1093,
+  1093, 1095, 1095, 1096, 1097, 1097, 1099, 1099, 1101, 1102, 1102, 1102, 1104, 1105, 1106, 1106,
+  1108, 1110, 1111, 1112, 1113, 1115, 1115, 1116, 1116, 1117, 1118, 1118, 1119, 1119, 1120, 1120,
+  1120, 1121, 1121, 1122, 1123, 1123, 1123, 1127, 1130, 1132, 1132, 1134, 1135, 1136, 1136, 1136,
+  1136, 1136, 1136, 1139, 1139, 1140, 1141, 1143, 1144, 1144, 1144, 1145, 1145, 1146, 1146, 1147,
+  1147, 1147, 1147, 1148, 1149, 1150, 1151, 1152, 1154, 1155, 1156, 1156, 1156, 1157, 1158, 1159,
+  1161, 1161, 1162, 1164, 1166, 1167, 1170, 1171, 1171, 1172, 1172, 1174, 1176, 1176, 1176, 1180,
+  1180, 1181, 1181, 1182, 1184, 1185, 1186, 1188, 1189, 1190, 1192, 1192, 1194, 1194, 1195, 1196,
+  1197, 1199, 1200, 1202, 1204, 1204, 1205, 1205, 1206, 1208, 1209, 1210, 1211, 1211, 1212, 1212,
+  1213, 1213, 1214, 1215, 1216, 1217, 1217, 1217, 1218, 1218, 1220, 1221, 1221, 1221, 1221, 1223,
+  1223, 1223, 1223, 1224, 1225, 1227, 1227, 1227, 1228, 1229, 1229, 1229, 1229, 1229, 1229, 1229,
+  1230, 1230, 1231, 1232, 1232, 1232, 1233, 1233, 1233, 1233, 1235, 1236, 1236, 1237, 1237, 1237,
+  1237, 1237, 1237, 1237, 1238, 1239, 1242, 1243, 1244, 1244, 1246, 1248, 1248, 1249, 1250, 1251,
+  1251, 1252, 1253, 1253, 1253, 1255, 1255, 1256, 1257, 1258, 1259, 1259, 1260, 1260, 1261, 1263,
+  1264, 1265, 1266, 1268, 1268, 1269, 1270, 1271, 1272, 1275, 1278, 1278, 1278, 1279, 1279, 1281,
+  1282, 1282, 1284, 1284, 1284, 1284, 1286, 1287, 1288, 1289, 1292, 1293, 1296, 1298, 1299, 1300,
+  1300, 1302, 1304, 1304, 1305, 1305, 1306, 1307, 1308, 1309, 1309, 1309, 1310, 1310, 1310, 1312,
+  1312, 1313, 1314, 1316, 1316, 1316, 1316, 1316, 1318, 1320, 1321, 1323, 1324, 1325, 1326, 1327,
+  1329, 1330, 1333, 1335, 1335, 1336, 1336, 1336, 1336, 1336, 1337, 1337, 1337, 1338, 1338, 1339,
+  1340, 1340, 1341, 1342, 1345, 1347, 1348, 1349, 1354, 1354, 1356, 1357, 1358, 1358, 1359, 1359,
+  1359, 1360, 1361, 1362, 1364, 1366, 1369, 1370, 1371, 1371, 1371, 1372, 1373, 1374, 1375, 1376,
+  1376, 1376, 1376, 1376, 1377, 1379, 1380, 1382, 1384, 1384, 1385, 1385, 1386, 1386, 1387, 1389,
+  1389, 1390, 1390, 1390, 1392, 1393, 1393, 1394, 1395, 1396, 1398, 1398, 1398, 1398, 1399, 1400,
+  1402, 1402, 1403, 1403, 1406, 1407, 1410, 1411, 1412, 1414, 1414, 1416, 1416, 1418, 1419, 1422,
+  1422, 1423, 1424, 1424, 1425, 1425, 1426, 1427, 1428, 1428, 1428, 1428, 1429, 1430, 1431, 1431,
+  1432, 1433, 1434, 1435, 1436, 1437, 1439, 1440, 1440, 1441, 1445, 1446, 1449, 1450, 1450, 1450,
+  1450, 1452, 1452, 1453, 1455, 1456, 1459, 1459, 1462, 1463, 1465, 1465, 1468, 1470, 1470, 1470,
+  1472, 1473, 1473, 1474, 1475, 1475, 1476, 1478, 1478, 1479, 1482, 1482, 1483, 1487, 1487, 1487,
+  1488, 1490, 1491, 1491, 1494, 1497, 1499, 1499, 1501, 1502, 1503, 1504, 1504, 1507, 1507, 1507,
+  1508, 1509, 1511, 1512, 1514, 1514, 1514, 1514, 1515, 1518, 1519, 1519, 1519, 1519, 1520, 1523,
+  1524, 1527, 1527, 1529, 1530, 1530, 1530, 1530, 1531, 1534, 1536, 1537, 1537, 1539, 1539, 1540,
+  1540, 1541, 1542, 1542, 1542, 1543, 1543, 1545, 1550, 1551, 1551, 1551, 1553, 1554, 1555, 1555,
+  1555, 1555, 1558, 1559, 1559, 1560, 1560, 1561, 1562, 1563, 1565, 1566, 1567, 1568, 1570, 1573,
+  1574, 1574, 1574, 1575, 1575, 1576, 1576, 1576, 1577, 1579, 1580, 1580, 1580, 1580, 1581, 1582,
+  1583, 1583, 1585, 1585, 1586, 1586, 1588, 1588, 1590, 1590, 1590, 1590, 1591, 1591, 1593, 1593,
+  1594, 1596, 1596, 1597, 1598, 1598, 1598, 1598, 1600, 1600, 1600, 1602, 1603, 1606, 1607, 1608,
+  1610, 1611, 1611, 1611, 1613, 1613, 1614, 1615, 1616, 1616, 1619, 1621, 1621, 1622, 1623, 1623,
+  1623, 1624, 1624, 1625, 1626, 1628, 1630, 1630, 1630, 1633, 1634, 1634, 1636, 1636, 1637, 1638,
+  1640, 1641, 1642, 1643, 1644, 1645, 1645, 1646, 1646, 1648, 1648, 1651, 1654, 1654, 1656, 1656,
+  1658, 1658, 1659, 1659, 1659, 1659, 1660, 1661, 1661, 1661, 1661, 1663, 1664, 1667, 1667, 1669,
+  1669, 1673, 1674, 1675, 1675, 1675, 1678, 1679, 1679, 1680, 1681, 1681, 1681, 1681, 1682, 1683,
+  1684, 1685, 1687, 1688, 1689, 1689, 1692, 1693, 1697, 1698, 1698, 1699, 1701, 1701, 1701, 1706,
+  1706, 1707, 1707, 1710, 1710, 1712, 1712, 1712, 1712, 1713, 1714, 1715, 1715, 1717, 1717, 1718,
+  1720, 1721, 1721, 1721, 1722, 1722, 1722, 1723, 1725, 1726, 1726, 1726, 1727, 1728, 1729, 1729,
+  1729, 1729, 1729, 1730, 1731, 1733, 1733, 1735, 1736, 1737, 1738, 1738, 1739, 1740, 1740, 1740,
+  1740, 1741, 1743, 1745, 1745, 1745, 1745, 1745, 1746, 1748, 1750, 1751, 1752, 1753, 1755, 1756,
+  1757, 1758, 1758, 1759, 1759, 1760, 1761, 1764, 1765, 1765, 1766, 1766, 1769, 1770, 1773, 1773,
+  1774, 1774, 1774, 1775, 1777, 1779, 1781, 1782, 1784, 1785, 1786, 1787, 1788, 1789, 1789, 1789,
+  1789, 1790, 1790, 1790, 1790, 1791, 1791, 1791, 1793, 1793, 1794, 1795, 1795, 1797, 1799, 1801,
+  1802, 1803, 1804, 1805, 1806, 1807, 1808, 1808, 1809, 1810, 1814, 1815, 1816, 1818, 1819, 1820,
+  1821, 1821, 1821, 1822, 1822, 1824, 1826, 1826, 1827, 1828, 1830, 1834, 1835, 1835, 1838, 1838,
+  1840, 1842, 1842, 1842, 1842, 1843, 1846, 1847, 1848, 1849, 1850, 1850, 1850, 1852, 1852, 1852,
+  1854, 1854, 1855, 1855, 1856, 1857, 1859, 1860, 1862, 1863, 1863, 1863, 1863, 1865, 1866, 1869,
+  1870, 1875, 1875, 1876, 1878, 1880, 1881, 1881, 1881, 1881, 1883, 1884, 1885, 1885, 1885, 1886,
+  1887, 1887, 1887, 1888, 1889, 1889, 1889, 1890, 1891, 1891, 1892, 1892, 1893, 1896, 1898, 1901,
+  1901, 1901, 1901, 1901, 1901, 1902, 1904, 1904, 1905, 1907, 1907, 1907, 1909, 1909, 1910, 1911,
+  1914, 1915, 1917, 1918, 1919, 1919, 1921, 1921, 1921, 1921, 1922, 1922, 1922, 1922, 1923, 1923,
+  1923, 1924, 1925, 1926, 1929, 1932, 1936, 1936, 1936, 1936, 1937, 1938, 1941, 1941, 1941, 1943,
+  1943, 1943, 1945, 1946, 1946, 1947, 1948, 1949, 1949, 1949, 1950, 1950, 1951, 1951, 1951, 1951,
+  1951, 1951, 1952, 1953, 1954, 1957, 1957, 1960, 1961, 1964, 1964, 1964, 1967, 1967, 1967, 1968,
+  1969, 1969, 1969, 1969, 1970, 1970, 1970, 1970, 1971, 1973, 1973, 1974, 1974, 1974, 1978, 1979,
+  1980, 1982, 1983, 1983, 1984, 1984, 1985, 1986, 1986, 1989, 1989, 1992, 1992, 1992, 1992, 1993,
+  1993, 1993, 1995, 1995, 1995, 1997, 1997, 1998, 1998, 1999, 2001, 2002, 2002, 2003, 2004, 2004,
+  2005, 2006, 2006, 2006, 2006, 2007, 2010, 2010, 2011, 2013, 2013, 2013, 2015, 2016, 2017, 2018,
+  2018, 2018, 2022, 2023, 2024, 2024, 2024, 2024, 2025, 2027, 2028, 2028, 2028, 2030, 2031, 2032,
+  2033, 2034, 2035, 2036, 2036, 2036, 2036, 2036, 2036, 2037, 2038, 2039, 2040, 2040, 2041, 2041,
+  2042, 2043, 2043, 2043, 2043, 2047, 2048, 2048, 2050, 2053, 2053, 2054, 2054, 2054, 2056, 2057,
+  2058, 2059, 2059, 2059, 2060, 2060, 2062, 2064, 2064, 2065, 2067, 2068, 2069, 2069, 2069, 2071,
+  2072, 2073, 2073, 2073, 2073, 2074, 2076, 2076, 2077, 2077, 2077, 2078, 2080, 2081, 2082, 2082,
+  2083, 2084, 2085, 2085, 2086, 2087, 2087, 2087, 2087, 2087, 2089, 2090, 2091, 2092, 2093, 2093,
+  2095, 2095, 2095, 2096, 2096, 2097, 2097, 2097, 2099, 2100, 2102, 2103, 2103, 2103, 2105, 2106,
+  2106, 2107, 2108, 2108, 2109, 2110, 2110, 2113, 2114, 2114, 2115, 2116, 2117, 2121, 2123, 2125,
+  2125, 2125, 2126, 2126, 2129, 2130, 2131, 2132, 2133, 2133, 2133, 2133, 2134, 2134, 2135, 2138,
+  2139, 2139, 2140, 2142, 2143, 2143, 2144, 2146, 2146, 2146, 2147, 2149, 2149, 2149, 2149, 2151,
+  2152, 2152, 2153, 2155, 2155, 2155, 2155, 2159, 2160, 2161, 2162, 2162, 2163, 2163, 2163, 2165,
+  2166, 2166, 2169, 2170, 2171, 2171, 2171, 2171, 2172, 2174, 2175, 2176, 2176, 2177, 2179, 2180,
+  2181, 2181, 2182, 2182, 2183, 2184, 2186, 2186, 2186, 2186, 2187, 2187, 2188, 2189, 2189, 2195,
+  2197, 2198, 2200, 2200, 2200, 2202, 2202, 2203, 2203, 2204, 2204, 2206, 2206, 2206, 2206, 2206,
+  2207, 2208, 2209, 2211, 2212, 2213, 2213, 2213, 2213, 2213, 2213, 2213, 2214, 2214, 2216, 2217,
+  2219, 2219, 2220, 2222, 2222, 2222, 2222, 2222, 2222, 2222, 2222, 2222, 2223, 2223, 2224, 2225,
+  2225, 2225, 2225, 2226, 2226, 2227, 2227, 2230, 2232, 2232, 2232, 2233, 2234, 2234, 2234, 2234,
+  2234, 2235, 2236, 2238, 2240, 2241, 2242, 2242, 2243, 2243, 2243, 2243, 2243, 2243, 2243, 2245,
+  2245, 2246, 2248, 2249, 2249, 2250, 2251, 2252, 2253, 2253, 2254, 2255, 2255, 2257, 2258, 2259,
+  2261, 2261, 2261, 2262, 2262, 2263, 2266, 2266, 2266, 2267, 2271, 2273, 2273, 2274, 2274, 2274,
+  2274, 2277, 2278, 2280, 2280, 2280, 2281, 2282, 2283, 2283, 2283, 2283, 2283, 2283, 2284, 2285,
+  2285, 2286, 2287, 2287, 2287, 2289, 2290, 2290, 2292, 2294, 2294, 2294, 2295, 2296, 2296, 2297,
+  2298, 2301, 2302, 2303, 2303, 2304, 2306, 2306, 2306, 2307, 2309, 2311, 2311, 2311, 2313, 2314,
+  2316, 2318, 2319, 2319, 2320, 2322, 2323, 2323, 2323, 2324, 2324, 2324, 2325, 2326, 2327, 2327,
+  2330, 2331, 2333, 2335, 2335, 2335, 2335, 2335, 2338, 2339, 2340, 2342, 2344, 2345, 2346, 2348,
+  2350, 2351, 2352, 2353, 2355, 2355, 2355, 2356, 2356, 2358, 2359, 2359, 2360, 2361, 2361, 2362,
+  2362, 2363, 2364, 2366, 2366, 2366, 2366, 2366, 2367, 2367, 2368, 2368, 2368, 2368, 2368, 2369,
+  2369, 2369, 2369, 2369, 2369, 2370, 2371, 2372, 2373, 2373, 2373, 2374, 2377, 2378, 2379, 2381,
+  2381, 2381, 2384, 2384, 2385, 2386, 2386, 2388, 2389, 2389, 2391, 2392, 2393, 2395, 2397, 2398,
+  2398, 2398, 2399, 2399, 2401, 2403, 2405, 2405, 2407, 2408, 2409, 2409, 2409, 2410, 2411, 2412,
+  2412, 2412, 2413, 2414, 2414, 2414, 2415, 2415, 2416, 2418, 2418, 2419, 2420, 2420, 2422, 2423,
+  2424, 2424, 2425, 2427, 2428, 2431, 2433, 2434, 2434, 2435, 2435, 2435, 2437, 2438, 2438, 2439,
+  2439, 2441, 2441, 2442, 2443, 2443, 2445, 2445, 2446, 2446, 2447, 2449, 2452, 2452, 2452, 2453,
+  2453, 2453, 2453, 2454, 2454, 2455, 2455, 2455, 2457, 2458, 2458, 2458, 2460, 2460, 2460, 2460,
+  2462, 2464, 2466, 2467, 2467, 2469, 2469, 2471, 2471, 2472, 2473, 2473, 2474, 2475, 2477, 2477,
+  2477, 2477, 2477, 2477, 2477, 2477, 2477, 2479, 2479, 2479, 2479, 2479, 2480, 2481, 2482, 2485,
+  2486, 2489, 2491, 2491, 2491, 2492, 2492, 2494, 2494, 2494, 2496, 2497, 2498, 2500, 2500, 2501,
+  2501, 2501, 2501, 2504, 2505, 2506, 2507, 2508, 2509, 2510, 2510, 2511, 2512, 2513, 2514, 2515,
+  2516, 2516, 2516, 2517, 2518, 2519, 2520, 2521, 2523, 2523, 2526, 2528, 2528, 2528, 2531, 2531,
+  2533, 2534, 2538, 2539, 2539, 2539, 2539, 2540, 2541, 2541, 2542, 2542, 2542, 2542, 2542, 2543,
+  2543, 2545, 2546, 2547, 2549, 2549, 2550, 2550, 2550, 2550, 2551, 2552, 2552, 2552, 2553, 2554,
+  2557, 2558, 2559, 2559, 2559, 2559, 2559, 2561, 2561, 2561, 2563, 2564, 2564, 2566, 2566, 2567,
+  2567, 2567, 2568, 2568, 2568, 2569, 2570, 2570, 2571, 2573, 2574, 2574, 2574, 2574, 2575, 2576,
+  2576, 2577, 2578, 2578, 2580, 2580, 2580, 2581, 2583, 2583, 2585, 2586, 2587, 2587, 2589, 2590,
+  2591, 2592, 2593, 2594, 2596, 2596, 2596, 2598, 2599, 2600, 2601, 2601, 2601, 2601, 2601, 2603,
+  2603, 2603, 2603, 2604, 2605, 2606, 2609, 2610, 2610, 2612, 2612, 2612, 2613, 2613, 2614, 2614,
+  2616, 2617, 2617, 2618, 2621, 2621, 2621, 2622, 2622, 2622, 2622, 2622, 2622, 2623, 2623, 2625,
+  2626, 2626, 2627, 2629, 2629, 2629, 2631, 2632, 2634, 2634, 2635, 2635, 2635, 2635, 2636, 2637,
+  2638, 2638, 2638, 2639, 2641, 2642, 2645, 2645, 2646, 2646, 2647, 2647, 2649, 2650, 2650, 2653,
+  2653, 2653, 2654, 2654, 2655, 2656, 2657, 2657, 2657, 2657, 2657, 2658, 2661, 2663, 2663, 2665,
+  2666, 2667, 2668, 2669, 2671, 2672, 2673, 2673, 2674, 2674, 2675, 2675, 2675, 2676, 2677, 2677,
+  2678, 2678, 2679, 2679, 2679, 2679, 2680, 2680, 2680, 2681, 2682, 2683, 2684, 2684, 2684, 2685,
+  2687, 2689, 2689, 2690, 2692, 2692, 2694, 2694, 2695, 2696, 2696, 2697, 2697, 2698, 2699, 2699,
+  2699, 2700, 2702, 2703, 2703, 2703, 2705, 2708, 2709, 2709, 2709, 2710, 2713, 2714, 2714, 2715,
+  2718, 2719, 2721, 2724, 2724, 2726, 2726, 2726, 2727, 2728, 2730, 2731, 2733, 2735, 2736, 2736,
+  2737, 2737, 2738, 2739, 2739, 2740, 2740, 2740, 2742, 2742, 2742, 2744, 2745, 2745, 2745, 2747,
+  2748, 2750, 2751, 2751, 2752, 2753, 2754, 2755, 2758, 2759, 2760, 2760, 2763, 2764, 2765, 2765,
+  2765, 2766, 2768, 2770, 2773, 2775, 2775, 2777, 2777, 2778, 2780, 2781, 2783, 2784, 2786, 2786,
+  2788, 2788, 2788, 2788, 2789, 2789, 2790, 2791, 2792, 2794, 2794, 2795, 2795, 2796, 2799, 2799,
+  2799, 2799, 2799, 2799, 2801, 2803, 2803, 2804, 2806, 2806, 2807, 2807, 2807, 2807, 2808, 2810,
+  2811, 2811, 2811, 2812, 2813, 2813, 2813, 2814, 2814, 2815, 2816, 2816, 2817, 2818, 2818, 2819,
+  2820, 2821, 2822, 2823, 2823, 2823, 2823, 2823, 2823, 2824, 2824, 2824, 2825, 2826, 2827, 2828,
+  2829, 2830, 2830, 2830, 2830, 2831, 2834, 2834, 2837, 2837, 2837, 2837, 2837, 2838, 2840, 2841,
+  2841, 2841, 2842, 2843, 2843, 2844, 2844, 2844, 2844, 2845, 2849, 2851, 2852, 2854, 2855, 2857,
+  2857, 2858, 2860, 2861, 2862, 2862, 2862, 2862, 2866, 2866, 2866, 2867, 2871, 2872, 2874, 2874,
+  2874, 2875, 2876, 2876, 2880, 2882, 2884, 2885, 2885, 2887, 2889, 2891, 2892, 2893, 2895, 2895,
+  2895, 2895, 2897, 2898, 2898, 2899, 2901, 2903, 2903, 2906, 2907, 2908, 2909, 2909, 2910, 2911,
+  2913, 2914, 2914, 2914, 2916, 2916, 2917, 2918, 2918, 2918, 2919, 2920, 2922, 2924, 2927, 2931,
+  2935, 2936, 2937, 2938, 2938, 2939, 2939, 2939, 2943, 2944, 2948, 2950, 2953, 2955, 2955, 2958,
+  2958, 2959, 2959, 2959, 2959, 2959, 2960, 2961, 2965, 2965, 2965, 2967, 2968, 2970, 2971, 2971,
+  2971, 2972, 2973, 2974, 2974, 2975, 2976, 2976, 2976, 2977, 2978, 2978, 2978, 2981, 2983, 2983,
+  2984, 2984, 2985, 2986, 2987, 2991, 2991, 2992, 2992, 2992, 2993, 2993, 2994, 2994, 2994, 2994,
+  2994, 2994, 2994, 2994, 2994, 2995, 2997, 2997, 2998, 3000, 3002, 3003, 3003, 3004, 3004, 3004,
+  3004, 3004, 3004, 3004, 3004, 3006, 3006, 3008, 3011, 3011, 3012, 3013, 3013, 3014, 3015, 3018,
+  3019, 3020, 3021, 3023, 3024, 3024, 3026, 3026, 3026, 3026, 3027, 3029, 3030, 3030, 3033, 3033,
+  3033, 3033, 3033, 3034, 3035, 3036, 3036, 3037, 3038, 3041, 3041, 3041, 3043, 3043, 3044, 3044,
+  3045, 3045, 3047, 3050, 3050, 3050, 3051, 3052, 3052, 3053, 3055, 3056, 3057, 3057, 3058, 3059,
+  3059, 3060, 3061, 3061, 3061, 3061, 3062, 3063, 3065, 3065, 3065, 3066, 3068, 3069, 3070, 3070,
+  3071, 3072, 3072, 3072, 3072, 3073, 3074, 3076, 3079, 3079, 3079, 3079, 3080, 3083, 3084, 3086,
+  3087, 3087, 3088, 3088, 3089, 3090, 3091, 3091, 3092, 3093, 3094, 3096, 3098, 3100, 3102, 3102,
+  3102, 3102, 3103, 3103, 3104, 3104, 3104, 3104, 3104, 3105, 3107, 3109, 3110, 3111, 3111, 3112,
+  3112, 3115, 3120, 3120, 3120, 3122, 3122, 3122, 3124, 3125, 3126, 3127, 3127, 3127, 3128, 3129,
+  3129, 3131, 3133, 3135, 3136, 3137, 3138, 3140, 3143, 3144, 3144, 3145, 3146, 3146, 3147, 3147,
+  3147, 3147, 3148, 3149, 3150, 3151, 3152, 3155, 3156, 3156, 3159, 3161, 3161, 3164, 3164, 3167,
+  3168, 3168, 3169, 3172, 3173, 3175, 3175, 3175, 3175, 3175, 3175, 3175, 3176, 3178, 3179, 3180,
+  3180, 3183, 3184, 3185, 3187, 3190, 3192, 3192, 3194, 3195, 3195, 3196, 3197, 3197, 3199, 3201,
+  3202, 3202, 3203, 3204, 3206, 3207, 3208, 3208, 3210, 3212, 3213, 3213, 3215, 3218, 3218, 3219,
+  3219, 3220, 3222, 3222, 3222, 3223, 3224, 3226, 3228, 3229, 3231, 3231, 3231, 3233, 3233, 3234,
+  3234, 3235, 3235, 3236, 3237, 3237, 3237, 3237, 3237, 3238, 3239, 3241, 3243, 3246, 3247, 3248,
+  3250, 3251, 3253, 3253, 3254, 3255, 3257, 3258, 3258, 3258, 3259, 3260, 3261, 3261, 3263, 3264,
+  3268, 3270, 3271, 3272, 3274, 3276, 3277, 3278, 3279, 3280, 3280, 3280, 3280, 3280, 3282, 3283,
+  3284, 3284, 3284, 3287, 3288, 3289, 3289, 3289, 3291, 3293, 3293, 3294, 3294, 3294, 3295, 3295,
+  3296, 3298, 3298, 3299, 3299, 3299, 3299, 3299, 3300, 3302, 3302, 3304, 3304, 3304, 3304, 3305,
+  3306, 3308, 3309, 3311, 3312, 3313, 3315, 3315, 3316, 3316, 3316, 3316, 3317, 3320, 3321, 3323,
+  3324, 3324, 3324, 3324, 3325, 3325, 3325, 3326, 3327, 3329, 3329, 3330, 3330, 3330, 3332, 3334,
+  3336, 3336, 3336, 3336, 3337, 3339, 3340, 3342, 3344, 3344, 3347, 3347, 3347, 3349, 3351, 3351,
+  3353, 3353, 3353, 3353, 3354, 3356, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3358, 3360,
+  3362, 3365, 3368, 3369, 3369, 3369, 3370, 3371, 3371, 3372, 3372, 3372, 3372, 3372, 3373, 3375,
+  3376, 3376, 3376, 3377, 3377, 3379, 3379, 3384, 3384, 3386, 3387, 3388, 3389, 3390, 3391, 3392,
+  3392, 3392, 3392, 3393, 3394, 3394, 3394, 3396, 3398, 3398, 3398, 3399, 3400, 3400, 3401, 3402,
+  3404, 3404, 3404, 3405, 3406, 3408, 3411, 3414, 3414, 3414, 3414, 3415, 3416, 3417, 3420, 3422,
+  3422, 3423, 3425, 3426, 3427, 3429, 3430, 3432, 3432, 3432, 3434, 3436, 3439, 3439, 3439, 3441,
+  3442, 3444, 3445, 3445, 3446, 3447, 3447, 3447, 3447, 3450, 3450, 3450, 3450, 3450, 3452, 3453,
+  3455, 3456, 3456, 3457, 3458, 3461, 3461, 3462, 3462, 3463, 3464, 3464, 3464, 3466, 3467, 3467,
+  3469, 3470, 3470, 3471, 3471, 3472, 3474, 3474, 3475, 3477, 3478, 3480, 3481, 3484, 3485, 3485,
+  3485, 3485, 3485, 3487, 3488, 3490, 3490, 3490, 3490, 3490, 3490, 3493, 3493, 3493, 3494, 3494,
+  3494, 3494, 3496, 3496, 3496, 3496, 3496, 3498, 3499, 3500, 3503, 3505, 3506, 3507, 3509, 3510,
+  3511, 3513, 3515, 3517, 3519, 3521, 3523, 3523, 3525, 3527, 3527, 3530, 3530, 3530, 3531, 3534,
+  3536, 3538, 3538, 3540, 3540, 3542, 3543, 3544, 3544, 3545, 3545, 3545, 3547, 3548, 3548, 3548,
+  3550, 3551, 3552, 3552, 3553, 3554, 3555, 3559, 3561, 3563, 3566, 3566, 3566, 3567, 3570, 3571,
+  3571, 3572, 3573, 3574, 3575, 3576, 3577, 3578, 3580, 3580, 3581, 3581, 3583, 3584, 3585, 3588,
+  3589, 3592, 3592, 3593, 3593, 3594, 3596, 3596, 3596, 3600, 3603, 3604, 3606, 3606, 3606, 3607,
+  3608, 3608, 3608, 3611, 3611, 3611, 3611, 3615, 3615, 3615, 3617, 3618, 3620, 3620, 3620, 3621,
+  3622, 3623, 3625, 3625, 3625, 3626, 3626, 3627, 3629, 3630, 3631, 3631, 3631, 3631, 3632, 3633,
+  3635, 3637, 3637, 3637, 3638, 3638, 3638, 3641, 3641, 3642, 3643, 3643, 3644, 3646, 3646, 3648,
+  3648, 3648, 3649, 3649, 3650, 3650, 3651, 3651, 3653, 3656, 3656, 3656, 3657, 3658, 3659, 3661,
+  3661
+};
+
 #endif
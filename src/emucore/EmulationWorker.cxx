@@ -17,6 +17,17 @@
 
 #include <exception>
 
+#ifdef __linux__
+  #include <climits>
+  #include <ctime>
+  #include <linux/futex.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+#else
+  #include <condition_variable>
+  #include <mutex>
+#endif
+
 #include "EmulationWorker.hxx"
 #include "DispatchResult.hxx"
 #include "TIA.hxx"
@@ -24,36 +35,129 @@
 
 using namespace std::chrono;
 
+namespace {
+  static_assert(sizeof(std::atomic<uInt32>) == sizeof(uInt32) &&
+                std::atomic<uInt32>::is_always_lock_free);
+
+#ifndef __linux__
+  // Without futexes, sleeping threads wait on this condition variable; the
+  // mutex is only taken by sleepers and (briefly) by the waking side
+  std::mutex waitMutex;
+  std::condition_variable waitCondition;
+#endif
+
+  // Number of threads that are (about to go) sleeping. A sleeper registers
+  // before it checks the word, and a waker changes the word before it reads
+  // the count (both sequentially consistent), so a waker that sees no sleepers
+  // can't miss one, and the wakeup syscall / notification can be skipped.
+  std::atomic<uInt32> sleepers{0};
+
+  // Sleep while 'word' holds 'expected' (spurious wakeups are possible)
+  void waitOn(std::atomic<uInt32>& word, uInt32 expected)
+  {
+    sleepers.fetch_add(1);
+
+#ifdef __linux__
+    syscall(SYS_futex, reinterpret_cast<uInt32*>(&word), FUTEX_WAIT_PRIVATE,
+            expected, nullptr, nullptr, 0);
+#else
+    {
+      std::unique_lock<std::mutex> lock(waitMutex);
+      waitCondition.wait(lock, [&] { return word != expected; });
+    }
+#endif
+
+    sleepers.fetch_sub(1);
+  }
+
+  // Same as above, but return at 'deadline' at the latest
+  void waitOnUntil(std::atomic<uInt32>& word, uInt32 expected,
+                   high_resolution_clock::time_point deadline)
+  {
+    const auto now = high_resolution_clock::now();
+    if(deadline <= now) return;
+
+    sleepers.fetch_add(1);
+
+#ifdef __linux__
+    const auto ns = duration_cast<nanoseconds>(deadline - now).count();
+    const timespec timeout{static_cast<time_t>(ns / 1000000000),
+                           static_cast<long>(ns % 1000000000)};
+
+    syscall(SYS_futex, reinterpret_cast<uInt32*>(&word), FUTEX_WAIT_PRIVATE,
+            expected, &timeout, nullptr, 0);
+#else
+    {
+      std::unique_lock<std::mutex> lock(waitMutex);
+      waitCondition.wait_until(lock, deadline, [&] { return word != expected; });
+    }
+#endif
+
+    sleepers.fetch_sub(1);
+  }
+
+  // Wake up all threads sleeping on 'word'
+  void wakeAll(std::atomic<uInt32>& word)
+  {
+    // Most transitions happen while the other side is busy
+    if(sleepers == 0) return;
+
+#ifdef __linux__
+    syscall(SYS_futex, reinterpret_cast<uInt32*>(&word), FUTEX_WAKE_PRIVATE,
+            INT_MAX, nullptr, nullptr, 0);
+#else
+    // Taking the mutex makes sure that no sleeper is between checking the
+    // word and starting to wait, so the notification can't get lost
+    { const std::lock_guard<std::mutex> lock(waitMutex); }
+    waitCondition.notify_all();
+#endif
+  }
+} // namespace
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 EmulationWorker::EmulationWorker()
 {
-  std::mutex mutex;
-  std::unique_lock<std::mutex> lock(mutex);
-  std::condition_variable threadInitialized;
-
-  myThread = std::thread(
-    &EmulationWorker::threadMain, this, &threadInitialized, &mutex
-  );
+  myThread = std::thread(&EmulationWorker::threadMain, this);
 
-  // Wait until the thread has acquired myThreadIsRunningMutex and moved on
-  while (myState == State::initializing) threadInitialized.wait(lock);
+  // Wait until the thread has initialized
+  waitWhile(State::initializing);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 EmulationWorker::~EmulationWorker()
 {
-  // This has to run in a block in order to release the mutex before joining
+  for(;;)
   {
-    const std::unique_lock<std::mutex> lock(myThreadIsRunningMutex);
+    uInt32 state = myState;
+
+    if (state == State::exception || state == State::quit) break;
 
-    if (myState != State::exception) {
-      signalQuit();
-      myWakeupCondition.notify_one();
+    if (state == State::waitingForResume || state == State::waitingForStop) {
+      // The worker is sleeping -> raise the exit condition and wake it up
+      if (myState.compare_exchange_strong(state, State::quit)) {
+        wakeAll(myState);
+        break;
+      }
     }
+    else
+      // Wait until the worker has finished the current transition
+      waitWhile(state);
   }
 
   myThread.join();
 
+  if (myStats.timeslices > 0) {
+    ostringstream buf;
+    buf << "Emulation worker: " << myStats.timeslices << " timeslices, "
+        << myStats.wakeups << " wakeups (avg "
+        << (myStats.wakeups ? myStats.totalWakeupLatency / myStats.wakeups : 0)
+        << " us, max " << myStats.maxWakeupLatency << " us), "
+        << myStats.overruns << " overruns (avg "
+        << (myStats.overruns ? myStats.totalOverrun / myStats.overruns : 0)
+        << " us, max " << myStats.maxOverrun << " us)";
+    Logger::debug(buf.view());
+  }
+
   handlePossibleException();
 }
 
@@ -72,200 +176,151 @@ void EmulationWorker::handlePossibleException()
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void EmulationWorker::start(uInt32 cyclesPerSecond, uInt64 maxCycles, uInt64 minCycles, DispatchResult* dispatchResult, TIA* tia)
 {
-  // Wait until any pending signal has been processed
-  waitUntilPendingSignalHasProcessed();
+  // Wait until any pending stop has been processed
+  waitWhile(State::stopRequested);
 
-  // Run in a block to release the mutex before notifying; this avoids an unecessary
-  // block that will waste a timeslice
-  {
-    // Acquire the mutex -> wait until the thread is suspended
-    const std::unique_lock<std::mutex> lock(myThreadIsRunningMutex);
-
-    // Pass on possible exceptions
-    handlePossibleException();
+  // Pass on possible exceptions
+  handlePossibleException();
 
-    // Make sure that we don't overwrite the exit condition.
-    // This case is hypothetical and cannot happen, but handling it does not hurt, either
-    if (myPendingSignal == Signal::quit) return;
+  const uInt32 state = myState;
 
-    // NB: The thread does not suspend execution in State::initialized
-    if (myState != State::waitingForResume)
-      fatal("start called on running or dead worker");
+  // Make sure that we don't overwrite the exit condition.
+  // This case is hypothetical and cannot happen, but handling it does not hurt, either
+  if (state == State::quit) return;
 
-    // Store the parameters for emulation
-    myTia = tia;
-    myCyclesPerSecond = cyclesPerSecond;
-    myMaxCycles = maxCycles;
-    myMinCycles = minCycles;
-    myDispatchResult = dispatchResult;
+  if (state != State::waitingForResume)
+    fatal("start called on running or dead worker");
 
-    // Raise the signal...
-    myPendingSignal = Signal::resume;
-  }
+  // Store the parameters for emulation. The worker is sleeping and will only
+  // pick them up after the state has changed below.
+  myTia = tia;
+  myCyclesPerSecond = cyclesPerSecond;
+  myMaxCycles = maxCycles;
+  myMinCycles = minCycles;
+  myDispatchResult = dispatchResult;
+  myResumeTime = high_resolution_clock::now();
 
-  // ... and wakeup the thread
-  myWakeupCondition.notify_one();
+  // Raise the signal and wake up the thread
+  myState = State::resumeRequested;
+  wakeAll(myState);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 uInt64 EmulationWorker::stop()
 {
-  // See EmulationWorker::start above for the gory details
-  waitUntilPendingSignalHasProcessed();
-
-  uInt64 totalCycles{0};
+  for(;;)
   {
-    const std::unique_lock<std::mutex> lock(myThreadIsRunningMutex);
-
-    // Paranoia: make sure that we don't doublecount an emulation timeslice
-    totalCycles = myTotalCycles;
-    myTotalCycles = 0;
-
-    handlePossibleException();
-
-    if (myPendingSignal == Signal::quit) return totalCycles;
-
+    uInt32 state = myState;
+
+    if (state == State::waitingForStop) {
+      // The worker is sleeping. If the CAS fails, it has just woken up on its
+      // own, and we have to wait for it to finish the timeslice.
+      if (myState.compare_exchange_strong(state, State::stopRequested)) {
+        wakeAll(myState);
+        break;
+      }
+    }
     // If the worker has stopped on its own, we return
-    if (myState == State::waitingForResume) return totalCycles;
-
-    // NB: The thread does not suspend execution in State::initialized or State::running
-    if (myState != State::waitingForStop)
+    else if (state == State::waitingForResume || state == State::quit)
+      break;
+    else if (state == State::exception) {
+      handlePossibleException();
+      break;
+    }
+    else if (state == State::resumeRequested || state == State::running)
+      waitWhile(state);
+    else
       fatal("stop called on a dead worker");
-
-    myPendingSignal = Signal::stop;
   }
 
-  myWakeupCondition.notify_one();
+  // The worker won't touch the cycle count until it is resumed again
+  const uInt64 totalCycles = myTotalCycles;
+  // Paranoia: make sure that we don't doublecount an emulation timeslice
+  myTotalCycles = 0;
 
   return totalCycles;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void EmulationWorker::threadMain(std::condition_variable* initializedCondition, std::mutex* initializationMutex)
+void EmulationWorker::threadMain()
 {
-  std::unique_lock<std::mutex> lock(myThreadIsRunningMutex);
-
   try {
-    {
-      // Wait until our parent releases the lock and sleeps
-      const std::lock_guard<std::mutex> guard(*initializationMutex);
-
-      // Update the state...
-      myState = State::initialized;
-
-      // ... and wake up our parent to notifiy that we have initialized. From this point, the
-      // parent can safely assume that we are running while the mutex is locked.
-      initializedCondition->notify_one();
-    }
+    // Notify our parent that we have initialized
+    myState = State::waitingForResume;
+    wakeAll(myState);
 
     // Loop until we have an exit condition
-    while (myPendingSignal != Signal::quit) handleWakeup(lock);
+    for(;;)
+    {
+      switch (myState) {
+        case State::waitingForResume:
+          waitOn(myState, State::waitingForResume);
+          break;
+
+        case State::resumeRequested:
+          // Acknowledge and enter emulation
+          myState = State::running;
+          wakeAll(myState);
+          recordWakeup(myResumeTime);
+
+          // Reset virtual clock and cycle counter
+          myVirtualTime = high_resolution_clock::now();
+          myTotalCycles = 0;
+
+          // This will emulate a timeslice and set the state upon completion.
+          dispatchEmulation();
+          break;
+
+        case State::waitingForStop:
+          handleWakeupFromWaitingForStop();
+          break;
+
+        case State::stopRequested:
+          // Enter waiting for resume and notify the main thread
+          myState = State::waitingForResume;
+          wakeAll(myState);
+          break;
+
+        case State::quit:
+          return;
+
+        default:
+          fatal("wakeup in invalid worker state");
+      }
+    }
   }
   catch (...) {
-    // Store away the exception and the state accordingly
+    // Store away the exception and the state accordingly. This also makes
+    // sure that the main thread will not deadlock if it is waiting for a
+    // state change.
     myPendingException = std::current_exception();
     myState = State::exception;
-
-    // Raising the exit condition is consistent and makes shure that the main thread
-    // will not deadlock if an exception is raised while it is waiting for a signal
-    // to be processed.
-    signalQuit();
-  }
-}
-
-// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void EmulationWorker::handleWakeup(std::unique_lock<std::mutex>& lock)
-{
-  switch (myState) {
-    case State::initialized:
-      // Enter waitingForResume and sleep after initialization
-      myState = State::waitingForResume;
-      myWakeupCondition.wait(lock);
-      break;
-
-    case State::waitingForResume:
-      handleWakeupFromWaitingForResume(lock);
-      break;
-
-    case State::waitingForStop:
-      handleWakeupFromWaitingForStop(lock);
-      break;
-
-    default:
-      fatal("wakeup in invalid worker state");
-  }
-}
-
-// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void EmulationWorker::handleWakeupFromWaitingForResume(std::unique_lock<std::mutex>& lock)
-{
-  switch (myPendingSignal) {
-    case Signal::resume:
-      // Clear the pending signal and notify the main thread
-      clearSignal();
-
-      // Reset virtual clock and cycle counter
-      myVirtualTime = high_resolution_clock::now();
-      myTotalCycles = 0;
-
-      // Enter emulation. This will emulate a timeslice and set the state upon completion.
-      dispatchEmulation(lock);
-      break;
-
-    case Signal::none:
-      // Reenter sleep on spurious wakeups
-      myWakeupCondition.wait(lock);
-      break;
-
-    case Signal::quit:
-      break;
-
-    default:
-      fatal("invalid signal while waiting for resume");
+    wakeAll(myState);
   }
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void EmulationWorker::handleWakeupFromWaitingForStop(std::unique_lock<std::mutex>& lock)
+void EmulationWorker::handleWakeupFromWaitingForStop()
 {
-  switch (myPendingSignal) {
-    case Signal::stop:
-      // Clear the pending signal and notify the main thread
-      clearSignal();
-
-      // Enter waiting for resume and sleep
-      myState = State::waitingForResume;
-      myWakeupCondition.wait(lock);
-      break;
-
-    case Signal::none:
-      if(myVirtualTime <= high_resolution_clock::now())
-        // The time allotted to the emulation timeslice has passed and we haven't been stopped?
-        // -> go for another emulation timeslice
-      {
-        Logger::debug("Frame dropped!");
-        dispatchEmulation(lock);
-      }
-      else
-        // Wakeup was spurious, reenter sleep
-        myWakeupCondition.wait_until(lock, myVirtualTime);
-
-      break;
-
-    case Signal::quit:
-      break;
-
-    default:
-      fatal("invalid signal while waiting for stop");
+  if (myVirtualTime <= high_resolution_clock::now()) {
+    // The time allotted to the emulation timeslice has passed and we haven't been stopped?
+    // -> go for another emulation timeslice. If the main thread requests stop
+    // concurrently, the CAS fails and we process the request instead.
+    uInt32 expected = State::waitingForStop;
+    if (myState.compare_exchange_strong(expected, State::running)) {
+      recordWakeup(myVirtualTime);
+      Logger::debug("Frame dropped!");
+      dispatchEmulation();
+    }
   }
+  else
+    // Wakeup was spurious, reenter sleep
+    waitOnUntil(myState, State::waitingForStop, myVirtualTime);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void EmulationWorker::dispatchEmulation(std::unique_lock<std::mutex>& lock)
+void EmulationWorker::dispatchEmulation()
 {
-  // Technically, we could do without State::running, but it is cleaner and might be useful in the future
-  myState = State::running;
-
   uInt64 totalCycles = 0;
 
   do {
@@ -274,6 +329,7 @@ void EmulationWorker::dispatchEmulation(std::unique_lock<std::mutex>& lock)
   } while (totalCycles < myMinCycles && myDispatchResult->getStatus() == DispatchResult::Status::ok);
 
   myTotalCycles += totalCycles;
+  ++myStats.timeslices;
 
   bool continueEmulating = false;
 
@@ -284,51 +340,43 @@ void EmulationWorker::dispatchEmulation(std::unique_lock<std::mutex>& lock)
 
     // If we aren't fast enough to keep up with the emulation, we stop immediatelly to avoid
     // starving the system for processing time --- emulation will stutter anyway.
-    continueEmulating = myVirtualTime > high_resolution_clock::now();
-  }
+    const auto now = high_resolution_clock::now();
+    continueEmulating = myVirtualTime > now;
 
-  if (continueEmulating) {
-    // If we are free to continue emulating, we sleep until either the timeslice has passed or we
-    // have been signalled from the main thread
-    myState = State::waitingForStop;
-    myWakeupCondition.wait_until(lock, myVirtualTime);
-  } else {
-    // If can't continue, we just stop and wait to be signalled
-    myState = State::waitingForResume;
-    myWakeupCondition.wait(lock);
-  }
-}
+    if (!continueEmulating) {
+      const auto overrun = static_cast<uInt64>(
+          duration_cast<microseconds>(now - myVirtualTime).count());
 
-// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void EmulationWorker::clearSignal()
-{
-  {
-    const std::unique_lock<std::mutex> lock(mySignalChangeMutex);
-    myPendingSignal = Signal::none;
+      ++myStats.overruns;
+      myStats.totalOverrun += overrun;
+      myStats.maxOverrun = std::max(myStats.maxOverrun, overrun);
+    }
   }
 
-  mySignalChangeCondition.notify_one();
+  // If we are free to continue emulating, we sleep until either the timeslice has passed or we
+  // have been signalled from the main thread. If can't continue, we just stop and wait to be
+  // signalled.
+  myState = continueEmulating ? State::waitingForStop : State::waitingForResume;
+  wakeAll(myState);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void EmulationWorker::signalQuit()
+void EmulationWorker::waitWhile(uInt32 state)
 {
-  {
-    const std::unique_lock<std::mutex> lock(mySignalChangeMutex);
-    myPendingSignal = Signal::quit;
-  }
-
-  mySignalChangeCondition.notify_one();
+  while (myState == state) waitOn(myState, state);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void EmulationWorker::waitUntilPendingSignalHasProcessed()
+void EmulationWorker::recordWakeup(high_resolution_clock::time_point due)
 {
-  std::unique_lock<std::mutex> lock(mySignalChangeMutex);
-
-  // White until there is no pending signal (or the exit condition has been raised)
-  while (myPendingSignal != Signal::none && myPendingSignal != Signal::quit)
-    mySignalChangeCondition.wait(lock);
+  const auto now = high_resolution_clock::now();
+  const uInt64 latency = now > due
+    ? static_cast<uInt64>(duration_cast<microseconds>(now - due).count())
+    : 0;
+
+  ++myStats.wakeups;
+  myStats.totalWakeupLatency += latency;
+  myStats.maxWakeupLatency = std::max(myStats.maxWakeupLatency, latency);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -33,14 +33,16 @@
  * In combination, the scheduling in the main loop and the microscheduling in the worker
  * ensure that the emulation continues to run even if rendering blocks, ensuring the real
  * time scheduling required for cycle exact audio to work.
+ *
+ * The handshake between the main thread and the worker is done through a single atomic
+ * state word; both sides advance it with compare-and-swap and sleep on it (directly via
+ * futex on Linux, through a condition variable elsewhere).
  */
 
 #ifndef EMULATION_WORKER_HXX
 #define EMULATION_WORKER_HXX
 
 #include <atomic>
-#include <mutex>
-#include <condition_variable>
 #include <thread>
 #include <exception>
 #include <chrono>
@@ -52,6 +54,28 @@ class DispatchResult;
 
 class EmulationWorker
 {
+  public:
+
+    /**
+      Scheduling statistics, collected by the worker while it emulates.
+     */
+    struct Stats {
+      // Number of wakeups (resume and timeslice) and their accumulated and
+      // maximum latency in microseconds
+      uInt64 wakeups{0};
+      uInt64 totalWakeupLatency{0};
+      uInt64 maxWakeupLatency{0};
+
+      // Number of timeslices that finished after their deadline, and the
+      // accumulated and maximum overrun in microseconds
+      uInt64 overruns{0};
+      uInt64 totalOverrun{0};
+      uInt64 maxOverrun{0};
+
+      // Number of timeslices emulated
+      uInt64 timeslices{0};
+    };
+
   public:
 
     /**
@@ -74,56 +98,50 @@ class EmulationWorker
      */
     uInt64 stop();
 
-  private:
-
     /**
-      Check whether an exception occurred on the thread and rethrow if appicable.
+      Answer the scheduling statistics. This must only be called from the main
+      thread while the worker is stopped.
      */
-    void handlePossibleException();
+    const Stats& stats() const { return myStats; }
 
     /**
-      The main thread entry point.
-      Passing references into a thread is awkward and requires std::ref -> use pointers here
+      Reset the scheduling statistics (same restrictions as 'stats').
      */
-    void threadMain(std::condition_variable* initializedCondition, std::mutex* initializationMutex);
+    void resetStats() { myStats = Stats{}; }
+
+  private:
 
     /**
-      Handle thread wakeup after sleep depending on the thread state.
+      Check whether an exception occurred on the thread and rethrow if appicable.
      */
-    void handleWakeup(std::unique_lock<std::mutex>& lock);
+    void handlePossibleException();
 
     /**
-      Handle wakeup while sleeping and waiting to be resumed.
+      The main thread entry point.
      */
-    void handleWakeupFromWaitingForResume(std::unique_lock<std::mutex>& lock);
+    void threadMain();
 
     /**
       Handle wakeup while sleeping and waiting to be stopped (or for the timeslice
       to expire).
      */
-    void handleWakeupFromWaitingForStop(std::unique_lock<std::mutex>& lock);
-
-    /**
-      Run the emulation, adjust the thread state according to the result and sleep.
-     */
-    void dispatchEmulation(std::unique_lock<std::mutex>& lock);
+    void handleWakeupFromWaitingForStop();
 
     /**
-      Clear any pending signal and wake up the main thread (if it is waiting for the signal
-      to be cleared).
+      Run the emulation and adjust the thread state according to the result.
      */
-    void clearSignal();
+    void dispatchEmulation();
 
     /**
-     * Signal quit and wake up the main thread if applicable.
+      Wait until the worker has left 'state'. This is called from the main thread.
      */
-    void signalQuit();
+    void waitWhile(uInt32 state);
 
     /**
-      Wait and sleep until a pending signal has been processed (or quit sigmalled).
-      This is called from the main thread.
+      Record the latency between the time the worker was supposed to wake up
+      and the time it actually did.
      */
-    void waitUntilPendingSignalHasProcessed();
+    void recordWakeup(std::chrono::high_resolution_clock::time_point due);
 
     /**
       Log a fatal error to cerr and throw a runtime exception.
@@ -131,61 +149,40 @@ class EmulationWorker
     [[noreturn]] static void fatal(const string& message);
 
   private:
-  /**
-    Thread state.
-   */
-    enum class State {
+
+    /**
+      Thread state. Transitions marked (main) are done by the main thread, all
+      others by the worker.
+     */
+    enum State: uInt32 {
       // Initial state
       initializing,
-      // Thread has initialized. From the point, myThreadIsRunningMutex is locked if and only if
-      // the thread is running.
-      initialized,
       // Sleeping and waiting for emulation to be resumed
       waitingForResume,
+      // Emulation parameters have been set, waiting for the worker to pick them up (main)
+      resumeRequested,
       // Running and emulating
       running,
       // Sleeping and waiting for emulation to be stopped
       waitingForStop,
+      // Stop has been requested while the worker was sleeping (main)
+      stopRequested,
+      // Quit has been requested (main)
+      quit,
       // An exception occurred and the thread has terminated (or is terminating)
       exception
     };
 
-    /**
-      Thread behavior is controlled by signals that are raised prior to waking up the thread.
-     */
-    enum class Signal {
-      // Resume emulation
-      resume,
-      // Stop emulation
-      stop,
-      // Quit (either during destruction or after an exception)
-      quit,
-      // No pending signal
-      none
-    };
-
   private:
 
     // Worker thread
     std::thread myThread;
 
-    // Condition variable for waking up the thread
-    std::condition_variable myWakeupCondition;
-    // The thread is running if and only if while this mutex is locked
-    std::mutex myThreadIsRunningMutex;
-
-    // Condition variable to signal changes to the pending signal
-    std::condition_variable mySignalChangeCondition;
-    // This mutex guards reading and writing the pending signal.
-    std::mutex mySignalChangeMutex;
-
     // Any exception on the worker thread is saved here to be rethrown on the main thread.
     std::exception_ptr myPendingException;
 
-    // Any pending signal (or Signal::none)
-    Signal myPendingSignal{Signal::none};
-    // The initial access to myState is not synchronized -> make this atomic
-    std::atomic<State> myState{State::initializing};
+    // The state word shared by the worker and the main thread
+    std::atomic<uInt32> myState{State::initializing};
 
     // Emulation parameters
     TIA* myTia{nullptr};
@@ -196,17 +193,20 @@ class EmulationWorker
 
     // Total number of cycles during this emulation run
     uInt64 myTotalCycles{0};
+
     // 6507 time
     std::chrono::time_point<std::chrono::high_resolution_clock> myVirtualTime;
 
-  private:
+    // Time at which the main thread requested resume
+    std::chrono::time_point<std::chrono::high_resolution_clock> myResumeTime;
 
-    EmulationWorker(const EmulationWorker&) = delete;
+    // Scheduling statistics
+    Stats myStats;
 
+  private:
+    EmulationWorker(const EmulationWorker&) = delete;
     EmulationWorker(EmulationWorker&&) = delete;
-
     EmulationWorker& operator=(const EmulationWorker&) = delete;
-
     EmulationWorker& operator=(EmulationWorker&&) = delete;
 };
 
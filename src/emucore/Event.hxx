@@ -18,7 +18,7 @@
 #ifndef EVENT_HXX
 #define EVENT_HXX
 
-#include <mutex>
+#include <atomic>
 #include <set>
 
 #include "bspf.hxx"
@@ -205,20 +205,27 @@ class Event
   public:
     /**
       Get the value associated with the event of the specified type.
+
+      Values are read and written without locking; each value is atomic on
+      its own, and no ordering between different values is implied.
+
+      Input is frame-synchronous without any batching: the event handler
+      only sets values from OSystem::mainLoop() while the emulation worker
+      is stopped, and the worker picks them up together with the start of
+      its next timeslice (EmulationWorker::start() publishes everything
+      written before it). Deferring the sets into a batch would also break
+      the event handler, which reads back switch values right after setting
+      them.
     */
     Int32 get(Type type) const {
-      std::lock_guard<std::mutex> lock(myMutex);
-
-      return myValues[type];
+      return myValues[type].load(std::memory_order_relaxed);
     }
 
     /**
       Set the value associated with the event of the specified type.
     */
     void set(Type type, Int32 value) {
-      std::lock_guard<std::mutex> lock(myMutex);
-
-      myValues[type] = value;
+      myValues[type].store(value, std::memory_order_relaxed);
     }
 
     /**
@@ -226,9 +233,8 @@ class Event
     */
     void clear()
     {
-      std::lock_guard<std::mutex> lock(myMutex);
-
-      myValues.fill(Event::NoType);
+      for(auto& value: myValues)
+        value.store(Event::NoType, std::memory_order_relaxed);
     }
 
     /**
@@ -252,9 +258,7 @@ class Event
 
   private:
     // Array of values associated with each event type
-    std::array<Int32, LastType> myValues;
-
-    mutable std::mutex myMutex;
+    std::array<std::atomic<Int32>, LastType> myValues;
 
   private:
     // Following constructors and assignment operators not supported
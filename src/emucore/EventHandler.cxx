@@ -280,8 +280,9 @@ void EventHandler::poll(uInt64 time)
       myOSystem.state().update();
 
   #ifdef CHEATCODE_SUPPORT
-    for(const auto& cheat: myOSystem.cheat().perFrame())
-      cheat->evaluate();
+    if(myOSystem.hasCheatManager())
+      for(const auto& cheat: myOSystem.cheat().perFrame())
+        cheat->evaluate();
   #endif
 
   #ifdef IMAGE_SUPPORT
@@ -335,6 +335,12 @@ size_t FSNode::getSize() const
   return (_realNode && _realNode->exists()) ? _realNode->getSize() : 0;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt64 FSNode::getModTime() const
+{
+  return (_realNode && _realNode->exists()) ? _realNode->getModTime() : 0;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 size_t FSNode::read(ByteBuffer& buffer, size_t size) const
 {
@@ -250,6 +250,14 @@ class FSNode
      */
     size_t getSize() const;
 
+    /**
+     * Get the last modification time of the current node path.
+     *
+     * @return  Modification time (in nanoseconds since the epoch, at the
+     *          resolution of the filesystem), or 0 if unknown.
+     */
+    uInt64 getModTime() const;
+
     /**
      * Read data (binary format) into the given buffer.
      *
@@ -452,6 +460,14 @@ class AbstractFSNode
      */
     virtual size_t getSize() const { return 0; }
 
+    /**
+     * Get the last modification time of the current node path.
+     *
+     * @return  Modification time (in nanoseconds since the epoch, at the
+     *          resolution of the filesystem), or 0 if unknown.
+     */
+    virtual uInt64 getModTime() const { return 0; }
+
     /**
      * Read data (binary format) into the given buffer.
      *
@@ -295,7 +295,7 @@ FBInitStatus FrameBuffer::createDisplay(string_view title, BufferType type,
   const GUI::Font& f = hidpiEnabled() ? infoFont() : font();
   myStatsMsg.color = kColorInfo;
   myStatsMsg.w = f.getMaxCharWidth() * 40 + 3;
-  myStatsMsg.h = (f.getFontHeight() + 2) * 3;
+  myStatsMsg.h = (f.getFontHeight() + 2) * 4;
 
   if(!myStatsMsg.surface)
   {
@@ -747,7 +747,8 @@ void FrameBuffer::drawFrameStats(float framesPerSecond)
     myStatsMsg.surface->drawString(f, ss.view(), xPos, yPos,
                                    myStatsMsg.w, myStatsMsg.color, TextAlign::Left, 0, true, kBGColor);
 
-  if(myOSystem.settings().getBool("dev.settings"))
+  const bool devSettings = myOSystem.settings().getBool("dev.settings");
+  if(devSettings)
   {
     xPosEnd = myStatsMsg.surface->drawString(f, "| ", xPosEnd, yPos,
                                   myStatsMsg.w, color, TextAlign::Left, 0, true, kBGColor);
@@ -762,12 +763,31 @@ void FrameBuffer::drawFrameStats(float framesPerSecond)
     }
     myStatsMsg.surface->drawString(f, ss.view(), xPosEnd, yPos,
         myStatsMsg.w, color, TextAlign::Left, 0, true, kBGColor);
+
+    // draw emulation worker scheduling (average/maximum wakeup latency and
+    // the timeslices that finished late)
+    const EmulationWorker::Stats& stats = myOSystem.emulationStats();
+
+    yPos += dy;
+    ss.str("");
+    ss
+      << "Wakeup "
+      << (stats.wakeups ? stats.totalWakeupLatency / stats.wakeups : 0)
+      << "/" << stats.maxWakeupLatency << "us, "
+      << stats.overruns << " late";
+    myStatsMsg.surface->drawString(f, ss.view(), xPos, yPos,
+        myStatsMsg.w, stats.overruns ? kDbgColorRed : myStatsMsg.color,
+        TextAlign::Left, 0, true, kBGColor);
   }
 
+  // the worker statistics line is only shown in developer mode
+  const int h = devSettings ? myStatsMsg.h : dy * 3;
+
+  myStatsMsg.surface->setSrcSize(myStatsMsg.w, h);
   myStatsMsg.surface->setDstPos(imageRect().x() + imageRect().w() / 64,
                                 imageRect().y() + imageRect().h() / 64);
   myStatsMsg.surface->setDstSize(myStatsMsg.w * hidpiScaleFactor(),
-                                 myStatsMsg.h * hidpiScaleFactor());
+                                 h * hidpiScaleFactor());
   myStatsMsg.surface->render();
 #endif
 }
@@ -51,6 +51,7 @@
 #include "EventHandler.hxx"
 #include "PNGLibrary.hxx"
 #include "JPGLibrary.hxx"
+#include "ImageCache.hxx"
 #include "Console.hxx"
 #include "Random.hxx"
 #include "StateManager.hxx"
@@ -62,6 +63,7 @@
 #include "TIA.hxx"
 #include "DispatchResult.hxx"
 #include "EmulationWorker.hxx"
+#include "FrameCapture.hxx"
 #include "AudioSettings.hxx"
 #include "M6532.hxx"
 
@@ -101,6 +103,7 @@ OSystem::OSystem()
   mySettings = MediaFactory::createSettings();
 
   myPropSet = make_unique<PropertiesSet>();
+  myRomCatalogue = make_unique<RomCatalogue>();
 
   Logger::instance().setLogParameters(Logger::Level::MAX, false);
 }
@@ -120,7 +123,12 @@ OSystem::~OSystem()
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool OSystem::initialize(const Settings::Options& options)
 {
+  const uInt64 startTicks = TimerManager::getTicks();
+  uInt64 ticks = startTicks;
+
   loadConfig(options);
+  myStartupTrace = mySettings->getBool("startuptrace");
+  traceStartup("Settings", ticks);
 
   ostringstream buf;
   buf << "Stella " << STELLA_VERSION << '\n'
@@ -154,41 +162,46 @@ bool OSystem::initialize(const Settings::Options& options)
     Logger::error(e.what());
     return false;
   }
+  traceStartup("FrameBuffer", ticks);
 
   // Create the event handler for the system
   myEventHandler = MediaFactory::createEventHandler(*this);
   myEventHandler->initialize();
+  traceStartup("EventHandler", ticks);
 
   myStateManager = make_unique<StateManager>(*this);
   myTimerManager = make_unique<TimerManager>();
+  myFrameCapture = make_unique<FrameCapture>(*this);
 
   myAudioSettings = make_unique<AudioSettings>(*mySettings);
+  traceStartup("Managers", ticks);
 
   // Create the sound object; the sound subsystem isn't actually
   // opened until needed, so this is non-blocking (on those systems
   // that only have a single sound device (no hardware mixing))
   createSound();
+  traceStartup("Sound", ticks);
 
   // Create random number generator
   myRandom = make_unique<Random>(static_cast<uInt32>(TimerManager::getTicks()));
 
-#ifdef CHEATCODE_SUPPORT
-  myCheatManager = make_unique<CheatManager>(*this);
-  myCheatManager->loadCheatDatabase();
-#endif
+  // The cheat manager, launcher and time machine are only created when
+  // first used (see 'cheat()', 'launcher()' and 'timeMachine()'), since
+  // many runs (-rominfo, a ROM given on the commandline, etc) never need
+  // them
 
 #ifdef GUI_SUPPORT
-  // Create various subsystems (menu and launcher GUI objects, etc)
+  // Create various subsystems (menu GUI objects, etc); their dialogs are
+  // only created when first shown
   myOptionsMenu = make_unique<OptionsMenu>(*this);
   myCommandMenu = make_unique<CommandMenu>(*this);
   myHighScoresManager = make_unique<HighScoresManager>(*this);
   myHighScoresMenu = make_unique<HighScoresMenu>(*this);
   myMessageMenu = make_unique<MessageMenu>(*this);
   myPlusRomMenu = make_unique<PlusRomsMenu>(*this);
-  myTimeMachine = make_unique<TimeMachine>(*this);
-  myLauncher = make_unique<Launcher>(*this);
 
   myHighScoresManager->setRepository(getHighscoreRepository());
+  traceStartup("Menus", ticks);
 #endif
 
 #ifdef IMAGE_SUPPORT
@@ -196,6 +209,9 @@ bool OSystem::initialize(const Settings::Options& options)
   myPNGLib = make_unique<PNGLibrary>(*this);
   // Create JPG handler
   myJPGLib = make_unique<JPGLibrary>(*this);
+  // Create cache for decoded images; its thread is only started when needed
+  myImageCache = make_unique<ImageCache>(*this);
+  traceStartup("Image libraries", ticks);
 #endif
 
   // Detect serial port for AtariVox-USB
@@ -206,10 +222,70 @@ bool OSystem::initialize(const Settings::Options& options)
 
   if(avoxport.empty() && !ports.empty())
     mySettings->setValue("avoxport", ports[0]);
+  traceStartup("Serial ports", ticks);
+
+  ticks = startTicks;
+  traceStartup("Total", ticks);
 
   return true;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void OSystem::traceStartup(string_view subsystem, uInt64& ticks) const
+{
+  const uInt64 now = TimerManager::getTicks();
+
+  if(myStartupTrace)
+  {
+    ostringstream buf;
+    buf << "Startup: " << std::left << std::setw(16) << subsystem
+        << std::right << std::setw(9) << (now - ticks) << " us";
+    Logger::log(buf.view());
+  }
+  ticks = now;
+}
+
+#ifdef CHEATCODE_SUPPORT
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+CheatManager& OSystem::cheat()
+{
+  if(!myCheatManager)
+  {
+    uInt64 ticks = TimerManager::getTicks();
+    myCheatManager = make_unique<CheatManager>(*this);
+    myCheatManager->loadCheatDatabase();
+    traceStartup("CheatManager", ticks);
+  }
+  return *myCheatManager;
+}
+#endif
+
+#ifdef GUI_SUPPORT
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+Launcher& OSystem::launcher()
+{
+  if(!myLauncher)
+  {
+    uInt64 ticks = TimerManager::getTicks();
+    myLauncher = make_unique<Launcher>(*this);
+    traceStartup("Launcher", ticks);
+  }
+  return *myLauncher;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+TimeMachine& OSystem::timeMachine()
+{
+  if(!myTimeMachine)
+  {
+    uInt64 ticks = TimerManager::getTicks();
+    myTimeMachine = make_unique<TimeMachine>(*this);
+    traceStartup("TimeMachine", ticks);
+  }
+  return *myTimeMachine;
+}
+#endif
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void OSystem::loadConfig(const Settings::Options& options)
 {
@@ -232,6 +308,8 @@ void OSystem::loadConfig(const Settings::Options& options)
 
   mySettings->setRepository(getSettingsRepository());
   myPropSet->setRepository(getPropertyRepository());
+  myRomCatalogue->setRepository(getRomCatalogueRepository(),
+                                getRomDetectionRepository());
 
   mySettings->load(options);
 
@@ -406,7 +484,7 @@ FBInitStatus OSystem::createFrameBuffer()
 
   #ifdef GUI_SUPPORT
     case EventHandlerState::LAUNCHER:
-      if((fbstatus = myLauncher->initializeVideo()) != FBInitStatus::Success)
+      if((fbstatus = launcher().initializeVideo()) != FBInitStatus::Success)
         return fbstatus;
       break;
   #endif
@@ -482,7 +560,11 @@ string OSystem::createConsole(const FSNode& rom, string_view md5sum, bool newrom
     myConsole->attachDebugger(*myDebugger);
   #endif
   #ifdef CHEATCODE_SUPPORT
-    myCheatManager->loadCheats(myRomMD5);
+    // Without a cheat database or cheats on the commandline, there is
+    // nothing to load until the user adds cheats
+    if(myCheatManager || myCheatFile.exists() ||
+       !mySettings->getString("cheat").empty())
+      cheat().loadCheats(myRomMD5);
   #endif
     myEventHandler->reset(EventHandlerState::EMULATION);
     myEventHandler->setMouseControllerMode(mySettings->getString("usemouse"));
@@ -494,6 +576,11 @@ string OSystem::createConsole(const FSNode& rom, string_view md5sum, bool newrom
     }
     myConsole->initializeAudio();
 
+    // Start recording, if requested
+    const string& capture = mySettings->getString("capture");
+    if(!capture.empty())
+      myFrameCapture->startRecording(capture);
+
     const string saveOnExit = settings().getString("saveonexit");
     const bool devSettings = settings().getBool("dev.settings");
     const bool activeTM = settings().getBool(
@@ -611,7 +698,7 @@ bool OSystem::createLauncher(string_view startdir)
   myEventHandler->reset(EventHandlerState::LAUNCHER);
   if(createFrameBuffer() == FBInitStatus::Success)
   {
-    myLauncher->reStack();
+    launcher().reStack();
     myFrameBuffer->setCursorState();
 
     status = true;
@@ -638,10 +725,17 @@ bool OSystem::launcherLostFocus()
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 string OSystem::getROMInfo(const FSNode& romfile)
 {
+  // Use the info printed for an earlier console, if nothing it depends on
+  // has changed since
+  RomCatalogue::Entry entry;
+  if(!mySettings->getBool("redetect") && myRomCatalogue->get(romfile, entry) &&
+     !entry.info.empty() && entry.infoKey == romInfoKey(entry.md5))
+    return entry.info;
+
   unique_ptr<Console> console;
+  string md5;
   try
   {
-    string md5;
     console = openConsole(romfile, md5);
   }
   catch(const runtime_error& e)
@@ -651,7 +745,18 @@ string OSystem::getROMInfo(const FSNode& romfile)
     return buf.str();
   }
 
-  return getROMInfo(*console);
+  const string info = getROMInfo(*console);
+
+  // Multicarts load a different ROM each time, so their info isn't stored
+  if(console->cartridge().multiCartID().empty())
+  {
+    entry = console->catalogueEntry();
+    entry.info = info;
+    entry.infoKey = romInfoKey(md5);
+    myRomCatalogue->save(romfile, entry);
+  }
+
+  return info;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -761,7 +866,28 @@ unique_ptr<Console> OSystem::openConsole(const FSNode& romfile, string& md5)
 
     // Finally, create the cart with the correct properties
     if(cart)
-      console = make_unique<Console>(*this, cart, props, *myAudioSettings);
+    {
+      // Use the results of earlier autodetection, which are only valid for
+      // the complete ROM image (ie, not for parts of a multicart); these
+      // are looked up by file first, and then by MD5 for new or changed files
+      const bool isMultiCart = !cart->multiCartID().empty();
+      RomCatalogue::Entry catalogued;
+      if(!isMultiCart && (mySettings->getBool("redetect") ||
+         ((!myRomCatalogue->get(romfile, catalogued) || catalogued.md5 != md5) &&
+          !myRomCatalogue->get(md5, catalogued))))
+      {
+        catalogued = RomCatalogue::Entry{};
+        catalogued.md5 = md5;
+      }
+      if(!isMultiCart && type == "AUTO")
+        catalogued.type = cart->detectedType();
+
+      console = make_unique<Console>(*this, cart, props, *myAudioSettings,
+                                     catalogued);
+
+      if(!isMultiCart && console->catalogueEntry() != catalogued)
+        myRomCatalogue->save(romfile, console->catalogueEntry());
+    }
   }
 
   return console;
@@ -772,9 +898,12 @@ void OSystem::closeConsole()
 {
   if(myConsole)
   {
+    myFrameCapture->stopRecording();
+
   #ifdef CHEATCODE_SUPPORT
     // If a previous console existed, save cheats before creating a new one
-    myCheatManager->saveCheats(myConsole->properties().get(PropType::Cart_MD5));
+    if(myCheatManager)
+      myCheatManager->saveCheats(myConsole->properties().get(PropType::Cart_MD5));
   #endif
     myConsole.reset();
   }
@@ -871,6 +1000,26 @@ string OSystem::getROMInfo(const Console& console)
   return buf.str();
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+string OSystem::romInfoKey(const string& md5) const
+{
+  Properties props;
+  myPropSet->getMD5(md5, props);
+
+  ostringstream buf;
+  for(uInt8 i = 0; i < static_cast<uInt8>(PropType::NumTypes); ++i)
+    buf << props.get(static_cast<PropType>(i)) << '\n';
+
+  // The commandline properties used by openConsole() for the ROM info, and
+  // the settings used by the autodetection and controller descriptions
+  for(const auto& name: {"bs", "type", "sp", "lc", "lq1", "lq2", "rc", "rq1",
+                         "rq2", "bc", "aq", "format", "detectpal60",
+                         "detectntsc50", "avoxport"})
+    buf << name << '=' << mySettings->getString(name) << '\n';
+
+  return MD5::hash(buf.view());
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 float OSystem::frameRate() const
 {
@@ -886,15 +1035,6 @@ double OSystem::dispatchEmulation(EmulationWorker& emulationWorker)
   const EmulationTiming& timing = myConsole->emulationTiming();
   DispatchResult dispatchResult;
 
-  // Check whether we have a frame pending for rendering...
-  const bool framePending = tia.newFramePending();
-  // ... and copy it to the frame buffer. It is important to do this before
-  // the worker is started to avoid racing.
-  if (framePending) {
-    myFpsMeter.render(tia.framesSinceLastRender());
-    tia.renderToFrameBuffer();
-  }
-
   // Start emulation on a dedicated thread. It will do its own scheduling to
   // sync 6507 and real time and will run until we stop the worker.
   emulationWorker.start(
@@ -905,12 +1045,22 @@ double OSystem::dispatchEmulation(EmulationWorker& emulationWorker)
     &tia
   );
 
+  // Check whether we have a frame pending for rendering and grab the newest
+  // one. The TIA hands completed frames over lock-free, so this is safe while
+  // the worker is running.
+  const uInt32 framesPending = tia.renderToFrameBuffer();
+
   // Render the frame. This may block, but emulation will continue to run on
   // the worker, so the audio pipeline is kept fed :)
-  if (framePending) myFrameBuffer->updateInEmulationMode(myFpsMeter.fps());
+  if (framesPending) {
+    myFpsMeter.render(framesPending);
+    myFrameCapture->addFrame(tia, framesPending);
+    myFrameBuffer->updateInEmulationMode(myFpsMeter.fps());
+  }
 
   // Stop the worker and wait until it has finished
   const uInt64 totalCycles = emulationWorker.stop();
+  myEmulationStats = emulationWorker.stats();
 
   // Handle the dispatch result
   switch (dispatchResult.getStatus()) {
@@ -971,6 +1121,7 @@ void OSystem::mainLoop()
 
     if (!wasEmulation && myEventHandler->state() == EventHandlerState::EMULATION) {
       myFpsMeter.reset();
+      emulationWorker.resetStats();
       virtualTime = high_resolution_clock::now();
     }
 
@@ -1016,10 +1167,13 @@ void OSystem::mainLoop()
 
   // Cleanup time
 #ifdef CHEATCODE_SUPPORT
-  if(myConsole)
-    myCheatManager->saveCheats(myConsole->properties().get(PropType::Cart_MD5));
-
-  myCheatManager->saveCheatDatabase();
+  // Nothing can have changed if the cheat manager was never created
+  if(myCheatManager)
+  {
+    if(myConsole)
+      myCheatManager->saveCheats(myConsole->properties().get(PropType::Cart_MD5));
+    myCheatManager->saveCheatDatabase();
+  }
 #endif
 }
 
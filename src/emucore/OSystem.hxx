@@ -28,8 +28,8 @@ class Sound;
 class StateManager;
 class TimerManager;
 class HighScoresManager;
-class EmulationWorker;
 class AudioSettings;
+class FrameCapture;
 #ifdef CHEATCODE_SUPPORT
   class CheatManager;
 #endif
@@ -49,6 +49,7 @@ class AudioSettings;
 #ifdef IMAGE_SUPPORT
   class PNGLibrary;
   class JPGLibrary;
+  class ImageCache;
 #endif
 
 #include <chrono>
@@ -57,6 +58,8 @@ class AudioSettings;
 #include "FrameBufferConstants.hxx"
 #include "EventHandlerConstants.hxx"
 #include "FpsMeter.hxx"
+#include "EmulationWorker.hxx"
+#include "RomCatalogue.hxx"
 #include "Settings.hxx"
 #include "Logger.hxx"
 #include "bspf.hxx"
@@ -135,6 +138,13 @@ class OSystem
     */
     PropertiesSet& propSet() const { return *myPropSet; }
 
+    /**
+      Get the catalogue of previously seen ROM files.
+
+      @return The ROM catalogue object
+    */
+    RomCatalogue& romCatalogue() const { return *myRomCatalogue; }
+
     /**
       Get the console of the system.  The console won't always exist,
       so we should test if it's available.
@@ -174,6 +184,13 @@ class OSystem
     */
     TimerManager& timer() const { return *myTimerManager; }
 
+    /**
+      Get the asynchronous frame/audio capture pipeline of the system.
+
+      @return The framecapture object
+    */
+    FrameCapture& capture() const { return *myFrameCapture; }
+
     /**
       This method should be called to save the current settings. It first asks
       each subsystem to update its settings, then it saves all settings to the
@@ -183,11 +200,18 @@ class OSystem
 
   #ifdef CHEATCODE_SUPPORT
     /**
-      Get the cheat manager of the system.
+      Get the cheat manager of the system.  It is created, and the cheat
+      database loaded, on first use.
 
       @return The cheatmanager object
     */
-    CheatManager& cheat() const { return *myCheatManager; }
+    CheatManager& cheat();
+
+    /**
+      Answer whether the cheat manager has been created; if not, no cheats
+      can be active.
+    */
+    bool hasCheatManager() const { return myCheatManager != nullptr; }
   #endif
 
   #ifdef DEBUGGER_SUPPORT
@@ -236,18 +260,19 @@ class OSystem
     PlusRomsMenu& plusRomsMenu() const { return *myPlusRomMenu; }
 
     /**
-      Get the ROM launcher of the system.
+      Get the ROM launcher of the system.  It is created on first use.
 
       @return The launcher object
     */
-    Launcher& launcher() const { return *myLauncher; }
+    Launcher& launcher();
 
     /**
-      Get the time machine of the system (manages state files).
+      Get the time machine of the system (manages state files).  It is
+      created on first use.
 
       @return The time machine object
     */
-    TimeMachine& timeMachine() const { return *myTimeMachine; }
+    TimeMachine& timeMachine();
   #endif
 
   #ifdef IMAGE_SUPPORT
@@ -264,6 +289,13 @@ class OSystem
       @return The JPGlib object
     */
     JPGLibrary& jpg() const { return *myJPGLib; }
+
+    /**
+      Get the cache of decoded images of the system.
+
+      @return The imagecache object
+    */
+    ImageCache& imageCache() const { return *myImageCache; }
 #endif
 
     /**
@@ -356,6 +388,21 @@ class OSystem
     */
     static string getROMMD5(const FSNode& rom);
 
+    /**
+      Open the given ROM and return an array containing its contents.
+      This method takes care of using only a valid size for the
+      ROM, and may be called from any thread.
+
+      @param romfile  The file node of the ROM to open (contains path)
+      @param size     The amount of data read into the image array
+      @param showErrorMessage  Whether to show (or ignore) any errors
+                               when opening the ROM
+
+      @return  Unique pointer to the array, otherwise nullptr
+    */
+    static ByteBuffer openROM(const FSNode& romfile, size_t& size,
+                              bool showErrorMessage);
+
     /**
       Creates a new game console from the specified romfile, and correctly
       initializes the system state to start emulation of the Console.
@@ -406,7 +453,9 @@ class OSystem
 
     /**
       Gets all possible info about the ROM by creating a temporary
-      Console object and querying it.
+      Console object and querying it.  The result is stored in the ROM
+      catalogue, and reused while the file, its properties and the
+      relevant settings are unchanged.
 
       @param romfile  The file node of the ROM to use
       @return  Some information about this ROM
@@ -446,6 +495,14 @@ class OSystem
 
     float frameRate() const;
 
+    /**
+      Answer the scheduling statistics of the emulation worker, as of the end
+      of the last timeslice (reset whenever emulation mode is entered).
+    */
+    const EmulationWorker::Stats& emulationStats() const {
+      return myEmulationStats;
+    }
+
     /**
       Attempt to override the base directory that will be used by derived
       classes, and use this one instead.  Note that this is only a hint;
@@ -486,6 +543,10 @@ class OSystem
 
     virtual shared_ptr<CompositeKeyValueRepositoryAtomic> getHighscoreRepository() = 0;
 
+    virtual shared_ptr<KeyValueRepositoryAtomic> getRomCatalogueRepository() = 0;
+
+    virtual shared_ptr<KeyValueRepositoryAtomic> getRomDetectionRepository() = 0;
+
   protected:
 
     //////////////////////////////////////////////////////////////////////
@@ -531,6 +592,9 @@ class OSystem
     // Pointer to the PropertiesSet object
     unique_ptr<PropertiesSet> myPropSet;
 
+    // Pointer to the RomCatalogue object
+    unique_ptr<RomCatalogue> myRomCatalogue;
+
     // Pointer to the (currently defined) Console object
     unique_ptr<Console> myConsole;
 
@@ -576,6 +640,9 @@ class OSystem
 
     // JPG object responsible for loading/saving JPG images
     unique_ptr<JPGLibrary> myJPGLib;
+
+    // Cache of decoded PNG/JPG images, decoding them in the background
+    unique_ptr<ImageCache> myImageCache;
   #endif
 
     // Pointer to the StateManager object
@@ -584,6 +651,9 @@ class OSystem
     // Pointer to the TimerManager object
     unique_ptr<TimerManager> myTimerManager;
 
+    // Pointer to the FrameCapture object
+    unique_ptr<FrameCapture> myFrameCapture;
+
   #ifdef GUI_SUPPORT
     // Pointer to the HighScoresManager object
     unique_ptr<HighScoresManager> myHighScoresManager;
@@ -598,6 +668,9 @@ class OSystem
     // Indicates whether to stop the main loop
     bool myQuitLoop{false};
 
+    // Indicates whether to log how long each subsystem took to create
+    bool myStartupTrace{false};
+
   private:
     FSNode myBaseDir, myStateDir, mySnapshotSaveDir, mySnapshotLoadDir,
            myNVRamDir, myCfgDir, myHomeDir, myUserDir, myBezelDir;
@@ -610,6 +683,9 @@ class OSystem
     static constexpr uInt32 FPS_METER_QUEUE_SIZE = 100;
     FpsMeter myFpsMeter{FPS_METER_QUEUE_SIZE};
 
+    // Copy of the emulation worker statistics, taken while it is stopped
+    EmulationWorker::Stats myEmulationStats;
+
     // If not empty, a hint for derived classes to use this as the
     // base directory (where all settings are stored)
     // Derived classes are free to ignore it and use their own defaults
@@ -630,18 +706,13 @@ class OSystem
     void createSound();
 
     /**
-      Open the given ROM and return an array containing its contents.
-      This method takes care of using only a valid size for the
+      If 'startuptrace' is enabled, log the time elapsed since the given
+      timestamp as the creation time of the given subsystem.
 
-      @param romfile  The file node of the ROM to open (contains path)
-      @param size     The amount of data read into the image array
-      @param showErrorMessage  Whether to show (or ignore) any errors
-                               when opening the ROM
-
-      @return  Unique pointer to the array, otherwise nullptr
+      @param subsystem  The name of the subsystem just created
+      @param ticks      The time creation started; updated to the current time
     */
-    static ByteBuffer openROM(const FSNode& romfile, size_t& size,
-                              bool showErrorMessage);
+    void traceStartup(string_view subsystem, uInt64& ticks) const;
 
     /**
       Creates an actual Console object based on the given info.
@@ -666,6 +737,16 @@ class OSystem
     */
     static string getROMInfo(const Console& console);
 
+    /**
+      Answer a fingerprint of everything besides the ROM file itself which
+      goes into the info about a console created for it (ie, its properties
+      and the settings overriding them or controlling autodetection).
+
+      @param md5  The MD5 of the ROM
+      @return  The fingerprint, for validating a cached ROM info
+    */
+    string romInfoKey(const string& md5) const;
+
     double dispatchEmulation(EmulationWorker& emulationWorker);
 
     // Following constructors and assignment operators not supported
@@ -49,6 +49,18 @@ shared_ptr<CompositeKeyValueRepositoryAtomic> OSystemStandalone::getHighscoreRep
   return {myStellaDb, &myStellaDb->highscoreRepository()};
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+shared_ptr<KeyValueRepositoryAtomic> OSystemStandalone::getRomCatalogueRepository()
+{
+  return {myStellaDb, &myStellaDb->romCatalogueRepository()};
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+shared_ptr<KeyValueRepositoryAtomic> OSystemStandalone::getRomDetectionRepository()
+{
+  return {myStellaDb, &myStellaDb->romDetectionRepository()};
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void OSystemStandalone::getBaseDirectories(
     string& basedir, string& homedir, bool useappdir, string_view usedir)
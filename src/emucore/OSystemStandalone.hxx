@@ -34,6 +34,10 @@ class OSystemStandalone : public OSystem
 
     shared_ptr<CompositeKeyValueRepositoryAtomic> getHighscoreRepository() override;
 
+    shared_ptr<KeyValueRepositoryAtomic> getRomCatalogueRepository() override;
+
+    shared_ptr<KeyValueRepositoryAtomic> getRomDetectionRepository() override;
+
   protected:
 
     void initPersistence(FSNode& basedir) override;
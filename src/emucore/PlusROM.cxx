@@ -17,7 +17,10 @@
 
 #include <regex>
 #include <atomic>
+#include <deque>
+#include <mutex>
 #include <thread>
+#include <condition_variable>
 
 #include "bspf.hxx"
 #include "PlusROM.hxx"
@@ -47,11 +50,12 @@ using std::chrono::milliseconds;
 class PlusROMRequest {
   public:
     struct Destination {
-      Destination(string_view _host, string_view _path)
-        : host{_host}, path{_path} {}
+      Destination(string_view _host, string_view _path, string_view _local)
+        : host{_host}, path{_path}, local{_local} {}
 
       string host;
       string path;
+      string local;  // Unix domain socket of a local backend, if not empty
     };
 
     struct PlusStoreId {
@@ -89,10 +93,23 @@ class PlusROMRequest {
         << "id=" << myId.id << "; "
         << "nick=" << myId.nick;
 
+    #if !defined(BSPF_WINDOWS)
+      const bool isLocal = !myDestination.local.empty();
+      httplib::Client client = isLocal
+        ? httplib::Client(myDestination.local, 80)
+        : httplib::Client(myDestination.host);
+      if(isLocal)
+        client.set_address_family(AF_UNIX);
+    #else
+      const bool isLocal = false;
       httplib::Client client(myDestination.host);
-      const httplib::Headers headers = {
+    #endif
+      httplib::Headers headers = {
         {"PlusROM-Info", content.str()}  // httplib can't accept string_view
       };
+      // Let the local backend know which host the ROM wanted to talk to
+      if(isLocal)
+        headers.emplace("Host", myDestination.host);
 
       client.set_connection_timeout(milliseconds(CONNECTION_TIMEOUT_MSEC));
       client.set_read_timeout(milliseconds(READ_TIMEOUT_MSEC));
@@ -196,6 +213,156 @@ class PlusROMRequest {
     PlusROMRequest& operator=(PlusROMRequest&&) = delete;
 };
 
+#if defined(HTTP_LIB_SUPPORT)
+/**
+  A single, reusable background thread which executes the queued requests
+  in order.  Finished requests are collected in a small ring, from which
+  the emulation picks up the responses without ever blocking on the network.
+
+  The thread is started with the first request and keeps a reference to the
+  worker, so that a request still in flight when the cart is destroyed can
+  finish safely.
+*/
+class PlusROMWorker : public std::enable_shared_from_this<PlusROMWorker>
+{
+  public:
+    using Callback = std::function<void(const PlusROMRequest&)>;
+
+  public:
+    explicit PlusROMWorker(Callback callback)
+      : myCallback{std::move(callback)} {}
+    ~PlusROMWorker() = default;
+
+    /**
+      Queue a request for execution.  Fails if the maximum number of
+      requests are already queued, executing or waiting to be received.
+    */
+    bool submit(const shared_ptr<PlusROMRequest>& request)
+    {
+      const std::scoped_lock lock(myMutex);
+
+      if(myQueue.size() + myCompletedCount + (myBusy ? 1 : 0)
+         >= MAX_CONCURRENT_REQUESTS)
+        return false;
+
+      myQueue.push_back(request);
+      if(!myStarted)
+      {
+        std::thread(&PlusROMWorker::run, shared_from_this()).detach();
+        myStarted = true;
+      }
+      myCondition.notify_one();
+
+      return true;
+    }
+
+    /**
+      Take the oldest finished request from the ring, or nullptr if none.
+    */
+    shared_ptr<PlusROMRequest> nextCompleted()
+    {
+      const std::scoped_lock lock(myMutex);
+
+      if(myCompletedCount == 0)
+        return nullptr;
+
+      auto request = std::move(myCompleted[myCompletedPos]);
+      myCompletedPos = (myCompletedPos + 1) % myCompleted.size();
+      --myCompletedCount;
+
+      return request;
+    }
+
+    /**
+      Discard all queued and finished requests; the response of a request
+      currently executing is dropped as well.
+    */
+    void clear()
+    {
+      const std::scoped_lock lock(myMutex);
+
+      myQueue.clear();
+      for(auto& request: myCompleted)
+        request.reset();
+      myCompletedCount = myCompletedPos = 0;
+      ++myGeneration;
+    }
+
+    /**
+      Tell the thread to quit.  No callbacks are made once this returns.
+    */
+    void stop()
+    {
+      {
+        const std::scoped_lock lock(myMutex);
+
+        myQueue.clear();
+        myCallback = nullptr;
+        myQuit = true;
+      }
+      myCondition.notify_one();
+    }
+
+  private:
+    void run()
+    {
+      std::unique_lock lock(myMutex);
+
+      while(true)
+      {
+        myCondition.wait(lock, [this]{ return myQuit || !myQueue.empty(); });
+        if(myQuit)
+          return;
+
+        const auto request = std::move(myQueue.front());
+        myQueue.pop_front();
+        const uInt32 generation = myGeneration;
+        myBusy = true;
+
+        lock.unlock();
+        request->execute();
+        lock.lock();
+
+        myBusy = false;
+        if(myQuit)
+          return;
+
+        if(myCallback)
+          myCallback(*request);
+
+        if(generation == myGeneration)
+        {
+          myCompleted[(myCompletedPos + myCompletedCount) % myCompleted.size()]
+            = request;
+          ++myCompletedCount;
+        }
+      }
+    }
+
+  private:
+    std::mutex myMutex;
+    std::condition_variable myCondition;
+
+    std::deque<shared_ptr<PlusROMRequest>> myQueue;
+
+    // Ring of finished requests; submit() makes sure it can't overflow
+    std::array<shared_ptr<PlusROMRequest>, MAX_CONCURRENT_REQUESTS> myCompleted;
+    size_t myCompletedPos{0}, myCompletedCount{0};
+
+    // Incremented by clear(), to drop the response of an executing request
+    uInt32 myGeneration{0};
+
+    Callback myCallback{nullptr};
+    bool myStarted{false}, myBusy{false}, myQuit{false};
+
+  private:
+    PlusROMWorker(const PlusROMWorker&) = delete;
+    PlusROMWorker(PlusROMWorker&&) = delete;
+    PlusROMWorker& operator=(const PlusROMWorker&) = delete;
+    PlusROMWorker& operator=(PlusROMWorker&&) = delete;
+};
+#endif
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 PlusROM::PlusROM(const Settings& settings, const Cartridge& cart)
   : mySettings{settings},
@@ -205,6 +372,15 @@ PlusROM::PlusROM(const Settings& settings, const Cartridge& cart)
   myTxBuffer.fill(0);
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+PlusROM::~PlusROM()
+{
+#if defined(HTTP_LIB_SUPPORT)
+  if(myWorker)
+    myWorker->stop();
+#endif
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool PlusROM::initialize(const ByteBuffer& image, size_t size)
 {
@@ -342,7 +518,10 @@ bool PlusROM::save(Serializer& out) const
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool PlusROM::load(Serializer& in)
 {
-  myPendingRequests.clear();
+#if defined(HTTP_LIB_SUPPORT)
+  if(myWorker)
+    myWorker->clear();
+#endif
 
   try
   {
@@ -365,7 +544,10 @@ bool PlusROM::load(Serializer& in)
 void PlusROM::reset()
 {
   myRxReadPos = myRxWritePos = myTxPos = 0;
-  myPendingRequests.clear();
+#if defined(HTTP_LIB_SUPPORT)
+  if(myWorker)
+    myWorker->clear();
+#endif
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -397,18 +579,6 @@ bool PlusROM::isValidPath(string_view path)
 void PlusROM::send()
 {
 #if defined(HTTP_LIB_SUPPORT)
-  if (myPendingRequests.size() >= MAX_CONCURRENT_REQUESTS) {
-    // Try to make room by consuming any requests that have completed.
-    receive();
-  }
-
-  if (myPendingRequests.size() >= MAX_CONCURRENT_REQUESTS) {
-    Logger::error("PlusCart: max number of concurrent requests exceeded");
-
-    myTxPos = 0;
-    return;
-  }
-
   string id = mySettings.getString("plusroms.id");
 
   if(id == EmptyString)
@@ -418,7 +588,8 @@ void PlusROM::send()
   {
     const string nick = mySettings.getString("plusroms.nick");
     auto request = make_shared<PlusROMRequest>(
-      PlusROMRequest::Destination(myHost, "/" + myPath),
+      PlusROMRequest::Destination(myHost, "/" + myPath,
+                                  mySettings.getString("plusroms.local")),
       PlusROMRequest::PlusStoreId(nick, id),
       myTxBuffer.data(),
       myTxPos
@@ -426,32 +597,34 @@ void PlusROM::send()
 
     myTxPos = 0;
 
-    // We push to the back in order to avoid reverse_iterator in receive()
-    myPendingRequests.push_back(request);
-
-    // The lambda will retain a copy of the shared_ptr that is alive as long
-    // as the thread is running. Thus, the request can only be destructed once
-    // the thread has finished, and we can safely evict it from the deque at
-    // any time.
-    std::thread thread([=, this]()
+    if(!myWorker)
+      myWorker = make_shared<PlusROMWorker>(
+        [this](const PlusROMRequest& executed)
+        {
+          // Called on the worker thread, but never after our destructor
+          switch(executed.getState())
+          {
+            case PlusROMRequest::State::failed:
+              myMsgCallback("PlusROM data sending failed!");
+              break;
+
+            case PlusROMRequest::State::done:
+              myMsgCallback("PlusROM data sent successfully");
+              break;
+
+            default:
+              break;
+          }
+        });
+
+    if(!myWorker->submit(request))
     {
-      request->execute();
-      switch(request->getState())
-      {
-        case PlusROMRequest::State::failed:
-          myMsgCallback("PlusROM data sending failed!");
-          break;
-
-        case PlusROMRequest::State::done:
-          myMsgCallback("PlusROM data sent successfully");
-          break;
-
-        default:
-          break;
-      }
-    });
+      // Try to make room by consuming any requests that have completed.
+      receive();
 
-    thread.detach();
+      if(!myWorker->submit(request))
+        Logger::error("PlusCart: max number of concurrent requests exceeded");
+    }
   }
 #endif
 }
@@ -460,34 +633,30 @@ void PlusROM::send()
 void PlusROM::receive()
 {
 #if defined(HTTP_LIB_SUPPORT)
-  auto iter = myPendingRequests.begin();
+  if(!myWorker)
+    return;
 
-  while(iter != myPendingRequests.end()) {
-    switch((*iter)->getState()) {
+  while(const auto request = myWorker->nextCompleted())
+  {
+    switch(request->getState())
+    {
       case PlusROMRequest::State::failed:
         myMsgCallback("PlusROM data receiving failed!");
-        // Request has failed? -> remove it and start over
-        myPendingRequests.erase(iter);
-        iter = myPendingRequests.begin();
-        continue;
+        break;
 
       case PlusROMRequest::State::done:
       {
         myMsgCallback("PlusROM data received successfully");
-        // Request has finished sucessfully? -> consume the response, remove it
-        // and start over
-        const auto [responseSize, response] = (*iter)->getResponse();
+        // Request has finished sucessfully? -> consume the response
+        const auto [responseSize, response] = request->getResponse();
 
         for(uInt8 i = 0; i < responseSize; i++)
           myRxBuffer[myRxWritePos++] = response[i];
-
-        myPendingRequests.erase(iter);
-        iter = myPendingRequests.begin();
-        continue;
+        break;
       }
 
       default:
-        iter++;
+        break;
     }
   }
 #endif
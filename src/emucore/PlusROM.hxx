@@ -20,8 +20,6 @@
 
 class Settings;
 
-#include <deque>
-
 #include "bspf.hxx"
 #include "Serializable.hxx"
 #include "Cart.hxx"
@@ -45,16 +43,22 @@ class Settings;
     $1FF3 contains the number of (unread) bytes left in the receive buffer
       (these bytes can be from multiple responses)
 
+  Requests are executed in order by a single background worker, so the
+  emulation never waits on the network.  For offline testing, the requests
+  can be redirected to a local PlusStore stand-in, an HTTP server listening
+  on the Unix domain socket given by 'plusroms.local'.
+
   @author  Stephen Anthony
 */
 
 class PlusROMRequest;
+class PlusROMWorker;
 
 class PlusROM : public Serializable
 {
   public:
     PlusROM(const Settings& settings, const Cartridge& cart);
-    ~PlusROM() override = default;
+    ~PlusROM() override;
 
   public:
     /**
@@ -166,7 +170,7 @@ class PlusROM : public Serializable
     void receive();
 
     /**
-      Send pending data to the backend on a thread.
+      Queue pending data for sending to the backend by the worker.
     */
     void send();
 
@@ -181,7 +185,9 @@ class PlusROM : public Serializable
     std::array<uInt8, 256> myRxBuffer, myTxBuffer;
     uInt8 myRxReadPos{0}, myRxWritePos{0}, myTxPos{0};
 
-    std::deque<shared_ptr<PlusROMRequest>> myPendingRequests;
+    // Executes the requests; created with the first request and shared with
+    // its thread, which may outlive us while a request is still in flight
+    shared_ptr<PlusROMWorker> myWorker;
 
     // Callback to output messages
     Cartridge::messageCallback myMsgCallback{nullptr};
@@ -54,12 +54,16 @@ namespace {
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 ProfilingRunner::ProfilingRunner(int argc, char* argv[])
-  : profilingRuns{std::max<size_t>(argc - 2, 0)}
 {
   for (int i = 2; i < argc; i++) {
-    ProfilingRun& run(profilingRuns[i-2]);
-
     const string arg = argv[i];
+
+    if (arg == "-busstats") {
+      myBusStatistics = true;
+      continue;
+    }
+
+    ProfilingRun& run(profilingRuns.emplace_back());
     const size_t splitPoint = arg.find_first_of(':');
 
     run.romFile = splitPoint == string::npos ? arg : arg.substr(0, splitPoint);
@@ -171,6 +175,7 @@ bool ProfilingRunner::runOne(const ProfilingRun& run)
   tia.setLayout(frameLayout);
 
   system.reset();
+  if (myBusStatistics) system.enableBusStatistics(true);
 
   const EmulationTiming emulationTiming(frameLayout, consoleTiming);
   uInt64 cycles = 0;
@@ -207,5 +212,7 @@ bool ProfilingRunner::runOne(const ProfilingRun& run)
   (cout << "100%" << '\n').flush();
   cout << "real time: " << realtimeUsed << " seconds\n";
 
+  if (myBusStatistics) system.printBusStatistics(cout);
+
   return true;
 }
@@ -57,6 +57,9 @@ class ProfilingRunner {
 
     vector<ProfilingRun> profilingRuns;
 
+    // Collect and print bus statistics ('-busstats')
+    bool myBusStatistics{false};
+
     Settings mySettings;
 
     Properties myProps;
@@ -25,6 +25,26 @@
 #include "repository/CompositeKeyValueRepositoryNoop.hxx"
 #include "repository/KeyValueRepositoryPropertyFile.hxx"
 
+namespace {
+  // Convert an MD5 string into the binary form used by DefPropsKeys
+  std::pair<bool, std::array<uInt64, 2>> md5ToKey(string_view md5)
+  {
+    std::array<uInt64, 2> key{};
+    if(md5.size() != 32)
+      return { false, key };
+
+    for(size_t i = 0; i < key.size(); ++i)
+    {
+      const char* const first = md5.data() + i * 16;
+      const char* const last = first + 16;
+      const auto [ptr, ec] = std::from_chars(first, last, key[i], 16);
+      if(ec != std::errc{} || ptr != last)
+        return { false, key };
+    }
+    return { true, key };
+  }
+} // namespace
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 PropertiesSet::PropertiesSet()
   : myRepository{make_shared<CompositeKeyValueRepositoryNoop>()}
@@ -71,29 +91,26 @@ bool PropertiesSet::getMD5(string_view md5, Properties& properties,
     }
   }
 
-  // Otherwise, search the internal database using binary search
+  // Otherwise, search the internal database, which is indexed by the
+  // first 12 bits of the MD5
   if(!found)
   {
-    int low = 0, high = DEF_PROPS_SIZE - 1;
-    while(low <= high)
+    const auto [ok, key] = md5ToKey(md5);
+    if(ok)
     {
-      const int i = (low + high) / 2;
-      const int cmp = BSPF::compareIgnoreCase(md5,
-          DefProps[i][static_cast<uInt8>(PropType::Cart_MD5)]);
-
-      if(cmp == 0)  // found it
+      const size_t prefix = key[0] >> 52;
+      for(uInt32 i = DefPropsIndex[prefix]; i < DefPropsIndex[prefix + 1]; ++i)
       {
-        for(uInt8 p = 0; p < static_cast<uInt8>(PropType::NumTypes); ++p)
-          if(DefProps[i][p][0] != 0)
-            properties.set(PropType{p}, DefProps[i][p]);
-
-        found = true;
-        break;
+        if(DefPropsKeys[i] == key)  // found it
+        {
+          for(uInt8 p = 0; p < static_cast<uInt8>(PropType::NumTypes); ++p)
+            if(DefProps[i][p][0] != 0)
+              properties.set(PropType{p}, DefProps[i][p]);
+
+          found = true;
+          break;
+        }
       }
-      else if(cmp < 0)
-        high = i - 1; // look at lower range
-      else
-        low = i + 1;  // look at upper range
     }
   }
 
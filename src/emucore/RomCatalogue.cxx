@@ -0,0 +1,198 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2024 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#include "Bankswitch.hxx"
+#include "CartDetector.hxx"
+#include "ControllerDetector.hxx"
+#include "FSNode.hxx"
+#include "Logger.hxx"
+#include "MD5.hxx"
+#include "OSystem.hxx"
+#include "json_lib.hxx"
+
+#include "RomCatalogue.hxx"
+
+using json = nlohmann::json;
+
+namespace {
+  // The autodetection results, which are stored both per path and per MD5
+  void detectionToJson(const RomCatalogue::Entry& entry, json& data)
+  {
+    if(!entry.type.empty())         data["type"] = entry.type;
+    if(!entry.format.empty())       data["format"] = entry.format;
+    if(!entry.formatFlags.empty())  data["formatFlags"] = entry.formatFlags;
+    if(!entry.leftPort.empty())     data["leftPort"] = entry.leftPort;
+    if(!entry.rightPort.empty())    data["rightPort"] = entry.rightPort;
+    if(entry.plusROM)               data["plusROM"] = true;
+  }
+
+  void detectionFromJson(const json& data, RomCatalogue::Entry& entry)
+  {
+    entry.type        = data.value("type", "");
+    entry.format      = data.value("format", "");
+    entry.formatFlags = data.value("formatFlags", "");
+    entry.leftPort    = data.value("leftPort", "");
+    entry.rightPort   = data.value("rightPort", "");
+    entry.plusROM     = data.value("plusROM", false);
+  }
+} // namespace
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RomCatalogue::setRepository(shared_ptr<KeyValueRepositoryAtomic> repository,
+                                 shared_ptr<KeyValueRepositoryAtomic> detection)
+{
+  const std::lock_guard<std::mutex> lock(myMutex);
+
+  myRepository = std::move(repository);
+  myDetectionRepository = std::move(detection);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool RomCatalogue::get(const FSNode& rom, Entry& entry) const
+{
+  const uInt64 modTime = rom.getModTime();
+  if(modTime == 0 || !rom.isFile())
+    return false;
+
+  Variant value;
+  {
+    const std::lock_guard<std::mutex> lock(myMutex);
+
+    if(!myRepository || !myRepository->get(rom.getPath(), value))
+      return false;
+  }
+
+  try
+  {
+    const json data = json::parse(value.toString());
+
+    // Make sure the file has not been changed since it was catalogued
+    if(data.at("size").get<uInt64>() != rom.getSize() ||
+       data.at("mtime").get<uInt64>() != modTime)
+      return false;
+
+    entry.md5 = data.at("md5").get<string>();
+    detectionFromJson(data, entry);
+    entry.info    = data.value("info", "");
+    entry.infoKey = data.value("infoKey", "");
+
+    return !entry.md5.empty();
+  }
+  catch(const json::exception& err)
+  {
+    Logger::error("ROM catalogue entry for '" + rom.getShortPath() +
+                  "' is invalid: " + err.what());
+
+    return false;
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool RomCatalogue::get(const string& md5, Entry& entry) const
+{
+  if(md5.empty())
+    return false;
+
+  Variant value;
+  {
+    const std::lock_guard<std::mutex> lock(myMutex);
+
+    if(!myDetectionRepository || !myDetectionRepository->get(md5, value))
+      return false;
+  }
+
+  try
+  {
+    entry.md5 = md5;
+    detectionFromJson(json::parse(value.toString()), entry);
+
+    return true;
+  }
+  catch(const json::exception& err)
+  {
+    Logger::error("ROM detection entry for '" + md5 + "' is invalid: " + err.what());
+
+    return false;
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RomCatalogue::save(const FSNode& rom, const Entry& entry)
+{
+  const uInt64 modTime = rom.getModTime();
+  if(modTime == 0 || entry.md5.empty() || !rom.isFile())
+    return;
+
+  json data = json::object();
+  data["size"] = static_cast<uInt64>(rom.getSize());
+  data["mtime"] = modTime;
+  data["md5"] = entry.md5;
+
+  json detection = json::object();
+  detectionToJson(entry, detection);
+  data.update(detection);
+  if(!entry.info.empty())
+  {
+    data["info"] = entry.info;
+    data["infoKey"] = entry.infoKey;
+  }
+
+  const std::lock_guard<std::mutex> lock(myMutex);
+
+  if(myRepository)
+    myRepository->save(rom.getPath(), data.dump());
+  if(myDetectionRepository && !detection.empty())
+    myDetectionRepository->save(entry.md5, detection.dump());
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+string RomCatalogue::md5(const FSNode& rom)
+{
+  Entry entry;
+  if(get(rom, entry))
+    return entry.md5;
+
+  entry.md5 = OSystem::getROMMD5(rom);
+  save(rom, entry);
+
+  return entry.md5;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool RomCatalogue::detect(const FSNode& rom, Entry& entry, const Settings& settings)
+{
+  size_t size = 0;
+  const ByteBuffer image = OSystem::openROM(rom, size, false);  // ignore error message
+  if(!image)
+    return false;
+
+  entry.md5 = MD5::hash(image, size);
+  entry.type = Bankswitch::typeToName(CartDetector::autodetectType(image, size));
+  entry.leftPort = Controller::getPropName(ControllerDetector::detectType(
+      image, size, Controller::Type::Unknown, Controller::Jack::Left, settings));
+  entry.rightPort = Controller::getPropName(ControllerDetector::detectType(
+      image, size, Controller::Type::Unknown, Controller::Jack::Right, settings));
+  entry.plusROM = CartDetector::isProbablyPlusROM(image, size);
+
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+string RomCatalogue::formatFlags(bool detectPal60, bool detectNtsc50)
+{
+  return string{detectPal60 ? "1" : "0"} + (detectNtsc50 ? "1" : "0");
+}
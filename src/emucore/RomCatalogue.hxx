@@ -0,0 +1,154 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2024 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef ROM_CATALOGUE_HXX
+#define ROM_CATALOGUE_HXX
+
+#include <mutex>
+
+class FSNode;
+class Settings;
+
+#include "bspf.hxx"
+#include "repository/KeyValueRepository.hxx"
+
+/**
+  This class maintains a persistent catalogue of ROM files, keyed by their
+  path, and validated by their size and modification time.  For each ROM
+  it remembers the MD5 and the results of the (expensive) autodetection of
+  bankswitch type, frame layout and controllers, so that these need only
+  be calculated once.
+
+  The autodetection results are additionally remembered per MD5, so that
+  they are reused for copies of a ROM, and for ROMs which are loaded
+  from different locations (eg. by headless batch runs).
+
+  All methods are threadsafe.
+*/
+class RomCatalogue
+{
+  public:
+    struct Entry {
+      string md5;          // MD5 of the ROM file
+      string type;         // autodetected bankswitch type
+      string format;       // autodetected display format
+      string formatFlags;  // the PAL60/NTSC50 detection settings used for 'format'
+      string leftPort;     // autodetected controller in the left jack
+      string rightPort;    // autodetected controller in the right jack
+      bool plusROM{false}; // PlusROM functionality detected
+
+      // The ROM info printed for the file (see OSystem::getROMInfo), and the
+      // fingerprint of the properties and settings it was created with; these
+      // are stored per path only
+      string info;
+      string infoKey;
+
+      bool operator==(const Entry&) const = default;
+    };
+
+  public:
+    RomCatalogue() = default;
+
+    /**
+      Set the repositories for the catalogue.
+
+      @param repository  The repository of ROM files, keyed by path
+      @param detection   The repository of autodetection results, keyed by MD5
+    */
+    void setRepository(shared_ptr<KeyValueRepositoryAtomic> repository,
+                       shared_ptr<KeyValueRepositoryAtomic> detection);
+
+    /**
+      Get the catalogue entry for the given ROM.
+
+      @param rom    The node representing the ROM file
+      @param entry  The entry, if found
+
+      @return  True if a valid entry exists for the ROM (ie, the file has
+               not changed since it was catalogued)
+    */
+    bool get(const FSNode& rom, Entry& entry) const;
+
+    /**
+      Get the autodetection results for a ROM with the given MD5.  This
+      is independent of the file containing the ROM.
+
+      @param md5    The MD5 of the ROM
+      @param entry  The entry, if found
+
+      @return  True if autodetection results exist for the MD5
+    */
+    bool get(const string& md5, Entry& entry) const;
+
+    /**
+      Add or update the catalogue entry for the given ROM, and the
+      autodetection results for its MD5.
+
+      @param rom    The node representing the ROM file
+      @param entry  The entry to store
+    */
+    void save(const FSNode& rom, const Entry& entry);
+
+    /**
+      Get the MD5 of the given ROM, calculating and cataloguing it if
+      necessary.
+
+      @param rom  The node representing the ROM file
+
+      @return  The MD5, or an empty string if the ROM is not valid
+    */
+    string md5(const FSNode& rom);
+
+    /**
+      Read the given ROM, and calculate its MD5 and autodetect its bankswitch
+      type, controllers and PlusROM support.  The display format is not
+      detected, since this requires emulation.  This may be called from any
+      thread.
+
+      @param rom       The node representing the ROM file
+      @param entry     The entry to update with the results
+      @param settings  The settings used for autodetection
+
+      @return  True if the ROM could be read
+    */
+    static bool detect(const FSNode& rom, Entry& entry, const Settings& settings);
+
+    /**
+      Answer the string describing the frame layout autodetection settings,
+      which is stored with an autodetected format.
+
+      @param detectPal60   The 'detectpal60' setting
+      @param detectNtsc50  The 'detectntsc50' setting
+    */
+    static string formatFlags(bool detectPal60, bool detectNtsc50);
+
+  private:
+    shared_ptr<KeyValueRepositoryAtomic> myRepository;
+    shared_ptr<KeyValueRepositoryAtomic> myDetectionRepository;
+
+    // The sqlite connection must not be used concurrently
+    mutable std::mutex myMutex;
+
+  private:
+    // Following constructors and assignment operators not supported
+    RomCatalogue(const RomCatalogue&) = delete;
+    RomCatalogue(RomCatalogue&&) = delete;
+    RomCatalogue& operator=(const RomCatalogue&) = delete;
+    RomCatalogue& operator=(RomCatalogue&&) = delete;
+};
+
+#endif
@@ -112,6 +112,7 @@ Settings::Settings()
 
   setPermanent("detectpal60", "false");
   setPermanent("detectntsc50", "false");
+  setTemporary("redetect", "false");
 
   // Sound options
   setPermanent(AudioSettings::SETTING_ENABLED, AudioSettings::DEFAULT_ENABLED);
@@ -216,16 +217,20 @@ Settings::Settings()
   // Misc options
   setPermanent("loglevel", static_cast<int>(Logger::Level::INFO));
   setPermanent("logtoconsole", "0");
+  setTemporary("startuptrace", "false");
   setPermanent("avoxport", "");
   setPermanent("fastscbios", "true");
+  setPermanent("instantscload", "false");
   setPermanent("threads", "false");
   setTemporary("romloadcount", "0");
   setTemporary("maxres", "");
+  setTemporary("capture", "");
   setPermanent("initials", "");
   setTemporary("turbo", "0");
   setPermanent("plusroms.nick", "");
   setTemporary("plusroms.id", "");
   setPermanent("plusroms.fixedid", "");
+  setTemporary("plusroms.local", "");
   setPermanent("filterbstypes", "true");
 
 #ifdef DEBUGGER_SUPPORT
@@ -539,7 +544,9 @@ void Settings::usage()
     << "  -pal.brightness  <-1.0 - 1.0>  Adjust brightness of current palette\n"
     << "  -pal.gamma       <-1.0 - 1.0>  Adjust gamma of current palette\n\n"
     << "  -detectpal60     <1|0>         Enable PAL-60 autodetection\n"
-    << "  -detectntsc50    <1|0>         Enable NTSC-50 autodetection\n\n"
+    << "  -detectntsc50    <1|0>         Enable NTSC-50 autodetection\n"
+    << "  -redetect        <1|0>         Ignore cached autodetection results (frame\n"
+    << "                                  layout, controllers) and detect again\n\n"
     << "  -speed           <number>      Run emulation at the given speed\n"
     << "  -turbo           <1|0>         Enable 'Turbo' mode for maximum emulation speed\n"
     << "  -uimessages      <1|0>         Show onscreen UI messages for different events\n"
@@ -595,6 +602,7 @@ void Settings::usage()
     << "                                description)\n"
     << "  -loglevel     <0|1|2>        Set level of logging during application run\n\n"
     << "  -logtoconsole <1|0>          Log output to console/commandline\n"
+    << "  -startuptrace <1|0>          Log the time taken to create each subsystem\n"
     << "  -joydeadzone  <0-29>         Sets digital 'dead zone' area for analog joysticks\n"
     << "  -joyallow4    <1|0>          Allow all 4 directions on a joystick to be\n"
     << "                                pressed simultaneously\n"
@@ -621,6 +629,7 @@ void Settings::usage()
     << "  -modcombo     <1|0>          Enable modifier key combos\n"
     << "                                (Control-Q for quit may not work when disabled!)\n"
     << "  -fastscbios   <1|0>          Disable Supercharger BIOS progress loading bars\n"
+    << "  -instantscload <1|0>         Skip the Supercharger BIOS code when loading\n"
     << "  -threads      <1|0>          Whether to using multi-threading during\n"
     << "                                emulation\n"
     << "  -snapsavedir  <path>         The directory to save snapshot files to\n"
@@ -631,7 +640,9 @@ void Settings::usage()
     << "  -ss1x         <1|0>          Generate TIA snapshot in 1x mode (ignore\n"
     << "                                scaling/effects)\n"
     << "  -ssinterval   <number>       Number of seconds between snapshots in\n"
-    << "                                continuous snapshot mode\n\n"
+    << "                                continuous snapshot mode\n"
+    << "  -capture      <path>         Record video and audio to <path>.y4m and\n"
+    << "                                <path>.wav\n\n"
     << "  -saveonexit   <none|current| Automatically save state(s) when exiting\n"
     << "                 all>           emulation\n"
     << "  -autoslot     <0|1>          Automatically change to next save slot when\n"
@@ -707,6 +718,8 @@ void Settings::usage()
     << "                                by attempting to use the application directory\n"
     << "  -plusroms.nick <nick>        Define a nickname for the PlusROMs backends.\n"
     << "  -plusroms.id   <id>          Define a temporary ID for the PlusROMs backends.\n"
+    << "  -plusroms.local <path>       Send PlusROM requests to a local HTTP backend\n"
+    << "                                listening on this Unix domain socket.\n"
     << "  -filterbstypes <0|1>         Filter bankswitch type list by ROM size.\n"
     << "  -help                        Show the text you're now reading\n"
   #ifdef DEBUGGER_SUPPORT
@@ -15,8 +15,11 @@
 // this file, and for a DISCLAIMER OF ALL WARRANTIES.
 //============================================================================
 
+#include <algorithm>
+#include <iomanip>
 #include <iostream>
 
+#include "Base.hxx"
 #include "Device.hxx"
 #include "M6502.hxx"
 #include "M6532.hxx"
@@ -67,6 +70,10 @@ void System::reset(bool autodetect)
 
   // There are no dirty pages upon startup
   clearDirtyPages();
+
+  // Don't count accesses from before the reset
+  if(myBusStatistics)
+    enableBusStatistics(true);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -117,6 +124,9 @@ uInt8 System::peek(uInt16 addr, Device::AccessFlags flags)
   }
 #endif
 
+  if(myBusStatistics) [[unlikely]]
+    countBusAccess(addr, access, access.directPeekBase != nullptr, false);
+
   // See if this page uses direct accessing or not
   const uInt8 result = access.directPeekBase
       ? *(access.directPeekBase + (addr & PAGE_MASK))
@@ -152,6 +162,9 @@ void System::poke(uInt16 addr, uInt8 value, Device::AccessFlags flags)
   }
 #endif
 
+  if(myBusStatistics) [[unlikely]]
+    countBusAccess(addr, access, access.directPokeBase != nullptr, true);
+
   // See if this page uses direct accessing or not
   if(access.directPokeBase)
   {
@@ -219,6 +232,146 @@ void System::increaseAccessCounter(uInt16 addr, bool isWrite) const
 }
 #endif
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void System::enableBusStatistics(bool enable)
+{
+  if(enable)
+  {
+    myBusStatistics = make_unique<BusStatistics>();
+    myBusStatistics->banks.resize(myCart.segmentCount());
+    for(uInt16 segment = 0; segment < myBusStatistics->banks.size(); ++segment)
+      myBusStatistics->banks[segment] = myCart.getSegmentBank(segment);
+    myBusStatistics->startCycles = myCycles;
+  }
+  else
+    myBusStatistics.reset();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void System::countBusAccess(uInt16 addr, const PageAccess& access,
+                            bool direct, bool write)
+{
+  // Ignore the debugger examining memory
+  if(myDataBusLocked)
+    return;
+
+  BusStatistics& stats = *myBusStatistics;
+
+  // Check if the previous access dispatched to the cartridge switched banks
+  if(stats.checkBanks)
+  {
+    bool switched = false;
+    for(uInt16 segment = 0; segment < stats.banks.size(); ++segment)
+    {
+      const uInt16 bank = myCart.getSegmentBank(segment);
+      if(bank != stats.banks[segment])
+      {
+        stats.banks[segment] = bank;
+        switched = true;
+      }
+    }
+    if(switched)
+    {
+      ++stats.bankSwitches;
+      ++stats.cartSwitches[stats.cartAddr];
+    }
+    stats.checkBanks = false;
+  }
+
+  const BusStatistics::Target target =
+      access.device == &myTIA   ? BusStatistics::TIA
+    : access.device == &myM6532 ? BusStatistics::RIOT
+    : access.device == &myCart  ? BusStatistics::Cart
+    : BusStatistics::Other;
+  const uInt16 page = (addr & ADDRESS_MASK) >> PAGE_SHIFT;
+
+  if(write)
+  {
+    ++(direct ? stats.directPokes : stats.pokes)[target];
+    ++stats.pagePokes[page];
+  }
+  else
+  {
+    ++(direct ? stats.directPeeks : stats.peeks)[target];
+    ++stats.pagePeeks[page];
+  }
+
+  if(!direct && target == BusStatistics::Cart)
+  {
+    stats.cartAddr = addr & ADDRESS_MASK;
+    ++stats.cartAccesses[stats.cartAddr];
+    stats.checkBanks = true;
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void System::printBusStatistics(ostream& out, uInt32 hotspots) const
+{
+  if(!myBusStatistics)
+  {
+    out << "bus statistics disabled\n";
+    return;
+  }
+
+  const BusStatistics& stats = *myBusStatistics;
+  // The system may have been reset since collecting started
+  const uInt64 cycles = myCycles >= stats.startCycles
+    ? myCycles - stats.startCycles : myCycles;
+  const double frames = myTIA.scanlinesLastFrame()
+    ? static_cast<double>(cycles) / (76 * myTIA.scanlinesLastFrame()) : 0.0;
+  const auto perFrame = [frames](uInt64 count) {
+    return frames > 0 ? count / frames : 0.0;
+  };
+  // Indices of the non-zero counts, most frequent first, at most 'hotspots'
+  const auto busiest = [hotspots](const auto& counts) {
+    vector<uInt16> indices;
+    for(uInt16 i = 0; i < counts.size(); ++i)
+      if(counts[i])
+        indices.push_back(i);
+    const size_t num = std::min<size_t>(indices.size(), hotspots);
+    std::partial_sort(indices.begin(), indices.begin() + num, indices.end(),
+      [&counts](uInt16 a, uInt16 b) { return counts[a] > counts[b]; });
+    indices.resize(num);
+    return indices;
+  };
+
+  static constexpr std::array<string_view, BusStatistics::NumTargets> names = {
+    "TIA", "RIOT", "Cart", "Other"
+  };
+
+  const std::ios_base::fmtflags flags = out.flags();
+  const std::streamsize precision = out.precision();
+
+  out << std::fixed << std::setprecision(1)
+      << "bus accesses per frame (" << frames << " frames)\n"
+      << "  device     peeks     pokes  direct peeks  direct pokes\n";
+  for(uInt32 t = 0; t < BusStatistics::NumTargets; ++t)
+    out << "  " << std::left << std::setw(6) << names[t] << std::right
+        << std::setw(10) << perFrame(stats.peeks[t])
+        << std::setw(10) << perFrame(stats.pokes[t])
+        << std::setw(14) << perFrame(stats.directPeeks[t])
+        << std::setw(14) << perFrame(stats.directPokes[t]) << '\n';
+  out << "bank switches per frame: " << perFrame(stats.bankSwitches) << '\n';
+
+  std::array<uInt64, NUM_PAGES> pageAccesses{};
+  for(uInt16 page = 0; page < NUM_PAGES; ++page)
+    pageAccesses[page] = stats.pagePeeks[page] + stats.pagePokes[page];
+  out << "busiest pages (accesses per frame)\n";
+  for(const uInt16 page: busiest(pageAccesses))
+    out << "  $"
+        << Common::Base::toString(page << PAGE_SHIFT, Common::Base::Fmt::_16_4)
+        << std::setw(10) << perFrame(stats.pagePeeks[page]) << " peeks"
+        << std::setw(10) << perFrame(stats.pagePokes[page]) << " pokes\n";
+
+  out << "cartridge accesses (per frame)\n";
+  for(const uInt16 addr: busiest(stats.cartAccesses))
+    out << "  $" << Common::Base::toString(addr, Common::Base::Fmt::_16_4)
+        << std::setw(10) << perFrame(stats.cartAccesses[addr]) << " accesses"
+        << std::setw(10) << perFrame(stats.cartSwitches[addr]) << " switches\n";
+  out.flags(flags);
+  out.precision(precision);
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool System::save(Serializer& out) const
 {
@@ -306,6 +306,19 @@ class System : public Serializable
       myPageAccessTable[(addr & ADDRESS_MASK) >> PAGE_SHIFT] = access;
     }
 
+    /**
+      Set the page accessing methods for consecutive pages, starting at
+      the specified address.
+
+      @param addr   The address of the first page
+      @param access The accessing methods to be used by the pages
+      @param pages  The number of pages
+    */
+    void setPageAccess(uInt16 addr, const PageAccess* access, uInt16 pages) {
+      std::copy_n(access, pages,
+                  &myPageAccessTable[(addr & ADDRESS_MASK) >> PAGE_SHIFT]);
+    }
+
     /**
       Get the page accessing method for the specified address.
 
@@ -349,6 +362,31 @@ class System : public Serializable
     */
     void clearDirtyPages();
 
+    /**
+      Enable/disable collecting statistics about bus accesses made by the
+      CPU: per device (split into direct and dispatched accesses), per
+      page and per cartridge address, plus the number of bank switches.
+      Enabling (again) and resetting the system start a new collection
+      period; disabling discards what was collected.  While disabled, the
+      only cost in peek()/poke() is a single predictable branch.
+
+      @param enable  Whether to collect bus statistics
+    */
+    void enableBusStatistics(bool enable);
+    bool busStatisticsEnabled() const { return myBusStatistics != nullptr; }
+
+    /**
+      Print a summary of the bus statistics collected since they were
+      enabled (or since the last reset), averaged over the frames (as
+      derived from the elapsed cycles and the last frame's scanlines),
+      including the cartridge addresses which were accessed most often
+      through the cartridge itself (hotspots etc).
+
+      @param out       The stream to print the summary to
+      @param hotspots  The maximum number of cartridge addresses to list
+    */
+    void printBusStatistics(ostream& out, uInt32 hotspots = 16) const;
+
     /**
       Save the current state of this system to the given Serializer.
 
@@ -365,6 +403,41 @@ class System : public Serializable
     */
     bool load(Serializer& in) override;
 
+  private:
+    // Bus access counters, see enableBusStatistics()
+    struct BusStatistics
+    {
+      enum Target { TIA, RIOT, Cart, Other, NumTargets };
+
+      // Accesses dispatched to the device
+      std::array<uInt64, NumTargets> peeks{}, pokes{};
+      // Accesses served through a page's direct peek/poke base
+      std::array<uInt64, NumTargets> directPeeks{}, directPokes{};
+      // All accesses, per page
+      std::array<uInt64, NUM_PAGES> pagePeeks{}, pagePokes{};
+      // Accesses dispatched to the cartridge, and the bank switches
+      // they triggered, per address
+      std::array<uInt64, ADDRESS_MASK + 1> cartAccesses{}, cartSwitches{};
+      uInt64 bankSwitches{0};
+
+      // Current bank of each cartridge segment
+      vector<uInt16> banks;
+      // The last access was dispatched to the cartridge at this address,
+      // and may have switched banks
+      bool checkBanks{false};
+      uInt16 cartAddr{0};
+
+      // System cycles when collecting started
+      uInt64 startCycles{0};
+    };
+
+    /**
+      Update the bus statistics for the given access; called before the
+      access is executed.
+    */
+    void countBusAccess(uInt16 addr, const PageAccess& access,
+                        bool direct, bool write);
+
   private:
     // The system RNG
     Random& myRandom;
@@ -406,6 +479,9 @@ class System : public Serializable
     // Some parts of the codebase need to act differently in such a case
     bool mySystemInAutodetect{false};
 
+    // Bus access counters, only allocated while they are collected
+    unique_ptr<BusStatistics> myBusStatistics;
+
   private:
     // Following constructors and assignment operators not supported
     System() = delete;
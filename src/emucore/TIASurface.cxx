@@ -24,6 +24,10 @@
 #include "PaletteHandler.hxx"
 #include "TIASurface.hxx"
 
+#ifdef AVX2_TARGET
+  #include <immintrin.h>
+#endif
+
 namespace {
   ScalingInterpolation interpolationModeFromSettings(const Settings& settings)
   {
@@ -40,6 +44,40 @@ namespace {
       ScalingInterpolation::sharp;
 #endif
   }
+
+#ifdef AVX2_TARGET
+  // AVX2 version of expandPalette(), returns the number of pixels converted
+  AVX2_TARGET uInt32 expandPaletteAVX2(const PaletteArray& palette,
+                                       const uInt8* in, uInt32* out, uInt32 n)
+  {
+    const int* base = reinterpret_cast<const int*>(palette.data());
+    uInt32 i = 0;
+
+    for(; i + 8 <= n; i += 8)
+    {
+      const __m256i idx = _mm256_cvtepu8_epi32(
+          _mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i)));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                          _mm256_i32gather_epi32(base, idx, 4));
+    }
+    return i;
+  }
+#endif
+
+  // Convert a row of TIA palette indices into RGB colors
+  void expandPalette(const PaletteArray& palette, const uInt8* in, uInt32* out,
+                     uInt32 n)
+  {
+    uInt32 i = 0;
+
+#ifdef AVX2_TARGET
+    if(BSPF::hasAVX2())
+      i = expandPaletteAVX2(palette, in, out, n);
+#endif
+
+    for(; i < n; ++i)
+      out[i] = palette[in[i]];
+  }
 } // namespace
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -118,6 +156,7 @@ void TIASurface::setPalette(const PaletteArray& tia_palette,
                             const PaletteArray& rgb_palette)
 {
   myPalette = tia_palette;
+  myRGBPalette = rgb_palette;
 
   // The NTSC filtering needs access to the raw RGB data, since it calculates
   // its own internal palette
@@ -533,14 +572,10 @@ void TIASurface::render(bool shade)
       const uInt8* tiaIn = myTIA->frameBuffer();
 
       uInt32 bufofs = 0, screenofsY = 0;
-      for(uInt32 y = 0; y < height; ++y)
+      for(uInt32 y = height; y ; --y)
       {
-        uInt32 pos = screenofsY;
-        for (uInt32 x = width / 2; x; --x)
-        {
-          out[pos++] = myPalette[tiaIn[bufofs++]];
-          out[pos++] = myPalette[tiaIn[bufofs++]];
-        }
+        expandPalette(myPalette, tiaIn + bufofs, out + screenofsY, width);
+        bufofs += width;
         screenofsY += outPitch;
       }
       break;
@@ -558,15 +593,12 @@ void TIASurface::render(bool shade)
       uInt32 bufofs = 0, screenofsY = 0;
       for(uInt32 y = height; y ; --y)
       {
-        uInt32 pos = screenofsY;
-        for(uInt32 x = width / 2; x ; --x)
-        {
-          // Store back into displayed frame buffer (for next frame)
-          rgbIn[bufofs] = out[pos++] = PhosphorHandler::getPixel(myPalette[tiaIn[bufofs]], rgbIn[bufofs]);
-          ++bufofs;
-          rgbIn[bufofs] = out[pos++] = PhosphorHandler::getPixel(myPalette[tiaIn[bufofs]], rgbIn[bufofs]);
-          ++bufofs;
-        }
+        // Expand into the displayed frame buffer, then blend it in place
+        // and store back into the RGB frame buffer (for next frame)
+        uInt32* row = out + screenofsY;
+        expandPalette(myPalette, tiaIn + bufofs, row, width);
+        PhosphorHandler::getRow(row, rgbIn + bufofs, row, width);
+        bufofs += width;
         screenofsY += outPitch;
       }
       break;
@@ -77,6 +77,11 @@ class TIASurface
     void setPalette(const PaletteArray& tia_palette,
                     const PaletteArray& rgb_palette);
 
+    /**
+      Get the RGB components of the current palette (as set by 'setPalette').
+    */
+    const PaletteArray& rgbPalette() const { return myRGBPalette; }
+
     /**
       Get a TIA surface that has no post-processing whatsoever.  This is
       currently used to save PNG image in the so-called '1x mode'.
@@ -258,6 +263,9 @@ class TIASurface
     // Palette for normal TIA rendering mode
     PaletteArray myPalette;
 
+    // The RGB components of the palette (0x00RRGGBB)
+    PaletteArray myRGBPalette;
+
     // Flag for saving a snapshot
     bool mySaveSnapFlag{false};
 
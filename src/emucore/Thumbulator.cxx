@@ -53,18 +53,20 @@ using Common::Base;
 #endif
 
 #ifdef THUMB_CYCLE_COUNT
+  // The cycle counting macros are used by the instruction handlers, which are
+  // instantiated with and without cycle counting (see execute())
   #define MERGE_I_S
   #define INC_S_CYCLES(addr, accessType) \
-    if(_countCycles)                     \
+    if(COUNT_CYCLES)                     \
       incSCycles(addr, accessType)
   #define INC_N_CYCLES(addr, accessType) \
-    if(_countCycles)                     \
+    if(COUNT_CYCLES)                     \
       incNCycles(addr, accessType)
   #define INC_I_CYCLES                   \
-    if(_countCycles)                     \
+    if(COUNT_CYCLES)                     \
       incICycles()
   #define INC_I_CYCLES_M(m)              \
-    if(_countCycles)                     \
+    if(COUNT_CYCLES)                     \
       incICycles(m)
 
   #define INC_SHIFT_CYCLES               \
@@ -97,7 +99,8 @@ using Common::Base;
     _prefetchAccessType[_pipeIdx] = accessType
 #endif
   #define FETCH_TYPE_N                          \
-    _prefetchCycleType[_pipeIdx] = CycleType::N
+    if(COUNT_CYCLES)                            \
+      _prefetchCycleType[_pipeIdx] = CycleType::N
 
   // ARM cycles
   #define INC_ARM_CYCLES(m) \
@@ -144,14 +147,16 @@ Thumbulator::Thumbulator(const uInt16* rom_ptr, uInt16* ram_ptr, uInt32 rom_size
     cBase{c_base},
     cStart{c_start},
     cStack{c_stack},
-    decodedRom{make_unique<Op[]>(romSize / 2)},  // NOLINT
-    decodedParam{make_unique<uInt32[]>(romSize / 2)},  // NOLINT
+    decodedRom{make_unique<DecodedOp[]>(romSize / 2)},  // NOLINT
+  #ifndef UNSAFE_OPTIMIZATIONS
+    decodedRam{make_unique<DecodedOp[]>(RAMSIZE / 2)},  // NOLINT
+  #endif
     ram{ram_ptr},
     configuration{configurefor},
     myCartridge{cartridge}
 {
   for(uInt32 i = 0; i < romSize / 2; ++i)
-    decodedRom[i] = decodeInstructionWord(CONV_RAMROM(rom[i]), i * 2);
+    decodedRom[i] = decode(CONV_RAMROM(rom[i]), i * 2);
 
   setConsoleTiming(ConsoleTiming::ntsc);
 #ifndef UNSAFE_OPTIMIZATIONS
@@ -170,7 +175,14 @@ string Thumbulator::doRun(uInt32& cycles, bool irqDrivenAudio)
   reset();
   for(;;)
   {
-    if(execute()) break;
+    // The accuracy tier is selected per basic block; execute<false>() returns
+    // early when cycle counting gets enabled (by reading APBDIV), so that the
+    // rest of the block is executed by the exact tier
+  #ifdef THUMB_CYCLE_COUNT
+    if(_countCycles ? execute<true>() : execute<false>()) break;
+  #else
+    if(execute<false>()) break;
+  #endif
 #ifndef UNSAFE_OPTIMIZATIONS
     if(_stats.instructions > 500000) // way more than would otherwise be possible
       throw runtime_error("instructions > 500000");
@@ -295,13 +307,10 @@ void Thumbulator::dump_regs()
 }
 #endif
 
+#ifdef THUMB_CYCLE_COUNT
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-FORCE_INLINE uInt32 Thumbulator::fetch16(uInt32 addr)
+FORCE_INLINE void Thumbulator::fetchCycles(uInt32 addr)
 {
-#ifndef UNSAFE_OPTIMIZATIONS
-  uInt32 data = 0;
-
-#ifdef THUMB_CYCLE_COUNT
   _pipeIdx = (_pipeIdx+1) % 3;
 
 #ifdef MERGE_I_S
@@ -321,18 +330,25 @@ FORCE_INLINE uInt32 Thumbulator::fetch16(uInt32 addr)
   //  }
   //  else
   //#endif
-      INC_S_CYCLES(addr, AccessType::prefetch);
-      //INC_S_CYCLES(addr, _prefetchAccessType[_pipeIdx]);
+      incSCycles(addr, AccessType::prefetch);
+      //incSCycles(addr, _prefetchAccessType[_pipeIdx]);
   }
   else
   {
-    INC_N_CYCLES(addr, AccessType::prefetch); // or ::data ?
-    //INC_N_CYCLES(addr, _prefetchAccessType[_pipeIdx]);
+    incNCycles(addr, AccessType::prefetch); // or ::data ?
+    //incNCycles(addr, _prefetchAccessType[_pipeIdx]);
   }
   _prefetchCycleType[_pipeIdx] = CycleType::S; // default
   //_prefetchAccessType[_pipeIdx] = AccessType::prefetch; // default
+}
 #endif
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+FORCE_INLINE uInt32 Thumbulator::fetch16(uInt32 addr)
+{
+#ifndef UNSAFE_OPTIMIZATIONS
+  uInt32 data = 0;
+
   switch(addr & 0xF0000000)
   {
     case 0x00000000: //ROM
@@ -812,8 +828,13 @@ FORCE_INLINE void Thumbulator::write_register(uInt32 reg, uInt32 data, bool isFl
       // dummy fetch + fill the pipeline
       //INC_N_CYCLES(reg_norm[15] - 2, AccessType::prefetch);
       //INC_S_CYCLES(data - 2, AccessType::branch);
-      INC_N_CYCLES(reg_norm[15] + 4, AccessType::prefetch);
-      INC_S_CYCLES(data, AccessType::branch);
+    #ifdef THUMB_CYCLE_COUNT
+      if(_countCycles)
+      {
+        incNCycles(reg_norm[15] + 4, AccessType::prefetch);
+        incSCycles(data, AccessType::branch);
+      }
+    #endif
     }
   }
   reg_norm[reg] = data;
@@ -840,7 +861,8 @@ void Thumbulator::do_cvflag(uInt32 a, uInt32 b, uInt32 c)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-Thumbulator::Op Thumbulator::decodeInstructionWord(uint16_t inst, uInt32 pc) {
+Thumbulator::Op Thumbulator::decodeInstructionWord(uInt16 inst, uInt32 pc,
+                                                   uInt32& param) {
   //ADC add with carry
   if((inst & 0xFFC0) == 0x4140) return Op::adc;
 
@@ -885,7 +907,7 @@ Thumbulator::Op Thumbulator::decodeInstructionWord(uint16_t inst, uInt32 pc) {
     rb <<= 1;
     rb += pc;
     rb += 2;
-    decodedParam[pc / 2] = rb + 4;
+    param = rb + 4;
 
     switch(op)
     {
@@ -946,7 +968,7 @@ Thumbulator::Op Thumbulator::decodeInstructionWord(uint16_t inst, uInt32 pc) {
     rb <<= 1;
     rb += pc;
     rb += 2;
-    decodedParam[pc / 2] = rb + 4;
+    param = rb + 4;
 
     return Op::b2;
   }
@@ -1141,46 +1163,115 @@ Thumbulator::Op Thumbulator::decodeInstructionWord(uint16_t inst, uInt32 pc) {
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-FORCE_INLINE int Thumbulator::execute()  // NOLINT (readability-function-size)
+Thumbulator::DecodedOp Thumbulator::decode(uInt16 inst, uInt32 pc)
 {
-  uInt32 sp, inst, ra, rb, rc, rm, rd, rn, rs;  // NOLINT
+  DecodedOp decoded;
 
+  decoded.inst = inst;
+  decoded.op = decodeInstructionWord(inst, pc, decoded.param);
+
+  return decoded;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+FORCE_INLINE const Thumbulator::DecodedOp* Thumbulator::decodedAt(uInt32 addr)
+{
 #ifndef UNSAFE_OPTIMIZATIONS
-  uInt32 pc = read_register(15);
+  switch(addr & 0xF0000000)
+  {
+    case 0x00000000: //ROM
+      if(addr >= 0x50 && addr < romSize)
+        return &decodedRom[addr >> 1];
+      break;
+
+    case 0x40000000: //RAM
+      // Mirrors are not cached, since branch targets depend on the address
+      if(addr < 0x40000000 + RAMSIZE)
+      {
+        const uInt32 idx = (addr & RAMADDMASK) >> 1;
+        const uInt16 inst = CONV_RAMROM(ram[idx]);
+        DecodedOp& decoded = decodedRam[idx];
+
+        // RAM can be modified by the ARM code and by the cartridge, so the
+        // decoding is only valid as long as the instruction is unchanged
+        if(decoded.op == Op::numOps || decoded.inst != inst)
+          decoded = decode(inst, addr);
+        return &decoded;
+      }
+      break;
+
+    default:
+      break;
+  }
+  return nullptr;  // handled by fetch16()
 #else
-  uInt32 pc = read_register(15) & ~1; // not checked and corrected in read_register
+  return &decodedRom[(addr & ROMADDMASK) >> 1];
 #endif
+}
 
-  const uInt32 instructionPtr = pc - 2;
-  const uInt32 instructionPtr2 = instructionPtr >> 1;
-  inst = fetch16(instructionPtr);
-
-  pc += 2;
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+template<bool COUNT_CYCLES>
+FORCE_INLINE int Thumbulator::execute()
+{
+  // Execute instructions sequentially from the decode cache, until an
+  // instruction changes the program counter (i.e. for one basic block)
 #ifndef UNSAFE_OPTIMIZATIONS
-  write_register(15, pc, false);
+  uInt32 addr = read_register(15) - 2;
 #else
-  write_register(15, pc);
+  uInt32 addr = (read_register(15) & ~1) - 2; // not checked and corrected in read_register
 #endif
-  DO_DISS(statusMsg << Base::HEX8 << (pc-5) << ": " << Base::HEX4 << inst << " ");
+  DecodedOp fetched;
 
+  for(;;)
+  {
+    const DecodedOp* decoded = decodedAt(addr);
+
+  #if defined(THUMB_CYCLE_COUNT) && !defined(UNSAFE_OPTIMIZATIONS)
+    if constexpr(COUNT_CYCLES)
+      fetchCycles(addr);
+  #endif
+    if(!decoded)
+    {
+      fetched = decode(fetch16(addr), addr);
+      decoded = &fetched;
+    }
+
+    const uInt32 pc = addr + 4;
 #ifndef UNSAFE_OPTIMIZATIONS
-  ++_stats.instructions;
+    write_register(15, pc, false);
+#else
+    write_register(15, pc);
 #endif
+    DO_DISS(statusMsg << Base::HEX8 << (pc-5) << ": " << Base::HEX4 << decoded->inst << " ");
 
-  Op decodedOp{};
 #ifndef UNSAFE_OPTIMIZATIONS
-  if ((instructionPtr & 0xF0000000) == 0 && instructionPtr < romSize)
-    decodedOp = decodedRom[instructionPtr2];
-  else
-    decodedOp = decodeInstructionWord(CONV_RAMROM(rom[instructionPtr2]), instructionPtr);
-#else
-  decodedOp = decodedRom[(instructionPtr & ROMADDMASK) >> 1];
+    ++_stats.instructions;
 #endif
 
+    if(executeOp<COUNT_CYCLES>(*decoded, pc))
+      return 1;
+    if(reg_norm[15] != pc)
+      return 0;
+  #ifdef THUMB_CYCLE_COUNT
+    if constexpr(!COUNT_CYCLES)
+      if(_countCycles)
+        return 0;  // continue with the next instruction, counting cycles
+  #endif
+    addr += 2;
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+template<bool COUNT_CYCLES>
+FORCE_INLINE int Thumbulator::executeOp(const DecodedOp& decoded, uInt32 pc)  // NOLINT (readability-function-size)
+{
+  uInt32 sp, ra, rb, rc, rm, rd, rn, rs;  // NOLINT
+  const uInt32 inst = decoded.inst;
+
 #ifdef COUNT_OPS
-  ++opCount[static_cast<int>(decodedOp)];
+  ++opCount[static_cast<int>(decoded.op)];
 #endif
-  switch (decodedOp) {
+  switch (decoded.op) {
     //ADC
     case Op::adc: {
       rd = (inst >> 0) & 0x07;
@@ -1404,70 +1495,70 @@ FORCE_INLINE int Thumbulator::execute()  // NOLINT (readability-function-size)
     case Op::beq: {
       THUMB_STAT(_stats.branches)
       if(!znFlags)
-        write_register(15, decodedParam[instructionPtr2]);
+        write_register(15, decoded.param);
       return 0;
     }
 
     case Op::bne: {
       THUMB_STAT(_stats.branches)
       if(znFlags)
-        write_register(15, decodedParam[instructionPtr2]);
+        write_register(15, decoded.param);
       return 0;
     }
 
     case Op::bcs: {
       THUMB_STAT(_stats.branches)
       if(cFlag)
-        write_register(15, decodedParam[instructionPtr2]);
+        write_register(15, decoded.param);
       return 0;
     }
 
     case Op::bcc: {
       THUMB_STAT(_stats.branches)
       if(!cFlag)
-        write_register(15, decodedParam[instructionPtr2]);
+        write_register(15, decoded.param);
       return 0;
     }
 
     case Op::bmi: {
       THUMB_STAT(_stats.branches)
       if(znFlags & 0x80000000)
-        write_register(15, decodedParam[instructionPtr2]);
+        write_register(15, decoded.param);
       return 0;
     }
 
     case Op::bpl: {
       THUMB_STAT(_stats.branches)
       if(!(znFlags & 0x80000000))
-        write_register(15, decodedParam[instructionPtr2]);
+        write_register(15, decoded.param);
       return 0;
     }
 
     case Op::bvs: {
       THUMB_STAT(_stats.branches)
       if(vFlag)
-        write_register(15, decodedParam[instructionPtr2]);
+        write_register(15, decoded.param);
       return 0;
     }
 
     case Op::bvc: {
       THUMB_STAT(_stats.branches)
       if(!vFlag)
-        write_register(15, decodedParam[instructionPtr2]);
+        write_register(15, decoded.param);
       return 0;
     }
 
     case Op::bhi: {
       THUMB_STAT(_stats.branches)
       if(cFlag && znFlags)
-        write_register(15, decodedParam[instructionPtr2]);
+        write_register(15, decoded.param);
       return 0;
     }
 
     case Op::bls: {
       THUMB_STAT(_stats.branches)
       if(!znFlags || !cFlag)
-        write_register(15, decodedParam[instructionPtr2]);
+        write_register(15, decoded.param);
       return 0;
     }
 
@@ -1475,7 +1566,7 @@ FORCE_INLINE int Thumbulator::execute()  // NOLINT (readability-function-size)
       THUMB_STAT(_stats.branches)
       if(((znFlags & 0x80000000) && vFlag) ||
          ((!(znFlags & 0x80000000)) && !vFlag))
-        write_register(15, decodedParam[instructionPtr2]);
+        write_register(15, decoded.param);
       return 0;
     }
 
@@ -1483,7 +1574,7 @@ FORCE_INLINE int Thumbulator::execute()  // NOLINT (readability-function-size)
       THUMB_STAT(_stats.branches)
       if((!(znFlags & 0x80000000) && vFlag) ||
          (((znFlags & 0x80000000)) && !vFlag))
-        write_register(15, decodedParam[instructionPtr2]);
+        write_register(15, decoded.param);
       return 0;
     }
 
@@ -1493,7 +1584,7 @@ FORCE_INLINE int Thumbulator::execute()  // NOLINT (readability-function-size)
       {
         if(((znFlags & 0x80000000) && vFlag) ||
            ((!(znFlags & 0x80000000)) && !vFlag))
-          write_register(15, decodedParam[instructionPtr2]);      }
+          write_register(15, decoded.param);      }
       return 0;
     }
 
@@ -1502,14 +1593,14 @@ FORCE_INLINE int Thumbulator::execute()  // NOLINT (readability-function-size)
       if(!znFlags ||
          (!(znFlags & 0x80000000) && vFlag) ||
          (((znFlags & 0x80000000)) && !vFlag))
-        write_register(15, decodedParam[instructionPtr2]);
+        write_register(15, decoded.param);
       return 0;
     }
 
     //B(2) unconditional branch
     case Op::b2: {
       THUMB_STAT(_stats.branches)
-      write_register(15, decodedParam[instructionPtr2]);
+      write_register(15, decoded.param);
       return 0;
     }
 
@@ -102,6 +102,14 @@ class Thumbulator
                otherwise an empty string
     */
     string run(uInt32& cycles, bool irqDrivenAudio);
+
+    /**
+      Select the accuracy of the emulation.  With cycle counting enabled, the
+      ARM code is executed cycle-exact (including MAM and pipeline effects),
+      otherwise a faster interpreter without any cycle accounting is used.
+      The mode can be changed at any time, and takes effect from the next
+      executed basic block on.
+    */
     void enableCycleCount(bool enable) { _countCycles = enable; }
     const Stats& stats() const { return _stats; }
     uInt32 cycles() const { return _totalCycles; }
@@ -197,6 +205,16 @@ class Thumbulator
       uxth,
       numOps
     };
+    // A decoded instruction.  This caches the result of the opcode decoding,
+    // and operands which depend on the instruction's address.  The register
+    // and immediate fields are still extracted from 'inst' by executeOp();
+    // doing so is a shift and a mask, and storing them here would only make
+    // the cache entries larger without saving any work.
+    struct DecodedOp {
+      Op op{Op::numOps};  // Op::numOps: not decoded yet
+      uInt16 inst{0};
+      uInt32 param{0};    // branch target (b1 and b2 variants)
+    };
   #ifdef THUMB_CYCLE_COUNT
     enum class CycleType {
       S, N, I // Sequential, Non-sequential, Internal
@@ -219,6 +237,9 @@ class Thumbulator
     uInt32 read_register(uInt32 reg);
     void write_register(uInt32 reg, uInt32 data, bool isFlowBreak = true);
 #endif
+  #ifdef THUMB_CYCLE_COUNT
+    void fetchCycles(uInt32 addr);
+  #endif
     uInt32 fetch16(uInt32 addr);
     uInt32 read16(uInt32 addr);
     uInt32 read32(uInt32 addr);
@@ -231,7 +252,9 @@ class Thumbulator
     void write32(uInt32 addr, uInt32 data);
     void updateTimer(uInt32 cycles);
 
-    Op decodeInstructionWord(uint16_t inst, uInt32 pc);
+    static Op decodeInstructionWord(uInt16 inst, uInt32 pc, uInt32& param);
+    static DecodedOp decode(uInt16 inst, uInt32 pc);
+    const DecodedOp* decodedAt(uInt32 addr);
 
     void do_cvflag(uInt32 a, uInt32 b, uInt32 c);
 
@@ -245,7 +268,10 @@ class Thumbulator
     void dump_counters() const;
     void dump_regs();
   #endif
-    int execute();
+    // Both are instantiated twice: with cycle counting (exact timing, for
+    // developers) and without it (fast playback), see enableCycleCount()
+    template<bool COUNT_CYCLES> int execute();
+    template<bool COUNT_CYCLES> int executeOp(const DecodedOp& decoded, uInt32 pc);
     int reset();
 
   #ifdef THUMB_CYCLE_COUNT
@@ -263,8 +289,12 @@ class Thumbulator
     uInt32 cBase{0};
     uInt32 cStart{0};
     uInt32 cStack{0};
-    const unique_ptr<Op[]> decodedRom;  // NOLINT
-    const unique_ptr<uInt32[]> decodedParam;  // NOLINT
+    // Decode cache; ROM is decoded upfront, RAM on first execution
+    // (and again whenever the instruction there has changed)
+    const unique_ptr<DecodedOp[]> decodedRom;  // NOLINT
+  #ifndef UNSAFE_OPTIMIZATIONS
+    const unique_ptr<DecodedOp[]> decodedRam;  // NOLINT
+  #endif
     uInt16* ram{nullptr};
     std::array<uInt32, 16> reg_norm; // normal execution mode, do not have a thread mode
     uInt32 znFlags{0};
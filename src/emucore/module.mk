@@ -90,6 +90,7 @@ MODULE_OBJS := \
 	src/emucore/Props.o \
 	src/emucore/PropsSet.o \
 	src/emucore/QuadTari.o \
+	src/emucore/RomCatalogue.o \
 	src/emucore/SaveKey.o \
 	src/emucore/Serializer.o \
 	src/emucore/Settings.o \
@@ -15146,7 +15146,7 @@ f"Cart.MD5" "000509d1ed2b8d30a9d94be1b3b5febb"
 "Cart.Highscore" "{\"score_addresses\":[\"0x85\",\"0x84\",\"0x83\"],\"score_digits\":6,\"variations_address\":\"0x8b\",\"variations_count\":2,\"variations_zero_based\":true}"
 ""
 
-"Cart.MD5" "E68E28752D3C54EDD3CCDA42C27E320C"
+"Cart.MD5" "e68e28752d3c54edd3ccda42c27e320c"
 "Cart.Manufacturer" "Xonox - K-Tel Software, Anthony R. Henderson"
 "Cart.ModelNo" "99007, 6240"
 "Cart.Name" "Tomarc the Barbarian (1983) (Xonox)"
@@ -179,14 +179,15 @@ void TIA::initialize()
   if (myFrameManager)
     myFrameManager->reset();
 
-  myFrontBufferScanlines = myFrameBufferScanlines = 0;
-
-  myFramesSinceLastRender = 0;
+  myFrameBuffersScanlines.fill(0);
 
   // Blank the various framebuffers; they may contain graphical garbage
-  myBackBuffer.fill(0);
-  myFrontBuffer.fill(0);
-  myFramebuffer.fill(0);
+  for(auto& buffer: myFrameBuffers)
+    buffer.fill(0);
+  myBackBufferIdx = 0;
+  myFrameBufferIdx = 1;
+  myReadyBuffer = 2;  // no frames pending
+  myBackBuffer = myFrameBuffers[myBackBufferIdx].data();
 
   // Prepare variables for auto-phosphor
   memset(&myPosP0, 0, sizeof(ObjectPos));
@@ -326,8 +327,8 @@ bool TIA::save(Serializer& out) const
     out.putLong(myFrameWsyncCycles);
   #endif
 
-    out.putInt(myFrameBufferScanlines);
-    out.putInt(myFrontBufferScanlines);
+    out.putInt(myFrameBuffersScanlines[myFrameBufferIdx]);
+    out.putInt(myFrameBuffersScanlines[myReadyBuffer & READY_INDEX_MASK]);
 
     out.putByte(myPFBitsDelay);
     out.putByte(myPFColorDelay);
@@ -401,8 +402,8 @@ bool TIA::load(Serializer& in)
     myFrameWsyncCycles = in.getLong();
   #endif
 
-    myFrameBufferScanlines = in.getInt();
-    myFrontBufferScanlines = in.getInt();
+    myFrameBuffersScanlines[myFrameBufferIdx] = in.getInt();
+    myFrameBuffersScanlines[myReadyBuffer & READY_INDEX_MASK] = in.getInt();
 
     myPFBitsDelay = in.getByte();
     myPFColorDelay = in.getByte();
@@ -928,10 +929,11 @@ bool TIA::saveDisplay(Serializer& out) const
 {
   try
   {
-    out.putByteArray(myFramebuffer.data(), myFramebuffer.size());
-    out.putByteArray(myBackBuffer.data(), myBackBuffer.size());
-    out.putByteArray(myFrontBuffer.data(), myFrontBuffer.size());
-    out.putInt(myFramesSinceLastRender);
+    out.putByteArray(myFrameBuffers[myFrameBufferIdx].data(), sizeof(FrameBufferArray));
+    out.putByteArray(myBackBuffer, sizeof(FrameBufferArray));
+    out.putByteArray(myFrameBuffers[myReadyBuffer & READY_INDEX_MASK].data(),
+                     sizeof(FrameBufferArray));
+    out.putInt(framesSinceLastRender());
   }
   catch(...)
   {
@@ -948,10 +950,12 @@ bool TIA::loadDisplay(const Serializer& in)
   try
   {
     // Reset frame buffer pointer and data
-    in.getByteArray(myFramebuffer.data(), myFramebuffer.size());
-    in.getByteArray(myBackBuffer.data(), myBackBuffer.size());
-    in.getByteArray(myFrontBuffer.data(), myFrontBuffer.size());
-    myFramesSinceLastRender = in.getInt();
+    const uInt32 ready = myReadyBuffer & READY_INDEX_MASK;
+
+    in.getByteArray(myFrameBuffers[myFrameBufferIdx].data(), sizeof(FrameBufferArray));
+    in.getByteArray(myBackBuffer, sizeof(FrameBufferArray));
+    in.getByteArray(myFrameBuffers[ready].data(), sizeof(FrameBufferArray));
+    myReadyBuffer = ready | (in.getInt() << READY_FRAMES_SHIFT);
   }
   catch(...)
   {
@@ -1028,22 +1032,48 @@ void TIA::update(DispatchResult& result, uInt64 maxCycles)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void TIA::renderToFrameBuffer()
+uInt32 TIA::renderToFrameBuffer()
 {
-  if (myFramesSinceLastRender == 0) return;
+  // Grab the newest completed frame together with the number of frames
+  // completed since the last render; the previous frame buffer becomes the
+  // new ready buffer (with no frames pending)
+  uInt32 ready = myReadyBuffer.load(std::memory_order_relaxed);
+  do {
+    if ((ready >> READY_FRAMES_SHIFT) == 0) return 0;
+  } while (!myReadyBuffer.compare_exchange_weak(ready, myFrameBufferIdx,
+             std::memory_order_acq_rel, std::memory_order_relaxed));
 
-  myFramesSinceLastRender = 0;
+  myFrameBufferIdx = ready & READY_INDEX_MASK;
 
-  myFramebuffer = myFrontBuffer;
+  return ready >> READY_FRAMES_SHIFT;
+}
 
-  myFrameBufferScanlines = myFrontBufferScanlines;
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt8* TIA::outputBuffer()
+{
+  // Only the debugger looks at partially drawn frames, so instead of copying
+  // each completed frame into the next back buffer, the part below the
+  // electron beam is completed from the newest frame on request
+  uInt32 x = 0, y = 0;
+  if(!electronBeamPos(x, y))
+    x = 0;
+
+  const size_t drawn = std::min<size_t>(
+    static_cast<size_t>(y) * TIAConstants::H_PIXEL + x, sizeof(FrameBufferArray));
+  const uInt32 newestIdx = framesSinceLastRender() > 0
+    ? myReadyBuffer & READY_INDEX_MASK : myFrameBufferIdx;
+
+  std::copy(myFrameBuffers[newestIdx].begin() + drawn,
+            myFrameBuffers[newestIdx].end(), myBackBuffer + drawn);
+
+  return myBackBuffer;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void TIA::clearFrameBuffer()
 {
-  myFramebuffer.fill(0);
-  myFrontBuffer.fill(0);
+  myFrameBuffers[myFrameBufferIdx].fill(0);
+  myFrameBuffers[myReadyBuffer & READY_INDEX_MASK].fill(0);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -1408,18 +1438,27 @@ void TIA::onFrameComplete()
 #endif
 
   if (myXAtRenderingStart > 0)
-    std::fill_n(myBackBuffer.begin(), myXAtRenderingStart, 0);
+    std::fill_n(myBackBuffer, myXAtRenderingStart, 0);
 
   // Blank out any extra lines not drawn this frame
   const Int32 missingScanlines = myFrameManager->missingScanlines();
   if (missingScanlines > 0)
-    std::fill_n(myBackBuffer.begin() +
+    std::fill_n(myBackBuffer +
       static_cast<size_t>(TIAConstants::H_PIXEL * myFrameManager->getY()),
       missingScanlines * TIAConstants::H_PIXEL, 0);
 
-  myFrontBuffer = myBackBuffer;
+  myFrameBuffersScanlines[myBackBufferIdx] = scanlinesLastFrame();
+
+  // Publish the completed frame (counting it as pending in the same atomic
+  // step) and continue drawing into the previous ready buffer
+  const uInt32 completedIdx = myBackBufferIdx;
+  uInt32 ready = myReadyBuffer.load(std::memory_order_relaxed);
+  while (!myReadyBuffer.compare_exchange_weak(ready,
+           completedIdx | ((ready & ~READY_INDEX_MASK) + (1 << READY_FRAMES_SHIFT)),
+           std::memory_order_acq_rel, std::memory_order_relaxed));
 
-  myFrontBufferScanlines = scanlinesLastFrame();
+  myBackBufferIdx = ready & READY_INDEX_MASK;
+  myBackBuffer = myFrameBuffers[myBackBufferIdx].data();
 
   if(myAutoPhosphorEnabled)
   {
@@ -1499,7 +1538,6 @@ void TIA::onFrameComplete()
     if(--myFlickerFrame < 0)
       myFlickerFrame = FLICKER_FRAMES - 1;
   }
-  ++myFramesSinceLastRender;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -1626,7 +1664,7 @@ void TIA::applyRsync()
 
   myHctrDelta = TIAConstants::H_CLOCKS - 3 - myHctr;
   if (myFrameManager->isRendering())
-    std::fill_n(myBackBuffer.begin() +
+    std::fill_n(myBackBuffer +
       static_cast<size_t>(myFrameManager->getY() * TIAConstants::H_PIXEL + x),
       TIAConstants::H_PIXEL - x, 0);
 
@@ -1718,8 +1756,8 @@ void TIA::cloneLastLine()
 
     if(!myFrameManager->isRendering() || y == 0) return;
 
-    std::copy_n(myBackBuffer.begin() + (y - 1) * TIAConstants::H_PIXEL,
-      TIAConstants::H_PIXEL, myBackBuffer.begin() + y * TIAConstants::H_PIXEL);
+    std::copy_n(myBackBuffer + (y - 1) * TIAConstants::H_PIXEL,
+      TIAConstants::H_PIXEL, myBackBuffer + y * TIAConstants::H_PIXEL);
 
     // Save positions of objects for auto-phosphor
     if(myAutoPhosphorEnabled)
@@ -1839,7 +1877,7 @@ void TIA::flushLineCache()
 void TIA::clearHmoveComb()
 {
   if (myFrameManager->isRendering() && myHstate == HState::blank)
-    std::fill_n(myBackBuffer.begin() +
+    std::fill_n(myBackBuffer +
       static_cast<size_t>(myFrameManager->getY() * TIAConstants::H_PIXEL),
       8, myColorHBlank);
 }
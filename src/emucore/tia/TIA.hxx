@@ -18,6 +18,7 @@
 #ifndef TIA_TIA
 #define TIA_TIA
 
+#include <atomic>
 #include <functional>
 
 #include "bspf.hxx"
@@ -224,33 +225,41 @@ class TIA : public Device
     /**
       Did we generate a new frame?
      */
-    bool newFramePending() { return myFramesSinceLastRender  > 0; }
+    bool newFramePending() const { return framesSinceLastRender() > 0; }
 
     /**
      * Clear any pending frames.
      */
-    void clearPendingFrame() { myFramesSinceLastRender = 0; }
+    void clearPendingFrame() { myReadyBuffer &= READY_INDEX_MASK; }
 
     /**
       The number of frames since we did last render to the front buffer.
      */
-    uInt32 framesSinceLastRender() { return myFramesSinceLastRender; }
+    uInt32 framesSinceLastRender() const {
+      return myReadyBuffer >> READY_FRAMES_SHIFT;
+    }
 
     /**
-      Render the pending frame to the framebuffer and clear the flag.
+      Make the newest completed frame the framebuffer and clear the flag.
+      No data is copied and the emulation may keep running concurrently
+      (the buffers are exchanged lock-free).
+
+      @return  The number of frames completed since the last render
      */
-    void renderToFrameBuffer();
+    uInt32 renderToFrameBuffer();
 
     /**
       Return the buffer that holds the currently drawing TIA frame
-      (the TIA output widget needs this).
+      (the TIA output widget needs this). The part not drawn yet is
+      filled from the newest completed frame first, since the back buffer
+      is recycled from an older frame.
      */
-    uInt8* outputBuffer() { return myBackBuffer.data(); }
+    uInt8* outputBuffer();
 
     /**
       Returns a pointer to the internal frame buffer.
     */
-    uInt8* frameBuffer() { return myFramebuffer.data(); }
+    uInt8* frameBuffer() { return myFrameBuffers[myFrameBufferIdx].data(); }
 
     void clearFrameBuffer();
 
@@ -338,7 +347,9 @@ class TIA : public Device
     /**
       The same, but for the frame in the frame buffer.
      */
-    uInt32 frameBufferScanlinesLastFrame() const { return myFrameBufferScanlines; }
+    uInt32 frameBufferScanlinesLastFrame() const {
+      return myFrameBuffersScanlines[myFrameBufferIdx];
+    }
 
     /**
       Answers the total system cycles from the start of the emulation.
@@ -840,20 +851,32 @@ class TIA : public Device
     LatchedInput myInput0;
     LatchedInput myInput1;
 
-    // Pointer to the internal color-index-based frame buffer
-    std::array<uInt8, TIAConstants::H_PIXEL * TIAConstants::frameBufferHeight> myFramebuffer;
-
-    // The frame is rendered to the backbuffer and only copied to the framebuffer
-    // upon completion
-    std::array<uInt8, TIAConstants::H_PIXEL * TIAConstants::frameBufferHeight> myBackBuffer;
-    std::array<uInt8, TIAConstants::H_PIXEL * TIAConstants::frameBufferHeight> myFrontBuffer;
-
-    // We snapshot frame statistics when the back buffer is copied to the front buffer
-    // and when the front buffer is copied to the frame buffer
-    uInt32 myFrontBufferScanlines{0}, myFrameBufferScanlines{0};
-
-    // Frames since the last time a frame was rendered to the render buffer
-    uInt32 myFramesSinceLastRender{0};
+    // The color-index-based frame buffers, used as a triple buffer:
+    //  - the back buffer is drawn into by the emulation
+    //  - upon completion, it is exchanged with the ready buffer
+    //  - upon rendering, the ready buffer is exchanged with the frame buffer
+    // The exchanges only swap indices; the frame data is only copied once,
+    // to start the new back buffer from the completed frame.
+    using FrameBufferArray =
+        std::array<uInt8, TIAConstants::H_PIXEL * TIAConstants::frameBufferHeight>;
+    std::array<FrameBufferArray, 3> myFrameBuffers;
+
+    // We snapshot frame statistics along with each completed frame
+    std::array<uInt32, 3> myFrameBuffersScanlines{0};
+
+    // Indices of the back buffer (emulation only) and the frame buffer
+    // (rendering only)
+    uInt8 myBackBufferIdx{0}, myFrameBufferIdx{1};
+
+    // Index of the ready buffer, shared by the emulation and rendering,
+    // combined with the number of frames completed since the last time a
+    // frame was rendered (so both are always exchanged consistently)
+    static constexpr uInt32 READY_INDEX_MASK = 0x03;
+    static constexpr uInt32 READY_FRAMES_SHIFT = 2;
+    std::atomic<uInt32> myReadyBuffer{2};
+
+    // Pointer to the data of the back buffer
+    uInt8* myBackBuffer{myFrameBuffers[0].data()};
 
     /**
      * Setting this to true randomizes TIA on reset.
@@ -15,6 +15,8 @@
 // this file, and for a DISCLAIMER OF ALL WARRANTIES.
 //============================================================================
 
+#include <numeric>
+
 #include "bspf.hxx"
 #include "ScrollBarWidget.hxx"
 #include "TimerManager.hxx"
@@ -24,6 +26,29 @@
 
 #include "FileListWidget.hxx"
 
+namespace {
+  // Check the given entries against an upper case pattern, and return the
+  // ones matching.  Empty names (directories) always match.
+  std::vector<uInt32> matchPattern(const StringList& names,
+                                   const std::vector<uInt32>& candidates,
+                                   string_view pattern,
+                                   const std::atomic<bool>& cancel)
+  {
+    std::vector<uInt32> matches;
+
+    matches.reserve(candidates.size());
+    for(const auto i: candidates)
+    {
+      if(cancel)
+        break;
+      if(pattern.empty() || names[i].empty() ||
+         BSPF::matchWithWildcards(names[i], pattern))
+        matches.push_back(i);
+    }
+    return matches;
+  }
+} // namespace
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 FileListWidget::FileListWidget(GuiObject* boss, const GUI::Font& font,
                                int x, int y, int w, int h)
@@ -34,6 +59,12 @@ FileListWidget::FileListWidget(GuiObject* boss, const GUI::Font& font,
   setTarget(this);
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+FileListWidget::~FileListWidget()
+{
+  stopFilter();
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void FileListWidget::setDirectory(const FSNode& node, string_view select)
 {
@@ -82,6 +113,7 @@ void FileListWidget::setLocation(const FSNode& node, string_view select)
     return myProgressDialog->isCancelled();
   };
 
+  stopFilter();
   _node = node;
 
   // Read in the data from the file system (start with an empty list)
@@ -89,48 +121,147 @@ void FileListWidget::setLocation(const FSNode& node, string_view select)
 
   getChildren(isCancelled);
 
+  // Keep the complete listing, so that pattern changes don't have to
+  // access the file system again
+  _allFiles = std::move(_fileList);
+  _allNames.clear();
+  _allNames.reserve(_allFiles.size());
+  for(const auto& file : _allFiles)
+  {
+    string name;
+
+    if(!file.isDirectory())
+      BSPF::toUpperCase(name = file.getName());
+    _allNames.push_back(std::move(name));
+  }
+
+  std::vector<uInt32> all(_allFiles.size());
+  std::iota(all.begin(), all.end(), 0);
+  _matches = matchPattern(_allNames, all, _pattern, _filterCancel);
+  _matchPattern = _pattern;
+
   // Now fill the list widget with the names from the file list,
   // even if cancelled
-  StringList list;
-  const size_t orgLen = _node.getShortPath().length();
+  _fileList.reserve(_matches.size());
+  for(const auto i: _matches)
+    _fileList.push_back(_allFiles[i]);
+  fillList(select);
 
-  _dirList.clear();
-  _iconTypeList.clear();
+  progress().close();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void FileListWidget::fillList(string_view select)
+{
+  StringList list;
 
+  list.reserve(_fileList.size());
   for(const auto& file : _fileList)
   {
-    const string& path = file.getShortPath();
     const string& name = file.getName();
 
-    // display only relative path in tooltip
-    if(path.length() >= orgLen && !fullPathToolTip())
-      _dirList.push_back(path.substr(orgLen));
-    else
-      _dirList.push_back(path);
-
     if(file.isDirectory() && !BSPF::endsWithIgnoreCase(name, ".zip"))
-    {
       list.push_back(name);
-      if(name == "..")
-        _iconTypeList.push_back(IconType::updir);
-      else
-        _iconTypeList.push_back(getIconType(file.getPath()));
-    }
     else
-    {
-      const string& displayName = _showFileExtensions ? name : file.getNameWithExt(EmptyString);
-
-      list.push_back(displayName);
-      _iconTypeList.push_back(getIconType(file.getPath()));
-    }
+      list.push_back(_showFileExtensions ? name : file.getNameWithExt(EmptyString));
   }
+  _iconTypeList.assign(_fileList.size(), IconType::pending);
   extendLists(list);
 
   setList(list);
   setSelected(select);
   ListWidget::recalc();
+}
 
-  progress().close();
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void FileListWidget::setPattern(string_view pattern)
+{
+  string pat{pattern};
+
+  BSPF::toUpperCase(pat);
+  if(pat == _pattern)
+    return;
+
+  _pattern = pat;
+  stopFilter();
+
+  // A pattern which only extends the pattern of the current matches at
+  // either end can only match a subset of these
+  std::vector<uInt32> candidates;
+
+  if(!_matchPattern.empty() && (BSPF::startsWithIgnoreCase(pat, _matchPattern)
+                             || BSPF::endsWithIgnoreCase(pat, _matchPattern)))
+    candidates = _matches;
+  else
+  {
+    candidates.resize(_allFiles.size());
+    std::iota(candidates.begin(), candidates.end(), 0);
+  }
+
+  if(candidates.size() > FILTER_THREAD_THRESHOLD)
+  {
+    // The result is applied in tick()
+    _filterCancel = false;
+    _filterDone = false;
+    _filterPattern = pat;
+    _filterThread = std::thread([this, candidates = std::move(candidates)] {
+      _filterResult = matchPattern(_allNames, candidates, _filterPattern, _filterCancel);
+      _filterDone = true;
+    });
+  }
+  else
+  {
+    _matches = matchPattern(_allNames, candidates, pat, _filterCancel);
+    _matchPattern = pat;
+    applyMatches();
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void FileListWidget::applyMatches()
+{
+  _selectedFile = _showFileExtensions
+    ? selected().getName()
+    : selected().getNameWithExt(EmptyString);
+
+  _fileList.clear();
+  _fileList.reserve(_matches.size());
+  for(const auto i: _matches)
+    _fileList.push_back(_allFiles[i]);
+  fillList(_selectedFile);
+
+  // An empty list doesn't report a selection change, but the boss still
+  // has to know about the changed contents
+  if(_list.empty())
+  {
+    setTarget(_boss);
+    sendCommand(ItemChanged, 0, _id);
+    setTarget(this);
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void FileListWidget::stopFilter()
+{
+  if(_filterThread.joinable())
+  {
+    _filterCancel = true;
+    _filterThread.join();
+    _filterCancel = false;
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void FileListWidget::tick()
+{
+  if(_filterThread.joinable() && _filterDone)
+  {
+    _filterThread.join();
+    _matches = std::move(_filterResult);
+    _matchPattern = _filterPattern;
+    applyMatches();
+  }
+  StringListWidget::tick();
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -170,6 +301,19 @@ FileListWidget::IconType FileListWidget::getIconType(string_view path) const
       ? IconType::rom : IconType::unknown;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+FileListWidget::IconType FileListWidget::iconType(int i) const
+{
+  if(_iconTypeList[i] == IconType::pending)
+  {
+    const FSNode& file = _fileList[i];
+
+    _iconTypeList[i] = file.isDirectory() && file.getName() == ".."
+      ? IconType::updir : getIconType(file.getPath());
+  }
+  return _iconTypeList[i];
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void FileListWidget::selectDirectory()
 {
@@ -280,6 +424,13 @@ void FileListWidget::reload()
   }
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+const FSNode& FileListWidget::nodeAt(int idx) const
+{
+  return idx >= 0 && idx < static_cast<int>(_fileList.size())
+    ? _fileList[idx] : ourDefaultNode;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 const FSNode& FileListWidget::selected()
 {
@@ -383,13 +534,17 @@ bool FileListWidget::handleText(char text)
   for(const auto& i : _list)
   {
     if(BSPF::startsWithIgnoreCase(i, _quickSelectStr))
+    {
+      const IconType type = iconType(selectedItem);
+
       // Select directories when the first character is uppercase
       if(firstShift ==
-          (_iconTypeList[selectedItem] == IconType::directory
-          || _iconTypeList[selectedItem] == IconType::userdir
-          || _iconTypeList[selectedItem] == IconType::recentdir
-          || _iconTypeList[selectedItem] == IconType::popdir))
+          (type == IconType::directory
+          || type == IconType::userdir
+          || type == IconType::recentdir
+          || type == IconType::popdir))
         break;
+    }
     selectedItem++;
   }
 
@@ -693,11 +848,11 @@ const FileListWidget::Icon* FileListWidget::getIcon(int i) const
     &unknown_large, &rom_large, &directory_large, &zip_large, &up_large,
   };
   const bool smallIcon = iconWidth() < 24;
-  const int iconType = static_cast<int>(_iconTypeList[i]);
+  const int type = static_cast<int>(iconType(i));
 
-  assert(iconType < idx);
+  assert(type < idx);
 
-  return smallIcon ? small_icons[iconType] : large_icons[iconType];
+  return smallIcon ? small_icons[type] : large_icons[type];
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -717,8 +872,17 @@ string FileListWidget::getToolTip(const Common::Point& pos) const
   if(idx < 0)
     return EmptyString;
 
-  if(_includeSubDirs && static_cast<int>(_dirList.size()) > idx)
-    return _toolTipText + _dirList[idx];
+  if(_includeSubDirs && static_cast<int>(_fileList.size()) > idx)
+  {
+    const string& path = _fileList[idx].getShortPath();
+    const size_t orgLen = _node.getShortPath().length();
+
+    // display only relative path in tooltip
+    if(path.length() >= orgLen && !fullPathToolTip())
+      return _toolTipText + path.substr(orgLen);
+    else
+      return _toolTipText + path;
+  }
 
   const string value = _list[idx];
 
@@ -21,6 +21,9 @@
 class CommandSender;
 class ProgressDialog;
 
+#include <atomic>
+#include <thread>
+
 #include "FSNode.hxx"
 #include "Stack.hxx"
 #include "StringListWidget.hxx"
@@ -38,7 +41,11 @@ class ProgressDialog;
   directory; instead the selection descends into the directory.
 
   Widgets wishing to enforce their own filename filtering are able
-  to use a 'NameFilter' as described below.
+  to use a 'NameFilter' as described below.  This filter is applied while
+  reading the directory.  Additionally, a wildcard pattern can be set, which
+  is applied to the cached listing without accessing the file system again.
+  When the pattern grows, only the previous matches are checked again, and
+  very large listings are filtered in a background thread.
 */
 class FileListWidget : public StringListWidget
 {
@@ -55,7 +62,7 @@ class FileListWidget : public StringListWidget
   public:
     FileListWidget(GuiObject* boss, const GUI::Font& font,
                    int x, int y, int w, int h);
-    ~FileListWidget() override = default;
+    ~FileListWidget() override;
 
     bool handleKeyDown(StellaKey key, StellaMod mod) override;
 
@@ -68,6 +75,13 @@ class FileListWidget : public StringListWidget
       _filter = filter;
     }
 
+    /**
+      Only show files whose names contain the given pattern ('*' and '?'
+      are allowed as wildcards, the case is ignored).  Directories are
+      always shown.  The current listing is filtered again immediately.
+    */
+    void setPattern(string_view pattern);
+
     // When enabled, all subdirectories will be searched too.
     void setIncludeSubDirs(bool enable) { _includeSubDirs = enable; }
 
@@ -101,12 +115,17 @@ class FileListWidget : public StringListWidget
     const FSNode& selected();
     const FSNode& currentDir() const { return _node; }
 
+    /** Gets the node at the given list position (or the default node) */
+    const FSNode& nodeAt(int idx) const;
+
     static void setQuickSelectDelay(uInt64 time) { _QUICK_SELECT_DELAY = time; }
     uInt64 getQuickSelectDelay() const { return _QUICK_SELECT_DELAY; }
 
     ProgressDialog& progress();
     void incProgress();
 
+    void tick() override;
+
   protected:
     struct HistoryType
     {
@@ -129,7 +148,8 @@ class FileListWidget : public StringListWidget
       userdir,
       recentdir,
       popdir,
-      numLauncherTypes = popdir - numTypes + 1
+      numLauncherTypes = popdir - numTypes + 1,
+      pending = -1  // not determined yet, see iconType()
     };
     using IconTypeList = std::vector<IconType>;
     using Icon = uIntArray;
@@ -147,6 +167,7 @@ class FileListWidget : public StringListWidget
     virtual void getChildren(const FSNode::CancelCheck& isCancelled);
     virtual void extendLists(StringList& list) { }
     virtual IconType getIconType(string_view path) const;
+    IconType iconType(int i) const;
     virtual const Icon* getIcon(int i) const;
     int iconWidth() const;
     virtual bool fullPathToolTip() const { return false; }
@@ -158,13 +179,19 @@ class FileListWidget : public StringListWidget
     FSList _fileList;
     FSNode::NameFilter _filter;
     string _selectedFile;
-    StringList _dirList;
     std::vector<HistoryType> _history;
     int _historyHome{0}; // offset into initially created history
     std::vector<HistoryType>::iterator _currentHistory{_history.begin()};
-    IconTypeList _iconTypeList;
+    // Icon types are only determined when an entry is displayed
+    mutable IconTypeList _iconTypeList;
 
   private:
+    // Listings with more entries are filtered in a background thread
+    static constexpr size_t FILTER_THREAD_THRESHOLD = 5000;
+
+    void fillList(string_view select);
+    void applyMatches();
+    void stopFilter();
     bool handleText(char text) override;
     void handleCommand(CommandSender* sender, int cmd, int data, int id) override;
     int drawIcon(int i, int x, int y, ColorId color) override;
@@ -186,6 +213,21 @@ class FileListWidget : public StringListWidget
 
     unique_ptr<ProgressDialog> myProgressDialog;
 
+    // The complete listing read by getChildren(), its upper case file names
+    // (empty for directories), and the entries matching '_matchPattern'
+    FSList _allFiles;
+    StringList _allNames;
+    std::vector<uInt32> _matches;
+    string _pattern, _matchPattern;
+
+    // Background filtering of large listings; '_filterResult' belongs to
+    // the thread until '_filterDone' is set
+    std::thread _filterThread;
+    std::atomic<bool> _filterCancel{false};
+    std::atomic<bool> _filterDone{false};
+    std::vector<uInt32> _filterResult;
+    string _filterPattern;
+
     static FSNode ourDefaultNode;
 
   private:
@@ -44,6 +44,7 @@
 #include "StellaKeys.hxx"
 #include "Props.hxx"
 #include "PropsSet.hxx"
+#include "RomCatalogue.hxx"
 #include "RomImageWidget.hxx"
 #include "RomInfoWidget.hxx"
 #include "TIAConstants.hxx"
@@ -68,7 +69,8 @@ LauncherDialog::LauncherDialog(OSystem& osystem, DialogContainer& parent,
                                int x, int y, int w, int h)
   : Dialog(osystem, parent, osystem.frameBuffer().launcherFont(), "",
            x, y, w, h),
-    CommandSender(this)
+    CommandSender(this),
+    myRomScanner{make_unique<RomScanner>(osystem)}
 {
   const bool bottomButtons = instance().settings().getBool("launcherbuttons");
   int ypos = Dialog::vBorder();
@@ -427,8 +429,9 @@ const string& LauncherDialog::selectedRomMD5()
     myMD5List.clear();
 
   // Lookup MD5, and if not present, cache it
+  // The ROM catalogue avoids rehashing ROMs which were seen before
   if(!myMD5List.contains(currentNode().getPath()))
-    myMD5List[currentNode().getPath()] = OSystem::getROMMD5(currentNode());
+    myMD5List[currentNode().getPath()] = instance().romCatalogue().md5(currentNode());
 
   return myMD5List[currentNode().getPath()];
 }
@@ -453,7 +456,7 @@ void LauncherDialog::reload()
   myMD5List.clear();
   myList->setShowFileExtensions(extensions);
   myList->reload();
-  myPendingReload = false;
+  startRomScan(true);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -473,12 +476,13 @@ void LauncherDialog::quit()
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void LauncherDialog::tick()
 {
-  if(myPendingReload && myReloadTime < TimerManager::getTicks() / 1000)
-    reload();
-
   if(myPendingRomInfo && myRomInfoTime < TimerManager::getTicks() / 1000)
     loadPendingRomInfo();
 
+  // Update the scan state once the scan has finished
+  if(myScanShown && !myRomScanner->isScanning())
+    updateRomCount();
+
   Dialog::tick();
 }
 
@@ -546,35 +550,47 @@ void LauncherDialog::updateUI()
   // Only enable the navigation buttons if function is available
   myNavigationBar->updateUI();
 
+  // Catalogue the ROMs of the new directory in the background
+  startRomScan();
+  updateRomCount();
+
+  loadRomInfo();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void LauncherDialog::updateRomCount()
+{
   // Indicate how many files were found
   ostringstream buf;
   buf << (myList->getList().size() - (currentDir().hasParent() ? 1 : 0))
     << (myShortCount ? " items" : " items found");
+  myScanShown = myRomScanner->isScanning() && !myShortCount;
+  if(myScanShown)
+    buf << ", scanning" << ELLIPSIS;
   myRomCount->setLabel(buf.view());
-
-  loadRomInfo();
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-string LauncherDialog::getRomDir()
+void LauncherDialog::startRomScan(bool force)
 {
-  const Settings& settings = instance().settings();
-  const string& tmpromdir = settings.getString("tmpromdir");
+  const bool subDirs = instance().settings().getBool("launchersubdirs");
+  const FSNode& dir = currentDir();
 
-  return tmpromdir != EmptyString ? tmpromdir : settings.getString("romdir");
+  if(force || dir.getPath() != myScannedDir || subDirs != myScannedSubDirs)
+  {
+    myScannedDir = dir.getPath();
+    myScannedSubDirs = subDirs;
+    myRomScanner->scan(dir, subDirs);
+  }
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool LauncherDialog::matchWithWildcardsIgnoreCase(
-    string_view str, string_view pattern)
+string LauncherDialog::getRomDir()
 {
-  string in{str};
-  string pat{pattern};
-
-  BSPF::toUpperCase(in);
-  BSPF::toUpperCase(pat);
+  const Settings& settings = instance().settings();
+  const string& tmpromdir = settings.getString("tmpromdir");
 
-  return BSPF::matchWithWildcards(in, pat);
+  return tmpromdir != EmptyString ? tmpromdir : settings.getString("romdir");
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -590,11 +606,6 @@ void LauncherDialog::applyFiltering()
         if(!Bankswitch::isValidRomName(node, ext) ||
            BSPF::compareIgnoreCase(ext, "zip") == 0) // exclude ZIPs without any valid ROMs
           return false;
-
-        // Skip over files that don't match the pattern in the 'pattern' textbox
-        if(myPattern && !myPattern->getText().empty() &&
-           !matchWithWildcardsIgnoreCase(node.getName(), myPattern->getText()))
-          return false;
       }
       return true;
     }
@@ -700,6 +711,35 @@ void LauncherDialog::loadRomInfo()
     myRomImageWidget->clearProperties();
     myRomInfoWidget->clearProperties();
   }
+  prefetchRomImages();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void LauncherDialog::prefetchRomImages()
+{
+  // Decode the images of the neighbouring ROMs in the background, so that
+  // they can be shown immediately when scrolling there
+  // Only ROMs which are already catalogued are considered, since
+  // calculating the MD5 here would stall the UI
+  const int selected = myList->getSelected();
+
+  for(const int idx: {selected + 1, selected - 1})
+  {
+    const FSNode& node = myList->nodeAt(idx);
+    if(node.getPath().empty() || node.isDirectory() ||
+       !Bankswitch::isValidRomName(node))
+      continue;
+
+    string cartName;
+    RomCatalogue::Entry entry;
+    if(instance().romCatalogue().get(node, entry))
+    {
+      Properties properties;
+      instance().propSet().getMD5(entry.md5, properties);
+      cartName = properties.get(PropType::Cart_Name);
+    }
+    myRomImageWidget->prefetchImage(node, cartName);
+  }
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -1038,20 +1078,9 @@ void LauncherDialog::handleCommand(CommandSender* sender, int cmd,
 
     case EditableWidget::kChangedCmd:
     case EditableWidget::kAcceptCmd:
-    {
-      const bool subDirs = instance().settings().getBool("launchersubdirs");
-
-      myList->setIncludeSubDirs(subDirs);
-      if(subDirs && cmd == EditableWidget::kChangedCmd)
-      {
-        // delay (potentially slow) subdirectories reloads until user stops typing
-        myReloadTime = TimerManager::getTicks() / 1000 + myList->getQuickSelectDelay();
-        myPendingReload = true;
-      }
-      else
-        reload();
+      // Files not matching the pattern are filtered from the cached listing
+      myList->setPattern(myPattern->getText());
       break;
-    }
 
     case kQuitCmd:
       handleQuit();
@@ -1127,6 +1156,10 @@ void LauncherDialog::loadRom()
   myList->updateFavorites();
   saveConfig();
 
+  // Don't let the scan compete with emulation
+  myRomScanner->stop();
+  myScannedDir = "";
+
   const string& result = instance().createConsole(currentNode(), selectedRomMD5());
   if(result == EmptyString)
   {
@@ -44,6 +44,7 @@ namespace GUI {
 #include "bspf.hxx"
 #include "Dialog.hxx"
 #include "FSNode.hxx"
+#include "RomScanner.hxx"
 #include "Variant.hxx"
 
 class LauncherDialog : public Dialog, CommandSender
@@ -123,6 +124,8 @@ class LauncherDialog : public Dialog, CommandSender
     void loadConfig() override;
     void saveConfig() override;
     void updateUI();
+    void updateRomCount();
+    void startRomScan(bool force = false);
     void addTitleWidget(int& ypos);
     void addFilteringWidgets(int& ypos);
     void addPathWidgets(int& ypos);
@@ -130,17 +133,6 @@ class LauncherDialog : public Dialog, CommandSender
     void addButtonWidgets(int& ypos);
     string getRomDir();
 
-    /**
-      Search if string contains pattern including wildcard '*'
-      and '?' as joker, ignoring case.
-
-      @param str      The searched string
-      @param pattern  The pattern to search for
-
-      @return True if pattern was found.
-    */
-    static bool matchWithWildcardsIgnoreCase(string_view str, string_view pattern);
-
     void applyFiltering();
 
     float getRomInfoZoom(int listHeight) const;
@@ -149,6 +141,7 @@ class LauncherDialog : public Dialog, CommandSender
     void loadRom();
     void loadRomInfo();
     void loadPendingRomInfo();
+    void prefetchRomImages();
     void loadRandomRom();
     void openSettings();
     void openGameProperties();
@@ -206,11 +199,15 @@ class LauncherDialog : public Dialog, CommandSender
     bool myUseMinimalUI{false};
     bool myEventHandled{false};
     bool myShortCount{false};
-    bool myPendingReload{false};
-    uInt64 myReloadTime{0};
     bool myPendingRomInfo{false};
     uInt64 myRomInfoTime{0};
 
+    // Scans the current directory in the background, filling the ROM catalogue
+    unique_ptr<RomScanner> myRomScanner;
+    string myScannedDir;
+    bool myScannedSubDirs{false};
+    bool myScanShown{false};
+
     enum {
       kSubDirsCmd    = 'lred',
       kLoadRndRomCmd = 'lrnd',  // load random ROM
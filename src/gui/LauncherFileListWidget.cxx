@@ -110,7 +110,6 @@ void LauncherFileListWidget::addFolder(StringList& list, int& offset,
   _fileList.insert(_fileList.begin() + offset,
     FSNode(_node.getPath() + n));
   list.insert(list.begin() + offset, n);
-  _dirList.insert(_dirList.begin() + offset, "");
   _iconTypeList.insert((_iconTypeList.begin() + offset), icon);
 
   ++offset;
@@ -521,16 +520,16 @@ const FileListWidget::Icon* LauncherFileListWidget::getIcon(int i) const
     &user_large, &recent_large, &popular_large
   };
 
-  if(static_cast<int>(_iconTypeList[i]) < static_cast<int>(IconType::numTypes))
+  if(static_cast<int>(iconType(i)) < static_cast<int>(IconType::numTypes))
     return FileListWidget::getIcon(i);
 
   const bool smallIcon = iconWidth() < 24;
-  const int iconType =
-    static_cast<int>(_iconTypeList[i]) - static_cast<int>(IconType::numTypes);
+  const int type =
+    static_cast<int>(iconType(i)) - static_cast<int>(IconType::numTypes);
 
-  assert(iconType < NLT);
+  assert(type < NLT);
 
-  return smallIcon ? small_icons[iconType] : large_icons[iconType];
+  return smallIcon ? small_icons[type] : large_icons[type];
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
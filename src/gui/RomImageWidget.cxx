@@ -20,9 +20,7 @@
 #include "Dialog.hxx"
 #include "FBSurface.hxx"
 #include "Font.hxx"
-#include "JPGLibrary.hxx"
 #include "OSystem.hxx"
-#include "PNGLibrary.hxx"
 #include "Props.hxx"
 #include "PropsSet.hxx"
 #include "TimerManager.hxx"
@@ -66,6 +64,9 @@ void RomImageWidget::setProperties(const FSNode& node,
 void RomImageWidget::clearProperties()
 {
   myHaveProperties = mySurfaceIsValid = false;
+#ifdef IMAGE_SUPPORT
+  myPendingImage.clear();
+#endif
   if(mySurface)
     mySurface->setVisible(false);
 
@@ -149,20 +150,26 @@ void RomImageWidget::parseProperties(const FSNode& node, bool full)
 
     // 1. Try to load first snapshot by property name
     string fileName = path + myProperties.get(PropType::Cart_Name);
-    tryImageFormats(fileName);
-    if(!mySurfaceIsValid)
+    bool found = tryImageFormats(fileName);
+    if(!found)
     {
       // 2. If none exists, try to load first snapshot by ROM file name
       fileName = path + node.getName();
-      tryImageFormats(fileName);
+      found = tryImageFormats(fileName);
     }
-    if(mySurfaceIsValid)
+    if(found)
       myImageList.emplace_back(fileName);
     else
     {
       // 3. If no ROM snapshots exist, try to load a default snapshot
       fileName = path + "default_snapshot";
-      tryImageFormats(fileName);
+      if(!tryImageFormats(fileName))
+      {
+        myPendingImage.clear();
+        mySurfaceIsValid = false;
+        mySurfaceErrorMsg = "No image found";
+        setDirty();
+      }
     }
   }
   else
@@ -181,6 +188,7 @@ void RomImageWidget::parseProperties(const FSNode& node, bool full)
       loadImage(myImageList[0].getPath());
     else
       setDirty(); // update the counter display
+    prefetchNeighbours();
   }
 #else
   mySurfaceIsValid = false;
@@ -203,14 +211,37 @@ void RomImageWidget::parseProperties(const FSNode& node, bool full)
 bool RomImageWidget::changeImage(int direction)
 {
 #ifdef IMAGE_SUPPORT
-  if(direction == -1 && myImageIdx)
-    return loadImage(myImageList[--myImageIdx].getPath());
-  else if(direction == 1 && myImageIdx + 1 < myImageList.size())
-    return loadImage(myImageList[++myImageIdx].getPath());
+  if((direction == -1 && myImageIdx) ||
+     (direction == 1 && myImageIdx + 1 < myImageList.size()))
+  {
+    myImageIdx += direction;
+    const bool result = loadImage(myImageList[myImageIdx].getPath());
+    prefetchNeighbours();
+    return result;
+  }
 #endif
   return false;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RomImageWidget::prefetchImage(const FSNode& node, string_view cartName)
+{
+#ifdef IMAGE_SUPPORT
+  // Use the same order as when selecting the ROM
+  const string& path = instance().snapshotLoadDir().getPath();
+  string fileName = path + string{cartName};
+
+  if(!cartName.empty() && findImageFormat(fileName))
+    instance().imageCache().prefetch(fileName);
+  else
+  {
+    fileName = path + node.getName();
+    if(findImageFormat(fileName))
+      instance().imageCache().prefetch(fileName);
+  }
+#endif
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void RomImageWidget::toggleImageZoom()
 {
@@ -263,61 +294,67 @@ bool RomImageWidget::getImageList(const string& propName, const string& romName,
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool RomImageWidget::tryImageFormats(string& fileName)
+bool RomImageWidget::findImageFormat(string& fileName)
 {
-  if(loadImage(fileName + ".png"))
-  {
-    fileName += ".png";
-    return true;
-  }
-  if(loadImage(fileName + ".jpg"))
+  for(const string_view ext: {".png", ".jpg"})
   {
-    fileName += ".jpg";
-    return true;
+    if(FSNode(fileName + string{ext}).isFile())
+    {
+      fileName += ext;
+      return true;
+    }
   }
   return false;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool RomImageWidget::loadImage(const string& fileName)
+bool RomImageWidget::tryImageFormats(string& fileName)
 {
-  mySurfaceErrorMsg.clear();
-
-  const string::size_type idx = fileName.find_last_of('.');
+  if(!findImageFormat(fileName))
+    return false;
 
-  if(idx != string::npos && fileName.substr(idx + 1) == "png")
-    mySurfaceIsValid = loadPng(fileName);
-  else
-    mySurfaceIsValid = loadJpg(fileName);
+  loadImage(fileName);
+  return true;
+}
 
-  if(mySurfaceIsValid)
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool RomImageWidget::loadImage(const string& fileName)
+{
+  const ImageCache::ImagePtr image = instance().imageCache().request(fileName);
+  if(image)
   {
-    mySrcRect = mySurface->srcRect();
-    zoomSurfaces(false, true);
+    myPendingImage.clear();
+    return showImage(*image);
   }
 
+  // The image is decoded in the background, and shown by 'tick()' once
+  // it is ready; until then, the previous image must not be shown
+  myPendingImage = fileName;
+  mySurfaceIsValid = false;
+  mySurfaceErrorMsg.clear();
+  myLabel.clear();
   if(mySurface)
-    mySurface->setVisible(mySurfaceIsValid);
+    mySurface->setVisible(false);
 
-  if (!myZoomMode)
-    myZoomTimer = 0;
   setDirty();
-  return mySurfaceIsValid;
+  return true;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool RomImageWidget::loadPng(const string& fileName)
+bool RomImageWidget::showImage(const ImageCache::Image& image)
 {
-  try
+  mySurfaceErrorMsg = image.error;
+  mySurfaceIsValid = mySurfaceErrorMsg.empty();
+
+  if(mySurfaceIsValid)
   {
-    VariantList metaData;
-    instance().png().loadImage(fileName, *mySurface, metaData);
+    ImageCache::loadToSurface(image, *mySurface);
 
     // Retrieve label for loaded image
     myLabel.clear();
-    for(const auto& data: metaData)
+    for(const auto& data: image.metaData)
     {
-      if(data.first == "Title")
+      if(data.first == "Title" || data.first == "ImageDescription")
       {
         myLabel = data.second.toString();
         break;
@@ -326,40 +363,29 @@ bool RomImageWidget::loadPng(const string& fileName)
           && data.second.toString().starts_with("Stella"))
         myLabel = "Snapshot"; // default for Stella snapshots with missing "Title" meta data
     }
-    return true;
-  }
-  catch(const runtime_error& e)
-  {
-    mySurfaceErrorMsg = e.what();
+
+    mySrcRect = mySurface->srcRect();
+    zoomSurfaces(false, true);
   }
-  return false;
+
+  if(mySurface)
+    mySurface->setVisible(mySurfaceIsValid);
+
+  if (!myZoomMode)
+    myZoomTimer = 0;
+  setDirty();
+  return mySurfaceIsValid;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool RomImageWidget::loadJpg(const string& fileName)
+void RomImageWidget::prefetchNeighbours()
 {
-  try
-  {
-    VariantList metaData;
-    instance().jpg().loadImage(fileName, *mySurface, metaData);
+  ImageCache& cache = instance().imageCache();
 
-    // Retrieve label for loaded image
-    myLabel.clear();
-    for(const auto& data: metaData)
-    {
-      if(data.first == "ImageDescription")
-      {
-        myLabel = data.second.toString();
-        break;
-      }
-    }
-    return true;
-  }
-  catch(const runtime_error& e)
-  {
-    mySurfaceErrorMsg = e.what();
-  }
-  return false;
+  if(myImageIdx + 1 < myImageList.size())
+    cache.prefetch(myImageList[myImageIdx + 1].getPath());
+  if(myImageIdx > 0 && myImageIdx - 1 < myImageList.size())
+    cache.prefetch(myImageList[myImageIdx - 1].getPath());
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -521,6 +547,18 @@ void RomImageWidget::handleMouseMoved(int x, int y)
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void RomImageWidget::tick()
 {
+  // Show the pending image as soon as it has been decoded
+  if(!myPendingImage.empty())
+  {
+    const ImageCache::ImagePtr image =
+        instance().imageCache().request(myPendingImage);
+    if(image)
+    {
+      myPendingImage.clear();
+      showImage(*image);
+    }
+  }
+
   if(myMouseArea == Area::ZOOM || myZoomMode)
   {
     myZoomTimer += REQUEST_SPEED;
@@ -22,6 +22,9 @@ class FBSurface;
 class Properties;
 
 #include "Widget.hxx"
+#ifdef IMAGE_SUPPORT
+  #include "ImageCache.hxx"
+#endif
 
 class RomImageWidget : public Widget
 {
@@ -40,6 +43,9 @@ class RomImageWidget : public Widget
     void clearProperties();
     void reloadProperties(const FSNode& node);
     bool changeImage(int direction = 1);
+    // Decode the first image of the given ROM in the background, so it is
+    // ready if the ROM gets selected
+    void prefetchImage(const FSNode& node, string_view cartName);
     // Toggle zoom via keyboard
     void toggleImageZoom();
     void disableImageZoom() { myZoomMode = false; }
@@ -60,10 +66,11 @@ class RomImageWidget : public Widget
   #ifdef IMAGE_SUPPORT
     bool getImageList(const string& propName, const string& romName,
                       const string& oldFileName);
+    static bool findImageFormat(string& fileName);
     bool tryImageFormats(string& fileName);
     bool loadImage(const string& fileName);
-    bool loadPng(const string& fileName);
-    bool loadJpg(const string& fileName);
+    bool showImage(const ImageCache::Image& image);
+    void prefetchNeighbours();
 
     void zoomSurfaces(bool zoomed, bool force = false);
     void positionSurfaces();
@@ -145,6 +152,11 @@ class RomImageWidget : public Widget
     // Index of currently displayed image
     size_t myImageIdx{0};
 
+  #ifdef IMAGE_SUPPORT
+    // The image being decoded in the background, to be shown when ready
+    string myPendingImage;
+  #endif
+
     // Label for the loaded image
     string myLabel;
 
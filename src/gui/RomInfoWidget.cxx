@@ -20,9 +20,7 @@
 #include "FBSurface.hxx"
 #include "Font.hxx"
 #include "OSystem.hxx"
-#include "ControllerDetector.hxx"
 #include "Bankswitch.hxx"
-#include "CartDetector.hxx"
 #include "Props.hxx"
 #include "PropsSet.hxx"
 #include "RomInfoWidget.hxx"
@@ -118,34 +116,40 @@ void RomInfoWidget::parseProperties(const FSNode& node, bool full)
     const Controller::Type rightType = Controller::getType(right);
     string bsDetected = myProperties.get(PropType::Cart_Type);
     bool isPlusCart = false;
-    size_t size = 0;
-    try
+    const size_t size = node.getSize();
+
+    // Controllers and bankswitch type are autodetected once, and then
+    // taken from the ROM catalogue
+    RomCatalogue::Entry entry;
+    if(!instance().romCatalogue().get(node, entry) || entry.type.empty() ||
+       entry.leftPort.empty() || entry.rightPort.empty())
     {
-      ByteBuffer image;
-      string md5;
+      Logger::debug(myProperties.get(PropType::Cart_Name) + ":");
 
+      // We simply don't update the controllers if the ROM can't be read
       if(node.exists() && !node.isDirectory() &&
-        (image = instance().openROM(node, md5, size)) != nullptr)
-      {
-        Logger::debug(myProperties.get(PropType::Cart_Name) + ":");
-        left = ControllerDetector::detectName(image, size, leftType,
-          !swappedPorts ? Controller::Jack::Left : Controller::Jack::Right,
-            instance().settings());
-        right = ControllerDetector::detectName(image, size, rightType,
-          !swappedPorts ? Controller::Jack::Right : Controller::Jack::Left,
-            instance().settings());
-        if(bsDetected == "AUTO")
-          bsDetected = Bankswitch::typeToName(CartDetector::autodetectType(image, size));
-
-        isPlusCart = CartDetector::isProbablyPlusROM(image, size);
-      }
+         RomCatalogue::detect(node, entry, instance().settings()))
+        instance().romCatalogue().save(node, entry);
+      else
+        entry.md5 = "";
     }
-    catch(const runtime_error&)
+
+    if(!entry.md5.empty())
     {
-      // Do nothing; we simply don't update the controllers if openROM
-      // failed for any reason
-      left = right = "";
+      const string& leftPort = !swappedPorts ? entry.leftPort : entry.rightPort;
+      const string& rightPort = !swappedPorts ? entry.rightPort : entry.leftPort;
+
+      left = Controller::getName(leftType != Controller::Type::Unknown
+                                 ? leftType : Controller::getType(leftPort));
+      right = Controller::getName(rightType != Controller::Type::Unknown
+                                  ? rightType : Controller::getType(rightPort));
+      if(bsDetected == "AUTO")
+        bsDetected = entry.type;
+
+      isPlusCart = entry.plusROM;
     }
+    else
+      left = right = "";
     if(!left.empty() && !right.empty())
       myRomInfo.push_back("Controllers: " + (left + " (left), " + right + " (right)"));
 
@@ -0,0 +1,156 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2024 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#include "Bankswitch.hxx"
+#include "Logger.hxx"
+#include "OSystem.hxx"
+#include "RomCatalogue.hxx"
+#include "Settings.hxx"
+
+#include "RomScanner.hxx"
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+RomScanner::RomScanner(OSystem& osystem)
+  : myOSystem{osystem}
+{
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+RomScanner::~RomScanner()
+{
+  stop();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RomScanner::scan(const FSNode& dir, bool includeSubDirs)
+{
+  stop();
+
+  if(!dir.isDirectory())
+    return;
+
+  // Copy the settings which the autodetection depends on
+  mySettings.setValue("rominfo", myOSystem.settings().value("rominfo"), false);
+
+  myQueue.push_back(dir);
+  myIncludeSubDirs = includeSubDirs;
+  myFound = myCatalogued = 0;
+  myStop = false;
+
+  // Leave at least one core for the UI
+  const uInt32 numWorkers = BSPF::clamp(std::thread::hardware_concurrency(),
+                                        2U, MAX_WORKERS + 1) - 1;
+  myActive = numWorkers;
+  for(uInt32 i = 0; i < numWorkers; ++i)
+    myWorkers.emplace_back(&RomScanner::worker, this);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RomScanner::stop()
+{
+  {
+    const std::lock_guard<std::mutex> lock(myMutex);
+    myStop = true;
+  }
+  myCondition.notify_all();
+
+  for(auto& worker: myWorkers)
+    worker.join();
+  myWorkers.clear();
+  myQueue.clear();
+  myBusy = 0;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RomScanner::worker()
+{
+  while(true)
+  {
+    FSNode node;
+    {
+      std::unique_lock<std::mutex> lock(myMutex);
+
+      // Wait for work; the scan is finished when the queue is empty and
+      // no other worker can add to it anymore
+      myCondition.wait(lock, [this] {
+        return myStop || !myQueue.empty() || myBusy == 0;
+      });
+      if(myStop || myQueue.empty())
+        break;
+
+      node = std::move(myQueue.front());
+      myQueue.pop_front();
+      ++myBusy;
+    }
+
+    if(node.isDirectory())
+      scanDirectory(node);
+    else
+      scanRom(node);
+
+    {
+      const std::lock_guard<std::mutex> lock(myMutex);
+      --myBusy;
+    }
+    myCondition.notify_all();
+  }
+
+  if(--myActive == 0 && !myStop)
+  {
+    ostringstream buf;
+    buf << "ROM scan finished, " << myFound << " ROMs found, "
+        << myCatalogued << " added to catalogue";
+    Logger::debug(buf.view());
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RomScanner::scanDirectory(const FSNode& dir)
+{
+  const FSNode::CancelCheck isCancelled = [this]() { return myStop.load(); };
+  FSList list;
+
+  dir.getChildren(list, myIncludeSubDirs ? FSNode::ListMode::All
+                                         : FSNode::ListMode::FilesOnly,
+                  [](const FSNode& node) {
+                    return node.isDirectory() || Bankswitch::isValidRomName(node);
+                  },
+                  false, false, isCancelled);
+
+  const std::lock_guard<std::mutex> lock(myMutex);
+  for(auto& node: list)
+    myQueue.push_back(std::move(node));
+  myCondition.notify_all();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void RomScanner::scanRom(const FSNode& rom)
+{
+  ++myFound;
+
+  RomCatalogue& catalogue = myOSystem.romCatalogue();
+  RomCatalogue::Entry entry;
+  if(catalogue.get(rom, entry) && !entry.type.empty() &&
+     !entry.leftPort.empty() && !entry.rightPort.empty())
+    return;
+
+  if(RomCatalogue::detect(rom, entry, mySettings))
+  {
+    catalogue.save(rom, entry);
+    ++myCatalogued;
+  }
+}
@@ -0,0 +1,114 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2024 by Bradford W. Mott, Stephen Anthony
+// and the Stella Team
+//
+// See the file "License.txt" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//============================================================================
+
+#ifndef ROM_SCANNER_HXX
+#define ROM_SCANNER_HXX
+
+class OSystem;
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "bspf.hxx"
+#include "FSNode.hxx"
+#include "Settings.hxx"
+
+/**
+  This class scans a ROM directory in the background, using a pool of
+  worker threads.  Each ROM found which is not yet in the ROM catalogue
+  (or whose entry is outdated) is read, and its MD5 and autodetection
+  results are added to the catalogue.  This way, later selecting or
+  loading the ROM doesn't have to do any of this work.
+
+  Subdirectories and ZIP files are walked if requested.
+*/
+class RomScanner
+{
+  public:
+    explicit RomScanner(OSystem& osystem);
+    ~RomScanner();
+
+    /**
+      Start scanning the given directory, stopping any scan in progress.
+
+      @param dir             The directory to scan
+      @param includeSubDirs  Whether to scan subdirectories (and ZIP files)
+    */
+    void scan(const FSNode& dir, bool includeSubDirs);
+
+    /**
+      Stop the current scan, and wait until all workers have finished.
+    */
+    void stop();
+
+    /**
+      Answer whether a scan is in progress.
+    */
+    bool isScanning() const { return myActive > 0; }
+
+    /**
+      Answer the number of ROMs found, and the number of ROMs newly added
+      to the catalogue, in the current (or last) scan.
+    */
+    uInt32 romsFound() const { return myFound; }
+    uInt32 romsCatalogued() const { return myCatalogued; }
+
+  private:
+    // The worker thread entry point
+    void worker();
+
+    // Process a single directory or ROM
+    void scanDirectory(const FSNode& dir);
+    void scanRom(const FSNode& rom);
+
+  private:
+    // The maximum number of worker threads
+    static constexpr uInt32 MAX_WORKERS = 4;
+
+    OSystem& myOSystem;
+
+    // The nodes still to be processed, guarded by myMutex
+    std::deque<FSNode> myQueue;
+    std::mutex myMutex;
+    std::condition_variable myCondition;
+    uInt32 myBusy{0};
+    bool myIncludeSubDirs{false};
+
+    // The settings used for autodetection; the workers must not access the
+    // application settings, since these may be changed by the UI meanwhile
+    Settings mySettings;
+
+    vector<std::thread> myWorkers;
+    std::atomic<uInt32> myActive{0};
+    std::atomic<bool> myStop{false};
+
+    // Statistics
+    std::atomic<uInt32> myFound{0}, myCatalogued{0};
+
+  private:
+    // Following constructors and assignment operators not supported
+    RomScanner() = delete;
+    RomScanner(const RomScanner&) = delete;
+    RomScanner(RomScanner&&) = delete;
+    RomScanner& operator=(const RomScanner&) = delete;
+    RomScanner& operator=(RomScanner&&) = delete;
+};
+
+#endif
@@ -49,6 +49,7 @@ MODULE_OBJS := \
         src/gui/RomAuditDialog.o \
         src/gui/RomImageWidget.o \
         src/gui/RomInfoWidget.o \
+        src/gui/RomScanner.o \
         src/gui/ScrollBarWidget.o \
         src/gui/SnapshotDialog.o \
         src/gui/StellaSettingsDialog.o \
@@ -77,6 +77,16 @@ class OSystemLIBRETRO : public OSystem
       return make_shared<CompositeKeyValueRepositoryNoop>();
     }
 
+    shared_ptr<KeyValueRepositoryAtomic>
+    getRomCatalogueRepository() override {
+      return make_shared<KeyValueRepositoryNoop>();
+    }
+
+    shared_ptr<KeyValueRepositoryAtomic>
+    getRomDetectionRepository() override {
+      return make_shared<KeyValueRepositoryNoop>();
+    }
+
   protected:
     void initPersistence(FSNode& basedir) override { }
     string describePresistence() override { return "none"; }
@@ -108,6 +108,23 @@ size_t FSNodePOSIX::getSize() const
   return _size;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt64 FSNodePOSIX::getModTime() const
+{
+  struct stat st;
+  if(stat(_path.c_str(), &st) != 0)
+    return 0;
+
+  // Use the full timestamp, so that changes within the same second are noticed
+#if defined(__APPLE__)
+  const timespec& mtime = st.st_mtimespec;
+#else
+  const timespec& mtime = st.st_mtim;
+#endif
+  return static_cast<uInt64>(mtime.tv_sec) * 1000000000 +
+         static_cast<uInt64>(mtime.tv_nsec);
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool FSNodePOSIX::hasParent() const
 {
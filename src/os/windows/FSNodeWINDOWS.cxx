@@ -96,6 +96,22 @@ size_t FSNodeWINDOWS::getSize() const
   return _size;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt64 FSNodeWINDOWS::getModTime() const
+{
+  WIN32_FILE_ATTRIBUTE_DATA data;
+  if(!GetFileAttributesEx(_path.c_str(), GetFileExInfoStandard, &data))
+    return 0;
+
+  // FILETIME counts 100ns intervals since 1601-01-01
+  static constexpr uInt64 EPOCH_OFFSET = 116444736000000000ULL;
+  const uInt64 time =
+    (static_cast<uInt64>(data.ftLastWriteTime.dwHighDateTime) << 32) |
+    data.ftLastWriteTime.dwLowDateTime;
+
+  return time > EPOCH_OFFSET ? (time - EPOCH_OFFSET) * 100 : 0;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 AbstractFSNodePtr FSNodeWINDOWS::getParent() const
 {
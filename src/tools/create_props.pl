@@ -80,8 +80,10 @@ print OUTFILE "*/\n";
 print OUTFILE "static constexpr BSPF::array2D<const char*, DEF_PROPS_SIZE, " . $typesize . "> DefProps = {{\n";
 
 # Walk the hash map and print each item in order of md5sum
+# The binary keys below depend on this order, so sort case-insensitively
+my @keys = sort { lc($a) cmp lc($b) } keys %propset;
 my $idx = 0;
-for my $key ( sort keys %propset )
+for my $key ( @keys )
 {
   print OUTFILE PropSet::build_prop_string(@{ $propset{$key} });
 
@@ -94,6 +96,52 @@ for my $key ( sort keys %propset )
 
 print OUTFILE "}};\n";
 print OUTFILE "\n";
+#######################################################################
+print OUTFILE "/**\n";
+print OUTFILE "  The MD5 of each entry in DefProps in binary form, as the most and\n";
+print OUTFILE "  least significant 64 bits.\n";
+print OUTFILE "*/\n";
+print OUTFILE "static constexpr BSPF::array2D<uInt64, DEF_PROPS_SIZE, 2> DefPropsKeys = {{\n";
+
+$idx = 0;
+for my $key ( @keys )
+{
+  my $md5 = lc($key);
+  print OUTFILE "  { 0x" . substr($md5, 0, 16) . ", 0x" . substr($md5, 16, 16) . " }";
+
+  if ($idx+1 < $setsize) {
+    print OUTFILE ",";
+  }
+  print OUTFILE "\n";
+  $idx++;
+}
+
+print OUTFILE "}};\n";
+print OUTFILE "\n";
+#######################################################################
+print OUTFILE "/**\n";
+print OUTFILE "  The entries of DefProps whose MD5 starts with the 12 bit prefix 'p'\n";
+print OUTFILE "  are found in the range [DefPropsIndex[p], DefPropsIndex[p + 1]).\n";
+print OUTFILE "*/\n";
+print OUTFILE "static constexpr std::array<uInt16, 4097> DefPropsIndex = {\n";
+
+my $row = 0;
+for my $prefix ( 0 .. 4096 )
+{
+  while ($row < $setsize && hex(substr(lc($keys[$row]), 0, 3)) < $prefix) {
+    $row++;
+  }
+  print OUTFILE ($prefix % 16 == 0 ? "  " : " ") . $row;
+  if ($prefix < 4096) {
+    print OUTFILE ",";
+  }
+  if ($prefix % 16 == 15 || $prefix == 4096) {
+    print OUTFILE "\n";
+  }
+}
+
+print OUTFILE "};\n";
+print OUTFILE "\n";
 print OUTFILE "#endif\n";
 
 close(OUTFILE);
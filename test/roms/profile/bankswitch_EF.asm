@@ -0,0 +1,58 @@
+; Bankswitching stress test for profiling: EF scheme, 16 x 4K banks
+;
+; All banks contain the same code, so execution simply continues after each
+; switch.  Every scanline triggers all 16 hotspots, resulting in more than
+; 4000 bank switches per frame.
+
+	processor 6502
+
+VSYNC	= $00
+WSYNC	= $02
+COLUBK	= $09
+
+	seg code
+
+BANK	SET 0
+	REPEAT 16
+
+	SUBROUTINE
+	org BANK * $1000
+	rorg $F000
+
+.Start
+	sei
+	cld
+	ldx #$FF
+	txs
+.Frame
+	lda #2
+	sta VSYNC
+	sta WSYNC
+	sta WSYNC
+	sta WSYNC
+	lda #0
+	sta VSYNC
+	tay			; 256 scanlines
+.Line
+HOTSPOT	SET $FFE0
+	REPEAT 16
+	lda HOTSPOT
+HOTSPOT	SET HOTSPOT + 1
+	REPEND
+	sty COLUBK
+	sta WSYNC
+	dey
+	bne .Line
+	sta WSYNC
+	sta WSYNC
+	sta WSYNC
+	jmp .Frame
+
+	org BANK * $1000 + $0FF8
+	rorg $FFF8
+	.byte "EFEF"		; signature for autodetection
+	.word .Start
+	.word .Start
+
+BANK	SET BANK + 1
+	REPEND
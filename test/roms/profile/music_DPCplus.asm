@@ -0,0 +1,80 @@
+; Music data fetcher stress test for profiling: DPC+ scheme
+;
+; The ARM driver area only contains the signature for autodetection, the
+; code runs in bank 5 (the startup bank) and never calls any ARM function.
+; Every scanline reads AMPLITUDE 16 times, resulting in 4096 updates of the
+; music data fetchers per frame.
+
+	processor 6502
+
+VSYNC	= $00
+WSYNC	= $02
+AUDV0	= $19
+
+AMPLITUDE = $F005
+NOTE0	= $F075
+NOTE1	= $F076
+NOTE2	= $F077
+
+	seg code
+
+; ARM driver (3K)
+	org $0000
+	.byte "DPC+"
+	org $0BFC
+	.byte "DPC+"
+
+; Bank 5 (banks 0 - 4 are unused)
+	org $0C00 + 5 * $1000 + $80
+	rorg $F080
+
+Start
+	sei
+	cld
+	ldx #$FF
+	txs
+	lda #1
+	sta NOTE0
+	lda #2
+	sta NOTE1
+	lda #3
+	sta NOTE2
+Frame
+	lda #2
+	sta VSYNC
+	sta WSYNC
+	sta WSYNC
+	sta WSYNC
+	lda #0
+	sta VSYNC
+	tay			; 256 scanlines
+Line
+	REPEAT 16
+	lda AMPLITUDE
+	REPEND
+	sta AUDV0
+	sta WSYNC
+	dey
+	bne Line
+	sta WSYNC
+	sta WSYNC
+	sta WSYNC
+	jmp Frame
+
+	org $0C00 + 5 * $1000 + $0FFC
+	rorg $FFFC
+	.word Start
+	.word Start
+	rend
+
+; Display data (4K), starting with waveform 0 used by all fetchers
+	org $6C00
+	.byte 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 5, 5, 4, 4, 3
+	.byte 3, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+
+; Frequency data (1K)
+	org $7C00
+	.long 0, $02000000, $03000000, $04C00000
+
+	org $7FFF
+	.byte 0